@@ -66,6 +66,8 @@ inline void technology_mapping(pybind11::module& m)
         .def_readwrite("mux", &fiction::technology_mapping_params::mux, DOC(fiction_technology_mapping_params_mux))
         .def_readwrite("and_xor", &fiction::technology_mapping_params::and_xor,
                        DOC(fiction_technology_mapping_params_and_xor))
+        .def_readwrite("cache_library", &fiction::technology_mapping_params::cache_library,
+                       DOC(fiction_technology_mapping_params_cache_library))
 
         ;
 
@@ -74,7 +76,9 @@ inline void technology_mapping(pybind11::module& m)
         .def("__repr__", [](const fiction::technology_mapping_stats& stats) { return stats.report(); })
         .def("report", &fiction::technology_mapping_stats::report, DOC(fiction_technology_mapping_stats_report))
         .def_readonly("mapper_stats", &fiction::technology_mapping_stats::mapper_stats,
-                      DOC(fiction_technology_mapping_stats_mapper_stats));
+                      DOC(fiction_technology_mapping_stats_mapper_stats))
+        .def_readonly("library_cache_hit", &fiction::technology_mapping_stats::library_cache_hit,
+                      DOC(fiction_technology_mapping_stats_library_cache_hit));
 
     m.def("and_or_not", &fiction::and_or_not, DOC(fiction_and_or_not));
 
@@ -89,6 +93,9 @@ inline void technology_mapping(pybind11::module& m)
     m.def("all_supported_standard_functions", &fiction::all_supported_standard_functions,
           DOC(fiction_all_supported_standard_functions));
 
+    m.def("clear_technology_mapping_library_cache", &fiction::clear_technology_mapping_library_cache,
+          DOC(fiction_clear_technology_mapping_library_cache));
+
     detail::technology_mapping<py_logic_network>(m);
 }
 
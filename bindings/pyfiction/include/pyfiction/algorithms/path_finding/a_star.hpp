@@ -51,6 +51,8 @@ inline void a_star(pybind11::module& m)
     py::class_<fiction::a_star_params>(m, "a_star_params", DOC(fiction_a_star_params))
         .def(py::init<>())
         .def_readwrite("crossings", &fiction::a_star_params::crossings, DOC(fiction_a_star_params_crossings))
+        .def_readwrite("dense_storage", &fiction::a_star_params::dense_storage,
+                       DOC(fiction_a_star_params_dense_storage))
 
         ;
 
@@ -35,6 +35,20 @@ inline void exact(pybind11::module& m)
 
         ;
 
+    py::class_<fiction::exact_solver_configuration>(m, "exact_solver_configuration",
+                                                    DOC(fiction_exact_solver_configuration))
+        .def(py::init<>())
+        .def_readwrite("random_seed", &fiction::exact_solver_configuration::random_seed,
+                       DOC(fiction_exact_solver_configuration_random_seed))
+        .def_readwrite("tactic", &fiction::exact_solver_configuration::tactic,
+                       DOC(fiction_exact_solver_configuration_tactic))
+        .def_readwrite("symmetry_breaking", &fiction::exact_solver_configuration::symmetry_breaking,
+                       DOC(fiction_exact_solver_configuration_symmetry_breaking))
+
+        ;
+
+    m.def("exact_solver_portfolio", &fiction::exact_solver_portfolio, "size"_a, DOC(fiction_exact_solver_portfolio));
+
     py::class_<fiction::exact_physical_design_params>(m, "exact_params", DOC(fiction_exact_physical_design_params))
         .def(py::init<>())
         .def_readwrite("scheme", &fiction::exact_physical_design_params::scheme,
@@ -47,6 +61,8 @@ inline void exact(pybind11::module& m)
                        DOC(fiction_exact_physical_design_params_fixed_size))
         .def_readwrite("num_threads", &fiction::exact_physical_design_params::num_threads,
                        DOC(fiction_exact_physical_design_params_num_threads))
+        .def_readwrite("portfolio", &fiction::exact_physical_design_params::portfolio,
+                       DOC(fiction_exact_physical_design_params_portfolio))
         .def_readwrite("crossings", &fiction::exact_physical_design_params::crossings,
                        DOC(fiction_exact_physical_design_params_crossings))
         .def_readwrite("border_io", &fiction::exact_physical_design_params::border_io,
@@ -66,6 +82,26 @@ inline void exact(pybind11::module& m)
 
         ;
 
+    py::class_<fiction::exact_physical_design_thread_stats>(m, "exact_thread_stats",
+                                                            DOC(fiction_exact_physical_design_thread_stats))
+        .def(py::init<>())
+        .def("report", &fiction::exact_physical_design_thread_stats::report,
+             DOC(fiction_exact_physical_design_thread_stats_report))
+        .def_readonly("time_solving", &fiction::exact_physical_design_thread_stats::time_solving,
+                      DOC(fiction_exact_physical_design_thread_stats_time_solving))
+        .def_readonly("num_sat", &fiction::exact_physical_design_thread_stats::num_sat,
+                      DOC(fiction_exact_physical_design_thread_stats_num_sat))
+        .def_readonly("num_unsat", &fiction::exact_physical_design_thread_stats::num_unsat,
+                      DOC(fiction_exact_physical_design_thread_stats_num_unsat))
+        .def_readonly("num_unknown", &fiction::exact_physical_design_thread_stats::num_unknown,
+                      DOC(fiction_exact_physical_design_thread_stats_num_unknown))
+        .def_readonly("num_dominated", &fiction::exact_physical_design_thread_stats::num_dominated,
+                      DOC(fiction_exact_physical_design_thread_stats_num_dominated))
+        .def_readonly("num_wins", &fiction::exact_physical_design_thread_stats::num_wins,
+                      DOC(fiction_exact_physical_design_thread_stats_num_wins))
+
+        ;
+
     py::class_<fiction::exact_physical_design_stats>(m, "exact_stats", DOC(fiction_exact_physical_design_stats))
         .def(py::init<>())
         .def("__repr__",
@@ -90,6 +126,8 @@ inline void exact(pybind11::module& m)
                       DOC(fiction_exact_physical_design_stats_num_crossings))
         .def_readonly("num_aspect_ratios", &fiction::exact_physical_design_stats::num_aspect_ratios,
                       DOC(fiction_exact_physical_design_stats_num_aspect_ratios))
+        .def_readonly("thread_stats", &fiction::exact_physical_design_stats::thread_stats,
+                      DOC(fiction_exact_physical_design_stats_thread_stats))
 
         ;
 
@@ -71,7 +71,9 @@ inline void graph_oriented_layout_design(pybind11::module& m)
         .def_readwrite("planar", &fiction::graph_oriented_layout_design_params::planar,
                        DOC(fiction_graph_oriented_layout_design_params_planar))
         .def_readwrite("enable_multithreading", &fiction::graph_oriented_layout_design_params::enable_multithreading,
-                       DOC(fiction_graph_oriented_layout_design_params_enable_multithreading));
+                       DOC(fiction_graph_oriented_layout_design_params_enable_multithreading))
+        .def_readwrite("num_layout_snapshots", &fiction::graph_oriented_layout_design_params::num_layout_snapshots,
+                       DOC(fiction_graph_oriented_layout_design_params_num_layout_snapshots));
 
     py::class_<fiction::graph_oriented_layout_design_stats>(m, "graph_oriented_layout_design_stats",
                                                             DOC(fiction_graph_oriented_layout_design_stats))
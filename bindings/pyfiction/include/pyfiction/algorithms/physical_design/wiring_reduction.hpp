@@ -26,7 +26,9 @@ inline void wiring_reduction(pybind11::module& m)
     py::class_<fiction::wiring_reduction_params>(m, "wiring_reduction_params", DOC(fiction_wiring_reduction_params))
         .def(py::init<>())
         .def_readwrite("timeout", &fiction::wiring_reduction_params::timeout,
-                       DOC(fiction_wiring_reduction_params_timeout));
+                       DOC(fiction_wiring_reduction_params_timeout))
+        .def_readwrite("incremental", &fiction::wiring_reduction_params::incremental,
+                       DOC(fiction_wiring_reduction_params_incremental));
 
     py::class_<fiction::wiring_reduction_stats>(m, "wiring_reduction_stats", DOC(fiction_wiring_reduction_stats))
         .def(py::init<>())
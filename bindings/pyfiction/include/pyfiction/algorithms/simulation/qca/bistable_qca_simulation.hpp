@@ -0,0 +1,98 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef PYFICTION_BISTABLE_QCA_SIMULATION_HPP
+#define PYFICTION_BISTABLE_QCA_SIMULATION_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/algorithms/simulation/qca/bistable_qca_simulation.hpp>
+
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <vector>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename Spec>
+void verify_qca_layout_by_simulation(pybind11::module& m)
+{
+    using namespace pybind11::literals;
+
+    m.def("verify_qca_layout_by_simulation", &fiction::verify_qca_layout_by_simulation<py_qca_layout, Spec>,
+          "layout"_a, "specification"_a, "params"_a = fiction::bistable_qca_simulation_params{},
+          "stats"_a = nullptr, DOC(fiction_verify_qca_layout_by_simulation));
+}
+
+}  // namespace detail
+
+inline void bistable_qca_simulation(pybind11::module& m)
+{
+    namespace py = pybind11;
+    using namespace pybind11::literals;
+
+    py::class_<fiction::bistable_qca_simulation_params>(m, "bistable_qca_simulation_params",
+                                                        DOC(fiction_bistable_qca_simulation_params))
+        .def(py::init<>())
+        .def_readwrite("epsilon_r", &fiction::bistable_qca_simulation_params::epsilon_r,
+                       DOC(fiction_bistable_qca_simulation_params_epsilon_r))
+        .def_readwrite("clock_high", &fiction::bistable_qca_simulation_params::clock_high,
+                       DOC(fiction_bistable_qca_simulation_params_clock_high))
+        .def_readwrite("clock_low", &fiction::bistable_qca_simulation_params::clock_low,
+                       DOC(fiction_bistable_qca_simulation_params_clock_low))
+        .def_readwrite("num_switching_steps", &fiction::bistable_qca_simulation_params::num_switching_steps,
+                       DOC(fiction_bistable_qca_simulation_params_num_switching_steps))
+        .def_readwrite("radius_of_effect", &fiction::bistable_qca_simulation_params::radius_of_effect,
+                       DOC(fiction_bistable_qca_simulation_params_radius_of_effect))
+        .def_readwrite("layer_separation", &fiction::bistable_qca_simulation_params::layer_separation,
+                       DOC(fiction_bistable_qca_simulation_params_layer_separation))
+        .def_readwrite("convergence_tolerance", &fiction::bistable_qca_simulation_params::convergence_tolerance,
+                       DOC(fiction_bistable_qca_simulation_params_convergence_tolerance))
+        .def_readwrite("max_iterations", &fiction::bistable_qca_simulation_params::max_iterations,
+                       DOC(fiction_bistable_qca_simulation_params_max_iterations))
+        .def_readwrite("max_clock_cycles", &fiction::bistable_qca_simulation_params::max_clock_cycles,
+                       DOC(fiction_bistable_qca_simulation_params_max_clock_cycles))
+        .def_readwrite("num_threads", &fiction::bistable_qca_simulation_params::num_threads,
+                       DOC(fiction_bistable_qca_simulation_params_num_threads))
+
+        ;
+
+    py::class_<fiction::bistable_qca_simulation_stats>(m, "bistable_qca_simulation_stats",
+                                                       DOC(fiction_bistable_qca_simulation_stats))
+        .def(py::init<>())
+        .def_readonly("time_total", &fiction::bistable_qca_simulation_stats::time_total,
+                      DOC(fiction_bistable_qca_simulation_stats_time_total))
+        .def_readonly("num_cells", &fiction::bistable_qca_simulation_stats::num_cells,
+                      DOC(fiction_bistable_qca_simulation_stats_num_cells))
+        .def_readonly("num_interactions", &fiction::bistable_qca_simulation_stats::num_interactions,
+                      DOC(fiction_bistable_qca_simulation_stats_num_interactions))
+        .def_readonly("num_input_patterns", &fiction::bistable_qca_simulation_stats::num_input_patterns,
+                      DOC(fiction_bistable_qca_simulation_stats_num_input_patterns))
+        .def_readonly("num_unconverged_patterns", &fiction::bistable_qca_simulation_stats::num_unconverged_patterns,
+                      DOC(fiction_bistable_qca_simulation_stats_num_unconverged_patterns))
+
+        ;
+
+    std::vector<py_tt> (*bistable_qca_simulation_function_pointer)(
+        const py_qca_layout&, const fiction::bistable_qca_simulation_params&, fiction::bistable_qca_simulation_stats*) =
+        &fiction::bistable_qca_simulation<py_qca_layout>;
+
+    m.def("bistable_qca_simulation", bistable_qca_simulation_function_pointer, "layout"_a,
+          "params"_a = fiction::bistable_qca_simulation_params{}, "stats"_a = nullptr,
+          DOC(fiction_bistable_qca_simulation_2));
+
+    detail::verify_qca_layout_by_simulation<py_logic_network>(m);
+    detail::verify_qca_layout_by_simulation<py_cartesian_gate_layout>(m);
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_BISTABLE_QCA_SIMULATION_HPP
@@ -90,7 +90,9 @@ inline void critical_temperature(pybind11::module& m)
         .def_readwrite("max_temperature", &fiction::critical_temperature_params::max_temperature,
                        DOC(fiction_critical_temperature_params_max_temperature))
         .def_readwrite("input_iterator_params", &fiction::critical_temperature_params::input_iterator_params,
-                       DOC(fiction_critical_temperature_params_input_iterator_params));
+                       DOC(fiction_critical_temperature_params_input_iterator_params))
+        .def_readwrite("input_sim_mode", &fiction::critical_temperature_params::input_sim_mode,
+                       DOC(fiction_critical_temperature_params_input_sim_mode));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
 
@@ -24,10 +24,18 @@ namespace detail
 template <typename Lyt>
 void exhaustive_ground_state_simulation(pybind11::module& m)
 {
+    namespace py = pybind11;
     using namespace pybind11::literals;
 
-    m.def("exhaustive_ground_state_simulation", &fiction::exhaustive_ground_state_simulation<Lyt>, "lyt"_a,
-          "params"_a = fiction::sidb_simulation_parameters{}, DOC(fiction_exhaustive_ground_state_simulation));
+    m.def("exhaustive_ground_state_simulation",
+          py::overload_cast<const Lyt&, const fiction::sidb_simulation_parameters&>(
+              &fiction::exhaustive_ground_state_simulation<Lyt>),
+          "lyt"_a, "params"_a = fiction::sidb_simulation_parameters{},
+          DOC(fiction_exhaustive_ground_state_simulation_2));
+    m.def("exhaustive_ground_state_simulation",
+          py::overload_cast<const Lyt&, const fiction::exhaustive_ground_state_simulation_params&>(
+              &fiction::exhaustive_ground_state_simulation<Lyt>),
+          "lyt"_a, "params"_a, DOC(fiction_exhaustive_ground_state_simulation));
 }
 
 }  // namespace detail
@@ -35,6 +43,29 @@ void exhaustive_ground_state_simulation(pybind11::module& m)
 inline void exhaustive_ground_state_simulation(pybind11::module& m)
 {
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
+    namespace py = pybind11;
+    using namespace pybind11::literals;
+
+    py::enum_<fiction::exhaustive_ground_state_simulation_params::result_mode>(
+        m, "exhaustive_ground_state_simulation_result_mode",
+        DOC(fiction_exhaustive_ground_state_simulation_params_result_mode))
+        .value("ALL_PHYSICALLY_VALID",
+               fiction::exhaustive_ground_state_simulation_params::result_mode::ALL_PHYSICALLY_VALID,
+               DOC(fiction_exhaustive_ground_state_simulation_params_result_mode_ALL_PHYSICALLY_VALID))
+        .value("GROUND_STATES_ONLY",
+               fiction::exhaustive_ground_state_simulation_params::result_mode::GROUND_STATES_ONLY,
+               DOC(fiction_exhaustive_ground_state_simulation_params_result_mode_GROUND_STATES_ONLY));
+
+    py::class_<fiction::exhaustive_ground_state_simulation_params>(
+        m, "exhaustive_ground_state_simulation_params", DOC(fiction_exhaustive_ground_state_simulation_params))
+        .def(py::init<>())
+        .def_readwrite("simulation_parameters",
+                       &fiction::exhaustive_ground_state_simulation_params::simulation_parameters,
+                       DOC(fiction_exhaustive_ground_state_simulation_params_simulation_parameters))
+        .def_readwrite("mode", &fiction::exhaustive_ground_state_simulation_params::mode,
+                       DOC(fiction_exhaustive_ground_state_simulation_params_mode))
+        .def_readwrite("num_threads", &fiction::exhaustive_ground_state_simulation_params::num_threads,
+                       DOC(fiction_exhaustive_ground_state_simulation_params_num_threads));
 
     detail::exhaustive_ground_state_simulation<py_sidb_100_lattice>(m);
     detail::exhaustive_ground_state_simulation<py_sidb_111_lattice>(m);
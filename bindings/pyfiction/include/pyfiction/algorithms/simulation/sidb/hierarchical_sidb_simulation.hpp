@@ -0,0 +1,78 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef PYFICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
+#define PYFICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/algorithms/simulation/sidb/hierarchical_sidb_simulation.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace pyfiction
+{
+
+inline void hierarchical_sidb_simulation(pybind11::module& m)
+{
+    namespace py = pybind11;
+    using namespace pybind11::literals;
+
+    py::class_<fiction::hierarchical_sidb_simulation_params>(m, "hierarchical_sidb_simulation_params",
+                                                             DOC(fiction_hierarchical_sidb_simulation_params))
+        .def(py::init<>())
+        .def_readwrite("simulation_parameters",
+                       &fiction::hierarchical_sidb_simulation_params::simulation_parameters,
+                       DOC(fiction_hierarchical_sidb_simulation_params_simulation_parameters))
+        .def_readwrite("sim_engine", &fiction::hierarchical_sidb_simulation_params::sim_engine,
+                       DOC(fiction_hierarchical_sidb_simulation_params_sim_engine))
+        .def_readwrite("bdl_pairs_params", &fiction::hierarchical_sidb_simulation_params::bdl_pairs_params,
+                       DOC(fiction_hierarchical_sidb_simulation_params_bdl_pairs_params))
+        .def_readwrite("num_threads", &fiction::hierarchical_sidb_simulation_params::num_threads,
+                       DOC(fiction_hierarchical_sidb_simulation_params_num_threads))
+        .def_readwrite("pattern_block_size", &fiction::hierarchical_sidb_simulation_params::pattern_block_size,
+                       DOC(fiction_hierarchical_sidb_simulation_params_pattern_block_size))
+
+        ;
+
+    py::class_<fiction::hierarchical_sidb_simulation_stats>(m, "hierarchical_sidb_simulation_stats",
+                                                            DOC(fiction_hierarchical_sidb_simulation_stats))
+        .def(py::init<>())
+        .def_readonly("time_total", &fiction::hierarchical_sidb_simulation_stats::time_total,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_time_total))
+        .def_readonly("num_tiles", &fiction::hierarchical_sidb_simulation_stats::num_tiles,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_tiles))
+        .def_readonly("num_levels", &fiction::hierarchical_sidb_simulation_stats::num_levels,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_levels))
+        .def_readonly("num_input_patterns", &fiction::hierarchical_sidb_simulation_stats::num_input_patterns,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_input_patterns))
+        .def_readonly("num_tile_simulations", &fiction::hierarchical_sidb_simulation_stats::num_tile_simulations,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_tile_simulations))
+        .def_readonly("num_cache_hits", &fiction::hierarchical_sidb_simulation_stats::num_cache_hits,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_cache_hits))
+        .def_readonly("num_undefined_patterns", &fiction::hierarchical_sidb_simulation_stats::num_undefined_patterns,
+                      DOC(fiction_hierarchical_sidb_simulation_stats_num_undefined_patterns))
+
+        ;
+
+    m.def("hierarchical_sidb_simulation",
+          &fiction::hierarchical_sidb_simulation<fiction::sidb_bestagon_library, py_hexagonal_gate_layout,
+                                                 py_sidb_layout>,
+          "gate_layout"_a, "cell_layout"_a, "params"_a = fiction::hierarchical_sidb_simulation_params{},
+          "stats"_a = nullptr, DOC(fiction_hierarchical_sidb_simulation));
+
+    m.def("verify_sidb_layout_by_hierarchical_simulation",
+          &fiction::verify_sidb_layout_by_hierarchical_simulation<fiction::sidb_bestagon_library,
+                                                                  py_hexagonal_gate_layout, py_sidb_layout>,
+          "gate_layout"_a, "cell_layout"_a, "params"_a = fiction::hierarchical_sidb_simulation_params{},
+          "stats"_a = nullptr, DOC(fiction_verify_sidb_layout_by_hierarchical_simulation));
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
@@ -51,6 +51,12 @@ inline void is_operational(pybind11::module& m)
         .value("REJECT_KINKS", fiction::operational_condition::REJECT_KINKS,
                DOC(fiction_operational_condition_REJECT_KINKS));
 
+    py::enum_<fiction::input_simulation_mode>(m, "input_simulation_mode", DOC(fiction_input_simulation_mode))
+        .value("FULL_LAYOUT", fiction::input_simulation_mode::FULL_LAYOUT,
+               DOC(fiction_input_simulation_mode_FULL_LAYOUT))
+        .value("INCREMENTAL", fiction::input_simulation_mode::INCREMENTAL,
+               DOC(fiction_input_simulation_mode_INCREMENTAL));
+
     py::class_<fiction::is_operational_params>(m, "is_operational_params", DOC(fiction_is_operational_params))
         .def(py::init<>())
         .def_readwrite("simulation_parameters", &fiction::is_operational_params::simulation_parameters,
@@ -60,7 +66,9 @@ inline void is_operational(pybind11::module& m)
         .def_readwrite("input_bdl_iterator_params", &fiction::is_operational_params::input_bdl_iterator_params,
                        DOC(fiction_is_operational_params_input_bdl_iterator_params))
         .def_readwrite("op_condition", &fiction::is_operational_params::op_condition,
-                       DOC(fiction_is_operational_params_op_condition));
+                       DOC(fiction_is_operational_params_op_condition))
+        .def_readwrite("input_sim_mode", &fiction::is_operational_params::input_sim_mode,
+                       DOC(fiction_is_operational_params_input_sim_mode));
 
     // NOTE be careful with the order of the following calls! Python will resolve the first matching overload!
     detail::is_operational<py_sidb_100_lattice>(m);
@@ -45,6 +45,9 @@ inline void quicksim(pybind11::module& m)
         .def_readwrite("alpha", &fiction::quicksim_params::alpha, DOC(fiction_quicksim_params_alpha))
         .def_readwrite("number_threads", &fiction::quicksim_params::number_threads,
                        DOC(fiction_quicksim_params_number_threads))
+        .def_readwrite("seed", &fiction::quicksim_params::seed, DOC(fiction_quicksim_params_seed))
+        .def_readwrite("interaction_cutoff", &fiction::quicksim_params::interaction_cutoff,
+                       DOC(fiction_quicksim_params_interaction_cutoff))
 
         ;
 
@@ -22,10 +22,20 @@ namespace detail
 template <typename Lyt>
 void time_to_solution(pybind11::module& m)
 {
+    namespace py = pybind11;
     using namespace pybind11::literals;
 
-    m.def("time_to_solution", &fiction::time_to_solution<Lyt>, "lyt"_a, "quickim_params"_a,
-          "tts_params"_a = fiction::time_to_solution_params{}, "ps"_a = nullptr, DOC(fiction_time_to_solution));
+    m.def("time_to_solution",
+          py::overload_cast<const Lyt&, const fiction::quicksim_params&, const fiction::time_to_solution_params&,
+                            fiction::time_to_solution_stats*>(&fiction::time_to_solution<Lyt>),
+          "lyt"_a, "quickim_params"_a, "tts_params"_a = fiction::time_to_solution_params{}, "ps"_a = nullptr,
+          DOC(fiction_time_to_solution_2));
+    m.def("time_to_solution",
+          py::overload_cast<const Lyt&, const fiction::sidb_simulation_result<Lyt>&, const fiction::quicksim_params&,
+                            const fiction::time_to_solution_params&, fiction::time_to_solution_stats*>(
+              &fiction::time_to_solution<Lyt>),
+          "lyt"_a, "results_exact"_a, "quickim_params"_a, "tts_params"_a = fiction::time_to_solution_params{},
+          "ps"_a = nullptr, DOC(fiction_time_to_solution));
     m.def("time_to_solution_for_given_simulation_results", &fiction::time_to_solution_for_given_simulation_results<Lyt>,
           "results_exact"_a, "results_heuristic"_a, "confidence_level"_a = 0.997, "ps"_a = nullptr,
           DOC(fiction_time_to_solution_for_given_simulation_results));
@@ -46,7 +56,9 @@ inline void time_to_solution(pybind11::module& m)
         .def_readwrite("repetitions", &fiction::time_to_solution_params::repetitions,
                        DOC(fiction_time_to_solution_params_repetitions))
         .def_readwrite("confidence_level", &fiction::time_to_solution_params::confidence_level,
-                       DOC(fiction_time_to_solution_params_confidence_level));
+                       DOC(fiction_time_to_solution_params_confidence_level))
+        .def_readwrite("num_threads", &fiction::time_to_solution_params::num_threads,
+                       DOC(fiction_time_to_solution_params_num_threads));
     /**
      * Statistics.
      */
@@ -69,6 +81,8 @@ inline void time_to_solution(pybind11::module& m)
                       DOC(fiction_time_to_solution_stats_single_runtime_exact))
         .def_readonly("algorithm", &fiction::time_to_solution_stats::algorithm,
                       DOC(fiction_time_to_solution_stats_algorithm))
+        .def_readonly("single_runtimes", &fiction::time_to_solution_stats::single_runtimes,
+                      DOC(fiction_time_to_solution_stats_single_runtimes))
 
         ;
 
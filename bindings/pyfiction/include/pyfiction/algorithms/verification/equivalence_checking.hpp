@@ -26,10 +26,11 @@ void equivalence_checking(pybind11::module& m)
 
     m.def(
         "equivalence_checking",
-        [](const Spec& spec, const Impl& impl, fiction::equivalence_checking_stats* pst = nullptr) -> fiction::eq_type
+        [](const Spec& spec, const Impl& impl, fiction::equivalence_checking_stats* pst = nullptr,
+           const fiction::equivalence_checking_params& params = {}) -> fiction::eq_type
         {
             fiction::equivalence_checking_stats stats{};
-            fiction::equivalence_checking(spec, impl, &stats);
+            fiction::equivalence_checking(spec, impl, params, &stats);
 
             if (pst != nullptr)
             {
@@ -38,7 +39,8 @@ void equivalence_checking(pybind11::module& m)
 
             return stats.eq;
         },
-        "specification"_a, "implementation"_a, "statistics"_a = nullptr, DOC(fiction_equivalence_checking));
+        "specification"_a, "implementation"_a, "statistics"_a = nullptr,
+        "params"_a = fiction::equivalence_checking_params{}, DOC(fiction_equivalence_checking));
 }
 
 }  // namespace detail
@@ -57,6 +59,41 @@ inline void equivalence_checking(pybind11::module& m)
 
         ;
 
+    py::enum_<fiction::equivalence_checking_params::checking_mode>(
+        m, "equivalence_checking_mode", DOC(fiction_equivalence_checking_params_checking_mode))
+        .value("MONOLITHIC", fiction::equivalence_checking_params::checking_mode::MONOLITHIC,
+               DOC(fiction_equivalence_checking_params_checking_mode_MONOLITHIC))
+        .value("OUTPUT_PARTITIONED", fiction::equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED,
+               DOC(fiction_equivalence_checking_params_checking_mode_OUTPUT_PARTITIONED))
+
+        ;
+
+    py::class_<fiction::equivalence_checking_params>(m, "equivalence_checking_params",
+                                                     DOC(fiction_equivalence_checking_params))
+        .def(py::init<>())
+        .def_readwrite("mode", &fiction::equivalence_checking_params::mode,
+                       DOC(fiction_equivalence_checking_params_mode))
+        .def_readwrite("num_simulation_rounds", &fiction::equivalence_checking_params::num_simulation_rounds,
+                       DOC(fiction_equivalence_checking_params_num_simulation_rounds))
+        .def_readwrite("seed", &fiction::equivalence_checking_params::seed,
+                       DOC(fiction_equivalence_checking_params_seed))
+        .def_readwrite("num_threads", &fiction::equivalence_checking_params::num_threads,
+                       DOC(fiction_equivalence_checking_params_num_threads))
+
+        ;
+
+    py::class_<fiction::equivalence_checking_output_stats>(m, "equivalence_checking_output_stats",
+                                                           DOC(fiction_equivalence_checking_output_stats))
+        .def(py::init<>())
+        .def_readonly("equivalent", &fiction::equivalence_checking_output_stats::equivalent,
+                      DOC(fiction_equivalence_checking_output_stats_equivalent))
+        .def_readonly("decided_by_simulation", &fiction::equivalence_checking_output_stats::decided_by_simulation,
+                      DOC(fiction_equivalence_checking_output_stats_decided_by_simulation))
+        .def_readonly("runtime", &fiction::equivalence_checking_output_stats::runtime,
+                      DOC(fiction_equivalence_checking_output_stats_runtime))
+
+        ;
+
     py::class_<fiction::equivalence_checking_stats>(m, "equivalence_checking_stats",
                                                     DOC(fiction_equivalence_checking_stats))
         .def(py::init<>())
@@ -75,6 +112,10 @@ inline void equivalence_checking(pybind11::module& m)
                       DOC(fiction_equivalence_checking_stats_spec_drv_stats))
         .def_readonly("impl_drv_stats", &fiction::equivalence_checking_stats::impl_drv_stats,
                       DOC(fiction_equivalence_checking_stats_impl_drv_stats))
+        .def_readonly("output_stats", &fiction::equivalence_checking_stats::output_stats,
+                      DOC(fiction_equivalence_checking_stats_output_stats))
+        .def_readonly("simulation_runtime", &fiction::equivalence_checking_stats::simulation_runtime,
+                      DOC(fiction_equivalence_checking_stats_simulation_runtime))
 
         ;
 
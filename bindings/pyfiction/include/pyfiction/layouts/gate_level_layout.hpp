@@ -125,6 +125,11 @@ void gate_level_layout(pybind11::module& m, const std::string& topology)
 
         .def("clear_tile", &GateLyt::clear_tile, "t"_a, DOC(fiction_gate_level_layout_clear_tile))
 
+        .def("enable_fanout_index", &GateLyt::enable_fanout_index, DOC(fiction_gate_level_layout_enable_fanout_index))
+        .def("disable_fanout_index", &GateLyt::disable_fanout_index,
+             DOC(fiction_gate_level_layout_disable_fanout_index))
+        .def("has_fanout_index", &GateLyt::has_fanout_index, DOC(fiction_gate_level_layout_has_fanout_index))
+
         .def("is_gate_tile", &GateLyt::is_gate_tile, "t"_a, DOC(fiction_gate_level_layout_is_gate_tile))
         .def("is_wire_tile", &GateLyt::is_wire_tile, "t"_a, DOC(fiction_gate_level_layout_is_wire_tile))
         .def("is_empty_tile", &GateLyt::is_empty_tile, "t"_a, DOC(fiction_gate_level_layout_is_empty_tile))
@@ -153,6 +153,13 @@ static const char *__doc_fiction_a_star_params_crossings =
 R"doc(Allow paths to cross over obstructed tiles if they are occupied by
 wire segments.)doc";
 
+static const char *__doc_fiction_a_star_params_dense_storage =
+R"doc(Keep the closed list, g-values, and path origins in dense arrays that
+are addressed by coordinate index instead of in hash maps. This is
+only applicable to bounded layouts with unsigned offset coordinates
+(see `is_densely_indexable_coordinate_v`) and is ignored for all other
+layouts.)doc";
+
 static const char *__doc_fiction_all_2_input_functions =
 R"doc(Auxiliary function to create technology mapping parameters for AND,
 OR, NAND, NOR, XOR, XNOR, LE, GE, LT, GT, and NOT gates.
@@ -1046,6 +1053,136 @@ Parameter ``k``:
 Returns:
     The binomial coefficient :math:`\binom{n}{k}`.)doc";
 
+static const char *__doc_fiction_bistable_qca_simulation =
+R"doc(Simulates all :math:`2^n` input patterns of a QCA cell-level layout
+with :math:`n` input cells using the bistable approximation as
+implemented in QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/).
+
+Each cell is modeled by its polarization :math:`P \in [-1, 1]`, which
+responds to the polarizations of its neighbors weighted by their kink
+energies. Since the kink energy decays quickly with the distance, only
+cells within the radius of effect are considered, which results in a
+sparse neighbor kernel that is set up once and shared by all input
+patterns. The layout's clocking drives the simulation: clock zones
+switch one after another, each one driven by the preceding zone in its
+hold phase, while the tunneling barrier is lowered quasi-
+adiabatically. Vertically connected cells of adjacent layers are
+connected by via cells. Input patterns are distributed among multiple
+threads.
+
+Input cells and constant cells are fixed to polarization :math:`+1`
+(logic 1) or :math:`-1` (logic 0). An output cell reads logic 1 iff its
+polarization is positive after the simulation reached a steady state.
+
+This function throws an `std::invalid_argument` exception if more than
+`BISTABLE_QCA_SIMULATION_MAX_INPUTS` input cells are given.
+
+Template parameter ``Lyt``:
+    QCA cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``input_cells``:
+    Input cells of `lyt`. The `i`-th input cell is the `i`-th variable
+    of the resulting functions.
+
+Parameter ``output_cells``:
+    Output cells of `lyt` whose functions are to be returned.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    The Boolean function of each output cell in the order of
+    `output_cells`.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_2 =
+R"doc(Simulates all :math:`2^n` input patterns of a QCA cell-level layout
+using the bistable approximation. Input and output cells are ordered
+row-major, i.e., by row, column, and layer. See the overload above for
+details.
+
+Template parameter ``Lyt``:
+    QCA cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    The Boolean function of each output cell in row-major order.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params =
+R"doc(Parameters for the bistable QCA simulation. The default values
+correspond to the default parameters of the bistable simulation engine
+of QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/).)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_clock_high =
+R"doc(Tunneling energy of cells in the relax phase of their clock, i.e.,
+when they are not polarized (unit: J).)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_clock_low =
+R"doc(Tunneling energy of cells in the hold phase of their clock, i.e., when
+they are fully polarized (unit: J).)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_convergence_tolerance =
+R"doc(Maximum change in polarization of any cell for a relaxation to be
+considered converged.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_epsilon_r =
+R"doc(Relative permittivity of the substrate.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_layer_separation =
+R"doc(Vertical distance between two adjacent layers, i.e., between a cell
+layer and a via layer (unit: nm).)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_max_clock_cycles =
+R"doc(Maximum number of clock cycles to simulate per input pattern.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_max_iterations =
+R"doc(Maximum number of iterations per relaxation.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_num_switching_steps =
+R"doc(Number of tunneling energies between `clock_high` and `clock_low` at
+which the cells of a clock zone are relaxed during their switch phase.
+The quasi-adiabatic lowering of the tunneling barrier ensures that all
+driving cells are taken into account before the cells saturate.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_num_threads =
+R"doc(Number of threads that simulate input patterns in parallel.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_params_radius_of_effect =
+R"doc(Maximum distance between two cell centers for them to interact (unit:
+nm).)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats =
+R"doc(Statistics of the bistable QCA simulation.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats_num_cells =
+R"doc(Number of simulated cells including the via cells between layers.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats_num_input_patterns =
+R"doc(Number of simulated input patterns.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats_num_interactions =
+R"doc(Number of pairwise cell interactions in the sparse neighbor kernel.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats_num_unconverged_patterns =
+R"doc(Number of input patterns whose simulation did not reach a steady state
+within the given limits.)doc";
+
+static const char *__doc_fiction_bistable_qca_simulation_stats_time_total =
+R"doc(Total runtime.)doc";
+
 static const char *__doc_fiction_bounding_box_2d =
 R"doc(A 2D bounding box object that computes a minimum-sized box around all
 non-empty coordinates in a given layout. Layouts can be of arbitrary
@@ -2339,6 +2476,12 @@ Template parameter ``Lyt``:
 Parameter ``lyt``:
     The layout whose routing is to be deleted.)doc";
 
+static const char *__doc_fiction_clear_technology_mapping_library_cache =
+R"doc(Removes all compiled technology libraries from the process-wide cache
+that is used by `technology_mapping` if
+`technology_mapping_params::cache_library` is set. Libraries that are in
+use by running mappings stay valid.)doc";
+
 static const char *__doc_fiction_clocked_layout =
 R"doc(A layout type to layer on top of a coordinate layout, e.g.,
 `cartesian_layout`, `hexagonal_layout`, or `tile_based_layout`. This
@@ -2594,7 +2737,22 @@ Parameter ``cn``:
     number of different clock numbers.
 
 Parameter ``r``:
-    Flag to identify the scheme as regular.)doc";
+    Flag to identify the scheme as regular.
+
+Parameter ``l``:
+    Optional plain function that is equivalent to `f`. If provided, it
+    is called instead of `f` to avoid the overhead of `std::function`
+    on every clock number lookup.)doc";
+
+static const char *__doc_fiction_clocking_scheme_find_override =
+R"doc(Looks up the overridden clock number of the given clock zone.
+
+Parameter ``cz``:
+    Clock zone whose overridden clock number is desired.
+
+Returns:
+    Pointer to the overridden clock number of `cz` or `nullptr` if
+    `cz` has not been overridden.)doc";
 
 static const char *__doc_fiction_clocking_scheme_fn = R"doc(A function that determines clock numbers for given zones.)doc";
 
@@ -2604,6 +2762,8 @@ R"doc(Checks for the clocking scheme's regularity.
 Returns:
     `true` iff the clocking scheme is regular.)doc";
 
+static const char *__doc_fiction_clocking_scheme_lookup = R"doc(A plain function equivalent to `fn` that is preferred if available.)doc";
+
 static const char *__doc_fiction_clocking_scheme_max_in_degree = R"doc(Maximum number of inputs the clocking scheme supports per clock zone.)doc";
 
 static const char *__doc_fiction_clocking_scheme_max_out_degree = R"doc(Maximum number of outputs the clocking scheme supports per clock zone.)doc";
@@ -3357,6 +3517,91 @@ Parameter ``lyt``:
 Returns:
     A struct containing the CP and TP.)doc";
 
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer =
+R"doc(Incrementally maintains the critical path length (CP) and the
+throughput (TP) of a gate-level layout that is being modified, e.g., by
+an optimization algorithm. See `critical_path_length_and_throughput`
+for the definitions of both metrics.
+
+The analyzer caches the path information of all tiles in the PO's fan-
+in cones and subscribes to the layout's network events (`on_add`,
+`on_modified`, and `on_delete`) that are invoked by `create_...`,
+`move_node`, `connect`, and `clear_tile`. Each event discards the
+cached results of the affected tiles and their fan-out cones only.
+Hence, `get` merely re-evaluates the parts of the layout that were
+affected by the modifications since the last call and is much cheaper
+than a full recomputation after small edits. Its results are always
+identical to the ones of `critical_path_length_and_throughput`.
+
+Modifications that do not invoke network events, e.g., changes to the
+clocking scheme, have to be communicated to the analyzer via
+`invalidate` or `reset`.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_add_event =
+R"doc(Registered network events.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_critical_path_length_and_throughput_analyzer =
+R"doc(Standard constructor. Registers the analyzer with the given layout's
+network events. The layout has to outlive the analyzer.
+
+Parameter ``lyt``:
+    The gate-level layout whose CP and TP are to be maintained.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_critical_path_length_and_throughput_analyzer_2 = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_critical_path_length_and_throughput_analyzer_3 = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_delete_event = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_get =
+R"doc(Returns the current CP and TP of the layout. Only tiles whose cached
+results were discarded since the last call are re-evaluated.
+
+Returns:
+    A struct containing the CP and TP.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_impl =
+R"doc(Analysis with dependency tracking.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_invalidate =
+R"doc(Discards the cached results of tile `t` and its fan-out cone. This is
+only required for modifications that do not invoke network events.
+
+Parameter ``t``:
+    Tile whose cached results are to be discarded.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_invalidate_node =
+R"doc(Discards the cached results of node `n`'s current tile as well as the
+ones of its fanouts, which might not have considered `n` as an
+incoming node so far.
+
+Parameter ``n``:
+    Node whose surroundings changed.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_layout =
+R"doc(The analyzed layout.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_modified_event = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_num_evaluations =
+R"doc(Returns the number of tile evaluations that have been performed since
+the analyzer's construction. A full analysis evaluates each tile in the
+POs' fan-in cones exactly once.
+
+Returns:
+    Number of tile evaluations.)doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_operator_assign = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_operator_assign_2 = R"doc()doc";
+
+static const char *__doc_fiction_critical_path_length_and_throughput_analyzer_reset =
+R"doc(Discards all cached results such that the next call to `get` re-
+evaluates the entire layout.)doc";
+
 static const char *__doc_fiction_critical_temperature_gate_based =
 R"doc(This algorithm performs temperature-aware SiDB simulation as proposed
 in \"Temperature Behavior of Silicon Dangling Bond Logic\" by J.
@@ -3432,6 +3677,10 @@ static const char *__doc_fiction_critical_temperature_params_engine = R"doc(Simu
 
 static const char *__doc_fiction_critical_temperature_params_input_iterator_params = R"doc(Parameters for the BDL input iterator.)doc";
 
+static const char *__doc_fiction_critical_temperature_params_input_sim_mode =
+R"doc(Mode to simulate the input patterns of gate layouts (only applicable if
+engine == EXACT).)doc";
+
 static const char *__doc_fiction_critical_temperature_params_iteration_steps =
 R"doc(Number of iteration steps for the *QuickSim* algorithm (only
 applicable if engine == APPROXIMATE).)doc";
@@ -4269,6 +4518,142 @@ Returns:
     the type of charge state transition, and the minimum electrostatic
     potential required for the charge transition.)doc";
 
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl = R"doc()doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_bistable_qca_simulation_impl = R"doc()doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_cells =
+R"doc(All simulated cells.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_constant_cells =
+R"doc(Indices and polarizations of constant cells.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_dot_positions =
+R"doc(Computes the dot positions of the given cell (unit: nm). The first and
+third dot are occupied by an electron if the cell has polarization
+:math:`+1`.
+
+Parameter ``c``:
+    The cell.
+
+Returns:
+    Positions of the four quantum dots of `c`.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_input_cells =
+R"doc(Input cells in the order of the variables of the resulting truth tables.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_input_indices =
+R"doc(Indices of the input and output cells.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_kernel_energies =
+R"doc(Kink energies of the kernel divided by `2 * clock_low`.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_kernel_offsets =
+R"doc(Sparse neighbor kernel in compressed sparse row format. The
+interactions of cell `i` are stored at positions `kernel_offsets[i]`
+to `kernel_offsets[i + 1]` of `kernel_neighbors` and
+`kernel_energies`.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_kink_energy =
+R"doc(Computes the kink energy between two cells, i.e., the energy cost of
+them having opposite polarizations (unit: J). Each dot carries a
+charge of :math:`\pm e/2` relative to the neutralizing background.
+
+Parameter ``c1``:
+    First cell.
+
+Parameter ``c2``:
+    Second cell.
+
+Returns:
+    Kink energy between `c1` and `c2`.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_lyt =
+R"doc(The layout to simulate.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_num_clocks =
+R"doc(Number of clock phases.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_output_cells =
+R"doc(Output cells in the order of the resulting truth tables.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_ps =
+R"doc(Parameters.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_pst =
+R"doc(Statistics.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_qca_cell =
+R"doc(A simulated cell. Apart from the cells of the layout, via cells are
+inserted between vertically connected cells of adjacent layers.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_qca_cell_layer =
+R"doc(Physical layer, where cell layer `z` is at layer `2z` and the via
+layer above it is at layer `2z + 1`.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_qca_cell_rotated =
+R"doc(Whether the cell is rotated by 45°.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_qca_cell_x =
+R"doc(Horizontal position in the layout.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_qca_cell_y =
+R"doc(Vertical position in the layout.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_relax =
+R"doc(Relaxes the given cells to their steady-state polarizations while the
+tunneling energy is lowered from `clock_high` to `clock_low`. The
+bistable response :math:`P_i = x_i / \sqrt{1 + x_i^2}` with :math:`x_i
+= \sum_j E_{k,ij} P_j / 2\gamma` is iterated in Jacobi fashion such
+that the result does not depend on the order of the cells.
+
+Parameter ``zone``:
+    Indices of the cells to relax.
+
+Parameter ``polarization``:
+    Current polarizations of all cells.
+
+Parameter ``buffer``:
+    Scratch buffer.
+
+Returns:
+    `true` iff all relaxations converged.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_run = R"doc()doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_set_up_cells = R"doc()doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_set_up_kernel =
+R"doc(Sets up the sparse neighbor kernel. Only cells whose centers are
+within the radius of effect of each other interact, which are found
+via a spatial lookup of all cells in the bounding box of the radius.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_simulate_pattern =
+R"doc(Simulates one input pattern by cycling through the clock phases until
+the polarizations of all clock zones repeat. In each step, the cells
+of one clock zone switch while the preceding zone holds its
+polarization and all other zones are relaxed, i.e., unpolarized.
+
+Parameter ``pattern``:
+    Input pattern, where bit `i` is the value of the `i`-th input
+    cell.
+
+Parameter ``polarization``:
+    Scratch vector of current polarizations.
+
+Parameter ``settled``:
+    Polarizations of all cells after their last switch phase.
+
+Parameter ``buffer``:
+    Scratch buffer.
+
+Returns:
+    `true` iff a steady state was reached and all relaxations
+    converged.)doc";
+
+static const char *__doc_fiction_detail_bistable_qca_simulation_impl_zone_cells =
+R"doc(Indices of the non-fixed cells of each clock zone.)doc";
+
 static const char *__doc_fiction_detail_calculate_offset_matrix =
 R"doc(Calculate an offset matrix based on a to-delete list in a
 `wiring_reduction_layout`.
@@ -4450,12 +4835,123 @@ Returns:
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_cached_tile =
+R"doc(Fetches the tile that node `n` was placed on when its results were
+cached.
+
+Parameter ``n``:
+    Node whose tile is desired.
+
+Returns:
+    Tile of `n` at the time of its evaluation or a dead tile if `n` is
+    not cached.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_clear =
+R"doc(Discards all cached results.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_collect_orphans =
+R"doc(Removes all cached tiles that are no longer part of any PO's fan-in
+cone such that they do not distort the throughput.)doc";
+
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_critical_path_length_and_throughput_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_cache = R"doc()doc";
 
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry =
+R"doc(Cached path information of a tile.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_diff = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_in_progress =
+R"doc(Flag to indicate that the tile is currently being evaluated.
+Encountering such a tile again means that the layout contains a
+combinational loop.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_info = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_inputs =
+R"doc(Only maintained if dependencies are tracked: the incoming tiles whose
+results this entry was computed from and the tiles whose results were
+computed from this entry.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_is_gate =
+R"doc(Only gates are considered for the throughput.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_n =
+R"doc(Only maintained if dependencies are tracked: the node placed on the
+tile at the time of its evaluation.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_delay_entry_users = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_erase_entry_data =
+R"doc(Removes the data that was derived from the given (already erased)
+cache entry, i.e., its contribution to the throughput histogram and
+its usage of its incoming tiles.
+
+Parameter ``t``:
+    Tile of the erased entry.
+
+Parameter ``entry``:
+    The erased entry.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_evaluate =
+R"doc(Computes the path information of the top frame's tile from the ones of
+its incoming tiles, caches it, and removes the frame's data from the
+stacks.
+
+Parameter ``f``:
+    Top frame.
+
+Returns:
+    Path information of `f.t`.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame =
+R"doc(Evaluation frame of the explicit depth-first traversal.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame_incoming_begin =
+R"doc(Ranges of the frame's incoming tiles in `incoming_stack` and of their
+path information in `info_stack`.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame_info_begin = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame_next_incoming = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame_stack =
+R"doc(Explicit stacks that are reused across all traversals to avoid
+repeated allocations.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_frame_t = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_gate_diffs =
+R"doc(Only maintained if dependencies are tracked: histogram of the path
+length differences of all cached gates.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_incoming_stack = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_info_stack = R"doc()doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_invalidate =
+R"doc(Removes the cached results of tile `t` and of all tiles whose results
+depend on it, i.e., its entire fan-out cone. Requires dependency
+tracking.
+
+Parameter ``t``:
+    Tile whose cached results are to be discarded.)doc";
+
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_lyt = R"doc(Gate-level layout.)doc";
 
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_node_tiles =
+R"doc(Only maintained if dependencies are tracked: the tile each cached node
+was evaluated on.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_num_evaluations =
+R"doc(Number of tiles that were evaluated, i.e., whose path information was
+computed from the ones of their fanins.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_orphans =
+R"doc(Only maintained if dependencies are tracked: cached tiles that lost
+users and might no longer be part of any PO's fan-in cone.)doc";
+
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info = R"doc()doc";
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_delay = R"doc()doc";
@@ -4468,11 +4964,33 @@ static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_path_info_path_info_2 = R"doc()doc";
 
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_po_tiles =
+R"doc(Only maintained if dependencies are tracked: all PO tiles of the last
+run.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_push_frame = R"doc()doc";
+
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_result = R"doc(Result storage.)doc";
 
 static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_run = R"doc()doc";
 
-static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_signal_delay = R"doc()doc";
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_signal_delay =
+R"doc(Computes the path information of tile `t`. Instead of recursing, the
+fan-in cone is traversed depth-first via an explicit stack such that
+arbitrarily long paths can be handled. All intermediate results are
+cached.
+
+Parameter ``t``:
+    Tile whose path information is desired.
+
+Returns:
+    Path information of `t`.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_track_dependencies =
+R"doc(Flag to indicate whether dependencies between cached tiles are to be
+recorded.)doc";
+
+static const char *__doc_fiction_detail_critical_path_length_and_throughput_impl_worklist = R"doc()doc";
 
 static const char *__doc_fiction_detail_critical_temperature_impl = R"doc()doc";
 
@@ -4569,6 +5087,31 @@ Parameter ``to_delete``:
     The to-delete list representing coordinates of wires to be
     deleted. each specific coordinate.)doc";
 
+static const char *__doc_fiction_detail_delete_wires_in_place =
+R"doc(This function deletes wires from the provided layout like
+`delete_wires`, but shifts the gates in place. Instead of calculating a
+dense offset matrix and traversing every tile of the layout with the
+help of a full copy, it uses a sparse offset matrix, records the
+incoming data flow of the tiles that are deleted or shifted only, and
+exclusively visits the shifted tiles in the same diagonal order. The
+resulting layout is identical to the one of `delete_wires`.
+
+Template parameter ``Lyt``:
+    Cartesian gate-level layout type.
+
+Template parameter ``WiringReductionLyt``:
+    Type of the `wiring_reduction_layout`.
+
+Parameter ``lyt``:
+    The 2DDWave-clocked layout whose wiring is to be reduced.
+
+Parameter ``wiring_reduction_layout``:
+    The `wiring_reduction_layout`.
+
+Parameter ``to_delete``:
+    The to-delete list representing coordinates of wires to be
+    deleted.)doc";
+
 static const char *__doc_fiction_detail_design_sidb_gates_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_design_sidb_gates_impl_all_canvas_layouts = R"doc(All Canvas SiDB layout (without I/O pins).)doc";
@@ -5885,13 +6428,24 @@ based on the network hierarchy if the clocking scheme is feed-back-
 free. Symmetry breaking constraints.)doc";
 
 static const char *__doc_fiction_detail_exact_impl_thread_info =
-R"doc(Contains a context pointer and a currently worked on aspect ratio and
-can be shared between multiple worker threads so that they can notify
-each other via context interrupts based on their individual results,
-i.e., a thread that found a result at aspect ratio x * y can interrupt
-all other threads that are working on larger layout sizes.)doc";
+R"doc(Contains the contexts of a worker thread's solver portfolio and the
+currently worked on aspect ratio. It is shared between multiple worker
+threads so that they can notify each other via context interrupts
+based on their individual results, i.e., a thread that found a result
+at aspect ratio x * y can interrupt all other threads that are working
+on larger layout sizes and a thread that proved x * y to be UNSAT can
+interrupt all other threads that are working on aspect ratios
+dominated by it. Access is restricted by ti_mutex.)doc";
 
-static const char *__doc_fiction_detail_exact_impl_thread_info_ctx = R"doc(Pointer to a context.)doc";
+static const char *__doc_fiction_detail_exact_impl_thread_info_active =
+R"doc(Flag to indicate that the worker's solvers are currently running on
+worker_aspect_ratio.)doc";
+
+static const char *__doc_fiction_detail_exact_impl_thread_info_ctxs = R"doc(Pointers to the contexts of all solvers in the worker's portfolio.)doc";
+
+static const char *__doc_fiction_detail_exact_impl_thread_info_interrupted =
+R"doc(Flag to indicate that the worker's contexts have been interrupted by
+another thread.)doc";
 
 static const char *__doc_fiction_detail_exact_impl_thread_info_worker_aspect_ratio = R"doc(Currently examined layout aspect ratio.)doc";
 
@@ -5905,6 +6459,8 @@ Parameter ``handler``:
 Parameter ``time``:
     Time passed since beginning of the solving process.)doc";
 
+static const char *__doc_fiction_detail_exhaustive_ground_state_simulation_impl = R"doc()doc";
+
 static const char *__doc_fiction_detail_fanin_fanout_data =
 R"doc(This struct stores information about the fan-in and fan-out
 connections of a gate in a layout. These fan-in and fan-outs are the
@@ -6101,6 +6657,17 @@ R"doc(Checks for nodes that are not placed but still alive.
 Returns:
     Check summary as a one liner.)doc";
 
+static const char *__doc_fiction_detail_gate_set_key =
+R"doc(Encodes the gate set described by the given technology mapping
+parameters as a bitmask. Two parameter sets with the same bitmask
+produce identical technology libraries.
+
+Parameter ``params``:
+    Technology mapping parameters.
+
+Returns:
+    Gate set bitmask.)doc";
+
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_all_paths =
@@ -6343,11 +6910,32 @@ as better solutions are found.)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_optimized_solution = R"doc(Current best solution w.r.t. area after relocating POs.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_solution_for =
+R"doc(Fetches whether a solution has already been found for the given cost
+objective and, if so, its cost.
+
+Parameter ``cost_function``:
+    The cost objective.
+
+Returns:
+    A pair of a flag indicating whether a solution has already been
+    found and the cost of the best one.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_wire_solution =
 R"doc(The current best solution with respect to the number of wire segments,
 initialized to the maximum possible value. This value will be updated
 as better solutions are found.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_cache_snapshot =
+R"doc(Caches the given snapshot of the current vertex in the given search
+space graph. If the cache is full, the oldest snapshot is evicted.
+
+Parameter ``ssg``:
+    The search space graph.
+
+Parameter ``snapshot``:
+    The snapshot of the current vertex.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_calculate_cost = R"doc()doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_calculate_num_search_space_graphs =
@@ -6388,8 +6976,70 @@ Parameter ``planar``:
 Returns:
     A path from `src` to `dest` if one exists.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_clone_placement_info =
+R"doc(Creates an independent copy of the given placement information.
+Copies of node maps share their storage; hence, all mapped values are
+transferred to newly allocated maps.
+
+Parameter ``place_info``:
+    The placement information to copy.
+
+Parameter ``network``:
+    The network whose nodes are mapped.
+
+Returns:
+    A deep copy of `place_info`.)doc";
+
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_create_snapshot =
+R"doc(Creates a snapshot of the partial layout of the current vertex in the
+given search space graph unless caching is disabled or the vertex has
+already been cached.
+
+Parameter ``ssg``:
+    The search space graph.
+
+Parameter ``layout``:
+    The partial layout in which all positions of the current vertex
+    have been placed and routed.
+
+Parameter ``place_info``:
+    The respective placement information.
+
+Returns:
+    A snapshot of the current vertex or `std::nullopt` if none is
+    needed.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_custom_cost_objective = R"doc(Custom cost objective.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_expand_in_parallel =
+R"doc(Expands all search space graphs in parallel until their frontiers are
+exhausted, the time limit is reached, or, if `return_first` is set,
+the first layout is found.
+
+Each step of a search space graph, i.e., the expansion of its current
+vertex followed by the selection of the next one, constitutes a task.
+Since consecutive steps of the same search space graph depend on each
+other, a graph is processed by at most one thread at a time, but it
+may move to another thread after every step. Each worker thread
+processes the search space graphs in its own queue in a round-robin
+fashion and steals from the queues of the other threads once its own
+queue runs dry. Hence, no thread idles while there are search space
+graphs left that are not being expanded by other threads, and the
+runtime follows the total amount of work instead of the slowest search
+space graph. All threads prune the search against the shared atomic
+cost bounds of the best solutions found so far.
+
+Parameter ``best_lyt``:
+    The best layout found so far, which is updated whenever an
+    improved layout is found.
+
+Parameter ``timeout_set``:
+    Flag indicating whether the timeout was specified explicitly.
+
+Returns:
+    The first found layout if `return_first` is set and a layout was
+    found, `std::nullopt` otherwise.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_get_possible_positions =
 R"doc(Retrieves the possible positions for a given node in the layout based
 on its type and preceding nodes. It determines the type of the node
@@ -6556,6 +7206,21 @@ Parameter ``planar``:
 Returns:
     The initialized layout.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_lower_bound_to =
+R"doc(Lowers the given cost bound to `cost` if the latter is smaller. Since
+bounds are shared among all threads, the update is performed
+atomically such that no improvement found by another thread is
+overwritten.
+
+Parameter ``bound``:
+    The cost bound to lower.
+
+Parameter ``cost``:
+    The cost of a newly found solution.
+
+Returns:
+    `true` iff `bound` was lowered to `cost`.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_max_placed_nodes = R"doc(Keep track of the maximum number of placed nodes.)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_ntk = R"doc(The network to be placed and routed.)doc";
@@ -6580,6 +7245,17 @@ R"doc(In highest-effort mode with a custom cost function, 60 search space
 graphs are used (48 with the standard cost objectives and 12 for the
 custom one).)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_parent_snapshot =
+R"doc(Fetches the cached partial layout of the parent of the current vertex
+in the given search space graph.
+
+Parameter ``ssg``:
+    The search space graph.
+
+Returns:
+    A pointer to the parent's snapshot or `nullptr` if it is not
+    cached.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_place_and_route =
 R"doc(Executes a single placement step in the layout for the given network
 node. It determines the type of the node, places it accordingly, and
@@ -6658,10 +7334,40 @@ best found layout.
 Returns:
     The best layout found by the algorithm.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_select_next_vertex =
+R"doc(Selects the most promising vertex in the frontier of the given search
+space graph as the next one to be expanded. If the frontier is empty,
+the search space graph is deactivated.
+
+Parameter ``ssg``:
+    The search space graph.)doc";
+
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_snapshots_enabled =
+R"doc(Checks whether partial layouts are cached for the given search space
+graph.
+
+Parameter ``ssg``:
+    The search space graph.
+
+Returns:
+    `true` iff partial layouts of `ssg` are to be cached.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_ssg_vec = R"doc(Vector of search space graphs.)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_start = R"doc(Start time.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_time_limit_reached =
+R"doc(Checks whether the algorithm has to terminate due to its time limit.
+That is the case if the timeout has expired and it was either
+specified explicitly or a solution has already been found in high-
+efficiency mode.
+
+Parameter ``timeout_set``:
+    Flag indicating whether the timeout was specified explicitly.
+
+Returns:
+    `true` iff the algorithm has to terminate.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_timeout = R"doc(Timeout limit (in ms).)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_timeout_limit_reached = R"doc(Timeout limit reached.)doc";
@@ -6688,6 +7394,22 @@ Parameter ``place_info``:
 Parameter ``ssg``:
     The search space graph.)doc";
 
+static const char *__doc_fiction_detail_io_cells_in_row_major_order =
+R"doc(Returns the input or output cells of the given layout in row-major
+order, i.e., sorted by row, column, and layer.
+
+Template parameter ``Lyt``:
+    QCA cell-level layout type.
+
+Parameter ``lyt``:
+    The layout.
+
+Parameter ``inputs``:
+    Whether to return the input or the output cells.
+
+Returns:
+    Input or output cells of `lyt` in row-major order.)doc";
+
 static const char *__doc_fiction_detail_is_balanced_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_is_balanced_impl_balanced = R"doc()doc";
@@ -7563,6 +8285,23 @@ Template parameter ``Lyt``:
 Parameter ``lyt``:
     Gate-level layout.)doc";
 
+static const char *__doc_fiction_detail_order_io_cells_by_name =
+R"doc(Orders the given input or output cells by the given names. If any name
+does not uniquely identify a cell, the order is not changed.
+
+Template parameter ``Lyt``:
+    QCA cell-level layout type.
+
+Parameter ``lyt``:
+    The layout.
+
+Parameter ``io``:
+    Input or output cells of `lyt`. Reordered if all names could be
+    matched.
+
+Parameter ``names``:
+    Names in the desired order.)doc";
+
 static const char *__doc_fiction_detail_orthogonal_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_orthogonal_impl_orthogonal_impl = R"doc()doc";
@@ -7699,11 +8438,56 @@ Parameter ``old_pos``:
     The original tile position of the gate before the relocation
     attempt.
 
+Parameter ``unreachable_positions``:
+    Positions that are unreachable from each fan-in (see
+    `determine_unreachable_positions`).
+
 Returns:
     `true` if the gate was successfully relocated to `new_pos` and all
     routing paths were established. `false` if the relocation resulted
     in no movement (i.e., `new_pos` is the same as `old_pos`).)doc";
 
+static const char *__doc_fiction_detail_post_layout_optimization_impl_determine_unreachable_positions =
+R"doc(Determines for each fan-in of a gate which of the gate's potential
+new positions cannot be reached from that fan-in at all. Relocations to
+such positions are bound to fail, so the exhaustive search for a path
+from the respective fan-in can be skipped there.
+
+The searches are conducted on the layout as it is passed, i.e., after
+the gate's wiring has been removed. All occupied tiles, including the
+gate's current position and the tiles of its fan-ins and fan-outs, are
+obstructed here just like they are during every relocation attempt.
+The only difference is the gate's current position, which it leaves
+during relocation. Therefore, for each fan-in from which that position
+is reachable, a second search starts at both the fan-in and the current
+position to account for paths leading through it. Since every
+relocation attempt obstructs at least as much as these searches see, a
+position that is unreachable here is unreachable during every
+relocation attempt as well.
+
+Parameter ``lyt``:
+    Obstructed gate-level layout.
+
+Parameter ``fanins``:
+    Fan-ins of the gate.
+
+Parameter ``old_pos``:
+    Current position of the gate.
+
+Parameter ``min_x``:
+    Minimum x-coordinate of potential new positions.
+
+Parameter ``min_y``:
+    Minimum y-coordinate of potential new positions.
+
+Parameter ``max_diagonal``:
+    Maximum sum of x- and y-coordinate of potential new positions.
+
+Returns:
+    One set per fan-in in the order of `fanins` that contains the
+    potential new positions that are unreachable from the respective
+    fan-in.)doc";
+
 static const char *__doc_fiction_detail_post_layout_optimization_impl_fix_wires =
 R"doc(Utility function to move wires that cross over empty tiles down one
 layer. This can happen if the wiring of a gate is deleted.
@@ -8159,6 +8943,8 @@ Parameter ``cell``:
     The cell to challenge the stored maximum position of a cell in the
     layout against.)doc";
 
+static const char *__doc_fiction_detail_read_technology_network_cache_impl = R"doc()doc";
+
 static const char *__doc_fiction_detail_recursively_paint_edges = R"doc()doc";
 
 static const char *__doc_fiction_detail_sat_clocking_handler = R"doc()doc";
@@ -8333,12 +9119,22 @@ static const char *__doc_fiction_detail_search_space_graph_network = R"doc(The n
 
 static const char *__doc_fiction_detail_search_space_graph_num_expansions = R"doc(The maximum number of positions to be considered for expansions.)doc";
 
+static const char *__doc_fiction_detail_search_space_graph_num_snapshots =
+R"doc(The maximum number of cached partial layouts.)doc";
+
 static const char *__doc_fiction_detail_search_space_graph_pi_locs =
 R"doc(Enum indicating if primary inputs (PIs) can be placed at the top or
 left.)doc";
 
 static const char *__doc_fiction_detail_search_space_graph_planar = R"doc(Create planar layouts.)doc";
 
+static const char *__doc_fiction_detail_search_space_graph_snapshot_order =
+R"doc(Vertices in `snapshots` in the order in which they were cached to
+evict the oldest ones first.)doc";
+
+static const char *__doc_fiction_detail_search_space_graph_snapshots =
+R"doc(Partial layouts of recently expanded vertices.)doc";
+
 static const char *__doc_fiction_detail_sweep_parameter_to_string =
 R"doc(Converts a sweep parameter to a string representation. This is used to
 write the parameter name to the CSV file.
@@ -8349,6 +9145,16 @@ Parameter ``param``:
 Returns:
     The string representation of the sweep parameter.)doc";
 
+static const char *__doc_fiction_detail_technology_library_cache =
+R"doc(Process-wide, thread-safe cache of compiled technology libraries with up
+to `NumInp` inputs. Libraries are keyed by a bitmask that encodes the
+enabled gates of `technology_mapping_params` (see `gate_set_key`) and
+shared via `std::shared_ptr` so that they stay valid even if the cache
+is cleared while a mapping is in progress.
+
+Template parameter ``NumInp``:
+    Maximum input number of the gates in the technology library.)doc";
+
 static const char *__doc_fiction_detail_technology_mapping_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_technology_mapping_impl_ntk = R"doc(Input network to be mapped.)doc";
@@ -8493,6 +9299,22 @@ If any of this is the case, an `std::invalid_argument` is thrown.
 Parameter ``params``:
     The operational domain parameters to validate.)doc";
 
+static const char *__doc_fiction_detail_vertex_snapshot =
+R"doc(A partial layout in which all positions of a search space graph vertex
+have been placed and routed, together with the respective placement
+information. Expansions of the vertex's children can resume from it
+instead of placing and routing all preceding positions again.
+
+Template parameter ``ObstrLyt``:
+    The type of the layout.)doc";
+
+static const char *__doc_fiction_detail_vertex_snapshot_layout =
+R"doc(The partial layout.)doc";
+
+static const char *__doc_fiction_detail_vertex_snapshot_place_info =
+R"doc(The placement information after the vertex's last position has been
+placed.)doc";
+
 static const char *__doc_fiction_detail_wire_east = R"doc()doc";
 
 static const char *__doc_fiction_detail_wire_south = R"doc()doc";
@@ -8775,13 +9597,19 @@ static const char *__doc_fiction_detail_write_qca_layout_impl_write_via_cells =
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_description_color =
+R"doc(Alias for an SVG description template of a cell and its color.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_cell_based_svg =
-R"doc(Generates an SVG string representing the cell-based clocked cell
-layout and appends it to the output stream.)doc";
+R"doc(Generates an SVG representation of the cell-based clocked cell layout
+and streams it to the output stream. Each distinct combination of cell
+description and color is defined once as a symbol that is instantiated
+per cell.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_description_color =
 R"doc(Generates and returns a pair of strings representing the description
-and color of the given cell.
+and color of the given cell. The description is empty if the cell is
+not to be drawn.
 
 Parameter ``c``:
     The cell for which to generate the description and color.
@@ -8791,8 +9619,13 @@ Returns:
     given cell `c`.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_generate_tile_based_svg =
-R"doc(Generates an SVG string representing the tile-based clocked cell
-layout and appends it to the output stream.)doc";
+R"doc(Generates an SVG representation of the tile-based clocked cell layout
+and streams it to the output stream. Tiles are processed one at a
+time. Each distinct tile, i.e., each distinct combination of clock
+zone and contained cells, is defined once as a symbol that is
+instantiated for every tile that looks alike. Memory consumption and
+file size therefore scale with the number of distinct tiles instead of
+the number of cells.)doc";
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_lyt = R"doc()doc";
 
@@ -8802,6 +9635,34 @@ static const char *__doc_fiction_detail_write_qca_layout_svg_impl_ps = R"doc()do
 
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_symbol_instance =
+R"doc(Position of an instance of a reusable SVG symbol.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_symbol_instance_symbol =
+R"doc(Index of the symbol.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_symbol_instance_x =
+R"doc(Position of the instance.)doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_symbol_instance_y = R"doc()doc";
+
+static const char *__doc_fiction_detail_write_qca_layout_svg_impl_write_header_and_symbols =
+R"doc(Writes the SVG header and the definitions of all given symbols to the
+output stream.
+
+Template parameter ``Symbols``:
+    Iterable container of pairs of symbol identifiers and SVG
+    descriptions.
+
+Parameter ``viewbox_x``:
+    Width of the view box.
+
+Parameter ``viewbox_y``:
+    Height of the view box.
+
+Parameter ``symbols``:
+    Symbols to define.)doc";
+
 static const char *__doc_fiction_detail_write_qca_layout_svg_impl_write_qca_layout_svg_impl = R"doc(Default constructor.)doc";
 
 static const char *__doc_fiction_detail_write_qcc_layout_impl = R"doc()doc";
@@ -8933,6 +9794,8 @@ R"doc(Writes both the `simulation_parameters` as well as the
 
 static const char *__doc_fiction_detail_write_sqd_sim_result_impl_write_sqd_sim_result_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_technology_network_cache_impl = R"doc()doc";
+
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_yen_k_shortest_paths_impl_k_shortest_paths = R"doc(The list of k shortest paths that is created during the algorithm.)doc";
@@ -9673,6 +10536,54 @@ Parameter ``pst``:
 Returns:
     The equivalence type of `spec` and `impl`.)doc";
 
+static const char *__doc_fiction_equivalence_checking_output_stats =
+R"doc(Per-output results of equivalence checking in `OUTPUT_PARTITIONED` mode.)doc";
+
+static const char *__doc_fiction_equivalence_checking_output_stats_decided_by_simulation =
+R"doc(`true` iff the output pair was shown to be non-equivalent by random
+simulation.)doc";
+
+static const char *__doc_fiction_equivalence_checking_output_stats_equivalent =
+R"doc(Whether the output pair is equivalent. `std::nullopt` if it could not
+be decided, e.g., because the resource limit was exceeded or because a
+counter example for another output was found first.)doc";
+
+static const char *__doc_fiction_equivalence_checking_output_stats_runtime =
+R"doc(Runtime of the SAT call for the output pair.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params =
+R"doc(Parameters for equivalence checking.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_checking_mode =
+R"doc(Strategies to prove logical equivalence.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_checking_mode_MONOLITHIC =
+R"doc(A single miter over all outputs of `Spec` and `Impl` is handed to one
+SAT call.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_checking_mode_OUTPUT_PARTITIONED =
+R"doc(Bit-parallel random simulation is applied first to cheaply find counter
+examples. Afterward, the miter is split into one miter per pair of
+primary outputs, each restricted to the transitive fan-in cones of both
+outputs. The remaining output miters are solved by independent SAT
+calls in parallel.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_mode =
+R"doc(Strategy to prove logical equivalence.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_num_simulation_rounds =
+R"doc(Number of rounds of random simulation in `OUTPUT_PARTITIONED` mode.
+Each round simulates 64 random input patterns at once.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_num_threads =
+R"doc(Maximum number of threads to solve output miters in
+`OUTPUT_PARTITIONED` mode. Gate-level design rule checks of `Spec` and
+`Impl` are run concurrently in this mode as well.)doc";
+
+static const char *__doc_fiction_equivalence_checking_params_seed =
+R"doc(Seed of the random input patterns. If none is given, a random seed is
+used.)doc";
+
 static const char *__doc_fiction_equivalence_checking_stats = R"doc()doc";
 
 static const char *__doc_fiction_equivalence_checking_stats_counter_example = R"doc(Stores a possible counter example.)doc";
@@ -9683,6 +10594,12 @@ static const char *__doc_fiction_equivalence_checking_stats_eq = R"doc(Stores th
 
 static const char *__doc_fiction_equivalence_checking_stats_impl_drv_stats = R"doc()doc";
 
+static const char *__doc_fiction_equivalence_checking_stats_output_stats =
+R"doc(Per-output results in `OUTPUT_PARTITIONED` mode.)doc";
+
+static const char *__doc_fiction_equivalence_checking_stats_simulation_runtime =
+R"doc(Runtime of the random simulation in `OUTPUT_PARTITIONED` mode.)doc";
+
 static const char *__doc_fiction_equivalence_checking_stats_spec_drv_stats = R"doc(Stores DRVs.)doc";
 
 static const char *__doc_fiction_equivalence_checking_stats_tp_diff = R"doc(Throughput values at which weak equivalence manifests.)doc";
@@ -9874,9 +10791,19 @@ minimized.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_num_threads =
 R"doc(Number of threads to use for exploring the possible aspect ratios.
+Each of these threads runs the entire solver `portfolio`, i.e.,
+`num_threads * portfolio.size()` threads are used in total.
 
 @note This is an unstable beta feature.)doc";
 
+static const char *__doc_fiction_exact_physical_design_params_portfolio =
+R"doc(Solver configurations that compete on each examined aspect ratio. Each
+configuration runs in its own thread and the first definite answer,
+i.e., SAT or UNSAT, is taken while all other solvers are interrupted.
+An empty portfolio is equivalent to a single default configuration.
+See `exact_solver_portfolio` for a diversified portfolio of a given
+size.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params_scheme = R"doc(Clocking scheme to be used.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_straight_inverters =
@@ -9922,10 +10849,46 @@ static const char *__doc_fiction_exact_physical_design_stats_num_wires = R"doc()
 
 static const char *__doc_fiction_exact_physical_design_stats_report = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_thread_stats =
+R"doc(Per-thread statistics. Only available if aspect ratios were explored
+asynchronously.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_x_size = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_y_size = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_thread_stats =
+R"doc(Statistics of a single thread that explores aspect ratios in the
+asynchronous mode of the exact physical design algorithm.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_num_dominated =
+R"doc(Number of aspect ratios that were skipped or aborted because they are
+dominated by an aspect ratio that another thread proved to be UNSAT.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_num_sat =
+R"doc(Number of aspect ratios that were found SAT, UNSAT, or that could not
+be decided, respectively.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_num_unknown =
+R"doc(Number of aspect ratios that were found SAT, UNSAT, or that could not
+be decided, respectively.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_num_unsat =
+R"doc(Number of aspect ratios that were found SAT, UNSAT, or that could not
+be decided, respectively.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_num_wins =
+R"doc(Number of definite answers that each configuration of the solver
+portfolio contributed first.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_report =
+R"doc(Reports the statistics to the given output stream.
+
+Parameter ``out``:
+    Output stream.)doc";
+
+static const char *__doc_fiction_exact_physical_design_thread_stats_time_solving = R"doc(Time spent in solver calls.)doc";
+
 static const char *__doc_fiction_exact_sidb_simulation_engine = R"doc(Selector exclusively for exact SiDB simulation engines.)doc";
 
 static const char *__doc_fiction_exact_sidb_simulation_engine_EXGS =
@@ -9937,6 +10900,36 @@ R"doc(*QuickExact* is also an exact simulation engine that requires
 exponential runtime, but it scales a lot better than ExGS due to its
 effective search-space pruning.)doc";
 
+static const char *__doc_fiction_exact_solver_configuration =
+R"doc(Configuration of a single SMT solver that is used by the exact
+physical design algorithm. Differently configured solvers tend to
+perform very differently on the same instance, which can be exploited
+by racing several of them against each other, i.e., by running a
+solver portfolio.)doc";
+
+static const char *__doc_fiction_exact_solver_configuration_random_seed = R"doc(Random seed that is passed to Z3.)doc";
+
+static const char *__doc_fiction_exact_solver_configuration_symmetry_breaking =
+R"doc(Flag to indicate that symmetry breaking constraints that are derived
+from the network's hierarchy should be generated.)doc";
+
+static const char *__doc_fiction_exact_solver_configuration_tactic =
+R"doc(Name of the Z3 tactic that the solver is to be constructed from, e.g.,
+`"smt"`. If empty, Z3's default incremental solver is used.)doc";
+
+static const char *__doc_fiction_exact_solver_portfolio =
+R"doc(Creates a diversified portfolio of solver configurations to be used in
+`exact_physical_design_params::portfolio`. The configurations differ
+in their random seeds and alternate between symmetry breaking on and
+off as well as between Z3's default incremental solver and one that is
+constructed from the `smt` tactic.
+
+Parameter ``size``:
+    Number of configurations in the portfolio.
+
+Returns:
+    A portfolio of `size` distinct solver configurations.)doc";
+
 static const char *__doc_fiction_exact_with_blacklist =
 R"doc(The same as `exact` but with a black list of tiles that are not
 allowed to be used to a specified set of Boolean functions and their
@@ -9981,6 +10974,16 @@ simulated in a reasonable time. However, since all charge
 configurations are checked for validity, 100 % simulation accuracy is
 guaranteed.
 
+Charge configurations are enumerated by a depth-first search that
+abandons partial configurations as soon as an already charged SiDB
+cannot fulfill population stability anymore. If only ground states
+are requested, partial configurations whose energy lower bound
+exceeds the energy of the best physically valid configuration found
+so far are abandoned as well. The search space is partitioned into
+disjoint charge index ranges that are processed by multiple threads.
+The physically valid charge distributions are returned in ascending
+order of their charge indices.
+
 @note This was the first exact simulation approach. However, it is
 replaced by *QuickExact* due to the much better runtimes and more
 functionality.
@@ -9992,14 +10995,56 @@ Parameter ``lyt``:
     The layout to simulate.
 
 Parameter ``params``:
-    Simulation parameters.
+    Parameters.
 
-Parameter ``ps``:
-    Simulation statistics.
+Returns:
+    sidb_simulation_result is returned with all results.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_2 =
+R"doc(*Exhaustive Ground State Simulation* (ExGS) that returns all
+physically valid charge distributions of the given layout. The
+enumeration is performed by the calling thread only, which makes this
+overload safe to use from already parallelized contexts, e.g.,
+operational domain computations.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to simulate.
+
+Parameter ``params``:
+    Simulation parameters.
 
 Returns:
     sidb_simulation_result is returned with all results.)doc";
 
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params =
+R"doc(Parameters for *Exhaustive Ground State Simulation* (ExGS).)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_mode =
+R"doc(Charge distributions to return.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_num_threads =
+R"doc(Number of threads that enumerate disjoint ranges of charge indices in
+parallel.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_result_mode =
+R"doc(Modes that determine which charge distributions are returned.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_result_mode_ALL_PHYSICALLY_VALID =
+R"doc(All physically valid charge distributions are returned.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_result_mode_GROUND_STATES_ONLY =
+R"doc(Only the physically valid charge distributions of minimal energy,
+i.e., the (degenerate) ground states, are returned. This allows to
+additionally abandon partial charge assignments whose energy lower
+bound exceeds the energy of the best physically valid charge
+distribution found so far.)doc";
+
+static const char *__doc_fiction_exhaustive_ground_state_simulation_params_simulation_parameters =
+R"doc(Physical parameters of the simulation.)doc";
+
 static const char *__doc_fiction_extract_routing_objectives =
 R"doc(Extracts all routing objectives from the given layout. To this end,
 all routing paths in the layout are traversed, starting at each PI.
@@ -10631,6 +11676,17 @@ Template parameter ``ClockedLayout``:
 
 static const char *__doc_fiction_gate_level_layout_assign_node = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_children_for_events =
+R"doc(Returns a copy of `n`'s children if any `on_modified` events are
+registered that require them. Otherwise, an empty container is
+returned to avoid unnecessary allocations.
+
+Parameter ``n``:
+    Node whose children are desired.
+
+Returns:
+    `n`'s children if `on_modified` events are registered.)doc";
+
 static const char *__doc_fiction_gate_level_layout_clear_tile =
 R"doc(Removes all assigned nodes from the given tile and marks them as dead.
 
@@ -10704,6 +11760,28 @@ static const char *__doc_fiction_gate_level_layout_create_xor = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_decr_value = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_disable_fanout_index =
+R"doc(Disables the fanout index of this layout and frees its memory. Fanouts
+are determined via lookups afterward.)doc";
+
+static const char *__doc_fiction_gate_level_layout_enable_fanout_index =
+R"doc(Enables the fanout index of this layout and builds it from scratch. By
+default, fanouts are determined by looking up the nodes placed on all
+outgoing clock zones (+/- one layer to include crossings) of a given
+node and checking whether they have the node as a child. With the
+fanout index enabled, each node additionally keeps track of its tile
+and all of its fanouts and their tiles such that `get_tile`,
+`foreach_fanout`, `fanout_size`, `outgoing_data_flow`, etc. no longer
+require any hash map lookups. The index is updated on every call to
+`create_...`, `move_node`, `connect`, and `clear_tile` and is, thus,
+suited for algorithms that query fanouts much more frequently than
+they modify the layout.
+
+Enabling the fanout index does not alter the results of any of the
+layout's functions, including the order in which fanouts are visited.
+Since the index is part of the layout's storage, it is shared by all
+shallow copies and duplicated by `clone`.)doc";
+
 static const char *__doc_fiction_gate_level_layout_events = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_evnts = R"doc()doc";
@@ -10722,6 +11800,16 @@ Parameter ``n``:
 Returns:
     Number of fanins to `n`.)doc";
 
+static const char *__doc_fiction_gate_level_layout_fanout_record =
+R"doc(Returns the fanout record of the given node if the fanout index is
+enabled and the node is placed.
+
+Parameter ``n``:
+    Node whose fanout record is desired.
+
+Returns:
+    Pointer to `n`'s fanout record or `nullptr` if there is none.)doc";
+
 static const char *__doc_fiction_gate_level_layout_fanout_size =
 R"doc(Returns the number of outgoing, adjacently placed, and properly
 clocked signals of the given node.
@@ -10887,11 +11975,46 @@ R"doc(Copy constructor from another `ClockedLayout`.
 Parameter ``lyt``:
     Clocked layout.)doc";
 
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record =
+R"doc(Entry of the optional fanout index (see `enable_fanout_index`) that is
+kept for each node. It stores the node's tile as well as all nodes that
+are connected to it as fanouts together with their tiles. Since most
+nodes in a layout have very few fanouts, the first ones are stored
+inline and only excess ones are spilled to the heap.)doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_add = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_clear = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_empty = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_fanout_at =
+R"doc(Returns the fanout node that is placed on the given tile or `0` if
+there is none.)doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_inline_capacity = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_inline_fanouts = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_num_inline = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_placed = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_remove = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_spilled_fanouts = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_fanout_record_tile = R"doc()doc";
+
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_const0 = R"doc()doc";
 
-static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_const1 = R"doc()doc";
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_const1 = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_fanout_index = R"doc()doc";
+
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_fanout_records = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_fn_cache = R"doc()doc";
 
@@ -10909,6 +12032,8 @@ static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_dat
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_tile_node_map = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_tile_parents = R"doc()doc";
+
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_trav_id = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_node =
@@ -10994,6 +12119,13 @@ Parameter ``t``:
 Returns:
     `true` iff `east(t)` is outgoing from `t`.)doc";
 
+static const char *__doc_fiction_gate_level_layout_has_fanout_index =
+R"doc(Checks whether the fanout index of this layout is enabled.
+
+Returns:
+    `true` iff `enable_fanout_index` was called and the index has not
+    been disabled since.)doc";
+
 static const char *__doc_fiction_gate_level_layout_has_input_name = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_has_name = R"doc()doc";
@@ -11266,6 +12398,17 @@ static const char *__doc_fiction_gate_level_layout_incr_trav_id = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_incr_value = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_index_fanin =
+R"doc(Adds node `p` as a fanout to the node its child `c` points to if `p`
+is placed.)doc";
+
+static const char *__doc_fiction_gate_level_layout_index_fanins =
+R"doc(Adds node `p` as a fanout to the nodes all of its children point to.)doc";
+
+static const char *__doc_fiction_gate_level_layout_index_node =
+R"doc(Registers node `n` on tile `t` in the fanout index and collects all
+placed nodes that have `t` as a child.)doc";
+
 static const char *__doc_fiction_gate_level_layout_index_to_node = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_initialize_truth_table_cache = R"doc()doc";
@@ -11588,6 +12731,21 @@ static const char *__doc_fiction_gate_level_layout_strg = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_trav_id = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_unassign_tile =
+R"doc(Removes the node assigned to the given tile and marks it as dead
+without invoking any events.
+
+Parameter ``t``:
+    Tile whose node is to be removed.)doc";
+
+static const char *__doc_fiction_gate_level_layout_unindex_fanins =
+R"doc(Removes node `p` as a fanout from the nodes all of its children point
+to.)doc";
+
+static const char *__doc_fiction_gate_level_layout_unindex_node =
+R"doc(Removes node `n` from the fanout index, i.e., marks it as not placed
+and removes it from its children's fanouts.)doc";
+
 static const char *__doc_fiction_gate_level_layout_value = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_visited = R"doc()doc";
@@ -11940,8 +13098,10 @@ execution of the layout design algorithm.
 When set to `true`, the algorithm will utilize multiple threads to
 process different search space graphs in parallel, improving
 performance by distributing the workload across available CPU cores.
-If set to `false`, the algorithm will run sequentially on a single
-thread.
+Individual vertex expansions are scheduled via work stealing such that
+threads that are done with their search space graphs take over the
+work of others instead of idling. If set to `false`, the algorithm
+will run sequentially on a single thread.
 
 Only recommended for `HIGH_EFFORT` and `HIGHEST_EFFORT` modes and
 complex networks (> 100 nodes).
@@ -11957,6 +13117,18 @@ Default value: `false`)doc";
 
 static const char *__doc_fiction_graph_oriented_layout_design_params_mode = R"doc(The effort mode used. Defaults to HIGH_EFFORT.)doc";
 
+static const char *__doc_fiction_graph_oriented_layout_design_params_num_layout_snapshots =
+R"doc(Maximum number of partial layouts that are cached per search space
+graph. Expanding a vertex requires the partial layout of its parent
+vertex, i.e., the layout in which all but the last of the vertex's
+positions have been placed and routed. If that layout is cached, only
+the new node has to be placed and routed instead of rebuilding the
+entire partial layout from scratch. Once the limit is reached, the
+oldest cached layouts are evicted first. Setting this value to 0
+disables caching. Caching is always disabled for custom cost
+objectives as they are not guaranteed to be monotonic in the number of
+placed nodes. Defaults to 16 layouts.)doc";
+
 static const char *__doc_fiction_graph_oriented_layout_design_params_num_vertex_expansions =
 R"doc(Number of expansions for each vertex that should be explored. For each
 partial layout, `num_vertex_expansions` positions will be checked for
@@ -12257,6 +13429,8 @@ static const char *__doc_fiction_has_cardinal_operations = R"doc()doc";
 
 static const char *__doc_fiction_has_create_dot = R"doc()doc";
 
+static const char *__doc_fiction_has_defect_potential_field = R"doc()doc";
+
 static const char *__doc_fiction_has_east = R"doc()doc";
 
 static const char *__doc_fiction_has_elevation_operations = R"doc()doc";
@@ -13182,6 +14356,120 @@ R"doc(Reports the statistics to the given output stream.
 Parameter ``out``:
     Output stream.)doc";
 
+static const char *__doc_fiction_hierarchical_sidb_simulation =
+R"doc(Hierarchical simulation of an SiDB circuit that was obtained by
+applying a tile-based gate library such as `sidb_bestagon_library` to
+a gate-level layout. A full circuit is far beyond the reach of exact
+simulation, but its tiles are not: each tile is simulated on its own
+with the boundary BDL states of its upstream neighbors as fixed
+negative charges, and its resulting output BDL states are propagated
+to its downstream neighbors. Tiles are processed in the order of the
+data flow, which follows the clocking, such that all tiles of one
+level are independent of each other and simulated in parallel.
+
+A tile simulation only depends on the SiDB pattern of the tile and the
+positions of the fixed charges at its borders. Therefore, results are
+cached by these two, which makes each distinct gate type in each
+distinct boundary state a single simulation, regardless of how often
+it occurs in the circuit and in how many input patterns.
+
+The input borders of primary input tiles are driven by a virtual BDL
+pair that continues the input wire beyond the tile. Each output border
+is loaded by a negative charge that represents the input wire of the
+next tile, just like the output perturbers of gate designs. A BDL pair
+encodes logic 1 if its lower SiDB is negatively charged and its upper
+SiDB is neutral, and logic 0 vice versa. If a tile does not reach a
+valid BDL state at an output in all of its ground states, the state is
+undefined and so are the states of all tiles downstream of it.
+
+Input patterns are propagated through the circuit in blocks of
+`pattern_block_size` patterns such that the output states of all tiles
+only have to be stored for one block at a time. This function throws an
+`std::invalid_argument` exception if `gate_lyt` has more than
+`HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS` primary inputs.
+
+@note Interactions between tiles are restricted to the boundary BDL
+pairs of connected neighbors. This is the assumption under which tile-
+based gate libraries are designed.
+
+Template parameter ``GateLibrary``:
+    Tile-based SiDB gate library that was applied to `gate_lyt`, e.g.,
+    `sidb_bestagon_library`.
+
+Template parameter ``GateLyt``:
+    Pointy-top hexagonal gate-level layout type.
+
+Template parameter ``CellLyt``:
+    SiDB cell-level layout type.
+
+Parameter ``gate_lyt``:
+    The gate-level layout that specifies the tiling.
+
+Parameter ``cell_lyt``:
+    The SiDB cell-level layout obtained from `gate_lyt` via
+    `apply_gate_library`.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    The Boolean function of each primary output of `gate_lyt` over its
+    primary inputs. Undefined output states are represented as 0.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params =
+R"doc(Parameters for the hierarchical SiDB simulation.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params_bdl_pairs_params =
+R"doc(Parameters for the detection of the BDL pairs at the borders of each
+tile.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params_num_threads =
+R"doc(Number of threads that simulate independent tiles in parallel.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params_pattern_block_size =
+R"doc(Number of input patterns that are propagated through the circuit at
+once. The output states of all tiles are only stored for one block of
+input patterns at a time, which bounds the memory consumption
+regardless of the number of primary inputs. Since simulated tiles are
+cached across blocks, smaller blocks hardly cause any additional tile
+simulations.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params_sim_engine =
+R"doc(Exact simulation engine that simulates each tile.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_params_simulation_parameters =
+R"doc(Physical parameters for the simulation of each tile.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats =
+R"doc(Statistics of the hierarchical SiDB simulation.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_cache_hits =
+R"doc(Number of tile evaluations whose result was taken from the cache
+instead of being simulated.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_input_patterns =
+R"doc(Number of simulated input patterns.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_levels =
+R"doc(Number of levels of tiles that were simulated one after another.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_tile_simulations =
+R"doc(Number of physical simulations of tiles.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_tiles =
+R"doc(Number of simulated tiles. Crossings count as a single tile.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_num_undefined_patterns =
+R"doc(Number of input patterns for which at least one primary output does
+not settle into a valid BDL state, e.g., because a tile has a
+degenerate ground state.)doc";
+
+static const char *__doc_fiction_hierarchical_sidb_simulation_stats_time_total =
+R"doc(Total runtime.)doc";
+
 static const char *__doc_fiction_high_degree_fanin_exception =
 R"doc(Exception class that can be thrown if some network exceeds a legal
 number of fanins.)doc";
@@ -13376,6 +14664,35 @@ Returns:
     ToPoliNano gate representation of `t` including I/Os, rotation,
     etc.)doc";
 
+static const char *__doc_fiction_input_simulation_mode =
+R"doc(Modes to simulate the :math:`2^n` input patterns of an :math:`n`-input
+SiDB gate layout.)doc";
+
+static const char *__doc_fiction_input_simulation_mode_FULL_LAYOUT =
+R"doc(Each input pattern is simulated as an independent layout that includes the
+input perturbers.)doc";
+
+static const char *__doc_fiction_input_simulation_mode_INCREMENTAL =
+R"doc(The gate body, i.e., the layout without its input BDL pairs, is set up
+once. The electrostatic potentials of its SiDBs and of every input
+perturber at the gate body are precomputed. This makes the check for
+positively charged SiDBs of an input pattern run in
+:math:`\mathcal{O}(N)` instead of :math:`\mathcal{O}(N^2)` for
+:math:`N` SiDBs. Each input pattern that is simulated is still passed
+to the simulation engine as a copy of the gate body in which the active
+input perturbers are fixed negative charges, i.e., SiDB defects. The
+engine rebuilds its charge distribution surface and thereby the
+distance and potential matrices of the gate body for every such
+pattern, so the simulation setup itself remains :math:`\mathcal{O}(N^2)`
+per pattern. The input perturbers are, however, no longer variables of
+the simulation. The results are identical to `FULL_LAYOUT` as long as
+the input perturbers are negatively charged, which is the case for the
+isolated perturbers used in gate designs.
+
+@note Only applicable to simulation engines that support SiDB defects,
+i.e., *QuickExact* and *ExGS*, and to layouts that are not charge
+distribution surfaces. Otherwise, `FULL_LAYOUT` is used.)doc";
+
 static const char *__doc_fiction_integral_abs =
 R"doc(Takes the absolute value of an integral number if it is signed, and
 otherwise computes the identity. This avoids a compiler warning when
@@ -13611,6 +14928,9 @@ static const char *__doc_fiction_is_operational_params = R"doc(Parameters for th
 
 static const char *__doc_fiction_is_operational_params_input_bdl_iterator_params = R"doc(Parameters for the BDL input iterator.)doc";
 
+static const char *__doc_fiction_is_operational_params_input_sim_mode =
+R"doc(Mode to simulate the input patterns of the layout.)doc";
+
 static const char *__doc_fiction_is_operational_params_op_condition =
 R"doc(Condition which is used to decide if a layout is `operational` or
 `non-operational`.)doc";
@@ -13953,6 +15273,25 @@ types.
 Template parameter ``NtkPtr``:
     Pointer type to a logic network.)doc";
 
+static const char *__doc_fiction_network_reader_cache_disabled =
+R"doc(Flag to indicate that the cache directory turned out to be unusable.)doc";
+
+static const char *__doc_fiction_network_reader_cache_file_name =
+R"doc(Computes the cache file name for the given source file from the 64-bit
+FNV-1a hash of its content. The network type and the version of the
+cache format are part of the key such that entries written for another
+network type or by another version are never read back.
+
+Parameter ``file``:
+    Source file.
+
+Returns:
+    Path to the cache file or an empty string if caching is disabled
+    or the file cannot be hashed.)doc";
+
+static const char *__doc_fiction_network_reader_cacheable =
+R"doc(Flag to indicate whether parsed networks can be cached.)doc";
+
 static const char *__doc_fiction_network_reader_get_networks =
 R"doc(Getter for networks generated from given files.
 
@@ -13966,18 +15305,54 @@ Returns:
 static const char *__doc_fiction_network_reader_network_reader =
 R"doc(Standard constructor. Reads and constructs logic networks. May throw.
 
+Files in a given folder are processed in lexicographical order of
+their paths.
+
 Parameter ``filename``:
     Path to the file or folder of files to read.
 
 Parameter ``out``:
-    Output stream to write status updates into.)doc";
+    Output stream to write status updates into.
+
+Parameter ``ps``:
+    Parameters.)doc";
 
 static const char *__doc_fiction_network_reader_networks = R"doc(Vector of logic networks read from files given at construction.)doc";
 
 static const char *__doc_fiction_network_reader_out = R"doc(Output stream to which status updates are to be written.)doc";
 
+static const char *__doc_fiction_network_reader_params =
+R"doc(Parameters for the network reader.)doc";
+
+static const char *__doc_fiction_network_reader_params_2 =
+R"doc(Parameters.)doc";
+
+static const char *__doc_fiction_network_reader_params_cache_directory =
+R"doc(Directory in which parsed technology networks are cached in a binary
+format (see `write_technology_network_cache`). Cache entries are keyed
+by a hash of the respective source file's content such that subsequent
+reads of unchanged files skip parsing altogether. An empty string
+disables the cache. The cache is only used if the network type is
+derived from `technology_network`.)doc";
+
+static const char *__doc_fiction_network_reader_params_num_threads =
+R"doc(Maximum number of worker threads to use if `parallel` is set.)doc";
+
+static const char *__doc_fiction_network_reader_params_parallel =
+R"doc(Parse multiple files concurrently. Each file is parsed into a separate
+network by one of the worker threads. The resulting networks and all
+status updates are nevertheless reported in the same deterministic
+order as in the sequential mode.)doc";
+
+static const char *__doc_fiction_network_reader_prepare_cache_directory =
+R"doc(Creates the cache directory if caching is enabled. Disables the cache
+if the directory cannot be created.)doc";
+
 static const char *__doc_fiction_network_reader_read =
 R"doc(Actual read function that constructs the logic network from a file.
+If caching is enabled, a cached version of the network is returned
+instead of parsing the file if available, and freshly parsed networks
+are added to the cache.
 
 Template parameter ``Reader``:
     The functor type which constructs the network, i.e. handles the
@@ -13990,7 +15365,65 @@ Parameter ``file``:
     The file name.
 
 Parameter ``rfun``:
-    The actual parsing function.)doc";
+    The actual parsing function.
+
+Parameter ``log``:
+    Output stream to write status updates into.
+
+Returns:
+    The constructed logic network or `nullptr` if the file could not
+    be read.)doc";
+
+static const char *__doc_fiction_network_reader_read_file =
+R"doc(Reads a single file by choosing the parser according to its
+extension.
+
+Parameter ``p``:
+    Path to the file.
+
+Parameter ``log``:
+    Output stream to write status updates into.
+
+Returns:
+    The constructed logic network or `nullptr` if the file could not
+    be read.)doc";
+
+static const char *__doc_fiction_network_reader_read_from_cache =
+R"doc(Attempts to restore a network from the given cache file. Missing or
+corrupted cache files are ignored.
+
+Parameter ``cache_file``:
+    Path to the cache file.
+
+Parameter ``name``:
+    Name to assign to the restored network.
+
+Returns:
+    The restored network or `nullptr` if no valid cache entry exists.)doc";
+
+static const char *__doc_fiction_network_reader_read_in_parallel =
+R"doc(Distributes the given files over a pool of worker threads. Each worker
+repeatedly claims the next unprocessed file and parses it into its own
+network. Status updates are buffered per file and written to `out` in
+the order of `paths` after all workers have finished such that the
+output does not depend on thread scheduling.
+
+Parameter ``paths``:
+    Files to read.)doc";
+
+static const char *__doc_fiction_network_reader_write_to_cache =
+R"doc(Stores the given network in the cache. The entry is first written to a
+temporary file that is then renamed such that concurrent readers never
+observe partially written entries.
+
+Parameter ``ntk``:
+    Network to cache.
+
+Parameter ``cache_file``:
+    Path to the cache file.
+
+Parameter ``log``:
+    Output stream to write status updates into.)doc";
 
 static const char *__doc_fiction_normalize_layout_coordinates =
 R"doc(A new layout is constructed and returned that is equivalent to the
@@ -14048,6 +15481,19 @@ static const char *__doc_fiction_obstruction_layout = R"doc()doc";
 
 static const char *__doc_fiction_obstruction_layout_2 = R"doc()doc";
 
+static const char *__doc_fiction_obstruction_layout_clone =
+R"doc(Clones the layout returning a deep copy that includes all manually
+obstructed coordinates and connections.
+
+Returns:
+    Deep copy of the layout.)doc";
+
+static const char *__doc_fiction_obstruction_layout_clone_2 =
+R"doc(Clones the layout returning a deep copy.
+
+Returns:
+    Deep copy of the layout.)doc";
+
 static const char *__doc_fiction_obstruction_layout_obstruction_layout = R"doc()doc";
 
 static const char *__doc_fiction_occupation_probability_gate_based =
@@ -15562,12 +17008,26 @@ static const char *__doc_fiction_quicksim_params_alpha =
 R"doc(`alpha` parameter for the *QuickSim* algorithm (should be reduced if
 no result is found).)doc";
 
+static const char *__doc_fiction_quicksim_params_interaction_cutoff =
+R"doc(If set, SiDBs only interact within this radius, which reduces the
+memory and runtime of the simulation of large layouts from quadratic to
+linear in the number of SiDBs. Since the screened Coulomb interaction
+decays exponentially, a radius of a few screening lengths `lambda_tf`
+suffices. The resulting bound on the system energy error is reported in
+the simulation result (unit: nm).)doc";
+
 static const char *__doc_fiction_quicksim_params_iteration_steps = R"doc(Number of iterations to run the simulation for.)doc";
 
 static const char *__doc_fiction_quicksim_params_number_threads =
 R"doc(Number of threads to spawn. By default the number of threads is set to
 the number of available hardware threads.)doc";
 
+static const char *__doc_fiction_quicksim_params_seed =
+R"doc(Seed for the random number generators of all threads. If no seed is
+given, the generators are seeded non-deterministically. With a seed,
+the set of found charge distributions is reproducible for a fixed
+number of threads.)doc";
+
 static const char *__doc_fiction_quicksim_params_simulation_parameters = R"doc(Simulation parameters for the simulation of the physical SiDB system.)doc";
 
 static const char *__doc_fiction_random_coordinate =
@@ -15893,6 +17353,42 @@ Parameter ``lyt``:
 Parameter ``filename``:
     The file name to open and read from.)doc";
 
+static const char *__doc_fiction_read_technology_network_cache =
+R"doc(Reads a technology network that was written via
+`write_technology_network_cache`.
+
+May throw a `technology_network_cache_error` if the input is malformed
+or was written by an incompatible version.
+
+This overload uses an input stream to read from.
+
+Template parameter ``Ntk``:
+    Technology network type, e.g., `tec_nt`.
+
+Parameter ``is``:
+    The input stream to read from. Should be opened in binary mode.
+
+Returns:
+    The restored network.)doc";
+
+static const char *__doc_fiction_read_technology_network_cache_2 =
+R"doc(Reads a technology network that was written via
+`write_technology_network_cache`.
+
+May throw a `technology_network_cache_error` if the file is malformed
+or was written by an incompatible version.
+
+This overload uses a file name to read from.
+
+Template parameter ``Ntk``:
+    Technology network type, e.g., `tec_nt`.
+
+Parameter ``filename``:
+    The file name to open and read from.
+
+Returns:
+    The restored network.)doc";
+
 static const char *__doc_fiction_relative_to_absolute_cell_position =
 R"doc(Converts a relative cell position within a tile to an absolute cell
 position within a layout. To compute the absolute position, the layout
@@ -16404,6 +17900,116 @@ returns the negation of the result.
 Parameter ``rhs``:
     `sidb_defect` instance to compare against.)doc";
 
+static const char *__doc_fiction_sidb_defect_potential_field =
+R"doc(The summed electrostatic potential field of all charged defects on an
+SiDB surface. It is computed once per surface and can be evaluated at
+arbitrary positions, which allows all charge distribution surfaces of
+layouts on the same surface to share it.
+
+The screened Coulomb potential of a defect decays exponentially with
+its Thomas-Fermi screening distance. Therefore, each defect is only
+considered up to the distance at which its potential falls below
+`cutoff_potential`. Defects are sorted by their x-position such that
+only those within the cutoff window of a position have to be visited.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_cutoff_distance =
+R"doc(Determines the distance beyond which the potential of the given defect
+falls below `cutoff_potential`.
+
+Parameter ``defect``:
+    The defect.
+
+Returns:
+    Cutoff distance of `defect`, which is infinite if its potential is
+    not screened (unit: nm).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_cutoff_potential =
+R"doc(Potential below which the contribution of a defect is neglected (unit:
+V).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_entries =
+R"doc(Charged defects sorted by their x-positions.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_interaction_energies =
+R"doc(Memoized interaction energies as tuples of `k`, `lambda_tf`, and the
+energy.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_interaction_energy =
+R"doc(Computes the interaction energy among all defects as it is considered
+in the system energy of a charge distribution surface, i.e., the sum of
+the chargeless screened Coulomb potentials over all ordered pairs of
+defects using the given physical parameters. The result is memoized per
+parameter combination.
+
+Parameter ``k``:
+    Coulomb constant divided by the relative permittivity (unit:
+    N·m²/C²).
+
+Parameter ``lambda_tf``:
+    Thomas-Fermi screening distance (unit: nm).
+
+Returns:
+    Interaction energy among all defects (unit: eV).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_max_cutoff =
+R"doc(Largest cutoff distance of all defects (unit: nm).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_memo_mutex =
+R"doc(Mutex to guard the memoized interaction energies.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_num_defects =
+R"doc(Returns the number of charged defects.
+
+Returns:
+    Number of charged defects that contribute to the field.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_positioned_defect =
+R"doc(A charged defect at a position in nm from the layout origin.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_positioned_defect_cutoff =
+R"doc(Distance beyond which the potential of the defect is neglected (unit:
+nm).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_positioned_defect_defect =
+R"doc(The defect.)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_positioned_defect_position =
+R"doc(Position of the defect (unit: nm).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_potential =
+R"doc(Returns the electrostatic potential that a defect generates at the
+given distance.
+
+Parameter ``defect``:
+    The defect.
+
+Parameter ``distance``:
+    Distance to the defect (unit: nm).
+
+Returns:
+    The electrostatic potential of `defect` at `distance`, which is 0
+    at the defect's position itself (unit: V).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_potential_at =
+R"doc(Evaluates the summed potential of all defects at the given position.
+
+Parameter ``position``:
+    Position in nm from the layout origin.
+
+Returns:
+    Summed electrostatic potential of all defects within their cutoff
+    distance of `position` (unit: V).)doc";
+
+static const char *__doc_fiction_sidb_defect_potential_field_sidb_defect_potential_field =
+R"doc(Standard constructor. Uncharged defects are ignored.
+
+Parameter ``defects``:
+    Defects and their positions in nm from the layout origin.
+
+Parameter ``cutoff_pot``:
+    Potential below which the contribution of a defect is neglected
+    (unit: V).)doc";
+
 static const char *__doc_fiction_sidb_defect_sidb_defect = R"doc(Standard constructor.)doc";
 
 static const char *__doc_fiction_sidb_defect_surface = R"doc()doc";
@@ -17566,6 +19172,14 @@ static const char *__doc_fiction_technology_mapping_params_and3 = R"doc(3-input
 
 static const char *__doc_fiction_technology_mapping_params_and_xor = R"doc(3-input AND-XOR gate.)doc";
 
+static const char *__doc_fiction_technology_mapping_params_cache_library =
+R"doc(Reuse compiled technology libraries across calls. Compiling a library,
+i.e., parsing its gates and computing its supergates, only depends on
+the enabled gates and the `decay` flag. If this flag is set, compiled
+libraries are stored in a process-wide cache so that mapping many
+networks with the same gate set only pays for cut enumeration and
+covering. See `clear_technology_mapping_library_cache`.)doc";
+
 static const char *__doc_fiction_technology_mapping_params_decay =
 R"doc(Enforce the application of at least one constant input to three-input
 gates.)doc";
@@ -17608,6 +19222,10 @@ static const char *__doc_fiction_technology_mapping_params_xor_and = R"doc(3-inp
 
 static const char *__doc_fiction_technology_mapping_stats = R"doc(Statistics for technology mapping.)doc";
 
+static const char *__doc_fiction_technology_mapping_stats_library_cache_hit =
+R"doc(`true` iff a previously compiled technology library was reused from the
+cache.)doc";
+
 static const char *__doc_fiction_technology_mapping_stats_mapper_stats = R"doc(Statistics for mockturtle's mapper.)doc";
 
 static const char *__doc_fiction_technology_mapping_stats_report = R"doc(Report statistics.)doc";
@@ -17636,6 +19254,17 @@ static const char *__doc_fiction_technology_network_add_additional_functions =
 R"doc(Adds some further Boolean functions to the truth table cache for fixed
 indexing.)doc";
 
+static const char *__doc_fiction_technology_network_cache_error =
+R"doc(Exception thrown when an error occurs while reading a cached technology
+network.)doc";
+
+static const char *__doc_fiction_technology_network_cache_error_technology_network_cache_error =
+R"doc(Constructs a `technology_network_cache_error` object with the given
+error message.
+
+Parameter ``msg``:
+    The error message describing the error.)doc";
+
 static const char *__doc_fiction_technology_network_clone = R"doc()doc";
 
 static const char *__doc_fiction_technology_network_clone_node = R"doc()doc";
@@ -17819,6 +19448,37 @@ static const char *__doc_fiction_tile_based_layout_tiles = R"doc()doc";
 
 static const char *__doc_fiction_time_to_solution =
 R"doc(This function determines the time-to-solution (TTS) and the accuracy
+(acc) of the *QuickSim* algorithm with respect to a given exact
+simulation result. This allows to reuse the exact reference simulation
+of a layout for multiple *QuickSim* parameter variants.
+
+The repetitions are distributed among `tts_params.num_threads`
+threads. If `quicksim_params.seed` is set, the seed of each repetition
+is derived from it and the repetition's index, which makes the results
+reproducible independently of the number of threads.
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Parameter ``lyt``:
+    Layout that is used for the simulation.
+
+Parameter ``results_exact``:
+    Simulation results of an exact algorithm for `lyt`.
+
+Parameter ``quicksim_params``:
+    Parameters required for the *QuickSim* algorithm.
+
+Parameter ``tts_params``:
+    Parameters used for the time-to-solution calculation. `engine` is
+    ignored.
+
+Parameter ``ps``:
+    Pointer to a struct where the results (time_to_solution, acc,
+    single runtime) are stored.)doc";
+
+static const char *__doc_fiction_time_to_solution_2 =
+R"doc(This function determines the time-to-solution (TTS) and the accuracy
 (acc) of the *QuickSim* algorithm.
 
 Template parameter ``Lyt``:
@@ -17877,6 +19537,12 @@ static const char *__doc_fiction_time_to_solution_params_engine =
 R"doc(Exhaustive simulation algorithm used to simulate the ground state as
 reference.)doc";
 
+static const char *__doc_fiction_time_to_solution_params_num_threads =
+R"doc(Number of threads that run the *QuickSim* repetitions in parallel.
+Each repetition is still timed individually. To avoid
+oversubscription, the number of threads used by each *QuickSim* run
+should be reduced accordingly.)doc";
+
 static const char *__doc_fiction_time_to_solution_params_repetitions =
 R"doc(Number of iterations of the heuristic algorithm used to determine the
 simulation accuracy (`repetitions = 100` means that accuracy is
@@ -17906,6 +19572,10 @@ static const char *__doc_fiction_time_to_solution_stats_single_runtime_exact =
 R"doc(Single simulation runtime of the exact ground state simulation
 algorithm.)doc";
 
+static const char *__doc_fiction_time_to_solution_stats_single_runtimes =
+R"doc(Runtimes of all single *QuickSim* runs in seconds in the order of
+their repetitions.)doc";
+
 static const char *__doc_fiction_time_to_solution_stats_time_to_solution = R"doc(Time-to-solution in seconds.)doc";
 
 static const char *__doc_fiction_transition_type =
@@ -18159,6 +19829,72 @@ Template parameter ``Lyt``:
 Returns:
     USE clocking scheme.)doc";
 
+static const char *__doc_fiction_verify_qca_layout_by_simulation =
+R"doc(Checks whether a QCA cell-level layout implements the given
+specification network by simulating all input patterns of the layout
+using `bistable_qca_simulation` and comparing the resulting output
+functions to the ones of `spec`. The specification can, e.g., be the
+gate-level layout from which the cell-level layout was created.
+
+Input and output cells are matched with the primary inputs and outputs
+of `spec` by their names. If the names do not match uniquely, input
+and output cells are considered in row-major order instead.
+
+Template parameter ``Lyt``:
+    QCA cell-level layout type.
+
+Template parameter ``Ntk``:
+    Logic network type.
+
+Parameter ``lyt``:
+    The layout to verify.
+
+Parameter ``spec``:
+    The specification.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    `true` iff `lyt` implements `spec` according to the simulation.)doc";
+
+static const char *__doc_fiction_verify_sidb_layout_by_hierarchical_simulation =
+R"doc(Checks whether an SiDB circuit implements the gate-level layout it was
+obtained from by simulating it with `hierarchical_sidb_simulation` and
+comparing the resulting output functions to the ones of the gate-level
+layout.
+
+Template parameter ``GateLibrary``:
+    Tile-based SiDB gate library that was applied to `gate_lyt`, e.g.,
+    `sidb_bestagon_library`.
+
+Template parameter ``GateLyt``:
+    Pointy-top hexagonal gate-level layout type.
+
+Template parameter ``CellLyt``:
+    SiDB cell-level layout type.
+
+Parameter ``gate_lyt``:
+    The gate-level layout that specifies the tiling and the expected
+    functions.
+
+Parameter ``cell_lyt``:
+    The SiDB cell-level layout obtained from `gate_lyt` via
+    `apply_gate_library`.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.
+
+Returns:
+    `true` iff all output states are defined and `cell_lyt` implements
+    the functions of `gate_lyt`.)doc";
+
 static const char *__doc_fiction_vertex_coloring =
 R"doc(A vertex coloring is simply a hash map from vertex IDs to Color types
 where Color should be constructible/convertible from int.
@@ -18218,6 +19954,20 @@ Parameter ``pst``:
 
 static const char *__doc_fiction_wiring_reduction_params = R"doc(Parameters for the wiring reduction algorithm.)doc";
 
+static const char *__doc_fiction_wiring_reduction_params_incremental =
+R"doc(Apply the cuts in place. Instead of computing a dense offset matrix and
+shifting every tile of the layout with the help of a full copy, only
+the tiles that are actually shifted are visited and their incoming
+data flow is recorded beforehand. Furthermore, search directions are
+skipped if the layout has not changed since their last unsuccessful
+search. The resulting layout is identical to the one obtained without
+this option.
+
+@note This option only reduces the cost of applying the cuts. Each
+search round still creates the obstruction layout of its search
+direction from scratch and computes the bounding box of the layout,
+both of which take time linear in the layout area.)doc";
+
 static const char *__doc_fiction_wiring_reduction_params_timeout =
 R"doc(Timeout limit (in ms). Specifies the maximum allowed time in
 milliseconds for the optimization process. For large layouts, the
@@ -18524,6 +20274,12 @@ supported exclusively so far.
 The utilized color scheme is based on the standard scheme used in
 QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/).
 
+The SVG is streamed into `os`. Identical tiles (or cells in cell-based
+layouts) are defined only once as a symbol in the SVG's `<defs>`
+section and instantiated via `<use>` elements. Hence, file size and
+memory consumption scale with the number of distinct tiles rather than
+with the number of cells.
+
 May throw an `unsupported_cell_type_exception` if it encounters
 unsupported cell types in the layout.
 
@@ -18729,6 +20485,47 @@ Parameter ``filename``:
     The file name to create and write into. Should preferably use the
     `.xml` extension.)doc";
 
+static const char *__doc_fiction_write_technology_network_cache =
+R"doc(Writes a technology network into a compact binary format that can be
+restored via `read_technology_network_cache` considerably faster than
+the network could be parsed from its original source file. It
+preserves the network's structure including the order of its primary
+inputs, gates, and primary outputs as well as its network name, signal
+names, and output names if `Ntk` provides them.
+
+The format stores all values in the host's byte order. It is,
+therefore, intended for caching purposes only and not as an exchange
+format between different machines.
+
+May throw a `technology_network_cache_error` if a gate has more than
+`TECHNOLOGY_NETWORK_CACHE_MAX_FANIN_SIZE` inputs.
+
+This overload uses an output stream to write into.
+
+Template parameter ``Ntk``:
+    Technology network type, e.g., `tec_nt`.
+
+Parameter ``ntk``:
+    The network to be written.
+
+Parameter ``os``:
+    The output stream to write into. Should be opened in binary mode.)doc";
+
+static const char *__doc_fiction_write_technology_network_cache_2 =
+R"doc(Writes a technology network into a compact binary format that can be
+restored via `read_technology_network_cache`.
+
+This overload uses a file name to create and write into.
+
+Template parameter ``Ntk``:
+    Technology network type, e.g., `tec_nt`.
+
+Parameter ``ntk``:
+    The network to be written.
+
+Parameter ``filename``:
+    The file name to create and write into.)doc";
+
 static const char *__doc_fiction_yen_k_shortest_paths =
 R"doc(Yen's algorithm for finding up to :math:`k` shortest paths without
 loops from a source to a target coordinate. If :math:`k` is larger
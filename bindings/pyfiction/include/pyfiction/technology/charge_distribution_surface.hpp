@@ -69,6 +69,10 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
             "assign_physical_parameters", [](py_cds& cds, fiction::sidb_simulation_parameters params)
             { return cds.assign_physical_parameters(params); }, "params"_a)
         .def("get_phys_params", [](py_cds& cds) { return cds.get_simulation_params(); })
+        .def("assign_interaction_cutoff", &py_cds::assign_interaction_cutoff, "cutoff_radius"_a)
+        .def("get_interaction_cutoff", &py_cds::get_interaction_cutoff)
+        .def("get_local_potential_error_bound", &py_cds::get_local_potential_error_bound)
+        .def("get_system_energy_error_bound", &py_cds::get_system_energy_error_bound)
         .def(
             "charge_exists", [](py_cds& cds, fiction::sidb_charge_state cs) { return cds.charge_exists(cs); }, "cs"_a)
         .def(
@@ -176,7 +180,9 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
 
         .def("get_max_charge_index", &py_cds::get_max_charge_index)
         .def("assign_charge_index", &py_cds::assign_charge_index, "charge_index"_a, "cdc"_a)
-        .def("adjacent_search", &py_cds::adjacent_search, "alpha"_a, "negative_indices"_a)
+        .def("adjacent_search",
+             py::overload_cast<const double, std::vector<uint64_t>&>(&py_cds::adjacent_search), "alpha"_a,
+             "negative_indices"_a)
         .def("assign_global_external_potential", &py_cds::assign_global_external_potential, "potential_value"_a,
              "dependent_cell"_a = fiction::dependent_cell_mode::FIXED)
         .def("is_three_state_simulation_required", &py_cds::is_three_state_simulation_required)
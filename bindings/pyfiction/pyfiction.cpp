@@ -26,6 +26,7 @@
 #include "pyfiction/algorithms/physical_design/wiring_reduction.hpp"
 #include "pyfiction/algorithms/properties/critical_path_length_and_throughput.hpp"
 #include "pyfiction/algorithms/simulation/logic_simulation.hpp"
+#include "pyfiction/algorithms/simulation/qca/bistable_qca_simulation.hpp"
 #include "pyfiction/algorithms/simulation/sidb/calculate_energy_and_state_type.hpp"
 #include "pyfiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp"
 #include "pyfiction/algorithms/simulation/sidb/compute_operational_ratio.hpp"
@@ -43,6 +44,7 @@
 #include "pyfiction/algorithms/simulation/sidb/convert_potential_to_distance.hpp"
 #include "pyfiction/algorithms/simulation/sidb/determine_groundstate_from_simulation_results.hpp"
 #include "pyfiction/algorithms/simulation/sidb/displacement_robustness_domain.hpp"
+#include "pyfiction/algorithms/simulation/sidb/hierarchical_sidb_simulation.hpp"
 #include "pyfiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "pyfiction/algorithms/simulation/sidb/occupation_probability_of_excited_states.hpp"
 #include "pyfiction/algorithms/simulation/sidb/operational_domain.hpp"
@@ -126,6 +128,7 @@ PYBIND11_MODULE(pyfiction, m)
      * Algorithms: Simulation
      */
     pyfiction::logic_simulation(m);
+    pyfiction::bistable_qca_simulation(m);
     pyfiction::sidb_simulation_engine(m);
     pyfiction::sidb_simulation_parameters(m);
     pyfiction::sidb_simulation_result(m);
@@ -153,6 +156,7 @@ PYBIND11_MODULE(pyfiction, m)
     pyfiction::determine_physically_valid_parameters(m);
     pyfiction::determine_displacement_robustness_domain(m);
     pyfiction::compute_operational_ratio(m);
+    pyfiction::hierarchical_sidb_simulation(m);
     /**
      * Algorithms: Iterators
      */
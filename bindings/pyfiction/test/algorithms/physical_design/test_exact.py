@@ -39,6 +39,22 @@ class TestExactCartesianPhysicalDesign(unittest.TestCase):
 
         self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
 
+    @unittest.skipIf(z3 == "OFF", "Z3 not enabled")
+    def test_exact_with_portfolio(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        params = exact_params()
+        params.crossings = True
+        params.num_threads = 2
+        params.portfolio = exact_solver_portfolio(2)
+
+        stats = exact_stats()
+
+        layout = exact_cartesian(network, params, stats)
+
+        self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+        self.assertEqual(len(stats.thread_stats), 2)
+
 
 class TestExactHexagonalPhysicalDesign(unittest.TestCase):
 
@@ -57,6 +57,7 @@ class TestGraphOrientedLayoutDesign(unittest.TestCase):
         params.planar = False
         params.cost = gold_cost_objective.WIRES
         params.enable_multithreading = False
+        params.num_layout_snapshots = 4
 
         layout = graph_oriented_layout_design(network, params)
 
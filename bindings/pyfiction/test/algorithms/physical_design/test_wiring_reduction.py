@@ -75,6 +75,22 @@ class TestWiringReduction(unittest.TestCase):
         self.assertEqual(stats.wiring_improvement, 28.57)
         self.assertEqual(stats.area_improvement, 37.50)
 
+    def test_wiring_reduction_incremental(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        layout = orthogonal(network)
+
+        params = wiring_reduction_params()
+        params.incremental = True
+
+        stats = wiring_reduction_stats()
+        wiring_reduction(layout, params, stats)
+
+        self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+        self.assertEqual(stats.x_size_after, 6)
+        self.assertEqual(stats.y_size_after, 5)
+        self.assertEqual(stats.num_wires_after, 15)
+
 
 if __name__ == '__main__':
     unittest.main()
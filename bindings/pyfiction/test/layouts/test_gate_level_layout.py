@@ -234,6 +234,33 @@ class TestCartesianGateLevelLayout(unittest.TestCase):
             # po
             self.assertTrue(layout.is_po(layout.get_node((1, 2))))
 
+    def test_gate_level_layout_fanout_index(self):
+
+        for layout in [cartesian_gate_layout((2, 2, 0), "2DDWave", "Layout"),
+                       shifted_cartesian_gate_layout((2, 2, 0), "2DDWave", "Layout"),
+                       hexagonal_gate_layout((2, 2, 0), "2DDWave", "Layout")]:
+            self.assertFalse(layout.has_fanout_index())
+            layout.enable_fanout_index()
+            self.assertTrue(layout.has_fanout_index())
+
+            x1 = layout.create_pi("x1", (0, 0))
+            fanout = layout.create_buf(x1, (1, 0))
+            layout.create_po(fanout, "f1", (2, 0))
+            layout.create_po(fanout, "f2", (1, 1))
+
+            self.assertEqual(layout.fanout_size(layout.get_node((1, 0))), 2)
+            self.assertTrue(layout.is_fanout(layout.get_node((1, 0))))
+            self.assertEqual(len(layout.fanouts((1, 0))), 2)
+
+            layout.clear_tile((1, 1))
+
+            self.assertEqual(layout.fanout_size(layout.get_node((1, 0))), 1)
+            self.assertEqual(layout.fanouts((1, 0)), [offset_coordinate((2, 0))])
+
+            layout.disable_fanout_index()
+            self.assertFalse(layout.has_fanout_index())
+            self.assertEqual(layout.fanout_size(layout.get_node((1, 0))), 1)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -58,6 +58,9 @@ class read_command : public command
         add_flag("--sqd,-s", "Parse SQD file as SiDB cell-level layout");
         add_flag("--fqca,-q", "Parse FQCA file as QCA cell-level layout");
         add_flag("--sort", sort, "Sort networks in given directory by node count prior to storing them");
+        add_flag("--parallel,-p", reader_ps.parallel, "Parse the files in given directory concurrently");
+        add_option("--cache,-c", reader_ps.cache_directory,
+                   "Directory in which parsed technology networks are cached to speed up subsequent reads");
     }
 
   protected:
@@ -98,25 +101,25 @@ class read_command : public command
             {
                 if (is_set("aig"))
                 {
-                    fiction::network_reader<fiction::aig_ptr> reader{filename, env->out()};
+                    fiction::network_reader<fiction::aig_ptr> reader{filename, env->out(), reader_ps};
 
                     store_ntks(reader);
                 }
                 if (is_set("xag"))
                 {
-                    fiction::network_reader<fiction::xag_ptr> reader{filename, env->out()};
+                    fiction::network_reader<fiction::xag_ptr> reader{filename, env->out(), reader_ps};
 
                     store_ntks(reader);
                 }
                 if (is_set("mig"))
                 {
-                    fiction::network_reader<fiction::mig_ptr> reader{filename, env->out()};
+                    fiction::network_reader<fiction::mig_ptr> reader{filename, env->out(), reader_ps};
 
                     store_ntks(reader);
                 }
                 if (is_set("tec"))
                 {
-                    fiction::network_reader<fiction::tec_ptr> reader{filename, env->out()};
+                    fiction::network_reader<fiction::tec_ptr> reader{filename, env->out(), reader_ps};
 
                     store_ntks(reader);
                 }
@@ -287,7 +290,8 @@ class read_command : public command
         }
 
         // reset flags, necessary for some reason... alice bug?
-        sort = false;
+        sort      = false;
+        reader_ps = {};
     }
 
   private:
@@ -303,6 +307,10 @@ class read_command : public command
      * Flag to indicate that files should be sorted by file size.
      */
     bool sort = false;
+    /**
+     * Parameters for reading logic networks.
+     */
+    fiction::network_reader_params reader_ps{};
     /**
      * Identifier of H-Si lattice orientation.
      */
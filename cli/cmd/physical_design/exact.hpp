@@ -14,6 +14,7 @@
 #include <alice/alice.hpp>
 #include <nlohmann/json.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <thread>
 #include <variant>
@@ -50,6 +51,8 @@ class exact_command : public command
 
         add_flag("--async_max,",
                  "Examine as many layout dimensions in parallel as threads are available (beta feature)");
+        add_option("--portfolio,-p", portfolio_size,
+                   "Number of differently configured solvers that race on each layout dimension");
         add_option("--hex", hexagonal_tile_shift,
                    "Use hexagonal tiles and specify tile shift. Possible values are 'odd_row', 'even_row', "
                    "'odd_column', or 'even_column'");
@@ -101,6 +104,11 @@ class exact_command : public command
             }
         }
 
+        if (is_set("portfolio"))
+        {
+            ps.portfolio = fiction::exact_solver_portfolio(portfolio_size);
+        }
+
         if (is_set("timeout"))
         {
             // convert timeout entered in seconds to milliseconds
@@ -176,6 +184,10 @@ class exact_command : public command
      * Tile shift for hexagonal layouts.
      */
     std::string hexagonal_tile_shift{};
+    /**
+     * Number of solver configurations in the portfolio.
+     */
+    std::size_t portfolio_size{1ul};
 
     /**
      * Reset all flags. Necessary for some reason... alice bug?
@@ -184,6 +196,7 @@ class exact_command : public command
     {
         ps                   = fiction::exact_physical_design_params{};
         hexagonal_tile_shift = {};
+        portfolio_size       = 1ul;
     }
 
     template <typename Lyt>
@@ -48,6 +48,9 @@ class optimize_command : public command
                  "During optimization, only relocate gates if the new wiring contains no crossings. For planar "
                  "layouts, the resulting layout will also be planar. If the layout already contains crossings, the "
                  "optimized layout will have the same number of crossings or less.");
+        add_flag("--incremental,-i", psw.incremental,
+                 "Apply the cuts of the wiring reduction in place instead of shifting all tiles via a layout copy "
+                 "(only applicable together with --wiring_reduction_only).");
         add_flag("--verbose,-v", "Be verbose");
         add_option("--timeout,-t", ps.timeout, "Timeout in seconds");
     }
@@ -38,6 +38,9 @@ class equiv_command : public command
     {
         add_flag("--logic_network,-n", "Perform equivalence checking with a logic network");
         add_flag("--gate_layout,-g", "Perform equivalence checking with a gate-level layout");
+        add_flag("--partition,-p",
+                 "Find counter examples by random simulation first and prove each primary output separately in "
+                 "parallel");
     }
 
   protected:
@@ -47,6 +50,12 @@ class equiv_command : public command
     void execute() override
     {
         result = {};
+        ps     = {};
+
+        if (is_set("partition"))
+        {
+            ps.mode = fiction::equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED;
+        }
 
         if (is_set("logic_network") && is_set("gate_layout"))
         {
@@ -116,13 +125,18 @@ class equiv_command : public command
     }
 
   private:
+    /**
+     * Parameters.
+     */
+    fiction::equivalence_checking_params ps{};
+
     fiction::equivalence_checking_stats result{};
 
     template <typename NtkOrLytVariant1, typename NtkOrLytVariant2>
     void equivalence_checking(const NtkOrLytVariant1& ntk_or_lyt_variant1, const NtkOrLytVariant2& ntk_or_lyt_variant_2)
     {
         const auto equiv_check = [this](auto&& ntk_or_lyt_ptr1, auto&& ntk_or_lyt_ptr2)
-        { fiction::equivalence_checking(*ntk_or_lyt_ptr1, *ntk_or_lyt_ptr2, &result); };
+        { fiction::equivalence_checking(*ntk_or_lyt_ptr1, *ntk_or_lyt_ptr2, ps, &result); };
 
         const auto get_name = [](auto&& ntk_or_lyt_ptr) -> std::string { return fiction::get_name(*ntk_or_lyt_ptr); };
 
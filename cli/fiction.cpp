@@ -1,3 +1,7 @@
+#if (FICTION_EXPLICIT_INSTANTIATIONS)
+#include <fiction/instantiations.hpp>
+#endif
+
 #include "commands.hpp"
 #include "stores.hpp"
 
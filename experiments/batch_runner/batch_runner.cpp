@@ -0,0 +1,209 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include "fiction_experiments.hpp"
+
+#include <fiction/algorithms/network_transformation/technology_mapping.hpp>  // technology mapping
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>       // layout conversion to cell-level
+#include <fiction/algorithms/physical_design/graph_oriented_layout_design.hpp>  // graph-oriented layout design algorithm
+#include <fiction/algorithms/physical_design/orthogonal.hpp>                // scalable heuristic for physical design
+#include <fiction/algorithms/physical_design/post_layout_optimization.hpp>  // post-layout optimization
+#include <fiction/algorithms/properties/critical_path_length_and_throughput.hpp>  // critical path and throughput calculations
+#include <fiction/algorithms/verification/equivalence_checking.hpp>               // SAT-based equivalence checking
+#include <fiction/io/network_reader.hpp>                                          // read networks from files
+#include <fiction/layouts/bounding_box.hpp>                                       // calculate area of generated layouts
+#include <fiction/technology/area.hpp>                                            // area requirement calculations
+#include <fiction/technology/qca_one_library.hpp>                                 // a pre-defined QCA gate library
+#include <fiction/types.hpp>                                                      // types suitable for the FCN domain
+#include <fiction/utils/batch_runner.hpp>                                         // pipelines over benchmark sets
+
+#if (FICTION_Z3_SOLVER)
+#include <fiction/algorithms/physical_design/exact.hpp>  // SMT-based physical design of FCN layouts
+#endif
+
+#include <fmt/format.h>                      // output formatting
+#include <mockturtle/views/depth_view.hpp>  // to determine network levels
+#include <nlohmann/json.hpp>                // JSON records
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// usage: batch_runner [ortho|gold|exact] [number of jobs] [stage timeout in sec] [memory limit in MiB]
+int main(int argc, char* argv[])  // NOLINT
+{
+    using gate_lyt =
+        fiction::gate_level_layout<fiction::clocked_layout<fiction::tile_based_layout<fiction::cartesian_layout<>>>>;
+    using cell_lyt = fiction::qca_cell_clk_lyt;
+
+    // data handed from stage to stage
+    struct pipeline_state
+    {
+        std::optional<fiction::tec_nt> network{};
+        std::optional<fiction::tec_nt> mapped_network{};
+        std::optional<gate_lyt>        gate_level_layout{};
+        std::optional<cell_lyt>        cell_level_layout{};
+    };
+
+    const std::string physical_design = argc > 1 ? argv[1] : "ortho";  // NOLINT
+
+    fiction::batch_runner_params runner_params{};
+    runner_params.num_jobs          = argc > 2 ? std::stoull(argv[2]) : std::thread::hardware_concurrency();  // NOLINT
+    runner_params.stage_timeout     = (argc > 3 ? std::stoull(argv[3]) : 600ull) * 1000ull;                  // NOLINT
+    runner_params.memory_limit      = argc > 4 ? std::stoull(argv[4]) : 0ull;                                // NOLINT
+    runner_params.isolate_processes = true;
+
+    static constexpr const uint64_t bench_select = fiction_experiments::trindade16 | fiction_experiments::fontes18 |
+                                                   fiction_experiments::iscas85 | fiction_experiments::epfl;
+
+    const auto layout_metrics = [](const gate_lyt& lyt)
+    {
+        const auto bounding_box = fiction::bounding_box_2d(lyt);
+        const auto width        = bounding_box.get_x_size() + 1;
+        const auto height       = bounding_box.get_y_size() + 1;
+        const auto cp_tp        = fiction::critical_path_length_and_throughput(lyt);
+
+        return nlohmann::json{{"width", width},
+                              {"height", height},
+                              {"area", width * height},
+                              {"gates", lyt.num_gates()},
+                              {"wires", lyt.num_wires()},
+                              {"critical_path", cp_tp.critical_path_length},
+                              {"throughput", cp_tp.throughput}};
+    };
+
+    using context = fiction::batch_stage_context;
+
+    const std::vector<fiction::batch_stage<pipeline_state>> pipeline{
+        {"read",
+         [](pipeline_state& state, const context& ctx)
+         {
+             std::ostringstream                        os{};
+             fiction::network_reader<fiction::tec_ptr> reader{fiction_experiments::benchmark_path(ctx.benchmark), os};
+
+             const auto nets = reader.get_networks();
+
+             if (nets.empty())
+             {
+                 throw fiction::batch_stage_error(os.str());
+             }
+
+             state.network = *nets.front();
+
+             mockturtle::depth_view depth_network{*state.network};
+
+             return nlohmann::json{{"inputs", state.network->num_pis()},
+                                   {"outputs", state.network->num_pos()},
+                                   {"gates", state.network->num_gates()},
+                                   {"depth", depth_network.depth()}};
+         }},
+        {"map",
+         [](pipeline_state& state, const context&)
+         {
+             // QCA ONE implements AND, OR, and inverters
+             state.mapped_network = fiction::technology_mapping(*state.network, fiction::and_or_not());
+
+             mockturtle::depth_view depth_network{*state.mapped_network};
+
+             return nlohmann::json{{"gates", state.mapped_network->num_gates()}, {"depth", depth_network.depth()}};
+         }},
+        {physical_design,
+         [&physical_design, &layout_metrics](pipeline_state& state, const context& ctx)
+         {
+             if (physical_design == "ortho")
+             {
+                 state.gate_level_layout = fiction::orthogonal<gate_lyt>(*state.mapped_network);
+             }
+             else if (physical_design == "gold")
+             {
+                 fiction::graph_oriented_layout_design_params ps{};
+                 if (ctx.timeout != 0)
+                 {
+                     ps.timeout = ctx.timeout;
+                 }
+
+                 state.gate_level_layout =
+                     fiction::graph_oriented_layout_design<gate_lyt>(*state.mapped_network, ps);
+             }
+#if (FICTION_Z3_SOLVER)
+             else if (physical_design == "exact")
+             {
+                 fiction::exact_physical_design_params ps{};
+                 ps.scheme    = "2DDWave";
+                 ps.crossings = true;
+                 ps.border_io = true;
+                 if (ctx.timeout != 0)
+                 {
+                     ps.timeout = static_cast<unsigned>(ctx.timeout);
+                 }
+
+                 state.gate_level_layout = fiction::exact<gate_lyt>(*state.mapped_network, ps);
+             }
+#endif
+             else
+             {
+                 throw fiction::batch_stage_error(
+                     fmt::format("unsupported physical design algorithm: {}", physical_design));
+             }
+
+             if (!state.gate_level_layout.has_value())
+             {
+                 throw fiction::batch_stage_error("no layout found");
+             }
+
+             return layout_metrics(*state.gate_level_layout);
+         }},
+        {"post_layout_optimization",
+         [&layout_metrics](pipeline_state& state, const context& ctx)
+         {
+             fiction::post_layout_optimization_params ps{};
+             if (ctx.timeout != 0)
+             {
+                 ps.timeout = ctx.timeout;
+             }
+
+             fiction::post_layout_optimization(*state.gate_level_layout, ps);
+
+             return layout_metrics(*state.gate_level_layout);
+         }},
+        {"apply_gate_library",
+         [](pipeline_state& state, const context&)
+         {
+             state.cell_level_layout =
+                 fiction::apply_gate_library<cell_lyt, fiction::qca_one_library>(*state.gate_level_layout);
+
+             fiction::area_params<fiction::qca_technology> ps{};
+
+             return nlohmann::json{{"cells", state.cell_level_layout->num_cells()},
+                                   {"area_nm2", fiction::area(*state.cell_level_layout, ps)}};
+         }},
+        {"verify",
+         [](pipeline_state& state, const context&)
+         {
+             // SAT-based equivalence checking of the gate-level layout against its specification
+             const auto eq = fiction::equivalence_checking(*state.network, *state.gate_level_layout);
+
+             if (eq == fiction::eq_type::NO)
+             {
+                 throw fiction::batch_stage_error("layout is not equivalent to its specification");
+             }
+
+             return nlohmann::json{{"equivalence", eq == fiction::eq_type::STRONG ? "STRONG" : "WEAK"}};
+         }}};
+
+    std::ofstream jsonl_file{fmt::format("batch_runner_{}.jsonl", physical_design)};
+    std::ofstream csv_file{fmt::format("batch_runner_{}.csv", physical_design)};
+
+    fiction::batch_record_writer writer{jsonl_file, &csv_file};
+    fiction::batch_runner        runner{pipeline, runner_params};
+
+    runner.run(fiction_experiments::all_benchmarks(bench_select), writer);
+
+    return EXIT_SUCCESS;
+}
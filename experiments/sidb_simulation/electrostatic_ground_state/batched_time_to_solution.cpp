@@ -0,0 +1,245 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include "fiction_experiments.hpp"
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp>
+#include <fiction/algorithms/simulation/sidb/time_to_solution.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/technology/sidb_nm_distance.hpp>
+#include <fiction/types.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace fiction;
+
+using Lyt = sidb_100_cell_clk_lyt_siqad;
+
+/**
+ * Generates a random SiDB layout from the given random number generator such that the benchmark set can be reproduced
+ * from its seed. SiDBs are placed uniformly at random in the given area while keeping a minimum distance to each
+ * other.
+ */
+static Lyt generate_seeded_layout(std::mt19937_64& generator, const uint64_t num_sidbs, const int32_t width,
+                                  const int32_t height)
+{
+    static constexpr const double min_distance = 0.75;  // unit: nm
+
+    std::uniform_int_distribution<int32_t> x_dist{0, width};
+    std::uniform_int_distribution<int32_t> y_dist{0, height};
+    std::uniform_int_distribution<int32_t> z_dist{0, 1};
+
+    Lyt lyt{};
+
+    std::vector<cell<Lyt>> sidbs{};
+
+    while (sidbs.size() < num_sidbs)
+    {
+        const cell<Lyt> c{x_dist(generator), y_dist(generator), z_dist(generator)};
+
+        if (std::all_of(sidbs.cbegin(), sidbs.cend(),
+                        [&lyt, &c](const auto& s) { return sidb_nm_distance<Lyt>(lyt, s, c) >= min_distance; }))
+        {
+            lyt.assign_cell_type(c, Lyt::cell_type::NORMAL);
+            sidbs.push_back(c);
+        }
+    }
+
+    return lyt;
+}
+
+/**
+ * Determines the given quantile of a runtime distribution.
+ */
+static double quantile(std::vector<double> runtimes, const double q)
+{
+    if (runtimes.empty())
+    {
+        return 0.0;
+    }
+
+    const auto k = static_cast<std::size_t>(q * static_cast<double>(runtimes.size() - 1));
+
+    std::nth_element(runtimes.begin(), runtimes.begin() + static_cast<std::ptrdiff_t>(k), runtimes.end());
+
+    return runtimes[k];
+}
+
+/**
+ * Batched time-to-solution (TTS) benchmark of *QuickSim*. For each layout, the exact reference simulation is run once
+ * and reused for all *QuickSim* parameter variants, whose repetitions are run in parallel. For each layout and variant,
+ * the TTS, the accuracy, and the runtime distribution of single *QuickSim* runs are reported together with the seed
+ * that reproduces them.
+ *
+ * Command-line Options:
+ *   --layouts <path>           Folder of .sqd files to benchmark. If empty, random layouts are generated instead.
+ *   --num_layouts <value>      Number of random layouts to generate.
+ *   --num_sidbs <value>        Number of SiDBs of each random layout.
+ *   --width <value>            Width of the area of random layouts in SiQAD coordinates.
+ *   --height <value>           Height of the area of random layouts in SiQAD coordinates.
+ *   --seed <value>             Seed for the random layouts and all QuickSim runs.
+ *   --repetitions <value>      Number of QuickSim runs per layout and variant.
+ *   --threads <value>          Number of threads that run the QuickSim repetitions (0: all hardware threads).
+ *   --engine <name>            Exact reference simulator, i.e., "QuickExact" or "ExGS".
+ *
+ * Example Usage:
+ *   ./batched_time_to_solution --layouts ../random_sidb_layouts/ --repetitions 200 --threads 16
+ */
+int main(int argc, const char* argv[])  // NOLINT
+{
+    std::unordered_map<std::string, std::string> options{{"--layouts", ""},
+                                                         {"--num_layouts", "20"},
+                                                         {"--num_sidbs", "15"},
+                                                         {"--width", "30"},
+                                                         {"--height", "15"},
+                                                         {"--seed", "42"},
+                                                         {"--repetitions", "100"},
+                                                         {"--threads", "0"},
+                                                         {"--engine", "QuickExact"}};
+
+    const std::vector<std::string> arguments(argv + 1, argv + argc);
+
+    for (std::size_t i = 0; i < arguments.size(); ++i)
+    {
+        if (options.count(arguments[i]) == 0)
+        {
+            std::cerr << fmt::format("Error: Unknown argument {}\n", arguments[i]);
+            return EXIT_FAILURE;
+        }
+        if (i + 1 >= arguments.size())
+        {
+            std::cerr << fmt::format("Error: Argument {} is missing a value\n", arguments[i]);
+            return EXIT_FAILURE;
+        }
+
+        options[arguments[i]] = arguments[i + 1];
+        ++i;
+    }
+
+    const uint64_t seed        = std::stoull(options["--seed"]);
+    const uint64_t repetitions = std::stoull(options["--repetitions"]);
+    // 0 selects the number of available hardware threads
+    const uint64_t num_threads = std::stoull(options["--threads"]) == 0 ?
+                                     std::max(std::thread::hardware_concurrency(), 1u) :
+                                     std::stoull(options["--threads"]);
+    const bool     use_exgs    = options["--engine"] == "ExGS";
+
+    // collect the layouts to benchmark
+    std::vector<std::pair<std::string, Lyt>> layouts{};
+
+    try
+    {
+        if (!options["--layouts"].empty())
+        {
+            std::vector<std::filesystem::path> files{};
+            for (const auto& entry : std::filesystem::directory_iterator(options["--layouts"]))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".sqd")
+                {
+                    files.push_back(entry.path());
+                }
+            }
+
+            // process the files in a deterministic order
+            std::sort(files.begin(), files.end());
+
+            for (const auto& file : files)
+            {
+                layouts.emplace_back(file.stem().string(), read_sqd_layout<Lyt>(file.string()));
+            }
+        }
+        else
+        {
+            std::mt19937_64 generator{seed};
+
+            const uint64_t num_sidbs = std::stoull(options["--num_sidbs"]);
+            const auto     width     = std::stoi(options["--width"]);
+            const auto     height    = std::stoi(options["--height"]);
+
+            for (uint64_t i = 0; i < std::stoull(options["--num_layouts"]); ++i)
+            {
+                layouts.emplace_back(fmt::format("random_{}_{}", seed, i),
+                                     generate_seeded_layout(generator, num_sidbs, width, height));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << fmt::format("Error: {}\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    experiments::experiment<std::string, uint64_t, uint64_t, double, double, double, double, double, double, double,
+                            double, uint64_t>
+        tts_exp{"batched_time_to_solution",
+                "Layout",
+                "#SiDBs",
+                "#Iterations",
+                "alpha",
+                "t_exact [s]",
+                "acc [%]",
+                "TTS [s]",
+                "t_mean [s]",
+                "t_min [s]",
+                "t_median [s]",
+                "t_p95 [s]",
+                "Seed"};
+
+    const sidb_simulation_parameters sim_params{2, -0.32};
+
+    // QuickSim parameter variants that share the exact reference simulation of each layout
+    static const std::vector<std::pair<uint64_t, double>> variants{{40, 0.4}, {40, 0.7}, {80, 0.4}, {80, 0.7}};
+
+    time_to_solution_params tts_params{};
+    tts_params.repetitions = repetitions;
+    tts_params.num_threads = num_threads;
+
+    for (const auto& [name, layout] : layouts)
+    {
+        const auto exact_result =
+            use_exgs ?
+                exhaustive_ground_state_simulation(
+                    layout, exhaustive_ground_state_simulation_params{
+                                sim_params, exhaustive_ground_state_simulation_params::result_mode::GROUND_STATES_ONLY,
+                                num_threads}) :
+                quickexact(layout, quickexact_params<cell<Lyt>>{sim_params});
+
+        for (const auto& [iteration_steps, alpha] : variants)
+        {
+            // each QuickSim run is single-threaded since the repetitions are already run in parallel
+            quicksim_params qs_params{sim_params, iteration_steps, alpha, 1};
+            qs_params.seed = seed;
+
+            time_to_solution_stats st{};
+            time_to_solution(layout, exact_result, qs_params, tts_params, &st);
+
+            tts_exp(name, layout.num_cells(), iteration_steps, alpha, st.single_runtime_exact, st.acc,
+                    st.time_to_solution, st.mean_single_runtime, quantile(st.single_runtimes, 0.0),
+                    quantile(st.single_runtimes, 0.5), quantile(st.single_runtimes, 0.95), seed);
+        }
+
+        tts_exp.save();
+        tts_exp.table();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -15,8 +15,13 @@
 #include <mockturtle/io/genlib_reader.hpp>
 #include <mockturtle/utils/tech_library.hpp>
 
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 namespace fiction
@@ -119,6 +124,13 @@ struct technology_mapping_params
      * 3-input AND-XOR gate.
      */
     bool and_xor{false};
+    /**
+     * Reuse compiled technology libraries across calls. Compiling a library, i.e., parsing its gates and computing its
+     * supergates, only depends on the enabled gates and the `decay` flag. If this flag is set, compiled libraries are
+     * stored in a process-wide cache so that mapping many networks with the same gate set only pays for cut
+     * enumeration and covering. See `clear_technology_mapping_library_cache`.
+     */
+    bool cache_library{true};
 };
 /**
  * Auxiliary function to create technology mapping parameters for AND, OR, and NOT gates.
@@ -293,6 +305,10 @@ struct technology_mapping_stats
      * Statistics for mockturtle's mapper.
      */
     mockturtle::map_stats mapper_stats{};
+    /**
+     * `true` iff a previously compiled technology library was reused from the cache.
+     */
+    bool library_cache_hit{false};
     /**
      * Report statistics.
      */
@@ -305,6 +321,102 @@ struct technology_mapping_stats
 namespace detail
 {
 
+/**
+ * Process-wide, thread-safe cache of compiled technology libraries with up to `NumInp` inputs. Libraries are keyed by
+ * a bitmask that encodes the enabled gates of `technology_mapping_params` (see `gate_set_key`) and shared via
+ * `std::shared_ptr` so that they stay valid even if the cache is cleared while a mapping is in progress.
+ *
+ * @tparam NumInp Maximum input number of the gates in the technology library.
+ */
+template <unsigned NumInp>
+class technology_library_cache
+{
+  public:
+    /**
+     * Returns the process-wide cache instance.
+     *
+     * @return The cache for technology libraries with up to `NumInp` inputs.
+     */
+    [[nodiscard]] static technology_library_cache& instance() noexcept
+    {
+        static technology_library_cache cache{};
+
+        return cache;
+    }
+    /**
+     * Returns the library stored under the given key. If there is none, it is compiled from the gates returned by
+     * `create_gates` and stored.
+     *
+     * @tparam GateFactory Functor type that returns a `std::vector<mockturtle::gate>`.
+     * @param key Gate set bitmask.
+     * @param create_gates Functor that creates the gates of the library on a cache miss.
+     * @param hit Is set to `true` iff the library was found in the cache.
+     * @return The compiled technology library.
+     */
+    template <typename GateFactory>
+    [[nodiscard]] std::shared_ptr<const mockturtle::tech_library<NumInp>> get(const uint32_t key,
+                                                                              GateFactory&&  create_gates, bool& hit)
+    {
+        const std::lock_guard lock{mutex};
+
+        if (const auto it = libraries.find(key); it != libraries.cend())
+        {
+            hit = true;
+
+            return it->second;
+        }
+
+        hit = false;
+
+        const auto lib = std::make_shared<const mockturtle::tech_library<NumInp>>(create_gates());
+        libraries.emplace(key, lib);
+
+        return lib;
+    }
+    /**
+     * Removes all libraries from the cache.
+     */
+    void clear() noexcept
+    {
+        const std::lock_guard lock{mutex};
+
+        libraries.clear();
+    }
+
+  private:
+    /**
+     * Mutex to protect the cache.
+     */
+    std::mutex mutex{};
+    /**
+     * Compiled technology libraries by gate set bitmask.
+     */
+    std::unordered_map<uint32_t, std::shared_ptr<const mockturtle::tech_library<NumInp>>> libraries{};
+};
+/**
+ * Encodes the gate set described by the given technology mapping parameters as a bitmask. Two parameter sets with the
+ * same bitmask produce identical technology libraries.
+ *
+ * @param params Technology mapping parameters.
+ * @return Gate set bitmask.
+ */
+[[nodiscard]] inline uint32_t gate_set_key(const technology_mapping_params& params) noexcept
+{
+    const std::array<bool, 21> flags{
+        {params.decay, params.inv, params.and2, params.nand2, params.or2, params.nor2, params.xor2, params.xnor2,
+         params.lt2, params.gt2, params.le2, params.ge2, params.and3, params.xor_and, params.or_and, params.onehot,
+         params.maj3, params.gamble, params.dot, params.mux, params.and_xor}};
+
+    uint32_t key = 0;
+
+    for (auto i = 0u; i < flags.size(); ++i)
+    {
+        key |= static_cast<uint32_t>(flags[i]) << i;
+    }
+
+    return key;
+}
+
 template <typename Ntk>
 class technology_mapping_impl
 {
@@ -317,22 +429,20 @@ class technology_mapping_impl
 
     tec_nt run()
     {
-        const auto gate_library = set_up_gates();
-
         tec_nt mapped_ntk{};
 
         if (params.maj3 || params.dot || params.and3 || params.xor_and || params.or_and || params.onehot ||
             params.gamble || params.mux || params.and_xor)
         {
-            mapped_ntk = perform_mapping<3>(gate_library);
+            mapped_ntk = perform_mapping<3>();
         }
         else if (params.and2 || params.nand2 || params.or2 || params.nor2 || params.xor2 || params.xnor2)
         {
-            mapped_ntk = perform_mapping<2>(gate_library);
+            mapped_ntk = perform_mapping<2>();
         }
         else if (params.inv)
         {
-            mapped_ntk = perform_mapping<1>(gate_library);
+            mapped_ntk = perform_mapping<1>();
         }
 
         return mapped_ntk;
@@ -501,19 +611,37 @@ class technology_mapping_impl
 
         return gates;
     }
+    /**
+     * Compiles the technology library with the given number of inputs or fetches it from the cache.
+     *
+     * @tparam NumInp Maximum input number of the gates in the technology library.
+     * @return Compiled technology library.
+     */
+    template <unsigned NumInp>
+    [[nodiscard]] std::shared_ptr<const mockturtle::tech_library<NumInp>> set_up_library() const
+    {
+        if (params.cache_library)
+        {
+            return technology_library_cache<NumInp>::instance().get(
+                gate_set_key(params), [this] { return set_up_gates(); }, stats.library_cache_hit);
+        }
+
+        stats.library_cache_hit = false;
+
+        return std::make_shared<const mockturtle::tech_library<NumInp>>(set_up_gates());
+    }
     /**
      * Perform technology mapping with the given number of inputs.
      *
      * @tparam NumInp Maximum input number of the gates in the technology library.
-     * @param gates Technology library.
      * @return Mapped network.
      */
     template <unsigned NumInp>
-    [[nodiscard]] tec_nt perform_mapping(const std::vector<mockturtle::gate>& gates) const noexcept
+    [[nodiscard]] tec_nt perform_mapping() const
     {
-        mockturtle::tech_library<NumInp> lib{gates};
+        const auto lib = set_up_library<NumInp>();
 
-        const auto mapped_ntk = mockturtle::map(ntk, lib, params.mapper_params, &stats.mapper_stats);
+        const auto mapped_ntk = mockturtle::map(ntk, *lib, params.mapper_params, &stats.mapper_stats);
 
         tec_nt converted_ntk{};
 
@@ -530,6 +658,16 @@ class technology_mapping_impl
 
 }  // namespace detail
 
+/**
+ * Removes all compiled technology libraries from the process-wide cache that is used by `technology_mapping` if
+ * `technology_mapping_params::cache_library` is set. Libraries that are in use by running mappings stay valid.
+ */
+inline void clear_technology_mapping_library_cache() noexcept
+{
+    detail::technology_library_cache<1>::instance().clear();
+    detail::technology_library_cache<2>::instance().clear();
+    detail::technology_library_cache<3>::instance().clear();
+}
 /**
  * Performs technology mapping on the given network. Technology mapping is the process of replacing the gates in a
  * network with gates from a given technology library. This function utilizes `mockturtle::map` to perform the
@@ -7,19 +7,19 @@
 
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
+#include "fiction/algorithms/path_finding/search_storage.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
+#include "fiction/utils/instrumentation.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
 
-#include <phmap.h>
-
-#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 #include <type_traits>
-#include <vector>
 
 namespace fiction
 {
@@ -33,23 +33,31 @@ struct a_star_params
      * Allow paths to cross over obstructed tiles if they are occupied by wire segments.
      */
     bool crossings = false;
+    /**
+     * Keep the closed list, g-values, and path origins in dense arrays that are addressed by coordinate index
+     * instead of in hash maps. This is only applicable to bounded layouts with unsigned offset coordinates (see
+     * `is_densely_indexable_coordinate_v`) and is ignored for all other layouts.
+     */
+    bool dense_storage = false;
 };
 
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist, typename Cost>
+template <typename Path, typename Lyt, typename Dist, typename Cost, typename Context>
 class a_star_impl
 {
   public:
     a_star_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const distance_functor<Lyt, Dist>& dist_fn,
-                const cost_functor<Lyt, Cost>& cost_fn, const a_star_params& p) :
+                const cost_functor<Lyt, Cost>& cost_fn, Context& ctx, const a_star_params& p) :
             layout{lyt},
             objective{obj},
             distance{dist_fn},
             cost{cost_fn},
+            context{ctx},
             params{p}
     {
+        context.prepare(layout);
         open_list.push(coordinate_f{objective.source, 0});
     }
 
@@ -66,6 +74,8 @@ class a_star_impl
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
+        FICTION_PROFILE_SCOPE("a_star");
+
         do {
             // get coordinate with lowest f-value
             const auto current = get_lowest_f_coord();
@@ -76,10 +86,11 @@ class a_star_impl
                 return reconstruct_path();
             }
             // don't examine the current coordinate again
-            closed_list.insert(current);
+            storage.close(current);
 
             // expand from current coordinate
             expand(current);
+            FICTION_PROFILE_COUNT("a_star: expansions", 1);
 
         } while (!open_list.empty());  // until the open list is empty
 
@@ -103,6 +114,10 @@ class a_star_impl
      * The cost functor that implements the cost function.
      */
     const cost_functor<Lyt, Cost> cost;
+    /**
+     * Reusable buffers for the search.
+     */
+    Context& context;
     /**
      * Routing parameters.
      */
@@ -112,65 +127,22 @@ class a_star_impl
      * The values used for g and f have a type in accordance with Dist and Cost.
      */
     using g_f_type = std::common_type_t<Dist, Cost>;
+    static_assert(std::is_same_v<typename Context::coordinate_type, coordinate<Lyt>>,
+                  "Context has a different coordinate type than Lyt");
+    static_assert(std::is_same_v<typename Context::value_type, g_f_type>,
+                  "Context has a different value type than std::common_type_t<Dist, Cost>");
     /**
      * Stores a coordinate and its f-value.
      */
-    struct coordinate_f
-    {
-        /**
-         * Coordinate.
-         */
-        coordinate<Lyt> coord;  // cannot be const because operator= is required by std::priority_queue
-        /**
-         * f-value of the coordinate.
-         */
-        g_f_type f;
-
-        /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
-         */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
-        /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
-         */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
-    };
-
-    /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
-     */
-    using a_star_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
+    using coordinate_f = search_frontier_entry<coordinate<Lyt>, g_f_type>;
     /**
      * Open list that contains all coordinates to process next sorted by their f-value.
      */
-    a_star_priority_queue open_list{};
-    /**
-     * Closed list that acts as a set of already visited coordinates.
-     */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
-    /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
-     */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, g_f_type> g_values{};
+    typename Context::open_list_type& open_list{context.open_list()};
     /**
-     * Tracks the origin of each coordinate to recreate the path.
+     * Closed list, g-values, and path origins.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
+    typename Context::storage_type& storage{context.storage()};
     /**
      * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
      *
@@ -241,25 +213,26 @@ class a_star_impl
             // compute the g-value of cz. In this implementation, the costs of each 'step' are given by a function
             const g_f_type tentative_g = g(current) + cost(current, successor);
 
-            // f-value does not matter because the comparator compares only the coordinates
-            const auto it = open_list.find({successor, 0});
-            if (it != open_list.end() && no_improvement(successor, tentative_g))
+            // a coordinate that has a g-value but is not closed is contained in the open list (frontier); this avoids
+            // a linear search through the open list for coordinates that are discovered for the first time
+            const auto in_open_list = storage.has_g(successor);
+            if (in_open_list && no_improvement(successor, tentative_g))
             {
                 return;  // skip the coordinate if it does not offer improvement
             }
 
-            // track origin
-            came_from[successor] = current;
-            set_g(successor, tentative_g);
+            // track origin and update g-value
+            storage.discover(successor, tentative_g, current);
 
             // compute new f-value
             const auto f = tentative_g + static_cast<g_f_type>(distance(layout, successor, objective.target));
 
             // if successor is contained in the open list (frontier)
-            if (it != open_list.end())
+            if (in_open_list)
             {
-                // update its f-value
-                it->f = f;
+                // update its f-value; f-value does not matter for the lookup because the comparator compares only the
+                // coordinates
+                open_list.find({successor, 0})->f = f;
             }
             else
             {
@@ -287,32 +260,17 @@ class a_star_impl
      */
     bool is_visited(const coordinate<Lyt>& c) const noexcept
     {
-        return closed_list.count(c) > 0;
+        return storage.is_closed(c);
     }
     /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
+     * Returns the g-value of a coordinate by accessing the storage. Returns 0 if no entry exists.
      *
      * @param c Coordinate whose g-value is desired.
      * @return g-value of coordinate c or 0 if no value has been stored.
      */
     g_f_type g(const coordinate<Lyt>& c) const noexcept
     {
-        if (const auto it = g_values.find(c); it != g_values.cend())
-        {
-            return it->second;
-        }
-
-        return 0ul;
-    }
-    /**
-     * Updates the g-value of the given coordinate to the given value.
-     *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
-     */
-    void set_g(const coordinate<Lyt>& c, const g_f_type g_val) noexcept
-    {
-        g_values.insert_or_assign(c, g_val);
+        return storage.g(c);
     }
     /**
      * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
@@ -333,23 +291,59 @@ class a_star_impl
      */
     Path reconstruct_path() const noexcept
     {
-        Path path{};
+        auto& reversed_path = context.path_buffer();
 
-        // iterate backwards over the found connections and add them to the path
-        for (auto current = objective.target; current != objective.source; current = came_from.at(current))
+        // iterate backwards over the found connections and add them to the buffer
+        for (auto current = objective.target; current != objective.source; current = storage.origin(current))
         {
-            path.push_back(current);
+            reversed_path.push_back(current);
         }
         // finally, add the source coordinate
-        path.push_back(objective.source);
-        // and reverse the path to bring it in proper order
-        std::reverse(std::begin(path), std::end(path));
+        reversed_path.push_back(objective.source);
 
-        return path;
+        // copy the buffer in reverse to bring the path in proper order with a single allocation
+        return Path(std::crbegin(reversed_path), std::crend(reversed_path));
     }
 };
 }  // namespace detail
 
+/**
+ * The A* path finding algorithm for shortest loop-less paths between a given source and target coordinate in a layout.
+ * See the overload without a search context below for a detailed description.
+ *
+ * This overload performs the search in the given reusable context (see `path_search_context`) instead of allocating
+ * all search data structures anew. This significantly reduces allocator pressure when many paths are determined one
+ * after another. The storage type of the context determines the internal bookkeeping, i.e.,
+ * `a_star_params::dense_storage` is ignored.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @tparam Storage Storage type of the search context.
+ * @param layout The layout in which the shortest path between a source and target coordinate is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param context Reusable search context whose value type is `std::common_type_t<Dist, Cost>`.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t, typename Storage>
+[[nodiscard]] Path a_star(const Lyt& layout, const routing_objective<Lyt>& objective,
+                          path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>& context,
+                          const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                          const cost_functor<Lyt, Cost>&     cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                          const a_star_params&               params  = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using context_type = path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>;
+
+    return detail::a_star_impl<Path, Lyt, Dist, Cost, context_type>{layout, objective, dist_fn, cost_fn, context,
+                                                                    params}
+        .run();
+}
 /**
  * The A* path finding algorithm for shortest loop-less paths between a given source and target coordinate in a layout.
  * This function automatically detects whether the given layout implements a clocking interface (see `clocked_layout`)
@@ -368,6 +362,12 @@ class a_star_impl
  * if the crossing layer is not obstructed. Furthermore, it is ensured that crossings do not run along another wire but
  * cross only in a single point (orthogonal crossings + knock-knees/double wires).
  *
+ * On bounded layouts with unsigned offset coordinates, the internal bookkeeping can be switched from hash maps to
+ * dense, index-addressed arrays via `a_star_params::dense_storage`. This trades memory proportional to the layout's
+ * area for constant-time lookups without hashing, which pays off when many paths are determined on the same layout.
+ * To additionally avoid allocating all search data structures in each call, use the overload that accepts a reusable
+ * `path_search_context`.
+ *
  * In certain cases it might be desirable to determine regular coordinate paths even if the layout implements a clocking
  * interface. This can be achieved by static-casting the layout to a coordinate layout when calling this function:
  * @code{.cpp}
@@ -401,7 +401,21 @@ template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost =
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::a_star_impl<Path, Lyt, Dist, Cost>{layout, objective, dist_fn, cost_fn, params}.run();
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
+    if constexpr (is_densely_indexable_coordinate_v<coordinate<Lyt>>)
+    {
+        if (params.dense_storage)
+        {
+            dense_path_search_context<coordinate<Lyt>, g_f_type> context{};
+
+            return a_star<Path>(layout, objective, context, dist_fn, cost_fn, params);
+        }
+    }
+
+    path_search_context<coordinate<Lyt>, g_f_type> context{};
+
+    return a_star<Path>(layout, objective, context, dist_fn, cost_fn, params);
 }
 /**
  * A distance function that does not approximate but compute the actual minimum path length on the given layout via A*
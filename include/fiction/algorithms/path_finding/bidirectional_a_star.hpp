@@ -0,0 +1,518 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_BIDIRECTIONAL_A_STAR_HPP
+#define FICTION_BIDIRECTIONAL_A_STAR_HPP
+
+#include "fiction/algorithms/path_finding/cost.hpp"
+#include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace fiction
+{
+
+/**
+ * Parameters for the bidirectional A* algorithm.
+ */
+struct bidirectional_a_star_params
+{
+    /**
+     * Keep the closed lists, g-values, and path origins of both search directions in dense arrays that are addressed by
+     * coordinate index instead of in hash maps. This is only applicable to bounded layouts with unsigned offset
+     * coordinates (see `is_densely_indexable_coordinate_v`) and is ignored for all other layouts.
+     */
+    bool dense_storage = false;
+};
+
+namespace detail
+{
+
+template <typename Path, typename Lyt, typename Dist, typename Cost, typename Context>
+class bidirectional_a_star_impl
+{
+  public:
+    bidirectional_a_star_impl(const Lyt& lyt, const routing_objective<Lyt>& obj,
+                              const distance_functor<Lyt, Dist>& dist_fn, const cost_functor<Lyt, Cost>& cost_fn,
+                              Context& forward_ctx, Context& backward_ctx) :
+            layout{lyt},
+            objective{obj},
+            distance{dist_fn},
+            cost{cost_fn},
+            forward_context{forward_ctx},
+            backward_context{backward_ctx}
+    {
+        assert(&forward_context != &backward_context && "Both search directions require their own context");
+
+        forward_context.prepare(layout);
+        backward_context.prepare(layout);
+
+        // the end points are their own origins, which terminates path reconstruction
+        forward_storage.discover(objective.source, 0, objective.source);
+        forward_open_list.push(coordinate_f{objective.source, forward_heuristic(objective.source)});
+
+        backward_storage.discover(objective.target, 0, objective.target);
+        backward_open_list.push(coordinate_f{objective.target, backward_heuristic(objective.target)});
+    }
+
+    /**
+     * Determine the shortest path in a layout that starts at `objective.source` and leads to `objective.target` by
+     * searching from both end points simultaneously.
+     *
+     * @return The shortest path in `layout` from `objective.source` to `objective.target`.
+     */
+    [[nodiscard]] Path run() noexcept
+    {
+        assert(!objective.source.is_dead() && !objective.target.is_dead() &&
+               "Neither source nor target coordinate can be dead");
+
+        assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
+               "Both source and target coordinate have to be within the layout bounds");
+
+        if (objective.source == objective.target)
+        {
+            return Path{objective.source};
+        }
+
+        while (true)
+        {
+            const auto forward_min  = lowest_f(forward_open_list, forward_storage);
+            const auto backward_min = lowest_f(backward_open_list, backward_storage);
+
+            // if one of the frontiers is exhausted, no further paths can be found
+            if (!forward_min.has_value() || !backward_min.has_value())
+            {
+                break;
+            }
+
+            // every path that has not yet been found passes through both frontiers and thus costs at least as much as
+            // the larger of the two lowest f-values; if the best path found so far is not more expensive, it is optimal
+            if (meeting_point.has_value() && best_cost <= std::max(*forward_min, *backward_min))
+            {
+                break;
+            }
+
+            // expand the smaller frontier to keep both search trees balanced
+            if (forward_open_list.size() <= backward_open_list.size())
+            {
+                expand_forward();
+            }
+            else
+            {
+                expand_backward();
+            }
+        }
+
+        return meeting_point.has_value() ? reconstruct_path() : Path{};
+    }
+
+  private:
+    /**
+     * The layout in which the shortest path between `source` and `target` is to be found.
+     */
+    const Lyt& layout;
+    /**
+     * The source-target coordinate pair.
+     */
+    const routing_objective<Lyt> objective;
+    /**
+     * The distance functor that implements the heuristic estimation function.
+     */
+    const distance_functor<Lyt, Dist> distance;
+    /**
+     * The cost functor that implements the cost function.
+     */
+    const cost_functor<Lyt, Cost> cost;
+    /**
+     * Reusable buffers for the search from `source` towards `target`.
+     */
+    Context& forward_context;
+    /**
+     * Reusable buffers for the search from `target` towards `source`.
+     */
+    Context& backward_context;
+
+    /**
+     * The values used for g and f have a type in accordance with Dist and Cost.
+     */
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
+    static_assert(std::is_same_v<typename Context::coordinate_type, coordinate<Lyt>>,
+                  "Context has a different coordinate type than Lyt");
+    static_assert(std::is_same_v<typename Context::value_type, g_f_type>,
+                  "Context has a different value type than std::common_type_t<Dist, Cost>");
+    /**
+     * Stores a coordinate and its f-value.
+     */
+    using coordinate_f = search_frontier_entry<coordinate<Lyt>, g_f_type>;
+    /**
+     * Open list of the forward search.
+     */
+    typename Context::open_list_type& forward_open_list{forward_context.open_list()};
+    /**
+     * Closed list, g-values, and path origins of the forward search.
+     */
+    typename Context::storage_type& forward_storage{forward_context.storage()};
+    /**
+     * Open list of the backward search.
+     */
+    typename Context::open_list_type& backward_open_list{backward_context.open_list()};
+    /**
+     * Closed list, g-values, and path origins of the backward search, where origins point towards `target`.
+     */
+    typename Context::storage_type& backward_storage{backward_context.storage()};
+    /**
+     * Coordinate at which the cheapest path found so far joins the two search trees.
+     */
+    std::optional<coordinate<Lyt>> meeting_point{std::nullopt};
+    /**
+     * Cost of the cheapest path found so far.
+     */
+    g_f_type best_cost{std::numeric_limits<g_f_type>::max()};
+    /**
+     * Heuristic estimation of the remaining costs from a coordinate to `target`.
+     *
+     * @param c Coordinate to estimate.
+     * @return Estimated costs from `c` to `target`.
+     */
+    [[nodiscard]] g_f_type forward_heuristic(const coordinate<Lyt>& c) const noexcept
+    {
+        return static_cast<g_f_type>(distance(layout, c, objective.target));
+    }
+    /**
+     * Heuristic estimation of the remaining costs from `source` to a coordinate.
+     *
+     * @param c Coordinate to estimate.
+     * @return Estimated costs from `source` to `c`.
+     */
+    [[nodiscard]] g_f_type backward_heuristic(const coordinate<Lyt>& c) const noexcept
+    {
+        return static_cast<g_f_type>(distance(layout, objective.source, c));
+    }
+    /**
+     * Discards entries of already closed coordinates from the top of the given open list and returns the lowest
+     * f-value of the remaining ones.
+     *
+     * @param open_list Open list to inspect.
+     * @param storage Storage of the same search direction.
+     * @return Lowest f-value in `open_list` or `std::nullopt` if it does not contain any open coordinates.
+     */
+    [[nodiscard]] static std::optional<g_f_type> lowest_f(typename Context::open_list_type&    open_list,
+                                                          const typename Context::storage_type& storage) noexcept
+    {
+        // coordinates whose f-value has been lowered are contained in the open list multiple times
+        while (!open_list.empty() && storage.is_closed(open_list.top().coord))
+        {
+            open_list.pop();
+        }
+
+        return open_list.empty() ? std::nullopt : std::optional<g_f_type>{open_list.top().f};
+    }
+    /**
+     * Checks whether the given coordinate is obstructed and may therefore not be entered unless it is `end_point`.
+     *
+     * @param c Coordinate to check.
+     * @param end_point Coordinate that may be entered regardless of obstructions.
+     * @return `true` iff `c` is obstructed and not `end_point`.
+     */
+    [[nodiscard]] bool is_blocked([[maybe_unused]] const coordinate<Lyt>& c,
+                                  [[maybe_unused]] const coordinate<Lyt>& end_point) const noexcept
+    {
+        if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+        {
+            return layout.is_obstructed_coordinate(c) && c != end_point;
+        }
+
+        return false;
+    }
+    /**
+     * Checks whether the directed connection from `c1` to `c2` is obstructed.
+     *
+     * @param c1 Start of the connection.
+     * @param c2 End of the connection.
+     * @return `true` iff the connection is obstructed.
+     */
+    [[nodiscard]] bool is_blocked_connection([[maybe_unused]] const coordinate<Lyt>& c1,
+                                             [[maybe_unused]] const coordinate<Lyt>& c2) const noexcept
+    {
+        if constexpr (has_is_obstructed_connection_v<Lyt>)
+        {
+            return layout.is_obstructed_connection(c1, c2);
+        }
+
+        return false;
+    }
+    /**
+     * Updates the best path if the given coordinate has been reached by both search directions on a cheaper path.
+     *
+     * @param c Coordinate that has just been discovered by one of the two searches.
+     */
+    void update_meeting_point(const coordinate<Lyt>& c) noexcept
+    {
+        if (forward_storage.has_g(c) && backward_storage.has_g(c))
+        {
+            if (const auto path_cost = forward_storage.g(c) + backward_storage.g(c); path_cost < best_cost)
+            {
+                best_cost     = path_cost;
+                meeting_point = c;
+            }
+        }
+    }
+    /**
+     * Relaxes the edge to `next` in the search direction given by `storage` and `open_list`.
+     *
+     * @param current Coordinate that is currently examined.
+     * @param next Neighbor of `current` in the search direction.
+     * @param step_cost Cost of the edge between `current` and `next`.
+     * @param heuristic Estimated remaining cost from `next` to the opposite end point.
+     * @param storage Storage of the search direction.
+     * @param open_list Open list of the search direction.
+     */
+    void relax(const coordinate<Lyt>& current, const coordinate<Lyt>& next, const g_f_type step_cost,
+               const g_f_type heuristic, typename Context::storage_type& storage,
+               typename Context::open_list_type& open_list) noexcept
+    {
+        if (storage.is_closed(next))
+        {
+            return;  // skip any coordinate that is already in the closed list
+        }
+
+        const g_f_type tentative_g = storage.g(current) + step_cost;
+
+        if (storage.has_g(next) && tentative_g >= storage.g(next))
+        {
+            return;  // skip the coordinate if it does not offer improvement
+        }
+
+        storage.discover(next, tentative_g, current);
+
+        // instead of updating an existing entry, which would break the heap property, push another one
+        open_list.push({next, tentative_g + heuristic});
+
+        update_meeting_point(next);
+    }
+    /**
+     * Closes the most promising coordinate of the forward search and explores its successors in information flow
+     * direction.
+     */
+    void expand_forward() noexcept
+    {
+        const auto current = forward_open_list.top().coord;
+        forward_open_list.pop();
+
+        forward_storage.close(current);
+
+        // paths are not continued beyond the target
+        if (current == objective.target)
+        {
+            return;
+        }
+
+        const auto explore_successor = [this, &current](const auto& s) noexcept
+        {
+            const auto successor = layout.below(s);
+
+            if (is_blocked(successor, objective.target) || is_blocked_connection(current, successor))
+            {
+                return;
+            }
+
+            relax(current, successor, static_cast<g_f_type>(cost(current, successor)), forward_heuristic(successor),
+                  forward_storage, forward_open_list);
+        };
+
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            layout.foreach_outgoing_clocked_zone(current, explore_successor);
+        }
+        else
+        {
+            layout.foreach_adjacent_coordinate(current, explore_successor);
+        }
+    }
+    /**
+     * Closes the most promising coordinate of the backward search and explores its predecessors against information
+     * flow direction.
+     */
+    void expand_backward() noexcept
+    {
+        const auto current = backward_open_list.top().coord;
+        backward_open_list.pop();
+
+        backward_storage.close(current);
+
+        // paths are not continued beyond the source
+        if (current == objective.source)
+        {
+            return;
+        }
+
+        const auto explore_predecessor = [this, &current](const auto& p) noexcept
+        {
+            const auto predecessor = layout.below(p);
+
+            if (is_blocked(predecessor, objective.source) || is_blocked_connection(predecessor, current))
+            {
+                return;
+            }
+
+            relax(current, predecessor, static_cast<g_f_type>(cost(predecessor, current)),
+                  backward_heuristic(predecessor), backward_storage, backward_open_list);
+        };
+
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            layout.foreach_incoming_clocked_zone(current, explore_predecessor);
+        }
+        else
+        {
+            layout.foreach_adjacent_coordinate(current, explore_predecessor);
+        }
+    }
+    /**
+     * Reconstruct the final path by joining the forward search tree from `source` to the meeting point with the
+     * backward search tree from the meeting point to `target`.
+     *
+     * @return The shortest path connecting source and target.
+     */
+    [[nodiscard]] Path reconstruct_path() const noexcept
+    {
+        auto& reversed_path = forward_context.path_buffer();
+
+        // iterate backwards from the meeting point to the source
+        auto current = *meeting_point;
+        for (auto origin = forward_storage.origin(current); origin != current; origin = forward_storage.origin(current))
+        {
+            reversed_path.push_back(current);
+            current = origin;
+        }
+        reversed_path.push_back(current);
+
+        Path path(std::crbegin(reversed_path), std::crend(reversed_path));
+
+        // iterate forwards from the meeting point to the target
+        current = *meeting_point;
+        for (auto origin = backward_storage.origin(current); origin != current;
+             origin      = backward_storage.origin(current))
+        {
+            path.push_back(origin);
+            current = origin;
+        }
+
+        return path;
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A bidirectional variant of the A* path finding algorithm (see `a_star`) for shortest loop-less paths between a given
+ * source and target coordinate in a layout. It simultaneously searches forward from the source and backward from the
+ * target, always expanding the smaller of the two frontiers, and terminates as soon as no path via the remaining
+ * frontiers can be cheaper than the best path that joins both search trees. On long routes, the two frontiers
+ * together usually cover considerably fewer coordinates than a single frontier that spans the entire distance.
+ *
+ * This function automatically detects whether the given layout implements a clocking interface (see `clocked_layout`)
+ * and respects the underlying information flow imposed by `layout`'s clocking scheme. To this end, the backward
+ * search traverses incoming clock zones instead of outgoing ones.
+ *
+ * If the given layout implements the obstruction interface (see `obstruction_layout`), paths will not be routed via
+ * obstructed coordinates and connections. Source and target may be obstructed.
+ *
+ * The heuristic distance function is used to estimate the remaining costs towards the target in the forward search and
+ * the costs from the source in the backward search. It should be consistent for the returned paths to be shortest ones.
+ *
+ * @note In contrast to `a_star`, this algorithm does not support wire crossings because the decision whether a wire
+ * can be crossed depends on the information flow direction, which is unknown during the backward search.
+ *
+ * This overload performs the search in the given reusable contexts (see `path_search_context`), one per search
+ * direction. Their storage type determines the internal bookkeeping, i.e., `bidirectional_a_star_params::dense_storage`
+ * is ignored.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @tparam Storage Storage type of the search contexts.
+ * @param layout The layout in which the shortest path between a source and target coordinate is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param forward_context Reusable search context for the forward search.
+ * @param backward_context Reusable search context for the backward search. Must differ from `forward_context`.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t, typename Storage>
+[[nodiscard]] Path
+bidirectional_a_star(const Lyt& layout, const routing_objective<Lyt>& objective,
+                     path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>& forward_context,
+                     path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>& backward_context,
+                     const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                     const cost_functor<Lyt, Cost>&     cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                     [[maybe_unused]] const bidirectional_a_star_params& params = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using context_type = path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>;
+
+    return detail::bidirectional_a_star_impl<Path, Lyt, Dist, Cost, context_type>{
+        layout, objective, dist_fn, cost_fn, forward_context, backward_context}
+        .run();
+}
+/**
+ * A bidirectional variant of the A* path finding algorithm (see `a_star`) for shortest loop-less paths between a given
+ * source and target coordinate in a layout. See the overload with search contexts above for a detailed description.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @param layout The layout in which the shortest path between a source and target coordinate is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t>
+[[nodiscard]] Path
+bidirectional_a_star(const Lyt& layout, const routing_objective<Lyt>& objective,
+                     const distance_functor<Lyt, Dist>&  dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                     const cost_functor<Lyt, Cost>&      cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                     const bidirectional_a_star_params& params  = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
+    if constexpr (is_densely_indexable_coordinate_v<coordinate<Lyt>>)
+    {
+        if (params.dense_storage)
+        {
+            dense_path_search_context<coordinate<Lyt>, g_f_type> forward_context{}, backward_context{};
+
+            return bidirectional_a_star<Path>(layout, objective, forward_context, backward_context, dist_fn, cost_fn,
+                                              params);
+        }
+    }
+
+    path_search_context<coordinate<Lyt>, g_f_type> forward_context{}, backward_context{};
+
+    return bidirectional_a_star<Path>(layout, objective, forward_context, backward_context, dist_fn, cost_fn, params);
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_BIDIRECTIONAL_A_STAR_HPP
@@ -6,37 +6,51 @@
 #define FICTION_JUMP_POINT_SEARCH_HPP
 
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
+#include "fiction/algorithms/path_finding/search_storage.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
 
-#include <phmap.h>
-
-#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
 #include <iterator>
 #include <optional>
 #include <type_traits>
-#include <vector>
 
 namespace fiction
 {
 
+/**
+ * Parameters for the Jump Point Search algorithm.
+ */
+struct jump_point_search_params
+{
+    /**
+     * Keep the closed list, g-values, and path origins in dense arrays that are addressed by coordinate index
+     * instead of in hash maps. This is only applicable to bounded layouts with unsigned offset coordinates (see
+     * `is_densely_indexable_coordinate_v`) and is ignored for all other layouts.
+     */
+    bool dense_storage = false;
+};
+
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist>
+template <typename Path, typename Lyt, typename Dist, typename Context>
 class jump_point_search_impl
 {
   public:
     jump_point_search_impl(const Lyt& lyt, const routing_objective<Lyt>& obj,
-                           const distance_functor<Lyt, Dist>& dist_fn) :
+                           const distance_functor<Lyt, Dist>& dist_fn, Context& ctx) :
             layout{lyt},
             objective{obj},
-            distance{dist_fn}
+            distance{dist_fn},
+            context{ctx}
     {
+        context.prepare(layout);
         open_list.push(coordinate_f{objective.source, 0});
     }
 
@@ -58,7 +72,7 @@ class jump_point_search_impl
                 return reconstruct_path();
             }
             // don't examine the current coordinate again
-            closed_list.insert(current);
+            storage.close(current);
 
             // expand from current coordinate
             expand(current);
@@ -81,66 +95,26 @@ class jump_point_search_impl
      * The distance functor that implements the heuristic estimation function.
      */
     const distance_functor<Lyt, Dist> distance;
-
     /**
-     * Stores a coordinate and its f-value.
+     * Reusable buffers for the search.
      */
-    struct coordinate_f
-    {
-        /**
-         * Coordinate.
-         */
-        coordinate<Lyt> coord;
-        /**
-         * f-value of the coordinate.
-         */
-        Dist f;
-
-        /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
-         */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
-        /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
-         */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
-    };
+    Context& context;
 
+    static_assert(std::is_same_v<typename Context::coordinate_type, coordinate<Lyt>>,
+                  "Context has a different coordinate type than Lyt");
+    static_assert(std::is_same_v<typename Context::value_type, Dist>, "Context has a different value type than Dist");
     /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
+     * Stores a coordinate and its f-value.
      */
-    using jump_point_search_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
+    using coordinate_f = search_frontier_entry<coordinate<Lyt>, Dist>;
     /**
      * Open list that contains all coordinates to process next sorted by their f-value.
      */
-    jump_point_search_priority_queue open_list{};
-    /**
-     * Closed list that acts as a set of already visited coordinates.
-     */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
+    typename Context::open_list_type& open_list{context.open_list()};
     /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
+     * Closed list, g-values, and path origins.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, Dist> g_values{};
-    /**
-     * Tracks the origin of each coordinate to recreate the path.
-     */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
+    typename Context::storage_type& storage{context.storage()};
     /**
      * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
      *
@@ -191,25 +165,25 @@ class jump_point_search_impl
                 // compute the g-value of current. Add the distance to the jump point as it might not be adjacent
                 const auto tentative_g = g(current) + distance(layout, *jump_point, current);
 
-                // f-value does not matter because the comparator compares only the coordinates
-                const auto it = open_list.find({*jump_point, 0});
-                if (it != open_list.end() && no_improvement(*jump_point, tentative_g))
+                // a coordinate that has a g-value but is not closed is contained in the open list (frontier)
+                const auto in_open_list = storage.has_g(*jump_point);
+                if (in_open_list && no_improvement(*jump_point, tentative_g))
                 {
                     return;  // skip the coordinate if it does not offer improvement
                 }
 
-                // track origin
-                came_from[*jump_point] = current;
-                set_g(*jump_point, tentative_g);
+                // track origin and update g-value
+                storage.discover(*jump_point, tentative_g, current);
 
                 // compute new f-value
                 const auto f = tentative_g + distance(layout, *jump_point, objective.target);
 
                 // if successor is contained in the open list (frontier)
-                if (it != open_list.end())
+                if (in_open_list)
                 {
-                    // update its f-value
-                    it->f = f;
+                    // update its f-value; f-value does not matter for the lookup because the comparator compares only
+                    // the coordinates
+                    open_list.find({*jump_point, 0})->f = f;
                 }
                 else
                 {
@@ -339,32 +313,17 @@ class jump_point_search_impl
      */
     [[nodiscard]] bool is_visited(const coordinate<Lyt>& c) const noexcept
     {
-        return closed_list.count(c) > 0;
+        return storage.is_closed(c);
     }
     /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
+     * Returns the g-value of a coordinate by accessing the storage. Returns 0 if no entry exists.
      *
      * @param c Coordinate whose g-value is desired.
      * @return g-value of coordinate c or 0 if no value has been stored.
      */
     [[nodiscard]] Dist g(const coordinate<Lyt>& c) const noexcept
     {
-        if (const auto it = g_values.find(c); it != g_values.cend())
-        {
-            return it->second;
-        }
-
-        return 0ul;
-    }
-    /**
-     * Updates the g-value of the given coordinate to the given value.
-     *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
-     */
-    void set_g(const coordinate<Lyt>& c, const Dist g_val) noexcept
-    {
-        g_values.insert_or_assign(c, g_val);
+        return storage.g(c);
     }
     /**
      * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
@@ -385,17 +344,18 @@ class jump_point_search_impl
      */
     [[nodiscard]] Path reconstruct_path() const noexcept
     {
-        Path path{};
+        auto& reversed_path = context.path_buffer();
 
-        // iterate backwards over the found connections and add them to the path
-        for (auto current = objective.target; current != objective.source; current = came_from.at(current))
+        // iterate backwards over the found connections and add them to the buffer
+        for (auto current = objective.target; current != objective.source; current = storage.origin(current))
         {
-            path.push_back(current);
+            reversed_path.push_back(current);
         }
         // finally, add the source coordinate
-        path.push_back(objective.source);
-        // and reverse the path to bring it in proper order
-        std::reverse(std::begin(path), std::end(path));
+        reversed_path.push_back(objective.source);
+
+        // copy the buffer in reverse to bring the path in proper order
+        const Path path(std::crbegin(reversed_path), std::crend(reversed_path));
 
         return fill_in_jumps(path);  // fill in the blanks that were skipped via jump points
     }
@@ -485,6 +445,38 @@ class jump_point_search_impl
 
 }  // namespace detail
 
+/**
+ * The Jump Point Search (JPS) path finding algorithm for shortest loop-less paths between a given source and target
+ * coordinate in a Cartesian layout. See the overload without a search context below for a detailed description.
+ *
+ * This overload performs the search in the given reusable context (see `path_search_context`) instead of allocating
+ * all search data structures anew. The storage type of the context determines the internal bookkeeping, i.e.,
+ * `jump_point_search_params::dense_storage` is ignored.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Storage Storage type of the search context.
+ * @param layout The layout in which the shortest path between a source and target is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param context Reusable search context whose value type is `Dist`.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param params Parameters.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Storage>
+[[nodiscard]] Path
+jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
+                  path_search_context<coordinate<Lyt>, Dist, Storage>& context,
+                  const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, Dist>(),
+                  [[maybe_unused]] const jump_point_search_params& params = {}) noexcept
+{
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+
+    return detail::jump_point_search_impl<Path, Lyt, Dist, path_search_context<coordinate<Lyt>, Dist, Storage>>{
+        layout, objective, dist_fn, context}
+        .run();
+}
 /**
  * The Jump Point Search (JPS) path finding algorithm for shortest loop-less paths between a given source and target
  * coordinate in a Cartesian layout. This function automatically detects whether the given layout implements a clocking
@@ -521,22 +513,40 @@ class jump_point_search_impl
  *
  * @note JPS does not support wire crossings.
  *
+ * On bounded layouts with unsigned offset coordinates, the internal bookkeeping can be switched from hash maps to
+ * dense, index-addressed arrays via `jump_point_search_params::dense_storage`. To additionally avoid allocating all
+ * search data structures in each call, use the overload that accepts a reusable `path_search_context`.
+ *
  * @tparam Path Type of the returned path.
  * @tparam Lyt Type of the layout to perform path finding on.
  * @tparam Dist Distance value type to be used in the heuristic estimation function.
  * @param layout The layout in which the shortest path between a source and target is to be found.
  * @param objective Source-target coordinate pair.
  * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param params Parameters.
  * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
  */
 template <typename Path, typename Lyt, typename Dist = uint64_t>
 [[nodiscard]] Path
 jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
-                  const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, Dist>()) noexcept
+                  const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, Dist>(),
+                  const jump_point_search_params&    params  = {}) noexcept
 {
     static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
 
-    return detail::jump_point_search_impl<Path, Lyt, Dist>{layout, objective, dist_fn}.run();
+    if constexpr (is_densely_indexable_coordinate_v<coordinate<Lyt>>)
+    {
+        if (params.dense_storage)
+        {
+            dense_path_search_context<coordinate<Lyt>, Dist> context{};
+
+            return jump_point_search<Path>(layout, objective, context, dist_fn, params);
+        }
+    }
+
+    path_search_context<coordinate<Lyt>, Dist> context{};
+
+    return jump_point_search<Path>(layout, objective, context, dist_fn, params);
 }
 
 }  // namespace fiction
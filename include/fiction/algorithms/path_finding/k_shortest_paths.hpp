@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
@@ -35,20 +36,21 @@ struct yen_k_shortest_paths_params
 namespace detail
 {
 
-template <typename Path, typename Lyt>
+template <typename Path, typename Lyt, typename Context>
 class yen_k_shortest_paths_impl
 {
   public:
-    yen_k_shortest_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const uint32_t k,
+    yen_k_shortest_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const uint32_t k, Context& ctx,
                               const yen_k_shortest_paths_params& p) :
             layout{lyt},
             objective{obj.source, obj.target},  // create a new objective due to potentially differing types
             num_shortest_paths{k},
+            context{ctx},
             params{p}
     {
         // start by determining the shortest path between source and target
         k_shortest_paths.push_back(
-            a_star<Path>(layout, objective, manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
+            a_star<Path>(layout, objective, context, manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
                          unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), params.astar_params));
     }
 
@@ -113,7 +115,7 @@ class yen_k_shortest_paths_impl
 
                 // find an alternative path from the spur coordinate to the target and check that it is not empty
                 if (const auto spur_path =
-                        a_star<Path>(layout, {spur, objective.target},
+                        a_star<Path>(layout, {spur, objective.target}, context,
                                      manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
                                      unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), params.astar_params);
                     !spur_path.empty())
@@ -170,6 +172,10 @@ class yen_k_shortest_paths_impl
      * The number of paths to determine, i.e., k.
      */
     const uint32_t num_shortest_paths;
+    /**
+     * Reusable buffers for all internal A* searches.
+     */
+    Context& context;
     /**
      * Routing parameters.
      */
@@ -223,12 +229,43 @@ class yen_k_shortest_paths_impl
 
 }  // namespace detail
 
+/**
+ * Yen's algorithm for finding up to \f$k\f$ shortest paths without loops from a source to a target coordinate. See the
+ * overload without a search context below for a detailed description.
+ *
+ * This overload performs all internal A* searches in the given reusable context (see `path_search_context`). The
+ * storage type of the context determines the internal bookkeeping, i.e., `a_star_params::dense_storage` is ignored.
+ *
+ * @tparam Path Type of the returned individual paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Storage Storage type of the search context.
+ * @param layout The layout in which the \f$k\f$ shortest paths are to be found.
+ * @param objective Source-target coordinate pair.
+ * @param k Maximum number of shortest paths to find.
+ * @param context Reusable search context.
+ * @param params Parameters.
+ * @return A collection of up to \f$k\f$ shortest loop-less paths in `layout` from `objective.source` to
+ * `objective.target`.
+ */
+template <typename Path, typename Lyt, typename Storage>
+[[nodiscard]] path_collection<Path>
+yen_k_shortest_paths(const Lyt& layout, const routing_objective<Lyt>& objective, const uint32_t k,
+                     path_search_context<coordinate<Lyt>, uint64_t, Storage>& context,
+                     const yen_k_shortest_paths_params&                       params = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    return detail::yen_k_shortest_paths_impl<Path, Lyt, path_search_context<coordinate<Lyt>, uint64_t, Storage>>{
+        layout, objective, k, context, params}
+        .run();
+}
 /**
  * Yen's algorithm for finding up to \f$k\f$ shortest paths without loops from a source to a target coordinate. If
  * \f$k\f$ is larger than the number of possible paths from source to target, the size of the returned path collection
  * will be smaller than \f$k\f$.
  *
- * This implementation uses the A* algorithm with the Manhattan distance function internally.
+ * This implementation uses the A* algorithm with the Manhattan distance function internally. All internal searches
+ * share a single search context such that their data structures are allocated only once.
  *
  * This function automatically detects whether the given layout implements a clocking interface (see `clocked_layout`)
  * and respects the underlying information flow imposed by `layout`'s clocking scheme. This algorithm does neither
@@ -271,7 +308,19 @@ template <typename Path, typename Lyt>
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::yen_k_shortest_paths_impl<Path, Lyt>{layout, objective, k, params}.run();
+    if constexpr (is_densely_indexable_coordinate_v<coordinate<Lyt>>)
+    {
+        if (params.astar_params.dense_storage)
+        {
+            dense_path_search_context<coordinate<Lyt>, uint64_t> context{};
+
+            return yen_k_shortest_paths<Path>(layout, objective, k, context, params);
+        }
+    }
+
+    path_search_context<coordinate<Lyt>, uint64_t> context{};
+
+    return yen_k_shortest_paths<Path>(layout, objective, k, context, params);
 }
 
 }  // namespace fiction
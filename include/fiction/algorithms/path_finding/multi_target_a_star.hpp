@@ -0,0 +1,421 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_MULTI_TARGET_A_STAR_HPP
+#define FICTION_MULTI_TARGET_A_STAR_HPP
+
+#include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/algorithms/path_finding/cost.hpp"
+#include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <phmap.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+namespace detail
+{
+
+template <typename Path, typename Lyt, typename Dist, typename Cost, typename Context>
+class multi_target_a_star_impl
+{
+  public:
+    multi_target_a_star_impl(const Lyt& lyt, const std::vector<coordinate<Lyt>>& srcs,
+                             const std::vector<coordinate<Lyt>>& tgts, const distance_functor<Lyt, Dist>& dist_fn,
+                             const cost_functor<Lyt, Cost>& cost_fn, Context& ctx, const a_star_params& p) :
+            layout{lyt},
+            sources{srcs.cbegin(), srcs.cend()},
+            targets{tgts},
+            target_set{tgts.cbegin(), tgts.cend()},
+            distance{dist_fn},
+            cost{cost_fn},
+            context{ctx},
+            params{p}
+    {
+        context.prepare(layout);
+
+        for (const auto& s : sources)
+        {
+            assert(!s.is_dead() && layout.is_within_bounds(s) && "Sources have to be within the layout bounds");
+
+            // sources are their own origin, which terminates path reconstruction
+            storage.discover(s, 0, s);
+            open_list.push(coordinate_f{s, heuristic(s)});
+        }
+    }
+
+    /**
+     * Determine the shortest paths from any coordinate in `sources` to each coordinate in `targets`.
+     *
+     * @return One path per target in the order of `targets`. Paths to unreachable targets are empty.
+     */
+    [[nodiscard]] std::vector<Path> run()
+    {
+        assert(std::all_of(targets.cbegin(), targets.cend(),
+                           [this](const auto& t) { return !t.is_dead() && layout.is_within_bounds(t); }) &&
+               "Targets have to be within the layout bounds");
+
+        auto num_unreached_targets = target_set.size();
+
+        while (!open_list.empty() && num_unreached_targets > 0)
+        {
+            // get coordinate with lowest f-value
+            const auto current = open_list.top().coord;
+            open_list.pop();
+
+            // coordinates whose f-value has been lowered are contained in the open list multiple times
+            if (storage.is_closed(current))
+            {
+                continue;
+            }
+            // don't examine the current coordinate again
+            storage.close(current);
+
+            if (is_target(current))
+            {
+                --num_unreached_targets;
+
+                // obstructed targets are end points that cannot be passed through
+                if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+                {
+                    if (layout.is_obstructed_coordinate(current) && !is_source(current))
+                    {
+                        continue;
+                    }
+                }
+            }
+
+            // expand from current coordinate
+            expand(current);
+        }
+
+        std::vector<Path> paths{};
+        paths.reserve(targets.size());
+
+        for (const auto& t : targets)
+        {
+            paths.push_back(storage.is_closed(t) ? reconstruct_path(t) : Path{});
+        }
+
+        return paths;
+    }
+
+  private:
+    /**
+     * The layout in which the shortest paths are to be found.
+     */
+    const Lyt& layout;
+    /**
+     * The set of coordinates from which paths may start.
+     */
+    const phmap::flat_hash_set<coordinate<Lyt>> sources;
+    /**
+     * The coordinates to which paths are to be found in the requested order.
+     */
+    const std::vector<coordinate<Lyt>>& targets;
+    /**
+     * The set of target coordinates for fast lookup.
+     */
+    const phmap::flat_hash_set<coordinate<Lyt>> target_set;
+    /**
+     * The distance functor that implements the heuristic estimation function.
+     */
+    const distance_functor<Lyt, Dist> distance;
+    /**
+     * The cost functor that implements the cost function.
+     */
+    const cost_functor<Lyt, Cost> cost;
+    /**
+     * Reusable buffers for the search.
+     */
+    Context& context;
+    /**
+     * Routing parameters.
+     */
+    const a_star_params params;
+
+    /**
+     * The values used for g and f have a type in accordance with Dist and Cost.
+     */
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
+    static_assert(std::is_same_v<typename Context::coordinate_type, coordinate<Lyt>>,
+                  "Context has a different coordinate type than Lyt");
+    static_assert(std::is_same_v<typename Context::value_type, g_f_type>,
+                  "Context has a different value type than std::common_type_t<Dist, Cost>");
+    /**
+     * Stores a coordinate and its f-value.
+     */
+    using coordinate_f = search_frontier_entry<coordinate<Lyt>, g_f_type>;
+    /**
+     * Open list that contains all coordinates to process next sorted by their f-value.
+     */
+    typename Context::open_list_type& open_list{context.open_list()};
+    /**
+     * Closed list, g-values, and path origins.
+     */
+    typename Context::storage_type& storage{context.storage()};
+    /**
+     * Checks whether the given coordinate is one of the sources.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is a source.
+     */
+    [[nodiscard]] bool is_source(const coordinate<Lyt>& c) const noexcept
+    {
+        return sources.count(c) > 0;
+    }
+    /**
+     * Checks whether the given coordinate is one of the targets.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is a target.
+     */
+    [[nodiscard]] bool is_target(const coordinate<Lyt>& c) const noexcept
+    {
+        return target_set.count(c) > 0;
+    }
+    /**
+     * The heuristic estimation of the remaining costs, i.e., the minimum distance to any target. As the minimum over
+     * consistent heuristics, it is consistent itself. Therefore, the g-value of each closed coordinate is optimal,
+     * regardless of which target it leads to.
+     *
+     * @param c Coordinate whose remaining costs are to be estimated.
+     * @return Minimum distance from `c` to any target.
+     */
+    [[nodiscard]] g_f_type heuristic(const coordinate<Lyt>& c) const noexcept
+    {
+        if (targets.empty())
+        {
+            return 0;
+        }
+
+        auto min_dist = static_cast<g_f_type>(distance(layout, c, targets.front()));
+
+        for (auto it = std::next(targets.cbegin()); it != targets.cend(); ++it)
+        {
+            min_dist = std::min(min_dist, static_cast<g_f_type>(distance(layout, c, *it)));
+        }
+
+        return min_dist;
+    }
+    /**
+     * Expands the frontier of coordinates to visit next in the direction of the heuristic cost function.
+     *
+     * @param current Coordinate that is currently examined.
+     */
+    void expand(const coordinate<Lyt>& current) noexcept
+    {
+        const auto explore_successor = [this, current](auto successor)  // make a copy
+            noexcept
+        {
+            // return to ground layer to avoid getting stuck in crossing layer
+            successor = layout.below(successor);
+
+            // check if successor is obstructed
+            if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+            {
+                if (layout.is_obstructed_coordinate(successor) && !is_target(successor))
+                {
+                    // if crossings are enabled, check if it is possible to switch to the crossing layer
+                    if (params.crossings && is_crossable_wire(layout, current, successor))
+                    {
+                        // if the crossing layer is not obstructed
+                        if (const auto above_successor = layout.above(successor);
+                            above_successor != successor && !is_target(above_successor) &&
+                            !layout.is_obstructed_coordinate(above_successor))
+                        {
+                            // allow exploring the crossing layer
+                            successor = above_successor;
+                        }
+                        else
+                        {
+                            return;  // skip the obstructed coordinate and keep looping
+                        }
+                    }
+                    else
+                    {
+                        return;  // skip the obstructed coordinate and keep looping
+                    }
+                }
+            }
+
+            // check if the connection to the successor is obstructed
+            if constexpr (has_is_obstructed_connection_v<Lyt>)
+            {
+                if (layout.is_obstructed_connection(current, successor))
+                {
+                    return;  // skip the obstructed connection and keep looping
+                }
+            }
+
+            if (storage.is_closed(successor))
+            {
+                return;  // skip any coordinate that is already in the closed list
+            }
+
+            const g_f_type tentative_g = storage.g(current) + cost(current, successor);
+
+            if (storage.has_g(successor) && tentative_g >= storage.g(successor))
+            {
+                return;  // skip the coordinate if it does not offer improvement
+            }
+
+            // track origin and update g-value
+            storage.discover(successor, tentative_g, current);
+
+            // instead of updating an existing entry, which would break the heap property, push another one; the stale
+            // entry is skipped later because its coordinate will have been closed by then
+            open_list.push({successor, tentative_g + heuristic(successor)});
+        };
+
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            // recurse for all outgoing clock zones
+            layout.foreach_outgoing_clocked_zone(current, explore_successor);
+        }
+        else
+        {
+            // recurse for all adjacent coordinates
+            layout.foreach_adjacent_coordinate(current, explore_successor);
+        }
+    }
+    /**
+     * Reconstruct the path to the given target from the origins that were stored during the search.
+     *
+     * @param target Closed target coordinate.
+     * @return The shortest path connecting any source with `target`.
+     */
+    [[nodiscard]] Path reconstruct_path(const coordinate<Lyt>& target) const noexcept
+    {
+        auto& reversed_path = context.path_buffer();
+        reversed_path.clear();
+
+        // iterate backwards over the found connections until a source, which is its own origin, is reached
+        auto current = target;
+        for (auto origin = storage.origin(current); origin != current; origin = storage.origin(current))
+        {
+            reversed_path.push_back(current);
+            current = origin;
+        }
+        // finally, add the source coordinate
+        reversed_path.push_back(current);
+
+        // copy the buffer in reverse to bring the path in proper order
+        return Path(std::crbegin(reversed_path), std::crend(reversed_path));
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A multi-source multi-target variant of the A* path finding algorithm (see `a_star`). Instead of determining a single
+ * path between one source and one target, it determines, in a single search, a shortest path from any of the given
+ * sources to each of the given targets. This is considerably faster than calling `a_star` once per source-target pair
+ * when many candidate end points are to be evaluated, e.g., all positions a gate could be relocated to.
+ *
+ * The search is initialized with all sources in the open list. Its heuristic is the minimum estimated distance to any
+ * target, which keeps it admissible and consistent for every single target. Consequently, each target is reached via a
+ * shortest path. The search terminates as soon as all targets have been reached or no further coordinate can be
+ * explored. Note that each heuristic evaluation considers all targets. For large target sets, a distance functor that
+ * is cheap to evaluate or a zero heuristic, which turns the search into Dijkstra's algorithm, is recommended.
+ *
+ * Like `a_star`, this function respects clocking, coordinate and connection obstructions, and wire crossings if
+ * enabled in the parameters. Targets may be obstructed, but are never passed through in that case.
+ *
+ * This overload performs the search in the given reusable context (see `path_search_context`). The storage type of the
+ * context determines the internal bookkeeping, i.e., `a_star_params::dense_storage` is ignored.
+ *
+ * @tparam Path Type of the returned paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @tparam Storage Storage type of the search context.
+ * @param layout The layout in which the shortest paths are to be found.
+ * @param sources Coordinates from which paths may start.
+ * @param targets Coordinates to which paths are to be found.
+ * @param context Reusable search context whose value type is `std::common_type_t<Dist, Cost>`.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return One shortest loop-less path per target in the order of `targets`, each starting at the source closest to it.
+ * Paths to unreachable targets are empty.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t, typename Storage>
+[[nodiscard]] std::vector<Path>
+multi_target_a_star(const Lyt& layout, const std::vector<coordinate<Lyt>>& sources,
+                    const std::vector<coordinate<Lyt>>&                                            targets,
+                    path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>& context,
+                    const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                    const cost_functor<Lyt, Cost>&     cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                    const a_star_params&               params  = {})
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using context_type = path_search_context<coordinate<Lyt>, std::common_type_t<Dist, Cost>, Storage>;
+
+    return detail::multi_target_a_star_impl<Path, Lyt, Dist, Cost, context_type>{
+        layout, sources, targets, dist_fn, cost_fn, context, params}
+        .run();
+}
+/**
+ * A multi-source multi-target variant of the A* path finding algorithm (see `a_star`). It determines, in a single
+ * search, a shortest path from any of the given sources to each of the given targets. See the overload with a search
+ * context above for a detailed description.
+ *
+ * @tparam Path Type of the returned paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @param layout The layout in which the shortest paths are to be found.
+ * @param sources Coordinates from which paths may start.
+ * @param targets Coordinates to which paths are to be found.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return One shortest loop-less path per target in the order of `targets`, each starting at the source closest to it.
+ * Paths to unreachable targets are empty.
+ */
+template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t>
+[[nodiscard]] std::vector<Path>
+multi_target_a_star(const Lyt& layout, const std::vector<coordinate<Lyt>>& sources,
+                    const std::vector<coordinate<Lyt>>& targets,
+                    const distance_functor<Lyt, Dist>&  dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                    const cost_functor<Lyt, Cost>&      cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                    const a_star_params&                params  = {})
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
+    if constexpr (is_densely_indexable_coordinate_v<coordinate<Lyt>>)
+    {
+        if (params.dense_storage)
+        {
+            dense_path_search_context<coordinate<Lyt>, g_f_type> context{};
+
+            return multi_target_a_star<Path>(layout, sources, targets, context, dist_fn, cost_fn, params);
+        }
+    }
+
+    path_search_context<coordinate<Lyt>, g_f_type> context{};
+
+    return multi_target_a_star<Path>(layout, sources, targets, context, dist_fn, cost_fn, params);
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_MULTI_TARGET_A_STAR_HPP
@@ -0,0 +1,188 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_SEARCH_CONTEXT_HPP
+#define FICTION_SEARCH_CONTEXT_HPP
+
+#include "fiction/algorithms/path_finding/search_storage.hpp"
+#include "fiction/utils/stl_utils.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * An entry of the open list of best-first path finding algorithms, i.e., a coordinate together with its f-value.
+ *
+ * @tparam CoordinateType Coordinate type.
+ * @tparam Value Type of the f-value.
+ */
+template <typename CoordinateType, typename Value>
+struct search_frontier_entry
+{
+    /**
+     * Coordinate.
+     */
+    CoordinateType coord;  // cannot be const because operator= is required by std::priority_queue
+    /**
+     * f-value of the coordinate.
+     */
+    Value f;
+
+    /**
+     * Comparator for the priority queue. Compares only the f-values.
+     *
+     * @param other Other entry to compare with.
+     * @return `true` iff this f-value is greater than the other's.
+     */
+    bool operator>(const search_frontier_entry& other) const
+    {
+        return this->f > other.f;
+    }
+    /**
+     * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
+     * priority queue.
+     *
+     * @param other Other entry to compare with.
+     * @return `true` iff this coord value is equal to the other's.
+     */
+    bool operator==(const search_frontier_entry& other) const
+    {
+        return this->coord == other.coord;
+    }
+};
+/**
+ * A reusable set of buffers for best-first path finding algorithms such as A* (see `a_star`), JPS (see
+ * `jump_point_search`), and Yen's algorithm (see `yen_k_shortest_paths`). It owns the open list, the closed list,
+ * g-values, and path origins as well as a buffer for path reconstruction.
+ *
+ * Without a context, each call to one of the path finding algorithms allocates and frees all of these data structures.
+ * When many paths are determined one after another, e.g., during physical design or post-layout optimization, passing
+ * the same context to all calls keeps the allocated memory alive in between searches. Each search starts by preparing
+ * the context, which empties the open list and the path buffer while keeping their capacities. With
+ * `dense_search_storage`, invalidating the closed list, g-values, and path origins takes constant time.
+ *
+ * A context can be used with any layout whose coordinate type is `CoordinateType`, but it must not be shared by
+ * concurrently running searches.
+ *
+ * Example:
+ * @code{.cpp}
+ * dense_path_search_context<offset::ucoord_t> ctx{};
+ *
+ * for (const auto& [source, target] : objectives)
+ * {
+ *     const auto path = a_star<path_type>(layout, {source, target}, ctx);
+ *     ...
+ * }
+ * @endcode
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search.
+ * @tparam Value Type of the g- and f-values. Has to match the value type of the algorithm it is used with.
+ * @tparam Storage Storage for the closed list, g-values, and path origins.
+ */
+template <typename CoordinateType, typename Value = uint64_t,
+          typename Storage = hashed_search_storage<CoordinateType, Value>>
+class path_search_context
+{
+  public:
+    /**
+     * Coordinate type.
+     */
+    using coordinate_type = CoordinateType;
+    /**
+     * Type of the g- and f-values.
+     */
+    using value_type = Value;
+    /**
+     * Storage type.
+     */
+    using storage_type = Storage;
+    /**
+     * Open list type, i.e., a priority queue that yields the entry with the smallest f-value first.
+     */
+    using open_list_type = searchable_priority_queue<search_frontier_entry<CoordinateType, Value>,
+                                                     std::vector<search_frontier_entry<CoordinateType, Value>>,
+                                                     std::greater<search_frontier_entry<CoordinateType, Value>>>;
+    /**
+     * Empties all buffers such that a new search can be performed on the given layout. Previously allocated memory is
+     * retained wherever possible.
+     *
+     * @tparam Lyt Coordinate layout type.
+     * @param lyt Layout on which the next search is to be performed.
+     */
+    template <typename Lyt>
+    void prepare(const Lyt& lyt) noexcept
+    {
+        search_storage.reset(lyt);
+        frontier.clear();
+        buffer.clear();
+    }
+    /**
+     * Returns the closed list, g-values, and path origins.
+     *
+     * @return Reference to the search storage.
+     */
+    [[nodiscard]] Storage& storage() noexcept
+    {
+        return search_storage;
+    }
+    /**
+     * Returns the open list.
+     *
+     * @return Reference to the open list.
+     */
+    [[nodiscard]] open_list_type& open_list() noexcept
+    {
+        return frontier;
+    }
+    /**
+     * Returns the buffer used for path reconstruction.
+     *
+     * @return Reference to the path buffer.
+     */
+    [[nodiscard]] std::vector<CoordinateType>& path_buffer() noexcept
+    {
+        return buffer;
+    }
+
+  private:
+    /**
+     * Closed list, g-values, and path origins.
+     */
+    Storage search_storage{};
+    /**
+     * Open list that contains all coordinates to process next sorted by their f-value.
+     */
+    open_list_type frontier{};
+    /**
+     * Buffer that collects path coordinates in reverse order during path reconstruction.
+     */
+    std::vector<CoordinateType> buffer{};
+};
+/**
+ * Alias for a path search context that uses `dense_search_storage`. Only applicable to unsigned offset coordinates.
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search.
+ * @tparam Value Type of the g- and f-values.
+ */
+template <typename CoordinateType, typename Value = uint64_t>
+using dense_path_search_context =
+    path_search_context<CoordinateType, Value, dense_search_storage<CoordinateType, Value>>;
+/**
+ * Alias for a path search context that uses `preferred_search_storage_t`, i.e., dense storage for unsigned offset
+ * coordinates and hashed storage otherwise.
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search.
+ * @tparam Value Type of the g- and f-values.
+ */
+template <typename CoordinateType, typename Value = uint64_t>
+using preferred_path_search_context =
+    path_search_context<CoordinateType, Value, preferred_search_storage_t<CoordinateType, Value>>;
+
+}  // namespace fiction
+
+#endif  // FICTION_SEARCH_CONTEXT_HPP
@@ -0,0 +1,307 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_SEARCH_STORAGE_HPP
+#define FICTION_SEARCH_STORAGE_HPP
+
+#include "fiction/utils/dense_coordinate_utils.hpp"
+#include "fiction/utils/instrumentation.hpp"
+
+#include <phmap.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Bookkeeping storage for best-first path finding algorithms such as A* and JPS. It keeps track of the closed list, the
+ * g-value of each discovered coordinate, and the coordinate it was discovered from. This implementation uses hash maps
+ * keyed by coordinate and is therefore applicable to any coordinate layout, including unbounded ones.
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search.
+ * @tparam Value Type of the stored g-values.
+ */
+template <typename CoordinateType, typename Value>
+class hashed_search_storage
+{
+  public:
+    /**
+     * Prepares the storage for a new search on the given layout by discarding all previously stored information.
+     *
+     * @tparam Lyt Coordinate layout type.
+     * @param lyt Layout on which the next search is to be performed.
+     */
+    template <typename Lyt>
+    void reset([[maybe_unused]] const Lyt& lyt) noexcept
+    {
+        closed_list.clear();
+        g_values.clear();
+        came_from.clear();
+    }
+    /**
+     * Checks whether the given coordinate has been closed already.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is in the closed list.
+     */
+    [[nodiscard]] bool is_closed(const CoordinateType& c) const noexcept
+    {
+        FICTION_PROFILE_COUNT("hashed_search_storage: probes", 1);
+
+        return closed_list.count(c) > 0;
+    }
+    /**
+     * Adds the given coordinate to the closed list.
+     *
+     * @param c Coordinate to close.
+     */
+    void close(const CoordinateType& c) noexcept
+    {
+        closed_list.insert(c);
+    }
+    /**
+     * Checks whether a g-value has been stored for the given coordinate.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` has been discovered.
+     */
+    [[nodiscard]] bool has_g(const CoordinateType& c) const noexcept
+    {
+        FICTION_PROFILE_COUNT("hashed_search_storage: probes", 1);
+
+        return g_values.count(c) > 0;
+    }
+    /**
+     * Returns the stored g-value of the given coordinate or 0 if no value has been stored.
+     *
+     * @param c Coordinate whose g-value is desired.
+     * @return g-value of `c`.
+     */
+    [[nodiscard]] Value g(const CoordinateType& c) const noexcept
+    {
+        FICTION_PROFILE_COUNT("hashed_search_storage: probes", 1);
+
+        if (const auto it = g_values.find(c); it != g_values.cend())
+        {
+            return it->second;
+        }
+
+        return Value{0};
+    }
+    /**
+     * Stores the g-value of the given coordinate together with the coordinate it has been reached from.
+     *
+     * @param c Coordinate to update.
+     * @param g_val New g-value of `c`.
+     * @param origin Predecessor of `c` on the best path found so far.
+     */
+    void discover(const CoordinateType& c, const Value g_val, const CoordinateType& origin) noexcept
+    {
+        g_values.insert_or_assign(c, g_val);
+        came_from.insert_or_assign(c, origin);
+    }
+    /**
+     * Returns the coordinate from which the given coordinate has been reached.
+     *
+     * @param c Discovered coordinate.
+     * @return Predecessor of `c`.
+     */
+    [[nodiscard]] CoordinateType origin(const CoordinateType& c) const noexcept
+    {
+        FICTION_PROFILE_COUNT("hashed_search_storage: probes", 1);
+
+        return came_from.at(c);
+    }
+
+  private:
+    /**
+     * Closed list that acts as a set of already visited coordinates.
+     */
+    phmap::flat_hash_set<CoordinateType> closed_list{};
+    /**
+     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
+     */
+    phmap::parallel_flat_hash_map<CoordinateType, Value> g_values{};
+    /**
+     * Tracks the origin of each coordinate to recreate the path.
+     */
+    phmap::parallel_flat_hash_map<CoordinateType, CoordinateType> came_from{};
+};
+
+/**
+ * Bookkeeping storage for best-first path finding algorithms such as A* and JPS that is addressed by a dense coordinate
+ * index instead of hashing. The closed list, g-values, and origins are stored in a flat array with one entry per
+ * coordinate of the layout.
+ *
+ * Entries are invalidated by a generation counter such that preparing the storage for another search on a layout of the
+ * same dimension is \f$\mathcal{O}(1)\f$. The storage adapts automatically if the layout has been resized in between
+ * searches.
+ *
+ * This implementation is only applicable to bounded layouts with unsigned offset coordinates (see
+ * `is_densely_indexable_coordinate_v`).
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search. Must be `offset::ucoord_t`.
+ * @tparam Value Type of the stored g-values.
+ */
+template <typename CoordinateType, typename Value>
+class dense_search_storage
+{
+  public:
+    static_assert(is_densely_indexable_coordinate_v<CoordinateType>, "CoordinateType is not densely indexable");
+
+    /**
+     * Prepares the storage for a new search on the given layout by invalidating all previously stored information.
+     *
+     * @tparam Lyt Coordinate layout type.
+     * @param lyt Layout on which the next search is to be performed.
+     */
+    template <typename Lyt>
+    void reset(const Lyt& lyt) noexcept
+    {
+        if (const auto dimension = CoordinateType{lyt.x(), lyt.y(), lyt.z()}; !index.matches(dimension))
+        {
+            index = dense_coordinate_indexer{dimension};
+
+            entries.assign(index.size(), entry{});
+
+            generation = 1;
+
+            return;
+        }
+
+        // on overflow, all stamps have to be invalidated explicitly once
+        if (++generation == 0)
+        {
+            std::fill(entries.begin(), entries.end(), entry{});
+            generation = 1;
+        }
+    }
+    /**
+     * Checks whether the given coordinate has been closed already during the current search.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is in the closed list.
+     */
+    [[nodiscard]] bool is_closed(const CoordinateType& c) const noexcept
+    {
+        return entries[index(c)].closed_stamp == generation;
+    }
+    /**
+     * Adds the given coordinate to the closed list.
+     *
+     * @param c Coordinate to close.
+     */
+    void close(const CoordinateType& c) noexcept
+    {
+        entries[index(c)].closed_stamp = generation;
+    }
+    /**
+     * Checks whether a g-value has been stored for the given coordinate during the current search.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` has been discovered.
+     */
+    [[nodiscard]] bool has_g(const CoordinateType& c) const noexcept
+    {
+        return entries[index(c)].stamp == generation;
+    }
+    /**
+     * Returns the stored g-value of the given coordinate or 0 if no value has been stored during the current search.
+     *
+     * @param c Coordinate whose g-value is desired.
+     * @return g-value of `c`.
+     */
+    [[nodiscard]] Value g(const CoordinateType& c) const noexcept
+    {
+        const auto& e = entries[index(c)];
+
+        return e.stamp == generation ? e.g : Value{0};
+    }
+    /**
+     * Stores the g-value of the given coordinate together with the coordinate it has been reached from.
+     *
+     * @param c Coordinate to update.
+     * @param g_val New g-value of `c`.
+     * @param origin Predecessor of `c` on the best path found so far.
+     */
+    void discover(const CoordinateType& c, const Value g_val, const CoordinateType& origin) noexcept
+    {
+        auto& e = entries[index(c)];
+
+        e.g      = g_val;
+        e.origin = origin;
+        e.stamp  = generation;
+    }
+    /**
+     * Returns the coordinate from which the given coordinate has been reached.
+     *
+     * @param c Discovered coordinate.
+     * @return Predecessor of `c`.
+     */
+    [[nodiscard]] CoordinateType origin(const CoordinateType& c) const noexcept
+    {
+        assert(has_g(c) && "Coordinate has not been discovered during the current search");
+
+        return entries[index(c)].origin;
+    }
+
+  private:
+    /**
+     * Per-coordinate search information.
+     */
+    struct entry
+    {
+        /**
+         * g-value of the coordinate.
+         */
+        Value g{0};
+        /**
+         * Predecessor of the coordinate.
+         */
+        CoordinateType origin{};
+        /**
+         * Generation in which the g-value and the origin have been written. Entries of other generations are considered
+         * empty.
+         */
+        uint32_t stamp{0};
+        /**
+         * Generation in which the coordinate has been closed. Coordinates closed in other generations are considered
+         * open.
+         */
+        uint32_t closed_stamp{0};
+    };
+    /**
+     * Maps coordinates to array positions.
+     */
+    dense_coordinate_indexer index{};
+    /**
+     * Flat array of per-coordinate search information.
+     */
+    std::vector<entry> entries{};
+    /**
+     * Current search generation.
+     */
+    uint32_t generation{0};
+};
+
+/**
+ * Selects `dense_search_storage` for densely indexable coordinate types and `hashed_search_storage` otherwise. This is
+ * the storage of choice when many searches are performed on the same bounded layout.
+ *
+ * @tparam CoordinateType Coordinate type of the layouts to search.
+ * @tparam Value Type of the stored g-values.
+ */
+template <typename CoordinateType, typename Value>
+using preferred_search_storage_t = std::conditional_t<is_densely_indexable_coordinate_v<CoordinateType>,
+                                                      dense_search_storage<CoordinateType, Value>,
+                                                      hashed_search_storage<CoordinateType, Value>>;
+
+}  // namespace fiction
+
+#endif  // FICTION_SEARCH_STORAGE_HPP
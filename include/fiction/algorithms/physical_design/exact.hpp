@@ -13,6 +13,7 @@
 #include "fiction/technology/cell_ports.hpp"
 #include "fiction/technology/sidb_surface_analysis.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/instrumentation.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
@@ -20,6 +21,7 @@
 #include "fiction/utils/truth_table_utils.hpp"
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 #include <kitty/dynamic_truth_table.hpp>
 #include <kitty/operations.hpp>
 #include <mockturtle/traits.hpp>
@@ -51,6 +53,7 @@
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -70,6 +73,28 @@ enum class technology_constraints : uint8_t
      */
     TOPOLINANO
 };
+/**
+ * Configuration of a single SMT solver that is used by the exact physical design algorithm. Differently configured
+ * solvers tend to perform very differently on the same instance, which can be exploited by racing several of them
+ * against each other, i.e., by running a solver portfolio.
+ */
+struct exact_solver_configuration
+{
+    /**
+     * Random seed that is passed to Z3.
+     */
+    unsigned random_seed = 0u;
+    /**
+     * Name of the Z3 tactic that the solver is to be constructed from, e.g., `"smt"`. If empty, Z3's default
+     * incremental solver is used.
+     */
+    std::string tactic{};
+    /**
+     * Flag to indicate that symmetry breaking constraints that are derived from the network's hierarchy should be
+     * generated.
+     */
+    bool symmetry_breaking = true;
+};
 /**
  * Parameters for the exact physical design algorithm.
  */
@@ -102,11 +127,19 @@ struct exact_physical_design_params
      */
     bool fixed_size = false;
     /**
-     * Number of threads to use for exploring the possible aspect ratios.
+     * Number of threads to use for exploring the possible aspect ratios. Each of these threads runs the entire solver
+     * `portfolio`, i.e., `num_threads * portfolio.size()` threads are used in total.
      *
      * @note This is an unstable beta feature.
      */
     std::size_t num_threads = 1ul;
+    /**
+     * Solver configurations that compete on each examined aspect ratio. Each configuration runs in its own thread and
+     * the first definite answer, i.e., SAT or UNSAT, is taken while all other solvers are interrupted. An empty
+     * portfolio is equivalent to a single default configuration. See `exact_solver_portfolio` for a diversified
+     * portfolio of a given size.
+     */
+    std::vector<exact_solver_configuration> portfolio{};
     /**
      * Flag to indicate that crossings may be used.
      */
@@ -148,6 +181,43 @@ struct exact_physical_design_params
      */
     technology_constraints technology_specifics = technology_constraints::NONE;
 };
+/**
+ * Statistics of a single thread that explores aspect ratios in the asynchronous mode of the exact physical design
+ * algorithm.
+ */
+struct exact_physical_design_thread_stats
+{
+    /**
+     * Time spent in solver calls.
+     */
+    mockturtle::stopwatch<>::duration time_solving{0};
+    /**
+     * Number of aspect ratios that were found SAT, UNSAT, or that could not be decided, respectively.
+     */
+    uint32_t num_sat{0ul}, num_unsat{0ul}, num_unknown{0ul};
+    /**
+     * Number of aspect ratios that were skipped or aborted because they are dominated by an aspect ratio that another
+     * thread proved to be UNSAT.
+     */
+    uint32_t num_dominated{0ul};
+    /**
+     * Number of definite answers that each configuration of the solver portfolio contributed first.
+     */
+    std::vector<uint32_t> num_wins{};
+    /**
+     * Reports the statistics to the given output stream.
+     *
+     * @param out Output stream.
+     */
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i]   solving time   = {:.2f} secs\n", mockturtle::to_seconds(time_solving));
+        out << fmt::format("[i]   SAT / UNSAT    = {} / {}\n", num_sat, num_unsat);
+        out << fmt::format("[i]   undecided      = {}\n", num_unknown);
+        out << fmt::format("[i]   dominated      = {}\n", num_dominated);
+        out << fmt::format("[i]   portfolio wins = {}\n", fmt::join(num_wins, ", "));
+    }
+};
 /**
  * Statistics.
  */
@@ -159,6 +229,10 @@ struct exact_physical_design_stats
     uint64_t num_gates{0ull}, num_wires{0ull}, num_crossings{0ull};
 
     uint32_t num_aspect_ratios{0ul};
+    /**
+     * Per-thread statistics. Only available if aspect ratios were explored asynchronously.
+     */
+    std::vector<exact_physical_design_thread_stats> thread_stats{};
 
     void report(std::ostream& out = std::cout) const
     {
@@ -167,8 +241,34 @@ struct exact_physical_design_stats
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
         out << fmt::format("[i] num. crossings  = {}\n", num_crossings);
+
+        for (auto i = 0ul; i < thread_stats.size(); ++i)
+        {
+            out << fmt::format("[i] thread {}:\n", i);
+            thread_stats[i].report(out);
+        }
     }
 };
+/**
+ * Creates a diversified portfolio of solver configurations to be used in `exact_physical_design_params::portfolio`.
+ * The configurations differ in their random seeds and alternate between symmetry breaking on and off as well as
+ * between Z3's default incremental solver and one that is constructed from the `smt` tactic.
+ *
+ * @param size Number of configurations in the portfolio.
+ * @return A portfolio of `size` distinct solver configurations.
+ */
+[[nodiscard]] inline std::vector<exact_solver_configuration> exact_solver_portfolio(const std::size_t size)
+{
+    std::vector<exact_solver_configuration> portfolio{};
+    portfolio.reserve(size);
+
+    for (auto i = 0ul; i < size; ++i)
+    {
+        portfolio.push_back({static_cast<unsigned>(i), (i / 2) % 2 == 0 ? "" : "smt", i % 2 == 0});
+    }
+
+    return portfolio;
+}
 
 namespace detail
 {
@@ -200,7 +300,7 @@ class exact_impl
 
     std::optional<Lyt> run()
     {
-        if (ps.num_threads > 1)
+        if (ps.num_threads > 1 || ps.portfolio.size() > 1)
         {
             return run_asynchronously();
         }
@@ -247,9 +347,15 @@ class exact_impl
      */
     std::optional<typename Lyt::aspect_ratio> result_aspect_ratio;
     /**
-     * Restricts access to the aspect_ratio_iterator and the result_aspect_ratio.
+     * Aspect ratios that have been proven UNSAT. They are shared across threads as lower bounds in the asynchronous
+     * case such that dominated aspect ratios, i.e., those that are not larger in any dimension, can be skipped.
+     */
+    std::vector<typename Lyt::aspect_ratio> unsat_aspect_ratios{};
+    /**
+     * Restricts access to the aspect_ratio_iterator, the result_aspect_ratio, the thread_info list, and the
+     * unsat_aspect_ratios.
      */
-    std::mutex ari_mutex{}, rar_mutex{};
+    std::mutex ari_mutex{}, rar_mutex{}, ti_mutex{}, unsat_mutex{};
 
     using ctx_ptr      = std::shared_ptr<z3::context>;
     using solver_ptr   = std::shared_ptr<z3::solver>;
@@ -269,13 +375,15 @@ class exact_impl
          * @param ctxp The context that is used in all solvers.
          * @param lyt The empty gate-level layout that is going to contain the created layout.
          * @param ps The parameters to respect in the SMT instance generation process.
+         * @param cfg The configuration of all solvers that are created by this handler.
          */
         smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk, const exact_physical_design_params& ps,
-                    const surface_black_list<Lyt, port_direction>& sbl) noexcept :
+                    const surface_black_list<Lyt, port_direction>& sbl, exact_solver_configuration cfg = {}) noexcept :
                 ctx{std::move(ctxp)},
                 layout{lyt},
                 network{ntk},
                 params{ps},
+                config{std::move(cfg)},
                 black_list{sbl},
                 node2pos{ntk},
                 depth_ntk{ntk},
@@ -344,43 +452,62 @@ class exact_impl
          *
          * @param ar Current aspect ratio to work on.
          */
-        void update(const typename Lyt::aspect_ratio& ar) noexcept
+        void update(const typename Lyt::aspect_ratio& ar)
         {
             layout.resize({ar.x, ar.y, params.crossings ? 1 : 0});
             check_point = std::make_shared<solver_check_point>(fetch_solver(ar));
             ++lc;
             solver = check_point->state->solver;
+
+            // the fetched solver might not know about the current timeout yet
+            if (timeout.has_value())
+            {
+                apply_timeout();
+            }
         }
         /**
-         * Sets the given timeout for the current solver.
+         * Sets the given timeout for the current solver and all solvers that are fetched in subsequent updates.
          *
          * @param t Timeout in ms.
          */
         void set_timeout(const unsigned t)
         {
-            z3::params p{*ctx};
-            p.set("timeout", t);
-            solver->set(p);
+            timeout = t;
+
+            if (solver != nullptr)
+            {
+                apply_timeout();
+            }
         }
         /**
          * Generates the SMT instance for the current solver check point and runs the solver check. In case the instance
          * was satisfiable, all constraints are moved to an z3::optimize if optimization criteria were specified. This
          * way, no unnecessary optimization constraints need to be generated over and over for UNSAT instances.
          *
-         * If the instance was found SAT on both levels, a layout is extract from the model and stored. The function
-         * returns then true.
+         * If the instance was found SAT on both levels, a layout is extract from the model and stored.
          *
-         * @return `true` iff the instance generated for the current configuration is SAT.
+         * @return `z3::sat` if the instance generated for the current configuration is SAT, `z3::unsat` if it was
+         * proven to be UNSAT, and `z3::unknown` if the solver timed out or was interrupted.
          */
-        [[nodiscard]] bool is_satisfiable()
+        [[nodiscard]] z3::check_result check()
         {
-            generate_smt_instance();
+            {
+                FICTION_PROFILE_SCOPE("exact: SMT instance generation");
+                generate_smt_instance();
+            }
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            auto z3_result = z3::unknown;
+            {
+                FICTION_PROFILE_SCOPE("exact: SMT check");
+                z3_result = solver->check(check_point->assumptions);
+            }
+
+            if (z3_result == z3::sat)
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
                 {
+                    FICTION_PROFILE_SCOPE("exact: SMT optimization");
                     opt->check();
                     assign_layout(opt->get_model());
                 }
@@ -388,11 +515,19 @@ class exact_impl
                 {
                     assign_layout(solver->get_model());
                 }
-
-                return true;
             }
 
-            return false;
+            return z3_result;
+        }
+        /**
+         * Generates the SMT instance for the current solver check point and checks whether it is satisfiable. See
+         * `check` for details.
+         *
+         * @return `true` iff the instance generated for the current configuration is SAT.
+         */
+        [[nodiscard]] bool is_satisfiable()
+        {
+            return check() == z3::sat;
         }
         /**
          * Stores the current solver state in the solver tree with aspect ratio ar as key.
@@ -493,6 +628,10 @@ class exact_impl
          * Configurations specifying layout restrictions. Used in instance generation among other places.
          */
         const exact_physical_design_params params;
+        /**
+         * Configuration of the created solvers.
+         */
+        const exact_solver_configuration config;
         /**
          * Maps tiles to blacklisted gate types via their truth tables and port information.
          */
@@ -538,6 +677,19 @@ class exact_impl
          * Shortcut to the solver stored in check_point.
          */
         solver_ptr solver;
+        /**
+         * Timeout in ms that is to be respected by all solvers.
+         */
+        std::optional<unsigned> timeout{};
+        /**
+         * Passes the stored timeout to the current solver.
+         */
+        void apply_timeout()
+        {
+            z3::params p{*ctx};
+            p.set("timeout", *timeout);
+            solver->set(p);
+        }
         /**
          * Returns the lc-th eastern assumption literal from the stored context.
          *
@@ -556,6 +708,23 @@ class exact_impl
         {
             return ctx->bool_const(fmt::format("lit_s_{}", lc).c_str());
         }
+        /**
+         * Creates a new solver from the stored context that respects the stored solver configuration.
+         *
+         * @return A new solver.
+         */
+        [[nodiscard]] solver_ptr create_solver()
+        {
+            auto s = config.tactic.empty() ?
+                         std::make_shared<z3::solver>(*ctx) :
+                         std::make_shared<z3::solver>(z3::tactic{*ctx, config.tactic.c_str()}.mk_solver());
+
+            z3::params p{*ctx};
+            p.set("random_seed", config.random_seed);
+            s->set(p);
+
+            return s;
+        }
         /**
          * Accesses the solver tree and looks for a solver state that is associated with an aspect ratio smaller by 1
          * row or column than given aspect ratio. The found one is returned together with the tiles that are new to this
@@ -638,7 +807,7 @@ class exact_impl
             }
 
             // create new state
-            solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()}};
+            solver_state new_state{create_solver(), {get_lit_e(), get_lit_s()}};
 
             return {std::make_shared<solver_state>(new_state), added_tiles, {}, create_assumptions(new_state)};
         }
@@ -2564,7 +2733,10 @@ class exact_impl
             // symmetry breaking constraints
             prevent_insufficiencies();
             define_number_of_connections();
-            utilize_hierarchical_information();
+            if (config.symmetry_breaking)
+            {
+                utilize_hierarchical_information();
+            }
         }
         /**
          * Creates and returns a z3::optimize if optimization criteria were set by the configuration. The optimize gets
@@ -2823,104 +2995,384 @@ class exact_impl
         handler.set_timeout(time_left);
     }
     /**
-     * Contains a context pointer and a currently worked on aspect ratio and can be shared between multiple worker
-     * threads so that they can notify each other via context interrupts based on their individual results, i.e., a
-     * thread that found a result at aspect ratio x * y can interrupt all other threads that are working on larger
-     * layout sizes.
+     * Contains the contexts of a worker thread's solver portfolio and the currently worked on aspect ratio. It is
+     * shared between multiple worker threads so that they can notify each other via context interrupts based on their
+     * individual results, i.e., a thread that found a result at aspect ratio x * y can interrupt all other threads
+     * that are working on larger layout sizes and a thread that proved x * y to be UNSAT can interrupt all other
+     * threads that are working on aspect ratios dominated by it. Access is restricted by ti_mutex.
      */
     struct thread_info
     {
         /**
-         * Pointer to a context.
+         * Pointers to the contexts of all solvers in the worker's portfolio.
          */
-        ctx_ptr ctx;
+        std::vector<ctx_ptr> ctxs;
         /**
          * Currently examined layout aspect ratio.
          */
         typename Lyt::aspect_ratio worker_aspect_ratio;
+        /**
+         * Flag to indicate that the worker's solvers are currently running on worker_aspect_ratio.
+         */
+        bool active = false;
+        /**
+         * Flag to indicate that the worker's contexts have been interrupted by another thread.
+         */
+        bool interrupted = false;
+    };
+    /**
+     * A single solver of a worker thread's portfolio. It owns its context and layout such that it can be raced against
+     * the other members of the portfolio and be replaced should its solver state become unusable.
+     */
+    struct portfolio_member
+    {
+        /**
+         * The context used by all solvers of this member.
+         */
+        ctx_ptr ctx;
+        /**
+         * The layout that this member's models are assigned to.
+         */
+        std::unique_ptr<Lyt> layout;
+        /**
+         * The SMT handler of this member.
+         */
+        std::unique_ptr<smt_handler> handler;
     };
     /**
-     * Thread function for the asynchronous solving strategy. It registers its own context in the given list of
-     * thread_info objects and starts exploring the search space. It fetches the next aspect ratio to work on from the
-     * global aspect ratio iterator which is protected by a mutex. When a result is found, other threads that are
-     * currently working on larger layout aspect ratios are interrupted while smaller ones may finish running.
+     * Creates a fresh portfolio member, i.e., a new context, layout, and SMT handler, from the given solver
+     * configuration.
      *
-     * @param t_num Thread's identifier.
-     * @param ti_list Pointer to a list of shared thread info that the threads use for communication.
-     * @return A found layout or nullptr if being interrupted.
+     * @param config Solver configuration of the new member.
+     * @return A portfolio member that has not examined any aspect ratio yet.
      */
-    [[nodiscard]] std::optional<Lyt> explore_asynchronously(const unsigned                                   t_num,
-                                                            const std::shared_ptr<std::vector<thread_info>>& ti_list)
+    [[nodiscard]] portfolio_member create_portfolio_member(const exact_solver_configuration& config) const
     {
-        const auto ctx = std::make_shared<z3::context>();
+        auto ctx     = std::make_shared<z3::context>();
+        auto layout  = std::make_unique<Lyt>(typename Lyt::aspect_ratio{}, scheme);
+        auto handler = std::make_unique<smt_handler>(ctx, *layout, *ntk, ps, black_list, config);
 
-        Lyt layout{{}, scheme};
+        return {std::move(ctx), std::move(layout), std::move(handler)};
+    }
+    /**
+     * Registers the contexts of the given portfolio in the thread_info object of thread t_num such that other threads
+     * are able to interrupt them.
+     *
+     * @param t_num Thread's identifier.
+     * @param portfolio The thread's solver portfolio.
+     * @param ti_list List of shared thread info.
+     */
+    void register_contexts(const unsigned t_num, const std::vector<portfolio_member>& portfolio,
+                           std::vector<thread_info>& ti_list)
+    {
+        std::lock_guard<std::mutex> guard(ti_mutex);
 
-        smt_handler handler{ctx, layout, *ntk, ps, black_list};
-        (*ti_list)[t_num].ctx = ctx;
+        auto& ctxs = ti_list[t_num].ctxs;
+        ctxs.clear();
 
-        while (true)
+        for (const auto& member : portfolio)
         {
-            typename Lyt::aspect_ratio ar;
+            ctxs.push_back(member.ctx);
+        }
+    }
+    /**
+     * Interrupts the contexts of all other threads whose currently examined aspect ratio satisfies the given
+     * predicate.
+     *
+     * @tparam Predicate Predicate type.
+     * @param t_num Identifier of the calling thread, which is never interrupted.
+     * @param ti_list List of shared thread info.
+     * @param pred Predicate that decides for an aspect ratio whether the thread examining it is to be interrupted.
+     */
+    template <typename Predicate>
+    void interrupt_workers(const unsigned t_num, std::vector<thread_info>& ti_list, Predicate&& pred)
+    {
+        std::lock_guard<std::mutex> guard(ti_mutex);
 
-            // mutually exclusive access to the aspect ratio iterator
+        for (auto i = 0u; i < ti_list.size(); ++i)
+        {
+            if (auto& ti = ti_list[i]; i != t_num && ti.active && pred(ti.worker_aspect_ratio))
             {
-                std::lock_guard<std::mutex> guard(ari_mutex);
-
-                ++ari;
-                ar = *ari;  // operations ++ and * are split to prevent a vector copy construction
+                for (const auto& ctx : ti.ctxs)
+                {
+                    ctx->interrupt();
+                }
 
-                // log the examination of a new aspect ratio
-                pst.num_aspect_ratios++;
+                ti.interrupted = true;
             }
+        }
+    }
+    /**
+     * Checks whether the given aspect ratio is dominated by one that has already been proven UNSAT, i.e., whether it
+     * is not larger in any dimension. Since any layout can be embedded into a larger one by leaving the additional
+     * tiles empty, dominated aspect ratios are UNSAT as well. This does not hold if I/Os are to be placed at the layout
+     * borders.
+     *
+     * @param ar Aspect ratio to check.
+     * @return `true` iff ar is known to be UNSAT.
+     */
+    [[nodiscard]] bool is_dominated(const typename Lyt::aspect_ratio& ar)
+    {
+        if (ps.border_io)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(unsat_mutex);
+
+        return std::any_of(unsat_aspect_ratios.cbegin(), unsat_aspect_ratios.cend(),
+                           [&ar](const auto& unsat_ar) { return ar.x <= unsat_ar.x && ar.y <= unsat_ar.y; });
+    }
+    /**
+     * Shares the given UNSAT aspect ratio as a lower bound with all threads and interrupts those that are currently
+     * examining aspect ratios dominated by it.
+     *
+     * @param ar Aspect ratio that has been proven UNSAT.
+     * @param t_num Identifier of the calling thread.
+     * @param ti_list List of shared thread info.
+     */
+    void share_unsat_aspect_ratio(const typename Lyt::aspect_ratio& ar, const unsigned t_num,
+                                  std::vector<thread_info>& ti_list)
+    {
+        if (ps.border_io)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(unsat_mutex);
+            unsat_aspect_ratios.push_back(ar);
+        }
+
+        interrupt_workers(t_num, ti_list,
+                          [&ar](const auto& worker_ar) { return worker_ar.x <= ar.x && worker_ar.y <= ar.y; });
+    }
+    /**
+     * Checks whether a result has been found already whose area is smaller than or equal to the one of the given
+     * aspect ratio.
+     *
+     * @param ar Aspect ratio to check.
+     * @return `true` iff examining ar cannot lead to a better result anymore.
+     */
+    [[nodiscard]] bool is_obsolete(const typename Lyt::aspect_ratio& ar)
+    {
+        std::lock_guard<std::mutex> guard(rar_mutex);
+
+        return result_aspect_ratio.has_value() && area(*result_aspect_ratio) <= area(ar);
+    }
+    /**
+     * Updates the timeouts of all members of the given portfolio.
+     *
+     * @param portfolio Solver portfolio whose timeouts are to be updated.
+     * @param time Time passed since beginning of the solving process.
+     */
+    void update_timeouts(std::vector<portfolio_member>& portfolio, const mockturtle::stopwatch<>::duration& time) const
+    {
+        for (auto& member : portfolio)
+        {
+            update_timeout(*member.handler, time);
+        }
+    }
+    /**
+     * Races all members of the given portfolio on aspect ratio ar. The first definite answer, i.e., SAT or UNSAT, is
+     * taken and all members that are still running at that point are interrupted. Interrupted solvers return
+     * `z3::unknown` but keep their state such that they can be reused incrementally. Members whose instance generation
+     * or solver call threw an exception, however, are left in an undefined state and are flagged in tainted so that
+     * they can be replaced afterwards.
+     *
+     * @param portfolio Solver portfolio to race.
+     * @param ar Aspect ratio to examine.
+     * @param tainted Flags for each member of the portfolio whether its state has become unusable.
+     * @return The first definite answer together with the index of the member that gave it. If no member came to a
+     * definite answer, `z3::unknown` is returned.
+     */
+    [[nodiscard]] std::pair<z3::check_result, std::size_t> race(std::vector<portfolio_member>&   portfolio,
+                                                                const typename Lyt::aspect_ratio& ar,
+                                                                std::vector<bool>&                tainted) const
+    {
+        const auto examine = [&ar](smt_handler& handler) -> std::optional<z3::check_result>
+        {
+            try
+            {
+                handler.update(ar);
 
-            if ((ar.x + 1) * (ar.y + 1) > ps.upper_bound_area || (ar.x >= ps.upper_bound_x && ar.y >= ps.upper_bound_y))
+                return handler.check();
+            }
+            catch (const z3::exception&)
             {
                 return std::nullopt;
             }
+        };
 
-            if (handler.skippable(ar))
-            {
-                continue;
-            }
+        // no need to spawn additional threads for a single solver
+        if (portfolio.size() == 1)
+        {
+            const auto result = examine(*portfolio.front().handler);
+
+            tainted.front() = !result.has_value();
 
-            // mutually exclusive access to the result aspect ratio
+            return {result.value_or(z3::unknown), 0ul};
+        }
+
+        std::vector<std::future<std::optional<z3::check_result>>> fut(portfolio.size());
+        for (auto i = 0ul; i < portfolio.size(); ++i)
+        {
+            fut[i] = std::async(std::launch::async, examine, std::ref(*portfolio[i].handler));
+        }
+
+        std::pair<z3::check_result, std::size_t> answer{z3::unknown, 0ul};
+        std::vector<bool>                        finished(portfolio.size(), false);
+
+        for (auto num_running = portfolio.size(); num_running > 0;)
+        {
+            for (auto i = 0ul; i < portfolio.size(); ++i)
             {
-                std::lock_guard<std::mutex> guard(rar_mutex);
+                using namespace std::chrono_literals;
+                if (finished[i] || fut[i].wait_for(10ms) == std::future_status::timeout)
+                {
+                    continue;
+                }
 
-                // a result is available already
-                if (result_aspect_ratio)
+                finished[i] = true;
+                --num_running;
+
+                const auto result = fut[i].get();
+
+                tainted[i] = !result.has_value();
+
+                if (const auto r = result.value_or(z3::unknown); r != z3::unknown && answer.first == z3::unknown)
                 {
-                    // stop working if its area is smaller or equal to the one currently at hand
-                    if (area(*result_aspect_ratio) <= area(ar))
+                    answer = {r, i};
+
+                    // interrupt all members that are still running
+                    for (auto j = 0ul; j < portfolio.size(); ++j)
                     {
-                        return std::nullopt;
+                        if (!finished[j])
+                        {
+                            portfolio[j].ctx->interrupt();
+                        }
                     }
                 }
             }
+        }
+
+        return answer;
+    }
+    /**
+     * Thread function for the asynchronous solving strategy. It creates its own solver portfolio, registers the
+     * portfolio's contexts in the given list of thread_info objects, and starts exploring the search space. It fetches
+     * the next aspect ratio to work on from the global aspect ratio iterator which is protected by a mutex and races
+     * its portfolio on it. When a result is found, other threads that are currently working on larger layout aspect
+     * ratios are interrupted while smaller ones may finish running. When an aspect ratio is proven UNSAT, it is shared
+     * with all other threads such that dominated aspect ratios are skipped.
+     *
+     * @param t_num Thread's identifier.
+     * @param ti_list Pointer to a list of shared thread info that the threads use for communication.
+     * @param start Point in time at which the solving process started.
+     * @return A found layout or std::nullopt if being interrupted.
+     */
+    [[nodiscard]] std::optional<Lyt> explore_asynchronously(const unsigned                                   t_num,
+                                                            const std::shared_ptr<std::vector<thread_info>>& ti_list,
+                                                            const std::chrono::steady_clock::time_point      start)
+    {
+        auto& tst = pst.thread_stats[t_num];
 
-            // update aspect ratio in the thread_info list and the handler
-            (*ti_list)[t_num].worker_aspect_ratio = ar;
-            handler.update(ar);
+        const auto configurations =
+            ps.portfolio.empty() ? std::vector<exact_solver_configuration>{exact_solver_configuration{}} : ps.portfolio;
 
-            try
+        tst.num_wins.assign(configurations.size(), 0u);
+
+        std::vector<portfolio_member> portfolio{};
+        portfolio.reserve(configurations.size());
+
+        for (const auto& config : configurations)
+        {
+            portfolio.push_back(create_portfolio_member(config));
+        }
+
+        register_contexts(t_num, portfolio, *ti_list);
+
+        const auto time_elapsed = [&start] { return std::chrono::steady_clock::now() - start; };
+
+        try
+        {
+            while (true)
             {
-                mockturtle::stopwatch stop{pst.time_total};
+                typename Lyt::aspect_ratio ar;
+
+                // mutually exclusive access to the aspect ratio iterator
+                {
+                    std::lock_guard<std::mutex> guard(ari_mutex);
 
-                if (handler.is_satisfiable())  // found a layout
+                    ++ari;
+                    ar = *ari;  // operations ++ and * are split to prevent a vector copy construction
+
+                    // log the examination of a new aspect ratio
+                    pst.num_aspect_ratios++;
+                }
+
+                if ((ar.x + 1) * (ar.y + 1) > ps.upper_bound_area ||
+                    (ar.x >= ps.upper_bound_x && ar.y >= ps.upper_bound_y))
+                {
+                    return std::nullopt;
+                }
+
+                if (portfolio.front().handler->skippable(ar))
+                {
+                    continue;
+                }
+
+                if (is_dominated(ar))
                 {
-                    // mutually exclusive access to the result_aspect_ratio
+                    ++tst.num_dominated;
+                    continue;
+                }
+
+                // stop working if a result with an area smaller or equal to the one at hand is available already
+                if (is_obsolete(ar))
+                {
+                    return std::nullopt;
+                }
+
+                update_timeouts(portfolio, time_elapsed());
+
+                for (auto examined = false; !examined;)
+                {
+                    // make the aspect ratio known to the other threads
                     {
-                        std::lock_guard<std::mutex> guard(rar_mutex);
+                        std::lock_guard<std::mutex> guard(ti_mutex);
 
-                        // update the result_aspect_ratio if there is none
-                        if (!result_aspect_ratio)
-                        {
-                            result_aspect_ratio = ar;
-                        }
-                        else  // or if the own one is smaller
+                        (*ti_list)[t_num].worker_aspect_ratio = ar;
+                        (*ti_list)[t_num].active              = true;
+                    }
+
+                    std::vector<bool> tainted(portfolio.size(), false);
+
+                    const auto answer = mockturtle::call_with_stopwatch(
+                        tst.time_solving, [this, &portfolio, &ar, &tainted] { return race(portfolio, ar, tainted); });
+
+                    auto interrupted = false;
+
+                    {
+                        std::lock_guard<std::mutex> guard(ti_mutex);
+
+                        auto& ti = (*ti_list)[t_num];
+
+                        ti.active = false;
+                        std::swap(interrupted, ti.interrupted);
+                    }
+
+                    if (const auto [result, winner] = answer; result == z3::sat)  // found a layout
+                    {
+                        ++tst.num_sat;
+                        ++tst.num_wins[winner];
+
+                        // mutually exclusive access to the result_aspect_ratio
                         {
-                            if (area(*result_aspect_ratio) > area(ar))
+                            std::lock_guard<std::mutex> guard(rar_mutex);
+
+                            // update the result_aspect_ratio if there is none or if the own one is smaller
+                            if (!result_aspect_ratio || area(*result_aspect_ratio) > area(ar))
                             {
                                 result_aspect_ratio = ar;
                             }
@@ -2929,33 +3381,78 @@ class exact_impl
                                 return std::nullopt;
                             }
                         }
+
+                        // interrupt other threads that are working on higher aspect ratios
+                        interrupt_workers(t_num, *ti_list,
+                                          [&ar](const auto& worker_ar) { return area(ar) <= area(worker_ar); });
+
+                        return *portfolio[winner].layout;
+                    }
+                    else if (result == z3::unsat)  // no layout with this aspect ratio possible
+                    {
+                        ++tst.num_unsat;
+                        ++tst.num_wins[winner];
+
+                        share_unsat_aspect_ratio(ar, t_num, *ti_list);
+
+                        for (auto i = 0ul; i < portfolio.size(); ++i)
+                        {
+                            if (!tainted[i])
+                            {
+                                portfolio[i].handler->store_solver_state(ar);
+                            }
+                        }
+
+                        examined = true;
+                    }
+                    else  // undecided
+                    {
+                        ++tst.num_unknown;
+
+                        // without interruption from the outside, all solvers ran into the timeout
+                        if (!interrupted)
+                        {
+                            return std::nullopt;
+                        }
                     }
 
-                    // interrupt other threads that are working on higher aspect ratios
-                    for (const auto& ti : *ti_list)
+                    // replace all members whose state has become unusable
+                    if (std::any_of(tainted.cbegin(), tainted.cend(), [](const auto t) { return t; }))
                     {
-                        if (area(ar) <= area(ti.worker_aspect_ratio))
+                        for (auto i = 0ul; i < portfolio.size(); ++i)
                         {
-                            ti.ctx->interrupt();
+                            if (tainted[i])
+                            {
+                                portfolio[i] = create_portfolio_member(configurations[i]);
+                            }
                         }
+
+                        register_contexts(t_num, portfolio, *ti_list);
                     }
 
-                    return layout;
-                }
-                // no layout with this aspect ratio possible
-                // One could assume that interrupting other threads that are working on real smaller (not bigger
-                // in any dimension) layouts could be beneficial here. However, testing revealed that this code
-                // was hardly ever triggered and if it was, it impacted performance negatively because no solver
-                // state could be stored that could positively influence performance of later SMT calls
+                    if (!examined)
+                    {
+                        // interrupted because the aspect ratio turned out to be dominated by an UNSAT one
+                        if (is_dominated(ar))
+                        {
+                            ++tst.num_dominated;
+                            examined = true;
+                        }
+                        // interrupted because a result was found
+                        else if (is_obsolete(ar))
+                        {
+                            return std::nullopt;
+                        }
+                        // otherwise, examine the aspect ratio again
+                    }
 
-                handler.store_solver_state(ar);
-            }
-            catch (const z3::exception&)  // timed out or interrupted
-            {
-                return std::nullopt;
+                    update_timeouts(portfolio, time_elapsed());
+                }
             }
-
-            update_timeout(handler, pst.time_total);
+        }
+        catch (const z3::exception&)  // timed out
+        {
+            return std::nullopt;
         }
 
         // unreachable code, but compiler complains if it's not there
@@ -2972,17 +3469,23 @@ class exact_impl
 
         Lyt layout{{}, scheme};
 
+        const auto num_threads = std::max(ps.num_threads, std::size_t{1});
+
+        pst.thread_stats.assign(num_threads, {});
+
         {
             mockturtle::stopwatch stop{pst.time_total};
 
+            const auto start = std::chrono::steady_clock::now();
+
             using fut_layout = std::future<std::optional<Lyt>>;
-            std::vector<fut_layout> fut(ps.num_threads);
+            std::vector<fut_layout> fut(num_threads);
 
-            const auto ti_list = std::make_shared<std::vector<thread_info>>(ps.num_threads);
+            const auto ti_list = std::make_shared<std::vector<thread_info>>(num_threads);
 
 #if (PROGRESS_BARS)
             mockturtle::progress_bar thread_bar("[i] examining layout aspect ratios using {} threads");
-            thread_bar(ps.num_threads);
+            thread_bar(num_threads * std::max(ps.portfolio.size(), std::size_t{1}));
 
             auto post_toggle = false;
 
@@ -2990,16 +3493,16 @@ class exact_impl
                 "[i] some layout has been found; waiting for threads examining smaller aspect ratios to terminate");
 #endif
 
-            for (auto i = 0u; i < ps.num_threads; ++i)
+            for (auto i = 0u; i < num_threads; ++i)
             {
-                fut[i] = std::async(std::launch::async, &exact_impl::explore_asynchronously, this, i, ti_list);
+                fut[i] = std::async(std::launch::async, &exact_impl::explore_asynchronously, this, i, ti_list, start);
             }
 
             // wait for all tasks to finish running (can be made much prettier in C++20...)
             for (auto still_running = true; still_running;)
             {
                 still_running = false;
-                for (auto i = 0u; i < ps.num_threads; ++i)
+                for (auto i = 0u; i < num_threads; ++i)
                 {
                     using namespace std::chrono_literals;
                     if (fut[i].wait_for(10ms) == std::future_status::timeout)
@@ -3058,7 +3561,8 @@ class exact_impl
     {
         Lyt layout{{}, scheme};
 
-        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps, black_list};
+        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps, black_list,
+                            ps.portfolio.empty() ? exact_solver_configuration{} : ps.portfolio.front()};
 
         const auto upper_bound = std::min(static_cast<uint64_t>(ps.upper_bound_area),
                                           static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y));
@@ -3084,10 +3588,10 @@ class exact_impl
             bar(ar.x + 1, ar.y + 1);
 #endif
 
-            handler.update(ar);
-
             try
             {
+                handler.update(ar);
+
                 const auto sat =
                     mockturtle::call_with_stopwatch(pst.time_total, [&handler] { return handler.is_satisfiable(); });
 
@@ -3142,6 +3646,11 @@ class exact_impl
  * the individual solver runs which destroys the benefits of incremental solving and thereby, comparatively, slows down
  * each run.
  *
+ * Additionally, a portfolio of differently configured solvers can be raced on each aspect ratio (see
+ * `exact_physical_design_params::portfolio`), which evens out Z3's notoriously volatile runtimes. When exploring aspect
+ * ratios in parallel, aspect ratios that are proven UNSAT by one thread are shared with all others such that aspect
+ * ratios that are not larger in any dimension are skipped or aborted.
+ *
  * The SMT instance works with a single layer of variables even though it is possible to allow crossings in the
  * solution. The reduced number of variables saves a considerable amount of runtime. That's why
  * `layout.foreach_ground_tile()` is used even though the model will be mapped to a 3-dimensional layout afterwards.
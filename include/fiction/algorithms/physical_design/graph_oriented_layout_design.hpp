@@ -8,6 +8,7 @@
 #include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
 #include "fiction/algorithms/physical_design/post_layout_optimization.hpp"
 #include "fiction/layouts/bounding_box.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
@@ -26,21 +27,24 @@
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/immutable_view.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
-#include <future>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -144,8 +148,10 @@ struct graph_oriented_layout_design_params
      * Flag to enable or disable multithreading during the execution of the layout design algorithm.
      *
      * When set to `true`, the algorithm will utilize multiple threads to process different search space graphs in
-     * parallel, improving performance by distributing the workload across available CPU cores. If set to `false`, the
-     * algorithm will run sequentially on a single thread.
+     * parallel, improving performance by distributing the workload across available CPU cores. Individual vertex
+     * expansions are scheduled via work stealing such that threads that are done with their search space graphs take
+     * over the work of others instead of idling. If set to `false`, the algorithm will run sequentially on a single
+     * thread.
      *
      * Only recommended for `HIGH_EFFORT` and `HIGHEST_EFFORT` modes and complex networks (> 100 nodes).
      *
@@ -157,6 +163,15 @@ struct graph_oriented_layout_design_params
      * Default value: `false`
      */
     bool enable_multithreading = false;
+    /**
+     * Maximum number of partial layouts that are cached per search space graph. Expanding a vertex requires the
+     * partial layout of its parent vertex, i.e., the layout in which all but the last of the vertex's positions have
+     * been placed and routed. If that layout is cached, only the new node has to be placed and routed instead of
+     * rebuilding the entire partial layout from scratch. Once the limit is reached, the oldest cached layouts are
+     * evicted first. Setting this value to 0 disables caching. Caching is always disabled for custom cost objectives as
+     * they are not guaranteed to be monotonic in the number of placed nodes. Defaults to 16 layouts.
+     */
+    uint64_t num_layout_snapshots = 16u;
     /**
      * Verbosity.
      */
@@ -325,6 +340,50 @@ enum class pi_locations : std::uint8_t
      */
     TOP_AND_LEFT
 };
+/**
+ * Struct to hold information necessary for gate placement during layout generation for one vertex.
+ *
+ * @tparam ObstrLyt The type of the layout.
+ */
+template <typename ObstrLyt>
+struct placement_info
+{
+    /**
+     * The index of the current node being placed.
+     */
+    uint64_t current_node;
+    /**
+     * The index of the current primary output.
+     */
+    uint64_t current_po;
+    /**
+     * Mapping of nodes to their positions in the layout.
+     */
+    node_dict_type<ObstrLyt, tec_nt> node2pos;
+    /**
+     * Mapping of primary input nodes to layout nodes.
+     */
+    mockturtle::node_map<mockturtle::node<ObstrLyt>, tec_nt> pi2node;
+};
+/**
+ * A partial layout in which all positions of a search space graph vertex have been placed and routed, together with the
+ * respective placement information. Expansions of the vertex's children can resume from it instead of placing and
+ * routing all preceding positions again.
+ *
+ * @tparam ObstrLyt The type of the layout.
+ */
+template <typename ObstrLyt>
+struct vertex_snapshot
+{
+    /**
+     * The partial layout.
+     */
+    ObstrLyt layout;
+    /**
+     * The placement information after the vertex's last position has been placed.
+     */
+    placement_info<ObstrLyt> place_info;
+};
 /**
  * A structure representing a search space graph.
  *
@@ -379,6 +438,18 @@ struct search_space_graph
      */
     graph_oriented_layout_design_params::cost_objective cost =
         graph_oriented_layout_design_params::cost_objective::AREA;
+    /**
+     * Partial layouts of recently expanded vertices.
+     */
+    std::unordered_map<coord_vec_type<Lyt>, vertex_snapshot<Lyt>, detail::nested_vector_hash<Lyt>> snapshots{};
+    /**
+     * Vertices in `snapshots` in the order in which they were cached to evict the oldest ones first.
+     */
+    std::deque<coord_vec_type<Lyt>> snapshot_order{};
+    /**
+     * The maximum number of cached partial layouts.
+     */
+    uint64_t num_snapshots = 16u;
 };
 /**
  * @brief Custom view class derived from mockturtle::topo_view.
@@ -634,31 +705,6 @@ enum class new_gate_location : std::uint8_t
      */
     DEST
 };
-/**
- * Struct to hold information necessary for gate placement during layout generation for one vertex.
- *
- * @tparam ObstrLyt The type of the layout.
- */
-template <typename ObstrLyt>
-struct placement_info
-{
-    /**
-     * The index of the current node being placed.
-     */
-    uint64_t current_node;
-    /**
-     * The index of the current primary output.
-     */
-    uint64_t current_po;
-    /**
-     * Mapping of nodes to their positions in the layout.
-     */
-    node_dict_type<ObstrLyt, tec_nt> node2pos;
-    /**
-     * Mapping of primary input nodes to layout nodes.
-     */
-    mockturtle::node_map<mockturtle::node<ObstrLyt>, tec_nt> pi2node;
-};
 /**
  * Implementation of the graph-oriented layout design algorithm.
  * This class handles the initialization and execution of the algorithm.
@@ -721,54 +767,19 @@ class graph_oriented_layout_design_impl
             timeout = 10000u;
         }
 
-        // main loop
-        while (!timeout_limit_reached)
+        if (ps.enable_multithreading)
         {
-            // if multithreading is enabled
-            if (ps.enable_multithreading)
+            // individual vertex expansions of all search space graphs are distributed among worker threads
+            if (auto first_layout = expand_in_parallel(best_lyt, timeout_set); first_layout.has_value())
             {
-                // mutex to protect the best found layout and statistics
-                std::mutex                                   update_best_layout_mutex{};
-                std::vector<std::future<std::optional<Lyt>>> futures{};
-                futures.reserve(ssg_vec.size());
-
-                // process `ssg_vec` in parallel using std::async
-                for (auto& ssg : ssg_vec)
-                {
-                    futures.emplace_back(std::async(std::launch::async,
-                                                    [&]() -> std::optional<Lyt>
-                                                    {
-                                                        auto result = process_ssg(ssg);
-                                                        if (result)
-                                                        {
-                                                            const std::lock_guard<std::mutex> lock(
-                                                                update_best_layout_mutex);
-                                                            best_lyt = *result;
-                                                            restore_names(ssg.network, best_lyt);
-                                                            update_stats(best_lyt);
-
-                                                            if (ps.return_first)
-                                                            {
-                                                                return best_lyt;
-                                                            }
-                                                        }
-                                                        return std::nullopt;
-                                                    }));
-                }
-
-                // check the futures for the result
-                for (auto& future : futures)
-                {
-                    const auto result = future.get();  // blocking wait to get the result from the future
-                    if (result)
-                    {
-                        return *result;  // return the first found layout if ps.return_first is true
-                    }
-                }
+                return first_layout;
             }
-            else
+        }
+        else
+        {
+            // main loop
+            while (!timeout_limit_reached)
             {
-                // single-threaded version
                 for (auto& ssg : ssg_vec)
                 {
                     auto result = process_ssg(ssg);
@@ -784,42 +795,17 @@ class graph_oriented_layout_design_impl
                         }
                     }
                 }
-            }
 
-            // update current_vertex and frontier_flag (non-parallel for now)
-            for (auto& ssg : ssg_vec)
-            {
-                if (ssg.frontier_flag)
+                // update current_vertex and frontier_flag
+                for (auto& ssg : ssg_vec)
                 {
-                    if (!ssg.frontier.empty())
-                    {
-                        ssg.current_vertex = ssg.frontier.get();
-                    }
-                    else
-                    {
-                        ssg.frontier_flag = false;
-                    }
+                    select_next_vertex(ssg);
                 }
-            }
-
-            // check if timeout is reached or solution found
-            timeout_limit_reached =
-                std::none_of(ssg_vec.cbegin(), ssg_vec.cend(), [](const auto& ssg) { return ssg.frontier_flag; });
-
-            const auto end = std::chrono::high_resolution_clock::now();
-            const auto duration_ms =
-                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 
-            if (duration_ms >= timeout)
-            {
-                // terminate the algorithm if the specified timeout was set or a solution was found in low-effort mode
-                if ((ps.mode == graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY &&
-                     (improve_area_solution || improve_wire_solution || improve_crossing_solution ||
-                      improve_acp_solution || improve_custom_solution)) ||
-                    timeout_set)
-                {
-                    timeout_limit_reached = true;
-                }
+                // check if timeout is reached or solution found
+                timeout_limit_reached =
+                    std::none_of(ssg_vec.cbegin(), ssg_vec.cend(), [](const auto& ssg) { return ssg.frontier_flag; }) ||
+                    time_limit_reached(timeout_set);
             }
         }
 
@@ -988,6 +974,225 @@ class graph_oriented_layout_design_impl
         pst.num_wires     = best_lyt.num_wires();
         pst.num_crossings = best_lyt.num_crossings();
     }
+    /**
+     * Checks whether the algorithm has to terminate due to its time limit. That is the case if the timeout has expired
+     * and it was either specified explicitly or a solution has already been found in high-efficiency mode.
+     *
+     * @param timeout_set Flag indicating whether the timeout was specified explicitly.
+     * @return `true` iff the algorithm has to terminate.
+     */
+    [[nodiscard]] bool time_limit_reached(const bool timeout_set) const noexcept
+    {
+        const auto end = std::chrono::high_resolution_clock::now();
+        const auto duration_ms =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
+        if (duration_ms < timeout)
+        {
+            return false;
+        }
+
+        // terminate the algorithm if the specified timeout was set or a solution was found in low-effort mode
+        return timeout_set || (ps.mode == graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY &&
+                               (improve_area_solution || improve_wire_solution || improve_crossing_solution ||
+                                improve_acp_solution || improve_custom_solution));
+    }
+    /**
+     * Selects the most promising vertex in the frontier of the given search space graph as the next one to be expanded.
+     * If the frontier is empty, the search space graph is deactivated.
+     *
+     * @param ssg The search space graph.
+     */
+    static void select_next_vertex(search_space_graph<ObstrLyt>& ssg) noexcept
+    {
+        if (ssg.frontier_flag)
+        {
+            if (!ssg.frontier.empty())
+            {
+                ssg.current_vertex = ssg.frontier.get();
+            }
+            else
+            {
+                ssg.frontier_flag = false;
+            }
+        }
+    }
+    /**
+     * Lowers the given cost bound to `cost` if the latter is smaller. Since bounds are shared among all threads, the
+     * update is performed atomically such that no improvement found by another thread is overwritten.
+     *
+     * @param bound The cost bound to lower.
+     * @param cost The cost of a newly found solution.
+     * @return `true` iff `bound` was lowered to `cost`.
+     */
+    static bool lower_bound_to(std::atomic<uint64_t>& bound, const uint64_t cost) noexcept
+    {
+        auto current = bound.load();
+
+        while (cost < current)
+        {
+            if (bound.compare_exchange_weak(current, cost))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Expands all search space graphs in parallel until their frontiers are exhausted, the time limit is reached, or,
+     * if `return_first` is set, the first layout is found.
+     *
+     * Each step of a search space graph, i.e., the expansion of its current vertex followed by the selection of the
+     * next one, constitutes a task. Since consecutive steps of the same search space graph depend on each other, a
+     * graph is processed by at most one thread at a time, but it may move to another thread after every step. Each
+     * worker thread processes the search space graphs in its own queue in a round-robin fashion and steals from the
+     * queues of the other threads once its own queue runs dry. Hence, no thread idles while there are search space
+     * graphs left that are not being expanded by other threads, and the runtime follows the total amount of work
+     * instead of the slowest search space graph. All threads prune the search against the shared atomic cost bounds of
+     * the best solutions found so far.
+     *
+     * @param best_lyt The best layout found so far, which is updated whenever an improved layout is found.
+     * @param timeout_set Flag indicating whether the timeout was specified explicitly.
+     * @return The first found layout if `return_first` is set and a layout was found, `std::nullopt` otherwise.
+     */
+    std::optional<Lyt> expand_in_parallel(Lyt& best_lyt, const bool timeout_set)
+    {
+        const auto num_threads =
+            std::max(std::min(static_cast<std::size_t>(std::thread::hardware_concurrency()), ssg_vec.size()),
+                     std::size_t{1});
+
+        // each thread owns a queue of indices of active search space graphs
+        std::vector<std::deque<std::size_t>> queues(num_threads);
+        std::vector<std::mutex>              queue_mutexes(num_threads);
+
+        std::atomic<std::size_t> num_active_ssgs{0};
+
+        for (std::size_t i = 0; i < ssg_vec.size(); ++i)
+        {
+            if (ssg_vec[i].frontier_flag)
+            {
+                queues[i % num_threads].push_back(i);
+                ++num_active_ssgs;
+            }
+        }
+
+        std::atomic<bool> terminate{false};
+
+        // protects the best found layout, its cost, and the statistics
+        std::mutex              best_layout_mutex{};
+        std::optional<uint64_t> best_layout_cost{};
+        std::optional<Lyt>      first_layout{};
+
+        // fetches the next search space graph from the own queue or steals one from another thread's queue
+        const auto fetch_task = [&queues, &queue_mutexes, num_threads](const std::size_t thread_id)
+        {
+            for (std::size_t offset = 0; offset < num_threads; ++offset)
+            {
+                const auto victim = (thread_id + offset) % num_threads;
+
+                const std::lock_guard<std::mutex> lock(queue_mutexes[victim]);
+
+                if (auto& queue = queues[victim]; !queue.empty())
+                {
+                    // own tasks are taken from the front and stolen ones from the back to reduce contention
+                    const auto task = offset == 0 ? queue.front() : queue.back();
+
+                    if (offset == 0)
+                    {
+                        queue.pop_front();
+                    }
+                    else
+                    {
+                        queue.pop_back();
+                    }
+
+                    return std::optional<std::size_t>{task};
+                }
+            }
+
+            return std::optional<std::size_t>{};
+        };
+
+        const auto worker = [&](const std::size_t thread_id)
+        {
+            while (!terminate && num_active_ssgs > 0)
+            {
+                const auto task = fetch_task(thread_id);
+
+                if (!task.has_value())
+                {
+                    // all remaining search space graphs are currently being expanded by other threads
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                auto& ssg = ssg_vec[*task];
+
+                if (const auto result = process_ssg(ssg); result.has_value())
+                {
+                    const auto cost = calculate_cost(*result, ps.cost);
+
+                    const std::lock_guard<std::mutex> lock(best_layout_mutex);
+
+                    // another thread might have stored an even better layout in the meantime
+                    if (!best_layout_cost.has_value() || cost < *best_layout_cost)
+                    {
+                        best_layout_cost = cost;
+                        best_lyt         = *result;
+                        restore_names(ssg.network, best_lyt);
+                        update_stats(best_lyt);
+                    }
+
+                    if (ps.return_first)
+                    {
+                        if (!first_layout.has_value())
+                        {
+                            first_layout = best_lyt;
+                        }
+
+                        terminate = true;
+
+                        return;
+                    }
+                }
+
+                select_next_vertex(ssg);
+
+                if (ssg.frontier_flag)
+                {
+                    const std::lock_guard<std::mutex> lock(queue_mutexes[thread_id]);
+                    queues[thread_id].push_back(*task);
+                }
+                else
+                {
+                    --num_active_ssgs;
+                }
+
+                if (time_limit_reached(timeout_set))
+                {
+                    terminate = true;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t thread_id = 0; thread_id < num_threads; ++thread_id)
+        {
+            threads.emplace_back(worker, thread_id);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        timeout_limit_reached = true;
+
+        return first_layout;
+    }
     /**
      * Checks if there is a path between the source and destination tiles in the given layout.
      *
@@ -1012,10 +1217,13 @@ class graph_oriented_layout_design_impl
             using dist = twoddwave_distance_functor<ObstrLyt, uint64_t>;
             using cost = unit_cost_functor<ObstrLyt, uint8_t>;
 
-            static a_star_params a_star_crossing_params{};
+            a_star_params a_star_crossing_params{};
             a_star_crossing_params.crossings = !planar;
 
-            return a_star<layout_coordinate_path<ObstrLyt>>(layout, {src, dest}, dist(), cost(),
+            // search space graphs may be expanded in parallel; hence, each thread reuses its own search buffers
+            thread_local preferred_path_search_context<tile<ObstrLyt>, uint64_t> path_finding_context{};
+
+            return a_star<layout_coordinate_path<ObstrLyt>>(layout, {src, dest}, path_finding_context, dist(), cost(),
                                                             a_star_crossing_params);
         }
 
@@ -1560,7 +1768,7 @@ class graph_oriented_layout_design_impl
     {
         const auto layout_depth = planar ? 0 : 1;
         Lyt        lyt{{min_layout_width - 1, 0, layout_depth}, twoddwave_clocking<Lyt>()};
-        return obstruction_layout<Lyt>(lyt);
+        return obstruction_layout<Lyt>(lyt, obstruction_storage::DENSE);
     }
     /**
      * Adjusts the layout size based on the last position.
@@ -1615,6 +1823,134 @@ class graph_oriented_layout_design_impl
         }
         return cost;
     }
+    /**
+     * Fetches whether a solution has already been found for the given cost objective and, if so, its cost.
+     *
+     * @param cost_function The cost objective.
+     * @return A pair of a flag indicating whether a solution has already been found and the cost of the best one.
+     */
+    [[nodiscard]] std::pair<bool, uint64_t>
+    best_solution_for(const graph_oriented_layout_design_params::cost_objective cost_function) const noexcept
+    {
+        switch (cost_function)
+        {
+            case graph_oriented_layout_design_params::cost_objective::AREA:
+            {
+                return {improve_area_solution, best_area_solution};
+            }
+            case graph_oriented_layout_design_params::cost_objective::WIRES:
+            {
+                return {improve_wire_solution, best_wire_solution};
+            }
+            case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
+            {
+                return {improve_crossing_solution, best_crossing_solution};
+            }
+            case graph_oriented_layout_design_params::cost_objective::ACP:
+            {
+                return {improve_acp_solution, best_acp_solution};
+            }
+            default:
+            {
+                return {improve_custom_solution, best_custom_solution};
+            }
+        }
+    }
+    /**
+     * Checks whether partial layouts are cached for the given search space graph.
+     *
+     * @param ssg The search space graph.
+     * @return `true` iff partial layouts of `ssg` are to be cached.
+     */
+    [[nodiscard]] static bool snapshots_enabled(const search_space_graph<ObstrLyt>& ssg) noexcept
+    {
+        return ssg.num_snapshots > 0 && ssg.cost != graph_oriented_layout_design_params::cost_objective::CUSTOM;
+    }
+    /**
+     * Creates an independent copy of the given placement information. Copies of node maps share their storage; hence,
+     * all mapped values are transferred to newly allocated maps.
+     *
+     * @param place_info The placement information to copy.
+     * @param network The network whose nodes are mapped.
+     * @return A deep copy of `place_info`.
+     */
+    [[nodiscard]] static placement_info<ObstrLyt> clone_placement_info(const placement_info<ObstrLyt>& place_info,
+                                                                       const tec_nt&                   network) noexcept
+    {
+        placement_info<ObstrLyt> copy{place_info.current_node, place_info.current_po,
+                                      node_dict_type<ObstrLyt, tec_nt>{network},
+                                      mockturtle::node_map<mockturtle::node<ObstrLyt>, tec_nt>{network}};
+
+        network.foreach_node(
+            [&copy, &place_info](const auto& n)
+            {
+                copy.node2pos[n] = place_info.node2pos[n];
+                copy.pi2node[n]  = place_info.pi2node[n];
+            });
+
+        return copy;
+    }
+    /**
+     * Fetches the cached partial layout of the parent of the current vertex in the given search space graph.
+     *
+     * @param ssg The search space graph.
+     * @return A pointer to the parent's snapshot or `nullptr` if it is not cached.
+     */
+    [[nodiscard]] static const vertex_snapshot<ObstrLyt>*
+    parent_snapshot(const search_space_graph<ObstrLyt>& ssg) noexcept
+    {
+        if (ssg.current_vertex.size() < 2 || ssg.snapshots.empty())
+        {
+            return nullptr;
+        }
+
+        const coord_vec_type<ObstrLyt> parent{ssg.current_vertex.cbegin(), std::prev(ssg.current_vertex.cend())};
+
+        if (const auto it = ssg.snapshots.find(parent); it != ssg.snapshots.cend())
+        {
+            return &it->second;
+        }
+
+        return nullptr;
+    }
+    /**
+     * Creates a snapshot of the partial layout of the current vertex in the given search space graph unless caching is
+     * disabled or the vertex has already been cached.
+     *
+     * @param ssg The search space graph.
+     * @param layout The partial layout in which all positions of the current vertex have been placed and routed.
+     * @param place_info The respective placement information.
+     * @return A snapshot of the current vertex or `std::nullopt` if none is needed.
+     */
+    [[nodiscard]] static std::optional<vertex_snapshot<ObstrLyt>>
+    create_snapshot(const search_space_graph<ObstrLyt>& ssg, const ObstrLyt& layout,
+                    const placement_info<ObstrLyt>& place_info) noexcept
+    {
+        if (!snapshots_enabled(ssg) || ssg.snapshots.count(ssg.current_vertex) > 0)
+        {
+            return std::nullopt;
+        }
+
+        return vertex_snapshot<ObstrLyt>{layout.clone(), clone_placement_info(place_info, ssg.network)};
+    }
+    /**
+     * Caches the given snapshot of the current vertex in the given search space graph. If the cache is full, the oldest
+     * snapshot is evicted.
+     *
+     * @param ssg The search space graph.
+     * @param snapshot The snapshot of the current vertex.
+     */
+    static void cache_snapshot(search_space_graph<ObstrLyt>& ssg, vertex_snapshot<ObstrLyt>&& snapshot) noexcept
+    {
+        if (ssg.snapshot_order.size() >= ssg.num_snapshots)
+        {
+            ssg.snapshots.erase(ssg.snapshot_order.front());
+            ssg.snapshot_order.pop_front();
+        }
+
+        ssg.snapshots.emplace(ssg.current_vertex, std::move(snapshot));
+        ssg.snapshot_order.push_back(ssg.current_vertex);
+    }
     /**
      * Generates the next possible positions with their priorities based on the layout and search space graph.
      *
@@ -1683,11 +2019,16 @@ class graph_oriented_layout_design_impl
         std::vector<std::pair<coord_vec_type<ObstrLyt>, double>> next_positions;
         next_positions.reserve(2 * ssg.num_expansions);
 
-        auto layout = initialize_layout(min_layout_width, ssg.planar);
+        // resume from the partial layout of the parent vertex if it is cached; otherwise, start from scratch
+        const auto* const parent = parent_snapshot(ssg);
+
+        auto layout = parent != nullptr ? parent->layout.clone() : initialize_layout(min_layout_width, ssg.planar);
 
-        auto                             pi2node = reserve_input_nodes(layout, ssg.network);
-        node_dict_type<ObstrLyt, tec_nt> node2pos{ssg.network};
-        placement_info<ObstrLyt>         place_info{0ul, 0ul, node2pos, pi2node};
+        auto place_info =
+            parent != nullptr ?
+                clone_placement_info(parent->place_info, ssg.network) :
+                placement_info<ObstrLyt>{0ul, 0ul, node_dict_type<ObstrLyt, tec_nt>{ssg.network},
+                                         reserve_input_nodes(layout, ssg.network)};
 
         coord_vec_type<ObstrLyt> possible_positions{};
         possible_positions.reserve(2 * ssg.num_expansions);
@@ -1697,7 +2038,19 @@ class graph_oriented_layout_design_impl
             possible_positions = get_possible_positions(layout, ssg, place_info);
         }
 
-        for (uint64_t idx = 0ul; idx < ssg.current_vertex.size(); ++idx)
+        if (parent != nullptr)
+        {
+            // the parent's partial layout might have become too costly since it was cached; as the cost objectives are
+            // monotonic, checking it is equivalent to checking all of its predecessors during a full replay
+            if (const auto [improve_solution, best_solution] = best_solution_for(ssg.cost);
+                improve_solution && calculate_cost(layout, ssg.cost) >= best_solution)
+            {
+                return {{}, std::nullopt};
+            }
+        }
+
+        for (uint64_t idx = parent != nullptr ? ssg.current_vertex.size() - 1 : 0ul; idx < ssg.current_vertex.size();
+             ++idx)
         {
             const auto position = ssg.current_vertex[idx];
 
@@ -1706,40 +2059,7 @@ class graph_oriented_layout_design_impl
             uint64_t cost         = 0ul;
             uint64_t desired_cost = 0ul;
 
-            bool     improve_solution = improve_custom_solution;
-            uint64_t best_solution    = best_custom_solution;
-
-            switch (ssg.cost)
-            {
-                case graph_oriented_layout_design_params::cost_objective::AREA:
-                {
-                    improve_solution = improve_area_solution;
-                    best_solution    = best_area_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::WIRES:
-                {
-                    improve_solution = improve_wire_solution;
-                    best_solution    = best_wire_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
-                {
-                    improve_solution = improve_crossing_solution;
-                    best_solution    = best_crossing_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::ACP:
-                {
-                    improve_solution = improve_acp_solution;
-                    best_solution    = best_acp_solution;
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
+            auto [improve_solution, best_solution] = best_solution_for(ssg.cost);
 
             if (improve_solution)
             {
@@ -1755,31 +2075,31 @@ class graph_oriented_layout_design_impl
                     case graph_oriented_layout_design_params::cost_objective::AREA:
                     {
                         improve_area_solution = true;
-                        best_area_solution    = cost;
+                        lower_bound_to(best_area_solution, cost);
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::WIRES:
                     {
                         improve_wire_solution = true;
-                        best_wire_solution    = cost;
+                        lower_bound_to(best_wire_solution, cost);
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
                     {
                         improve_crossing_solution = true;
-                        best_crossing_solution    = cost;
+                        lower_bound_to(best_crossing_solution, cost);
                         break;
                     }
                     case graph_oriented_layout_design_params::cost_objective::ACP:
                     {
                         improve_acp_solution = true;
-                        best_acp_solution    = cost;
+                        lower_bound_to(best_acp_solution, cost);
                         break;
                     }
                     default:
                     {
                         improve_custom_solution = true;
-                        best_custom_solution    = cost;
+                        lower_bound_to(best_custom_solution, cost);
                         break;
                     }
                 }
@@ -1795,10 +2115,8 @@ class graph_oriented_layout_design_impl
 
                 desired_cost = calculate_cost(layout, ps.cost);
 
-                if (desired_cost < best_optimized_solution)
+                if (lower_bound_to(best_optimized_solution, desired_cost))
                 {
-                    best_optimized_solution = desired_cost;
-
                     if (ps.verbose)
                     {
                         print_placement_info(layout);
@@ -1810,40 +2128,8 @@ class graph_oriented_layout_design_impl
                 return {{}, std::nullopt};
             }
 
-            improve_solution = improve_custom_solution;
-            best_solution    = best_custom_solution;
+            std::tie(improve_solution, best_solution) = best_solution_for(ssg.cost);
 
-            switch (ssg.cost)
-            {
-                case graph_oriented_layout_design_params::cost_objective::AREA:
-                {
-                    improve_solution = improve_area_solution;
-                    best_solution    = best_area_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::WIRES:
-                {
-                    improve_solution = improve_wire_solution;
-                    best_solution    = best_wire_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
-                {
-                    improve_solution = improve_crossing_solution;
-                    best_solution    = best_crossing_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::ACP:
-                {
-                    improve_solution = improve_acp_solution;
-                    best_solution    = best_acp_solution;
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
             if (improve_solution && cost >= best_solution)
             {
                 return {{}, std::nullopt};
@@ -1853,11 +2139,19 @@ class graph_oriented_layout_design_impl
             // check if it's the last position in the current vertex
             if (idx == (ssg.current_vertex.size() - 1))
             {
+                // the snapshot has to be taken before validation because the latter temporarily resizes the layout
+                auto snapshot = create_snapshot(ssg, layout, place_info);
+
                 if (!valid_layout(layout, ssg, place_info))
                 {
                     return {{}, std::nullopt};
                 }
 
+                if (snapshot.has_value())
+                {
+                    cache_snapshot(ssg, std::move(*snapshot));
+                }
+
                 possible_positions = get_possible_positions(layout, ssg, place_info);
             }
         }
@@ -1894,8 +2188,8 @@ class graph_oriented_layout_design_impl
         return std::nullopt;
     }
     /**
-     * Initializes the allowed positions for primary inputs (PIs), the cost for each search space graph and the maximum
-     * number of expansions.
+     * Initializes the allowed positions for primary inputs (PIs), the cost for each search space graph, the maximum
+     * number of expansions, and the maximum number of cached partial layouts.
      */
     void initialize_pis_cost_and_num_expansions() noexcept
     {
@@ -1925,6 +2219,7 @@ class graph_oriented_layout_design_impl
             graph.cost_so_far[graph.current_vertex] = 0;
             graph.num_expansions                    = ps.num_vertex_expansions;
             graph.planar                            = ps.planar;
+            graph.num_snapshots                     = ps.num_layout_snapshots;
         }
     }
     /**
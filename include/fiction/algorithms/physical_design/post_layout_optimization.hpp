@@ -11,6 +11,8 @@
 #include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/multi_target_a_star.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
 #include "fiction/algorithms/physical_design/wiring_reduction.hpp"
 #include "fiction/layouts/bounding_box.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
@@ -386,8 +388,8 @@ class post_layout_optimization_impl
         // determine the maximum number of gate relocations
         max_gate_relocations = ps.max_gate_relocations.value_or((plyt.x() + 1) * (plyt.y() + 1));
 
-        // create an obstruction layout based on the original layout
-        auto layout = obstruction_layout<Lyt>(plyt);
+        // create an obstruction layout based on the original layout; dense storage avoids hashing in path finding
+        auto layout = obstruction_layout<Lyt>(plyt, obstruction_storage::DENSE);
 
         // initialize flags to control the optimization loop
         bool moved_at_least_one_gate = true;
@@ -548,6 +550,10 @@ class post_layout_optimization_impl
      * Wiring reduction stats.
      */
     fiction::wiring_reduction_stats wiring_reduction_stats{};
+    /**
+     * Search context that is shared by all A* calls to avoid reallocating the search data structures for each path.
+     */
+    preferred_path_search_context<tile<Lyt>, uint64_t> path_finding_context{};
     /**
      * Utility function to move wires that cross over empty tiles down one layer. This can happen if the wiring of a
      * gate is deleted.
@@ -764,8 +770,8 @@ class post_layout_optimization_impl
         static a_star_params astar_params{};
         astar_params.crossings = !ps.planar_optimization;
 
-        const auto path =
-            a_star<layout_coordinate_path<ObstrLyt>>(lyt, {start_tile, end_tile}, dist(), cost(), astar_params);
+        const auto path = a_star<layout_coordinate_path<ObstrLyt>>(lyt, {start_tile, end_tile}, path_finding_context,
+                                                                   dist(), cost(), astar_params);
 
         // obstruct the tiles along the computed path.
         for (const auto& tile : path)
@@ -775,6 +781,88 @@ class post_layout_optimization_impl
 
         return path;
     }
+    /**
+     * Determines for each fan-in of a gate which of the gate's potential new positions cannot be reached from that
+     * fan-in at all. Relocations to such positions are bound to fail, so the exhaustive search for a path from the
+     * respective fan-in can be skipped there.
+     *
+     * The searches are conducted on the layout as it is passed, i.e., after the gate's wiring has been removed. All
+     * occupied tiles, including the gate's current position and the tiles of its fan-ins and fan-outs, are obstructed
+     * here just like they are during every relocation attempt. The only difference is the gate's current position,
+     * which it leaves during relocation. Therefore, for each fan-in from which that position is reachable, a second
+     * search starts at both the fan-in and the current position to account for paths leading through it. Since every
+     * relocation attempt obstructs at least as much as these searches see, a position that is unreachable here is
+     * unreachable during every relocation attempt as well.
+     *
+     * @param lyt Obstructed gate-level layout.
+     * @param fanins Fan-ins of the gate.
+     * @param old_pos Current position of the gate.
+     * @param min_x Minimum x-coordinate of potential new positions.
+     * @param min_y Minimum y-coordinate of potential new positions.
+     * @param max_diagonal Maximum sum of x- and y-coordinate of potential new positions.
+     * @return One set per fan-in in the order of `fanins` that contains the potential new positions that are
+     * unreachable from the respective fan-in.
+     */
+    std::vector<phmap::flat_hash_set<tile<ObstrLyt>>>
+    determine_unreachable_positions(const ObstrLyt& lyt, const std::vector<tile<Lyt>>& fanins,
+                                    const tile<ObstrLyt>& old_pos, const uint64_t min_x, const uint64_t min_y,
+                                    const uint64_t max_diagonal)
+    {
+        std::vector<tile<ObstrLyt>> candidates{};
+
+        for (auto y = min_y; y <= std::min(static_cast<uint64_t>(lyt.y()), max_diagonal); ++y)
+        {
+            for (auto x = min_x; x <= lyt.x() && x + y <= max_diagonal; ++x)
+            {
+                if (const auto t = tile<ObstrLyt>{x, y}; lyt.is_empty_tile(t) && lyt.is_empty_tile({x, y, 1}))
+                {
+                    candidates.push_back(t);
+                }
+            }
+        }
+
+        // the gate's current position is an additional target that is reached but not passed through
+        auto targets = candidates;
+        targets.push_back(old_pos);
+
+        // reachability does not depend on the heuristic; hence, Dijkstra's algorithm is used to avoid evaluating the
+        // distance to all candidates in each step
+        const distance_functor<ObstrLyt, uint64_t> no_heuristic{
+            [](const ObstrLyt&, const tile<ObstrLyt>&, const tile<ObstrLyt>&) { return uint64_t{0}; }};
+
+        a_star_params astar_params{};
+        astar_params.crossings = !ps.planar_optimization;
+
+        std::vector<phmap::flat_hash_set<tile<ObstrLyt>>> unreachable_positions{};
+        unreachable_positions.reserve(fanins.size());
+
+        for (const auto& fanin : fanins)
+        {
+            auto paths = multi_target_a_star<layout_coordinate_path<ObstrLyt>>(
+                lyt, {fanin}, targets, path_finding_context, no_heuristic, unit_cost_functor<ObstrLyt, uint8_t>(),
+                astar_params);
+
+            // the gate vacates its current position during relocation; hence, paths may lead through it
+            if (!paths.back().empty())
+            {
+                paths = multi_target_a_star<layout_coordinate_path<ObstrLyt>>(
+                    lyt, {fanin, old_pos}, candidates, path_finding_context, no_heuristic,
+                    unit_cost_functor<ObstrLyt, uint8_t>(), astar_params);
+            }
+
+            auto& unreachable = unreachable_positions.emplace_back();
+
+            for (auto i = 0ul; i < candidates.size(); ++i)
+            {
+                if (paths[i].empty())
+                {
+                    unreachable.insert(candidates[i]);
+                }
+            }
+        }
+
+        return unreachable_positions;
+    }
     /**
      * Calculates the elapsed milliseconds since the `start` time, sets the `timeout_limit_reached` flag
      * if the timeout is exceeded, and returns the remaining time.
@@ -802,14 +890,16 @@ class post_layout_optimization_impl
      * @param moved_gate           Reference to a boolean flag that will be set to `true` if the gate is successfully
      * moved.
      * @param old_pos              The original tile position of the gate before the relocation attempt.
+     * @param unreachable_positions Positions that are unreachable from each fan-in (see
+     *                              `determine_unreachable_positions`).
      *
      * @return `true` if the gate was successfully relocated to `new_pos` and all routing paths were established.
      *         `false` if the relocation resulted in no movement (i.e., `new_pos` is the same as `old_pos`).
      */
     bool check_new_position(ObstrLyt& lyt, const tile<ObstrLyt>& new_pos, uint64_t& num_gate_relocations,
                             tile<ObstrLyt>& current_pos, const std::vector<tile<Lyt>>& fanins,
-                            const std::vector<tile<Lyt>>& fanouts, bool& moved_gate,
-                            const tile<ObstrLyt>& old_pos) noexcept
+                            const std::vector<tile<Lyt>>& fanouts, bool& moved_gate, const tile<ObstrLyt>& old_pos,
+                            const std::vector<phmap::flat_hash_set<tile<ObstrLyt>>>& unreachable_positions) noexcept
     {
         if (lyt.is_empty_tile(new_pos) && lyt.is_empty_tile({new_pos.x, new_pos.y, 1}))
         {
@@ -824,13 +914,15 @@ class post_layout_optimization_impl
             // get paths for fanins and fanouts
             layout_coordinate_path<ObstrLyt> new_path_from_fanin_1_to_gate, new_path_from_fanin_2_to_gate,
                 new_path_from_gate_to_fanout_1, new_path_from_gate_to_fanout_2;
-            // get paths for fanins and fanouts
-            if (!fanins.empty())
+            // a search for a fanin that is known to fail is skipped, which has no side effects since failed searches
+            // do not obstruct any tiles; the remaining connections are still routed such that the obstructions along
+            // them are released just like in any other failed attempt
+            if (!fanins.empty() && unreachable_positions[0].count(new_pos) == 0)
             {
                 new_path_from_fanin_1_to_gate = get_path_and_obstruct(lyt, fanins[0], new_pos);
             }
 
-            if (fanins.size() == 2)
+            if (fanins.size() == 2 && unreachable_positions[1].count(new_pos) == 0)
             {
                 new_path_from_fanin_2_to_gate = get_path_and_obstruct(lyt, fanins[1], new_pos);
             }
@@ -1100,6 +1192,10 @@ class post_layout_optimization_impl
 
         uint64_t num_gate_relocations = 0;
 
+        // evaluate all potential new positions at once w.r.t. the routability of each fanin
+        const auto unreachable_positions =
+            determine_unreachable_positions(lyt, fanins, old_pos, min_x, min_y, max_diagonal);
+
         // iterate over layout diagonally
         for (uint64_t k = 0; k < lyt.x() + lyt.y() + 1; ++k)
         {
@@ -1123,7 +1219,7 @@ class post_layout_optimization_impl
                 {
                     new_pos = tile<ObstrLyt>{x, y};
                     if (!check_new_position(lyt, new_pos, num_gate_relocations, current_pos, fanins, fanouts,
-                                            moved_gate, old_pos))
+                                            moved_gate, old_pos, unreachable_positions))
                     {
                         return false;
                     }
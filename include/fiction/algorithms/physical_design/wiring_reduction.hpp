@@ -8,6 +8,7 @@
 #include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_context.hpp"
 #include "fiction/layouts/bounding_box.hpp"
 #include "fiction/layouts/cartesian_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
@@ -18,14 +19,20 @@
 
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <phmap.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <ostream>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -43,6 +50,17 @@ struct wiring_reduction_params
      * at every algorithm step and the functional correctness has to be ensured by completing essential algorithm steps.
      */
     uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    /**
+     * Apply the cuts in place. Instead of computing a dense offset matrix and shifting every tile of the layout with
+     * the help of a full copy, only the tiles that are actually shifted are visited and their incoming data flow is
+     * recorded beforehand. Furthermore, search directions are skipped if the layout has not changed since their last
+     * unsuccessful search. The resulting layout is identical to the one obtained without this option.
+     *
+     * @note This option only reduces the cost of applying the cuts. Each search round still creates the obstruction
+     * layout of its search direction from scratch and computes the bounding box of the layout, both of which take time
+     * linear in the layout area.
+     */
+    bool incremental = false;
 };
 
 /**
@@ -393,7 +411,8 @@ create_wiring_reduction_layout(const Lyt& lyt, const uint64_t x_offset = 0, cons
         {lyt.x() + x_offset + 1, lyt.y() + y_offset + 1, lyt.z()},
         direction};
 
-    auto wiring_reduction_lyt = wiring_reduction_layout_type<coordinate<Lyt>>(obs_wiring_reduction_layout);
+    auto wiring_reduction_lyt =
+        wiring_reduction_layout_type<coordinate<Lyt>>(obs_wiring_reduction_layout, obstruction_storage::DENSE);
 
     // iterate through nodes in the layout
     lyt.foreach_node(
@@ -664,22 +683,22 @@ void add_obstructions(WiringReductionLyt& lyt) noexcept
  * This helper function computes a path between two coordinates using the A* algorithm.
  *
  * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+ * @tparam Context Type of the search context.
  * @param lyt Reference to the layout.
  * @param start The starting coordinate of the path.
  * @param end The ending coordinate of the path.
+ * @param context Search context that is reused across all calls to avoid reallocations.
  * @return The computed path as a sequence of coordinates in the layout.
  */
-template <typename WiringReductionLyt>
-[[nodiscard]] layout_coordinate_path<WiringReductionLyt> get_path(WiringReductionLyt&                   lyt,
-                                                                  const coordinate<WiringReductionLyt>& start,
-                                                                  const coordinate<WiringReductionLyt>& end) noexcept
+template <typename WiringReductionLyt, typename Context>
+[[nodiscard]] layout_coordinate_path<WiringReductionLyt>
+get_path(WiringReductionLyt& lyt, const coordinate<WiringReductionLyt>& start,
+         const coordinate<WiringReductionLyt>& end, Context& context) noexcept
 {
     using dist = manhattan_distance_functor<WiringReductionLyt, uint64_t>;
     using cost = unit_cost_functor<WiringReductionLyt, uint8_t>;
 
-    static const a_star_params params{false};
-
-    return a_star<layout_coordinate_path<WiringReductionLyt>>(lyt, {start, end}, dist(), cost(), params);
+    return a_star<layout_coordinate_path<WiringReductionLyt>>(lyt, {start, end}, context, dist(), cost());
 }
 /**
  * Update the to-delete list based on a possible path in a wiring_reduction_layout.
@@ -767,6 +786,184 @@ calculate_offset_matrix(const WiringReductionLyt&                         lyt,
 
     return matrix;
 }
+/**
+ * Sparse alternative to the offset matrix. Instead of storing the offset of every single coordinate, it keeps the
+ * sorted positions of the deletable coordinates per column when searching from left to right, or per row when searching
+ * from top to bottom. The offset of a coordinate is then given by the number of deletable coordinates in front of it
+ * and is determined via binary search. Thereby, its size only depends on the number of deletable coordinates instead
+ * of the layout area.
+ */
+class sparse_offset_matrix
+{
+  public:
+    /**
+     * Standard constructor. Calculates the sparse offset matrix based on a to-delete list.
+     *
+     * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+     * @param lyt The `wiring_reduction_layout` for which the offset matrix is calculated.
+     * @param to_delete The to-delete list representing coordinates to be considered for the offset matrix.
+     */
+    template <typename WiringReductionLyt>
+    sparse_offset_matrix(const WiringReductionLyt& lyt, const layout_coordinate_path<WiringReductionLyt>& to_delete) :
+            horizontal{lyt.get_search_direction() == search_direction::HORIZONTAL},
+            lines(horizontal ? lyt.x() + 1 : lyt.y() + 1)
+    {
+        for (const auto& coord : to_delete)
+        {
+            if (horizontal)
+            {
+                lines[coord.x].push_back(coord.y);
+            }
+            else
+            {
+                lines[coord.y].push_back(coord.x);
+            }
+        }
+
+        for (auto& line : lines)
+        {
+            std::sort(line.begin(), line.end());
+        }
+    }
+    /**
+     * Returns the offset of the given coordinate, i.e., the same value as `offset_matrix[y][x]`.
+     *
+     * @param x X-coordinate.
+     * @param y Y-coordinate.
+     * @return Number of deletable coordinates above of (left to right) or to the left of (top to bottom) `(x, y)`.
+     */
+    [[nodiscard]] uint64_t operator()(const uint64_t x, const uint64_t y) const noexcept
+    {
+        const auto line     = horizontal ? x : y;
+        const auto position = horizontal ? y : x;
+
+        if (line >= lines.size())
+        {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(std::distance(
+            lines[line].cbegin(), std::lower_bound(lines[line].cbegin(), lines[line].cend(), position)));
+    }
+
+  private:
+    /**
+     * Flag to indicate that the lines are columns, i.e., that paths were searched from left to right.
+     */
+    const bool horizontal;
+    /**
+     * Sorted positions of the deletable coordinates per column or row.
+     */
+    std::vector<std::vector<uint64_t>> lines;
+};
+/**
+ * Returns the offset of the given coordinate in an offset matrix.
+ *
+ * @param mtrx Offset matrix.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ * @return Offset of `(x, y)`.
+ */
+[[nodiscard]] inline uint64_t offset_at(const offset_matrix& mtrx, const uint64_t x, const uint64_t y) noexcept
+{
+    return mtrx[y][x];
+}
+/**
+ * Returns the offset of the given coordinate in a sparse offset matrix.
+ *
+ * @param mtrx Sparse offset matrix.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ * @return Offset of `(x, y)`.
+ */
+[[nodiscard]] inline uint64_t offset_at(const sparse_offset_matrix& mtrx, const uint64_t x, const uint64_t y) noexcept
+{
+    return mtrx(x, y);
+}
+/**
+ * Records the incoming data flow of tiles in a gate-level layout. It provides the part of the gate-level layout
+ * interface that `adjust_tile` queries on its reference layout and can, therefore, replace a full copy of the layout
+ * when only the tiles that are affected by a wire deletion are recorded before the layout is modified. Tiles serve as
+ * their own node identifiers.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ */
+template <typename Lyt>
+class data_flow_snapshot
+{
+  public:
+    /**
+     * Records the incoming data flow of the given tile in its current state.
+     *
+     * @param lyt The gate-level layout.
+     * @param t Tile whose incoming data flow is to be recorded.
+     */
+    void record(const Lyt& lyt, const tile<Lyt>& t)
+    {
+        data_flow[t] = lyt.incoming_data_flow(t);
+    }
+    /**
+     * Returns the identifier of the given tile, which is the tile itself.
+     *
+     * @param t Tile.
+     * @return `t`.
+     */
+    [[nodiscard]] tile<Lyt> get_node(const tile<Lyt>& t) const noexcept
+    {
+        return t;
+    }
+    /**
+     * Returns the recorded number of fanins of the given tile.
+     *
+     * @param t Tile.
+     * @return Number of recorded incoming data flow tiles of `t`.
+     */
+    [[nodiscard]] std::size_t fanin_size(const tile<Lyt>& t) const noexcept
+    {
+        if (const auto it = data_flow.find(t); it != data_flow.cend())
+        {
+            return it->second.size();
+        }
+
+        return 0;
+    }
+    /**
+     * Returns the recorded incoming data flow of the given tile.
+     *
+     * @param t Tile.
+     * @return Recorded incoming data flow tiles of `t`.
+     */
+    [[nodiscard]] std::vector<tile<Lyt>> incoming_data_flow(const tile<Lyt>& t) const noexcept
+    {
+        if (const auto it = data_flow.find(t); it != data_flow.cend())
+        {
+            return it->second;
+        }
+
+        return {};
+    }
+    /**
+     * Applies a function to all recorded fanins of the given tile.
+     *
+     * @tparam Fn Functor type.
+     * @param t Tile whose recorded fanins are desired.
+     * @param fn Functor to apply to each of `t`'s recorded fanins.
+     */
+    template <typename Fn>
+    void foreach_fanin(const tile<Lyt>& t, Fn&& fn) const
+    {
+        if (const auto it = data_flow.find(t); it != data_flow.cend())
+        {
+            std::for_each(it->second.cbegin(), it->second.cend(), std::forward<Fn>(fn));
+        }
+    }
+
+  private:
+    /**
+     * Maps tiles to their recorded incoming data flow.
+     */
+    phmap::flat_hash_map<tile<Lyt>, std::vector<tile<Lyt>>> data_flow{};
+};
 /**
  * This function calculates the new coordinates of a tile after adjusting for wire deletion based on the
  * specified offset and search direction.
@@ -801,6 +998,7 @@ template <typename Lyt, typename WiringReductionLyt>
  *
  * @tparam Lyt Type of the Cartesian gate-level layout.
  * @tparam LytCpy Type of the copy of the original layout for reference.
+ * @tparam OffsetMatrix Type of the offset matrix, i.e., `offset_matrix` or `sparse_offset_matrix`.
  * @param lyt The 2DDWave-clocked layout whose wiring is to be reduced.
  * @param layout_copy Copy of the original layout for reference.
  * @param fanin Reference to the tile representing the fanin signal.
@@ -809,9 +1007,9 @@ template <typename Lyt, typename WiringReductionLyt>
  * @param offset The offset value used for adjusting the layout.
  * @param signals Vector to store signals for the adjusted coordinates.
  */
-template <typename Lyt, typename LytCpy>
+template <typename Lyt, typename LytCpy, typename OffsetMatrix>
 void adjust_tile_horizontal_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<Lyt>& fanin,
-                                       const offset_matrix& offset_mtrx, const tile<Lyt>& old_coord,
+                                       const OffsetMatrix& offset_mtrx, const tile<Lyt>& old_coord,
                                        const uint64_t& offset, std::vector<mockturtle::signal<Lyt>>& signals) noexcept
 {
     static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
@@ -826,7 +1024,7 @@ void adjust_tile_horizontal_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile
         bool traversing_deleted_wires = false;
 
         // check if traversing through deleted wires
-        if (offset_mtrx[fanin.y + 1][fanin.x] != offset_mtrx[fanin.y][fanin.x])
+        if (offset_at(offset_mtrx, fanin.x, fanin.y + 1) != offset_at(offset_mtrx, fanin.x, fanin.y))
         {
             fanin                    = {fanin.x, fanin.y, 0};
             traversing_deleted_wires = true;
@@ -840,7 +1038,8 @@ void adjust_tile_horizontal_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile
             for (uint64_t o = 0; o < offset; ++o)
             {
                 offset_offset++;
-                if ((fanin.y > 0) && (offset_mtrx[fanin.y][fanin.x] != offset_mtrx[fanin.y - 1][fanin.x]) &&
+                if ((fanin.y > 0) &&
+                    (offset_at(offset_mtrx, fanin.x, fanin.y) != offset_at(offset_mtrx, fanin.x, fanin.y - 1)) &&
                     (layout_copy.incoming_data_flow(fanin)[0].y != fanin.y))
                 {
                     fanin = {fanin.x, fanin.y - 1, fanin.z};
@@ -863,6 +1062,7 @@ void adjust_tile_horizontal_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile
  *
  * @tparam Lyt Type of the Cartesian gate-level layout.
  * @tparam LytCpy Type of the copy of the original layout for reference.
+ * @tparam OffsetMatrix Type of the offset matrix, i.e., `offset_matrix` or `sparse_offset_matrix`.
  * @param lyt The 2DDWave-clocked layout whose wiring is to be reduced.
  * @param layout_copy Copy of the original layout for reference.
  * @param fanin Reference to the tile representing the fanin signal.
@@ -871,9 +1071,9 @@ void adjust_tile_horizontal_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile
  * @param offset The offset value used for adjusting the layout.
  * @param signals Vector to store signals for the adjusted coordinates.
  */
-template <typename Lyt, typename LytCpy>
+template <typename Lyt, typename LytCpy, typename OffsetMatrix>
 void adjust_tile_vertical_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<Lyt>& fanin,
-                                     const offset_matrix& offset_mtrx, const tile<Lyt>& old_coord,
+                                     const OffsetMatrix& offset_mtrx, const tile<Lyt>& old_coord,
                                      const uint64_t offset, std::vector<mockturtle::signal<Lyt>>& signals) noexcept
 {
     static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
@@ -888,7 +1088,7 @@ void adjust_tile_vertical_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<L
         bool traversing_deleted_wires = false;
 
         // check if traversing through deleted wires
-        if (offset_mtrx[fanin.y][fanin.x + 1] != offset_mtrx[fanin.y][fanin.x])
+        if (offset_at(offset_mtrx, fanin.x + 1, fanin.y) != offset_at(offset_mtrx, fanin.x, fanin.y))
         {
             fanin                    = {fanin.x, fanin.y, 0};
             traversing_deleted_wires = true;
@@ -902,7 +1102,8 @@ void adjust_tile_vertical_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<L
             for (uint64_t o = 0; o < offset; ++o)
             {
                 excess_offset++;
-                if ((fanin.x > 0) && (offset_mtrx[fanin.y][fanin.x] != offset_mtrx[fanin.y][fanin.x - 1]) &&
+                if ((fanin.x > 0) &&
+                    (offset_at(offset_mtrx, fanin.x, fanin.y) != offset_at(offset_mtrx, fanin.x - 1, fanin.y)) &&
                     (layout_copy.incoming_data_flow(fanin)[0].x != fanin.x))
                 {
                     fanin = {fanin.x - 1, fanin.y, fanin.z};
@@ -926,6 +1127,7 @@ void adjust_tile_vertical_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<L
  * @tparam Lyt Type of the Cartesian gate-level layout.
  * @tparam LytCpy Type of the copy of the original layout for reference.
  * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+ * @tparam OffsetMatrix Type of the offset matrix, i.e., `offset_matrix` or `sparse_offset_matrix`.
  * @param lyt The 2DDWave-clocked layout whose wiring is to be reduced.
  * @param layout_copy Copy of the original layout for reference.
  * @param wiring_reduction_lyt The `wiring_reduction_layout`.
@@ -934,14 +1136,14 @@ void adjust_tile_vertical_search_dir(Lyt& lyt, const LytCpy& layout_copy, tile<L
  * @param z Z-index of the tile to adjust.
  * @param offset_mtrx The offset matrix used for adjusting the layout.
  */
-template <typename Lyt, typename LytCpy, typename WiringReductionLyt>
+template <typename Lyt, typename LytCpy, typename WiringReductionLyt, typename OffsetMatrix>
 void adjust_tile(Lyt& lyt, const LytCpy& layout_copy, const WiringReductionLyt& wiring_reduction_lyt, uint64_t x,
-                 const uint64_t y, uint64_t z, const offset_matrix& offset_mtrx) noexcept
+                 const uint64_t y, uint64_t z, const OffsetMatrix& offset_mtrx) noexcept
 {
     static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
     static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
 
-    const auto      offset    = offset_mtrx[y][x];
+    const auto      offset    = offset_at(offset_mtrx, x, y);
     const tile<Lyt> old_coord = {x, y, z};
 
     // check if the tile is not empty and has an offset
@@ -1044,6 +1246,75 @@ void delete_wires(Lyt& lyt, WiringReductionLyt& wiring_reduction_layout,
     // resize the layout to the optimized size
     lyt.resize({optimized_layout_width, optimized_layout_height, lyt.z()});
 }
+/**
+ * This function deletes wires from the provided layout like `delete_wires`, but shifts the gates in place. Instead of
+ * calculating a dense offset matrix and traversing every tile of the layout with the help of a full copy, it uses a
+ * sparse offset matrix, records the incoming data flow of the tiles that are deleted or shifted only, and exclusively
+ * visits the shifted tiles in the same diagonal order. The resulting layout is identical to the one of `delete_wires`.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+ * @param lyt The 2DDWave-clocked layout whose wiring is to be reduced.
+ * @param wiring_reduction_layout The `wiring_reduction_layout`.
+ * @param to_delete The to-delete list representing coordinates of wires to be deleted.
+ */
+template <typename Lyt, typename WiringReductionLyt>
+void delete_wires_in_place(Lyt& lyt, WiringReductionLyt& wiring_reduction_layout,
+                           const layout_coordinate_path<WiringReductionLyt>& to_delete) noexcept
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+
+    const sparse_offset_matrix off_mat{wiring_reduction_layout, to_delete};
+
+    data_flow_snapshot<Lyt> snapshot{};
+
+    // record the deleted wires, which are needed to reconnect the gates across the cuts
+    for (const auto& tile_to_delete : to_delete)
+    {
+        snapshot.record(lyt, tile_to_delete);
+    }
+
+    // gather and record all occupied tiles that are going to be shifted
+    std::vector<tile<Lyt>> shifted_tiles{};
+
+    lyt.foreach_node(
+        [&lyt, &off_mat, &snapshot, &shifted_tiles](const auto& node)
+        {
+            const auto t = lyt.get_tile(node);
+
+            if (!lyt.is_empty_tile(t) && off_mat(t.x, t.y) != 0)
+            {
+                snapshot.record(lyt, t);
+                shifted_tiles.push_back(t);
+            }
+        });
+
+    // shift the tiles in the same order as the diagonal traversal of delete_wires such that fanins are always
+    // positioned before their fanouts are reconnected
+    std::sort(shifted_tiles.begin(), shifted_tiles.end(),
+              [](const auto& t1, const auto& t2) noexcept
+              {
+                  return std::make_tuple(t1.x + t1.y, t1.x, t1.z) < std::make_tuple(t2.x + t2.y, t2.x, t2.z);
+              });
+
+    // clear tiles based on the to-delete list
+    for (const auto& tile_to_delete : to_delete)
+    {
+        lyt.clear_tile(tile_to_delete);
+    }
+
+    for (const auto& t : shifted_tiles)
+    {
+        adjust_tile(lyt, snapshot, wiring_reduction_layout, t.x, t.y, t.z, off_mat);
+    }
+
+    // calculate bounding box for optimized layout size
+    const auto bounding_box = bounding_box_2d(lyt);
+
+    // resize the layout to the optimized size
+    lyt.resize({bounding_box.get_x_size(), bounding_box.get_y_size(), lyt.z()});
+}
 
 template <typename Lyt>
 class wiring_reduction_impl
@@ -1070,13 +1341,16 @@ class wiring_reduction_impl
         pst.y_size_before    = plyt.y() + 1;
 
         // create an obstruction layout based on the original layout
-        auto layout = obstruction_layout<Lyt>(plyt);
+        auto layout = obstruction_layout<Lyt>(plyt, obstruction_storage::DENSE);
 
         // initialize the list of wires to delete
         layout_coordinate_path<wiring_reduction_layout_type<coordinate<Lyt>>> to_delete = {};
 
         bool found_wires = true;
 
+        // all paths are determined on layouts of the same coordinate type; hence, the search buffers can be shared
+        preferred_path_search_context<coordinate<Lyt>, uint64_t> path_finding_context{};
+
         // lambda to update the timeout status and calculate remaining time
         const auto update_timeout = [start = this->start, &ps = this->ps,
                                      &timeout_limit_reached = this->timeout_limit_reached]() noexcept -> void
@@ -1087,6 +1361,10 @@ class wiring_reduction_impl
             timeout_limit_reached = (elapsed_ms >= ps.timeout);
         };
 
+        // flags per search direction that indicate that the last search did not find any cut and that the layout has
+        // not been modified since; in incremental mode, such searches are not repeated
+        std::array<bool, 2> exhausted{false, false};
+
         // perform wiring reduction iteratively until no further wires can be deleted
         while (found_wires && !timeout_limit_reached)
         {
@@ -1094,6 +1372,11 @@ class wiring_reduction_impl
 
             for (const auto direction : {search_direction::HORIZONTAL, search_direction::VERTICAL})
             {
+                if (ps.incremental && exhausted[static_cast<std::size_t>(direction)])
+                {
+                    continue;
+                }
+
                 // update the remaining timeout
                 update_timeout();
 
@@ -1118,8 +1401,9 @@ class wiring_reduction_impl
                 to_delete.clear();
 
                 // get the initial possible path for wire deletion
-                auto possible_path =
-                    get_path(wiring_reduction_lyt, {0, 0}, {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
+                auto possible_path = get_path(wiring_reduction_lyt, {0, 0},
+                                              {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()},
+                                              path_finding_context);
 
                 // iterate while there is a possible path and timeout not reached
                 while (!possible_path.empty() && !timeout_limit_reached)
@@ -1135,15 +1419,29 @@ class wiring_reduction_impl
                     {
                         // get the next possible path for wire deletion
                         possible_path = get_path(wiring_reduction_lyt, {0, 0},
-                                                 {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
+                                                 {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()},
+                                                 path_finding_context);
                     }
                 }
 
                 if (!to_delete.empty())
                 {
                     // delete the identified wires from the layout
-                    delete_wires(layout, wiring_reduction_lyt, to_delete);
+                    if (ps.incremental)
+                    {
+                        delete_wires_in_place(layout, wiring_reduction_lyt, to_delete);
+                    }
+                    else
+                    {
+                        delete_wires(layout, wiring_reduction_lyt, to_delete);
+                    }
+
                     found_wires = true;
+                    exhausted.fill(false);
+                }
+                else if (!timeout_limit_reached)
+                {
+                    exhausted[static_cast<std::size_t>(direction)] = true;
                 }
             }
         }
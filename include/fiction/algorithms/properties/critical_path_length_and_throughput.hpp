@@ -7,12 +7,17 @@
 
 #include "fiction/traits.hpp"
 
+#include <mockturtle/networks/events.hpp>
 #include <mockturtle/traits.hpp>
 #include <phmap.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <iterator>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace fiction
@@ -40,24 +45,56 @@ template <typename Lyt>
 class critical_path_length_and_throughput_impl
 {
   public:
-    explicit critical_path_length_and_throughput_impl(const Lyt& src) : lyt{src} {}
+    /**
+     * Standard constructor.
+     *
+     * @param src Gate-level layout to analyze.
+     * @param track If `true`, dependencies between tiles are recorded such that cached results can be invalidated
+     * selectively via `invalidate` (see `critical_path_length_and_throughput_analyzer`).
+     */
+    explicit critical_path_length_and_throughput_impl(const Lyt& src, const bool track = false) :
+            lyt{src},
+            track_dependencies{track}
+    {}
 
     cp_and_tp run()
     {
+        result = {};
+
+        po_tiles.clear();
+
         lyt.foreach_po(
             [this](const auto& po)
             {
-                result.critical_path_length =
-                    std::max(signal_delay(static_cast<tile<Lyt>>(po)).length, result.critical_path_length);
+                const auto po_t = static_cast<tile<Lyt>>(po);
+
+                if (track_dependencies)
+                {
+                    po_tiles.insert(po_t);
+                }
+
+                result.critical_path_length = std::max(signal_delay(po_t).length, result.critical_path_length);
             });
 
-        const auto max_diff =
-            std::max_element(delay_cache.cbegin(), delay_cache.cend(),
-                             [](const auto& i1, const auto& i2) { return i1.second.diff < i2.second.diff; });
+        if (track_dependencies)
+        {
+            collect_orphans();
 
-        if (max_diff != delay_cache.cend())
+            if (!gate_diffs.empty())
+            {
+                result.throughput = gate_diffs.crbegin()->first;
+            }
+        }
+        else
         {
-            result.throughput = max_diff->second.diff;
+            const auto max_diff = std::max_element(delay_cache.cbegin(), delay_cache.cend(),
+                                                   [](const auto& i1, const auto& i2)
+                                                   { return i1.second.diff() < i2.second.diff(); });
+
+            if (max_diff != delay_cache.cend())
+            {
+                result.throughput = max_diff->second.diff();
+            }
         }
 
         // give throughput in cycles, not in phases
@@ -68,12 +105,75 @@ class critical_path_length_and_throughput_impl
 
         return result;
     }
+    /**
+     * Removes the cached results of tile `t` and of all tiles whose results depend on it, i.e., its entire fan-out
+     * cone. Requires dependency tracking.
+     *
+     * @param t Tile whose cached results are to be discarded.
+     */
+    void invalidate(const tile<Lyt>& t)
+    {
+        worklist.assign(1, t);
+
+        while (!worklist.empty())
+        {
+            const auto u = worklist.back();
+            worklist.pop_back();
+
+            const auto it = delay_cache.find(u);
+            if (it == delay_cache.end())
+            {
+                continue;
+            }
+
+            auto entry = std::move(it->second);
+            delay_cache.erase(it);
+
+            erase_entry_data(u, entry);
+
+            // all users have to be re-evaluated as well
+            worklist.insert(worklist.end(), entry.users.cbegin(), entry.users.cend());
+        }
+    }
+    /**
+     * Fetches the tile that node `n` was placed on when its results were cached.
+     *
+     * @param n Node whose tile is desired.
+     * @return Tile of `n` at the time of its evaluation or a dead tile if `n` is not cached.
+     */
+    [[nodiscard]] tile<Lyt> cached_tile(const mockturtle::node<Lyt>& n) const noexcept
+    {
+        if (const auto it = node_tiles.find(n); it != node_tiles.cend())
+        {
+            return it->second;
+        }
+
+        return {};
+    }
+    /**
+     * Discards all cached results.
+     */
+    void clear() noexcept
+    {
+        delay_cache.clear();
+        node_tiles.clear();
+        gate_diffs.clear();
+        orphans.clear();
+    }
+    /**
+     * Number of tiles that were evaluated, i.e., whose path information was computed from the ones of their fanins.
+     */
+    uint64_t num_evaluations{0ull};
 
   private:
     /**
      * Gate-level layout.
      */
     Lyt lyt;
+    /**
+     * Flag to indicate whether dependencies between cached tiles are to be recorded.
+     */
+    const bool track_dependencies;
     /**
      * Result storage.
      */
@@ -86,68 +186,288 @@ class critical_path_length_and_throughput_impl
 
         uint64_t length{0ull}, delay{0ull}, diff{0ull};
     };
+    /**
+     * Cached path information of a tile.
+     */
+    struct delay_entry
+    {
+        path_info info{};
+        /**
+         * Only gates are considered for the throughput.
+         */
+        bool is_gate{false};
+        /**
+         * Flag to indicate that the tile is currently being evaluated. Encountering such a tile again means that the
+         * layout contains a combinational loop.
+         */
+        bool in_progress{true};
+        /**
+         * Only maintained if dependencies are tracked: the node placed on the tile at the time of its evaluation.
+         */
+        mockturtle::node<Lyt> n{};
+        /**
+         * Only maintained if dependencies are tracked: the incoming tiles whose results this entry was computed from
+         * and the tiles whose results were computed from this entry.
+         */
+        std::vector<tile<Lyt>> inputs{}, users{};
+
+        [[nodiscard]] uint64_t diff() const noexcept
+        {
+            return is_gate ? info.diff : 0ull;
+        }
+    };
+    /**
+     * Cached path information of all evaluated tiles.
+     */
+    phmap::flat_hash_map<tile<Lyt>, delay_entry> delay_cache{};
+    /**
+     * Only maintained if dependencies are tracked: the tile each cached node was evaluated on.
+     */
+    phmap::flat_hash_map<mockturtle::node<Lyt>, tile<Lyt>> node_tiles{};
+    /**
+     * Only maintained if dependencies are tracked: histogram of the path length differences of all cached gates.
+     */
+    std::map<uint64_t, uint64_t> gate_diffs{};
+    /**
+     * Only maintained if dependencies are tracked: cached tiles that lost users and might no longer be part of any PO's
+     * fan-in cone.
+     */
+    std::vector<tile<Lyt>> orphans{};
+    /**
+     * Only maintained if dependencies are tracked: all PO tiles of the last run.
+     */
+    phmap::flat_hash_set<tile<Lyt>> po_tiles{};
+    /**
+     * Evaluation frame of the explicit depth-first traversal.
+     */
+    struct frame
+    {
+        tile<Lyt> t;
+        /**
+         * Ranges of the frame's incoming tiles in `incoming_stack` and of their path information in `info_stack`.
+         */
+        std::size_t incoming_begin, next_incoming, info_begin;
+    };
+    /**
+     * Explicit stacks that are reused across all traversals to avoid repeated allocations.
+     */
+    std::vector<frame>     frame_stack{};
+    std::vector<tile<Lyt>> incoming_stack{};
+    std::vector<path_info> info_stack{};
+    std::vector<tile<Lyt>> worklist{};
 
-    phmap::flat_hash_map<tile<Lyt>, path_info> delay_cache{};
-
-    path_info signal_delay(const tile<Lyt> t) noexcept
+    /**
+     * Computes the path information of tile `t`. Instead of recursing, the fan-in cone is traversed depth-first via an
+     * explicit stack such that arbitrarily long paths can be handled. All intermediate results are cached.
+     *
+     * @param t Tile whose path information is desired.
+     * @return Path information of `t`.
+     */
+    path_info signal_delay(const tile<Lyt>& t)
     {
         if (lyt.is_empty_tile(t))
         {
             return {};
         }
-
-        const auto idf = lyt.incoming_data_flow(t);
-        if (idf.empty())
+        if (const auto it = delay_cache.find(t); it != delay_cache.cend())  // cache hit
         {
-            return {1, lyt.get_clock_number(t), 0};
+            return it->second.info;
         }
-        if (const auto it = delay_cache.find(t); it != delay_cache.end())  // cache hit
+
+        push_frame(t);
+
+        while (true)
         {
-            return it->second;
+            auto& f = frame_stack.back();
+
+            if (f.next_incoming < incoming_stack.size())
+            {
+                const auto in_t = incoming_stack[f.next_incoming++];
+
+                if (const auto it = delay_cache.find(in_t); it != delay_cache.end())
+                {
+                    // a tile that is still being evaluated indicates a combinational loop, which is cut here
+                    info_stack.push_back(it->second.in_progress ? path_info{} : it->second.info);
+
+                    if (track_dependencies)
+                    {
+                        it->second.users.push_back(f.t);
+                    }
+                }
+                else
+                {
+                    push_frame(in_t);  // invalidates f
+                }
+
+                continue;
+            }
+
+            const auto info = evaluate(f);
+            const auto t_f  = f.t;
+
+            frame_stack.pop_back();
+
+            if (frame_stack.empty())
+            {
+                return info;
+            }
+
+            info_stack.push_back(info);
+
+            if (track_dependencies)
+            {
+                delay_cache[t_f].users.push_back(frame_stack.back().t);
+            }
         }
+    }
 
-        // cache miss
-        // fetch information about all incoming paths
-        std::vector<path_info> infos{};
+    void push_frame(const tile<Lyt>& t)
+    {
+        delay_cache.emplace(t, delay_entry{});
 
-        std::transform(idf.cbegin(), idf.cend(), std::back_inserter(infos),
-                       [this](const auto& in_tile) { return signal_delay(in_tile); });
+        const auto incoming_begin = incoming_stack.size();
+        lyt.foreach_fanin(lyt.get_node(t),
+                          [this](const auto& fi) { incoming_stack.push_back(static_cast<tile<Lyt>>(fi)); });
+
+        frame_stack.push_back({t, incoming_begin, incoming_begin, info_stack.size()});
+    }
+    /**
+     * Computes the path information of the top frame's tile from the ones of its incoming tiles, caches it, and removes
+     * the frame's data from the stacks.
+     *
+     * @param f Top frame.
+     * @return Path information of `f.t`.
+     */
+    path_info evaluate(const frame& f)
+    {
+        ++num_evaluations;
 
         path_info dominant_path{};
 
-        if (lyt.is_pi_tile(t))  // primary input to the circuit
+        if (f.incoming_begin == incoming_stack.size())
         {
-            infos.emplace_back(
-                1ull, static_cast<uint64_t>((lyt.get_clock_number(t) + (lyt.num_clocks() - 1)) % lyt.num_clocks()),
-                0ull);
+            dominant_path = {1, lyt.get_clock_number(f.t), 0};
         }
-
-        if (infos.size() == 1)  // size cannot be 0
+        else
         {
-            dominant_path = infos.front();
+            if (lyt.is_pi_tile(f.t))  // primary input to the circuit
+            {
+                info_stack.emplace_back(
+                    1ull,
+                    static_cast<uint64_t>((lyt.get_clock_number(f.t) + (lyt.num_clocks() - 1)) % lyt.num_clocks()),
+                    0ull);
+            }
+
+            const auto infos_begin = info_stack.begin() + static_cast<std::ptrdiff_t>(f.info_begin);
+
+            if (std::distance(infos_begin, info_stack.end()) == 1)  // size cannot be 0
+            {
+                dominant_path = *infos_begin;
+            }
+            else  // fetch the highest delay and difference
+            {
+                // sort by path length
+                std::sort(infos_begin, info_stack.end(),
+                          [](const auto& i1, const auto& i2) { return i1.length < i2.length; });
+
+                dominant_path.length = info_stack.back().length;
+                dominant_path.delay  = info_stack.back().delay;
+                dominant_path.diff   = static_cast<uint64_t>(
+                    std::abs(static_cast<int64_t>(info_stack.back().delay - infos_begin->delay)));
+            }
+
+            // incorporate self
+            ++dominant_path.length;
+            ++dominant_path.delay;
         }
-        else  // fetch the highest delay and difference
+
+        auto& entry = delay_cache[f.t];
+
+        entry.info        = dominant_path;
+        entry.is_gate     = !lyt.is_wire_tile(f.t);
+        entry.in_progress = false;
+
+        if (track_dependencies)
         {
-            // sort by path length
-            std::sort(infos.begin(), infos.end(), [](const auto& i1, const auto& i2) { return i1.length < i2.length; });
+            entry.inputs.assign(incoming_stack.cbegin() + static_cast<std::ptrdiff_t>(f.incoming_begin),
+                                incoming_stack.cend());
 
-            dominant_path.length = infos.back().length;
-            dominant_path.delay  = infos.back().delay;
-            dominant_path.diff =
-                static_cast<uint64_t>(std::abs(static_cast<int64_t>(infos.back().delay - infos.front().delay)));
+            entry.n             = lyt.get_node(f.t);
+            node_tiles[entry.n] = f.t;
+
+            if (entry.is_gate)
+            {
+                ++gate_diffs[entry.info.diff];
+            }
         }
 
-        // incorporate self
-        ++dominant_path.length;
-        ++dominant_path.delay;
+        incoming_stack.resize(f.incoming_begin);
+        info_stack.resize(f.info_begin);
 
-        // cache value for gates only
-        if (!lyt.is_wire_tile(t))
+        return dominant_path;
+    }
+    /**
+     * Removes the data that was derived from the given (already erased) cache entry, i.e., its contribution to the
+     * throughput histogram and its usage of its incoming tiles.
+     *
+     * @param t Tile of the erased entry.
+     * @param entry The erased entry.
+     */
+    void erase_entry_data(const tile<Lyt>& t, const delay_entry& entry)
+    {
+        if (entry.is_gate && !entry.in_progress)
         {
-            delay_cache[t] = dominant_path;
+            if (const auto it = gate_diffs.find(entry.info.diff); it != gate_diffs.end() && --it->second == 0)
+            {
+                gate_diffs.erase(it);
+            }
         }
 
-        return dominant_path;
+        if (const auto it = node_tiles.find(entry.n); it != node_tiles.end() && it->second == t)
+        {
+            node_tiles.erase(it);
+        }
+
+        for (const auto& in_t : entry.inputs)
+        {
+            if (const auto it = delay_cache.find(in_t); it != delay_cache.end())
+            {
+                auto& users = it->second.users;
+
+                if (const auto u_it = std::find(users.begin(), users.end(), t); u_it != users.end())
+                {
+                    users.erase(u_it);
+                }
+
+                if (users.empty())
+                {
+                    orphans.push_back(in_t);
+                }
+            }
+        }
+    }
+    /**
+     * Removes all cached tiles that are no longer part of any PO's fan-in cone such that they do not distort the
+     * throughput.
+     */
+    void collect_orphans()
+    {
+        while (!orphans.empty())
+        {
+            const auto t = orphans.back();
+            orphans.pop_back();
+
+            const auto it = delay_cache.find(t);
+            if (it == delay_cache.end() || !it->second.users.empty() || po_tiles.count(t) > 0)
+            {
+                continue;
+            }
+
+            auto entry = std::move(it->second);
+            delay_cache.erase(it);
+
+            erase_entry_data(t, entry);  // might create new orphans
+        }
     }
 };
 
@@ -172,6 +492,8 @@ class critical_path_length_and_throughput_impl
  * Nature in 2022.
  *
  * The complexity of this function is \f$\mathcal{O}(|T|)\f$ where \f$T\f$ is the set of all occupied tiles in `lyt`.
+ * The layout is traversed iteratively such that arbitrarily long paths do not lead to stack overflows. To repeatedly
+ * obtain the CP and TP of a layout that is being modified, see `critical_path_length_and_throughput_analyzer`.
  *
  * @tparam Lyt Gate-level layout type.
  * @param lyt The gate-level layout whose CP and TP are desired.
@@ -186,6 +508,139 @@ cp_and_tp critical_path_length_and_throughput(const Lyt& lyt)
 
     return p.run();
 }
+/**
+ * Incrementally maintains the critical path length (CP) and the throughput (TP) of a gate-level layout that is being
+ * modified, e.g., by an optimization algorithm. See `critical_path_length_and_throughput` for the definitions of both
+ * metrics.
+ *
+ * The analyzer caches the path information of all tiles in the PO's fan-in cones and subscribes to the layout's network
+ * events (`on_add`, `on_modified`, and `on_delete`) that are invoked by `create_...`, `move_node`, `connect`, and
+ * `clear_tile`. Each event discards the cached results of the affected tiles and their fan-out cones only. Hence,
+ * `get` merely re-evaluates the parts of the layout that were affected by the modifications since the last call and
+ * is much cheaper than a full recomputation after small edits. Its results are always identical to the ones of
+ * `critical_path_length_and_throughput`.
+ *
+ * Modifications that do not invoke network events, e.g., changes to the clocking scheme, have to be communicated to
+ * the analyzer via `invalidate` or `reset`.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+class critical_path_length_and_throughput_analyzer
+{
+  public:
+    /**
+     * Standard constructor. Registers the analyzer with the given layout's network events. The layout has to outlive
+     * the analyzer.
+     *
+     * @param lyt The gate-level layout whose CP and TP are to be maintained.
+     */
+    explicit critical_path_length_and_throughput_analyzer(const Lyt& lyt) : layout{lyt}, impl{lyt, true}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate layout type");
+
+        add_event = layout.events().register_add_event([this](const auto& n) { invalidate_node(n); });
+
+        modified_event = layout.events().register_modified_event(
+            [this](const auto& n, [[maybe_unused]] const auto& previous_children)
+            {
+                // n might have been moved from another tile
+                impl.invalidate(impl.cached_tile(n));
+                invalidate_node(n);
+            });
+
+        delete_event = layout.events().register_delete_event(
+            [this](const auto& n)
+            {
+                impl.invalidate(impl.cached_tile(n));
+                impl.invalidate(layout.get_tile(n));
+            });
+    }
+    /**
+     * Destructor. Releases the network events.
+     */
+    ~critical_path_length_and_throughput_analyzer()
+    {
+        layout.events().release_add_event(add_event);
+        layout.events().release_modified_event(modified_event);
+        layout.events().release_delete_event(delete_event);
+    }
+
+    critical_path_length_and_throughput_analyzer(const critical_path_length_and_throughput_analyzer&) = delete;
+    critical_path_length_and_throughput_analyzer(critical_path_length_and_throughput_analyzer&&)      = delete;
+    critical_path_length_and_throughput_analyzer&
+    operator=(const critical_path_length_and_throughput_analyzer&) = delete;
+    critical_path_length_and_throughput_analyzer& operator=(critical_path_length_and_throughput_analyzer&&) = delete;
+
+    /**
+     * Returns the current CP and TP of the layout. Only tiles whose cached results were discarded since the last call
+     * are re-evaluated.
+     *
+     * @return A struct containing the CP and TP.
+     */
+    [[nodiscard]] cp_and_tp get()
+    {
+        return impl.run();
+    }
+    /**
+     * Discards the cached results of tile `t` and its fan-out cone. This is only required for modifications that do not
+     * invoke network events.
+     *
+     * @param t Tile whose cached results are to be discarded.
+     */
+    void invalidate(const tile<Lyt>& t)
+    {
+        impl.invalidate(t);
+    }
+    /**
+     * Discards all cached results such that the next call to `get` re-evaluates the entire layout.
+     */
+    void reset() noexcept
+    {
+        impl.clear();
+    }
+    /**
+     * Returns the number of tile evaluations that have been performed since the analyzer's construction. A full
+     * analysis evaluates each tile in the POs' fan-in cones exactly once.
+     *
+     * @return Number of tile evaluations.
+     */
+    [[nodiscard]] uint64_t num_evaluations() const noexcept
+    {
+        return impl.num_evaluations;
+    }
+
+  private:
+    /**
+     * The analyzed layout.
+     */
+    Lyt layout;
+    /**
+     * Analysis with dependency tracking.
+     */
+    detail::critical_path_length_and_throughput_impl<Lyt> impl;
+    /**
+     * Registered network events.
+     */
+    std::shared_ptr<typename mockturtle::network_events<typename Lyt::base_type>::add_event_type>      add_event;
+    std::shared_ptr<typename mockturtle::network_events<typename Lyt::base_type>::modified_event_type> modified_event;
+    std::shared_ptr<typename mockturtle::network_events<typename Lyt::base_type>::delete_event_type>   delete_event;
+    /**
+     * Discards the cached results of node `n`'s current tile as well as the ones of its fanouts, which might not have
+     * considered `n` as an incoming node so far.
+     *
+     * @param n Node whose surroundings changed.
+     */
+    void invalidate_node(const mockturtle::node<Lyt>& n)
+    {
+        if (const auto t = layout.get_tile(n); !t.is_dead())
+        {
+            impl.invalidate(t);
+
+            layout.foreach_fanout(n, [this](const auto& fo) { impl.invalidate(layout.get_tile(fo)); });
+        }
+    }
+};
 
 }  // namespace fiction
 
@@ -0,0 +1,797 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_BISTABLE_QCA_SIMULATION_HPP
+#define FICTION_BISTABLE_QCA_SIMULATION_HPP
+
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/traits.hpp"
+
+#include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Largest number of input cells that `bistable_qca_simulation` accepts. All \f$2^n\f$ input patterns are simulated
+ * exhaustively and their output values are stored before being assembled into truth tables, which bounds both the
+ * runtime and the memory consumption. Layouts with more inputs are rejected.
+ */
+inline constexpr uint32_t BISTABLE_QCA_SIMULATION_MAX_INPUTS = 24u;
+/**
+ * Parameters for the bistable QCA simulation. The default values correspond to the default parameters of the bistable
+ * simulation engine of QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/).
+ */
+struct bistable_qca_simulation_params
+{
+    /**
+     * Relative permittivity of the substrate.
+     */
+    double epsilon_r{12.9};
+    /**
+     * Tunneling energy of cells in the relax phase of their clock, i.e., when they are not polarized (unit: J).
+     */
+    double clock_high{9.8e-22};
+    /**
+     * Tunneling energy of cells in the hold phase of their clock, i.e., when they are fully polarized (unit: J).
+     */
+    double clock_low{3.8e-23};
+    /**
+     * Number of tunneling energies between `clock_high` and `clock_low` at which the cells of a clock zone are relaxed
+     * during their switch phase. The quasi-adiabatic lowering of the tunneling barrier ensures that all driving cells
+     * are taken into account before the cells saturate.
+     */
+    uint64_t num_switching_steps{10};
+    /**
+     * Maximum distance between two cell centers for them to interact (unit: nm).
+     */
+    double radius_of_effect{65.0};
+    /**
+     * Vertical distance between two adjacent layers, i.e., between a cell layer and a via layer (unit: nm).
+     */
+    double layer_separation{11.5};
+    /**
+     * Maximum change in polarization of any cell for a relaxation to be considered converged.
+     */
+    double convergence_tolerance{1e-3};
+    /**
+     * Maximum number of iterations per relaxation.
+     */
+    uint64_t max_iterations{1000};
+    /**
+     * Maximum number of clock cycles to simulate per input pattern.
+     */
+    uint64_t max_clock_cycles{1000};
+    /**
+     * Number of threads that simulate input patterns in parallel.
+     */
+    uint64_t num_threads{std::thread::hardware_concurrency()};
+};
+/**
+ * Statistics of the bistable QCA simulation.
+ */
+struct bistable_qca_simulation_stats
+{
+    /**
+     * Total runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of simulated cells including the via cells between layers.
+     */
+    uint64_t num_cells{0};
+    /**
+     * Number of pairwise cell interactions in the sparse neighbor kernel.
+     */
+    uint64_t num_interactions{0};
+    /**
+     * Number of simulated input patterns.
+     */
+    uint64_t num_input_patterns{0};
+    /**
+     * Number of input patterns whose simulation did not reach a steady state within the given limits.
+     */
+    uint64_t num_unconverged_patterns{0};
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class bistable_qca_simulation_impl
+{
+  public:
+    bistable_qca_simulation_impl(const Lyt& layout, const std::vector<cell<Lyt>>& inputs,
+                                 const std::vector<cell<Lyt>>& outputs, const bistable_qca_simulation_params& p,
+                                 bistable_qca_simulation_stats& st) :
+            lyt{layout},
+            input_cells{inputs},
+            output_cells{outputs},
+            ps{p},
+            pst{st},
+            num_clocks{std::max(static_cast<uint64_t>(lyt.num_clocks()), uint64_t{1})}
+    {}
+
+    std::vector<kitty::dynamic_truth_table> run()
+    {
+        const mockturtle::stopwatch stop{pst.time_total};
+
+        set_up_cells();
+        set_up_kernel();
+
+        const auto num_inputs   = static_cast<uint32_t>(input_cells.size());
+        const auto num_outputs  = output_cells.size();
+        const auto num_patterns = uint64_t{1} << num_inputs;
+
+        // output values per input pattern; written concurrently, but each pattern by exactly one thread
+        std::vector<uint8_t> output_values(num_patterns * num_outputs, 0);
+
+        std::atomic<uint64_t> next_pattern{0};
+        std::atomic<uint64_t> num_unconverged{0};
+
+        const auto worker = [this, &next_pattern, &num_unconverged, &output_values, num_patterns, num_outputs]
+        {
+            std::vector<double> polarization(cells.size(), 0.0);
+            std::vector<double> settled(cells.size(), 0.0);
+            std::vector<double> buffer{};
+
+            for (auto pattern = next_pattern++; pattern < num_patterns; pattern = next_pattern++)
+            {
+                if (!simulate_pattern(pattern, polarization, settled, buffer))
+                {
+                    ++num_unconverged;
+                }
+
+                for (auto o = 0u; o < num_outputs; ++o)
+                {
+                    output_values[pattern * num_outputs + o] = settled[output_indices[o]] > 0.0 ? 1 : 0;
+                }
+            }
+        };
+
+        const auto num_threads = std::clamp(ps.num_threads, uint64_t{1}, num_patterns);
+
+        if (num_threads == 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            for (auto i = 0u; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::vector<kitty::dynamic_truth_table> functions(num_outputs, kitty::dynamic_truth_table{num_inputs});
+
+        for (uint64_t pattern = 0; pattern < num_patterns; ++pattern)
+        {
+            for (auto o = 0u; o < num_outputs; ++o)
+            {
+                if (output_values[pattern * num_outputs + o] != 0)
+                {
+                    kitty::set_bit(functions[o], pattern);
+                }
+            }
+        }
+
+        pst.num_cells                = cells.size();
+        pst.num_interactions         = kernel_neighbors.size();
+        pst.num_input_patterns       = num_patterns;
+        pst.num_unconverged_patterns = num_unconverged;
+
+        return functions;
+    }
+
+  private:
+    /**
+     * The layout to simulate.
+     */
+    const Lyt& lyt;
+    /**
+     * Input cells in the order of the variables of the resulting truth tables.
+     */
+    const std::vector<cell<Lyt>>& input_cells;
+    /**
+     * Output cells in the order of the resulting truth tables.
+     */
+    const std::vector<cell<Lyt>>& output_cells;
+    /**
+     * Parameters.
+     */
+    const bistable_qca_simulation_params& ps;
+    /**
+     * Statistics.
+     */
+    bistable_qca_simulation_stats& pst;
+    /**
+     * Number of clock phases.
+     */
+    const uint64_t num_clocks;
+    /**
+     * A simulated cell. Apart from the cells of the layout, via cells are inserted between vertically connected cells
+     * of adjacent layers.
+     */
+    struct qca_cell
+    {
+        /**
+         * Horizontal position in the layout.
+         */
+        int64_t x;
+        /**
+         * Vertical position in the layout.
+         */
+        int64_t y;
+        /**
+         * Physical layer, where cell layer `z` is at layer `2z` and the via layer above it is at layer `2z + 1`.
+         */
+        int64_t layer;
+        /**
+         * Whether the cell is rotated by 45°.
+         */
+        bool rotated;
+    };
+    /**
+     * All simulated cells.
+     */
+    std::vector<qca_cell> cells{};
+    /**
+     * Indices of the non-fixed cells of each clock zone.
+     */
+    std::vector<std::vector<uint32_t>> zone_cells{};
+    /**
+     * Indices and polarizations of constant cells.
+     */
+    std::vector<std::pair<uint32_t, double>> constant_cells{};
+    /**
+     * Indices of the input and output cells.
+     */
+    std::vector<uint32_t> input_indices{}, output_indices{};
+    /**
+     * Sparse neighbor kernel in compressed sparse row format. The interactions of cell `i` are stored at positions
+     * `kernel_offsets[i]` to `kernel_offsets[i + 1]` of `kernel_neighbors` and `kernel_energies`.
+     */
+    std::vector<uint32_t> kernel_offsets{}, kernel_neighbors{};
+    /**
+     * Kink energies of the kernel divided by `2 * clock_low`.
+     */
+    std::vector<double> kernel_energies{};
+
+    void set_up_cells()
+    {
+        zone_cells.resize(num_clocks);
+
+        std::map<cell<Lyt>, uint32_t> indices{};
+
+        const auto add_cell = [this](const cell<Lyt>& c, const int64_t layer, const bool rotated)
+        {
+            cells.push_back({static_cast<int64_t>(c.x), static_cast<int64_t>(c.y), layer, rotated});
+            return static_cast<uint32_t>(cells.size() - 1);
+        };
+
+        lyt.foreach_cell(
+            [this, &indices, &add_cell](const auto& c)
+            {
+                const auto type = lyt.get_cell_type(c);
+                const auto mode = lyt.get_cell_mode(c);
+                const auto zone = static_cast<uint64_t>(lyt.get_clock_number(c)) % num_clocks;
+
+                const auto i = add_cell(c, 2 * static_cast<int64_t>(c.z), qca_technology::is_rotated_cell_mode(mode));
+                indices[c]   = i;
+
+                if (qca_technology::is_const_0_cell(type))
+                {
+                    constant_cells.emplace_back(i, -1.0);
+                }
+                else if (qca_technology::is_const_1_cell(type))
+                {
+                    constant_cells.emplace_back(i, 1.0);
+                }
+                else if (!qca_technology::is_input_cell(type))
+                {
+                    zone_cells[zone].push_back(i);
+                }
+
+                // vertical cells are connected to the layer above by a via cell
+                if (qca_technology::is_vertical_cell_mode(mode) && c.z < lyt.z())
+                {
+                    zone_cells[zone].push_back(add_cell(c, 2 * static_cast<int64_t>(c.z) + 1, false));
+                }
+            });
+
+        for (const auto& c : input_cells)
+        {
+            input_indices.push_back(indices.at(c));
+        }
+        for (const auto& c : output_cells)
+        {
+            output_indices.push_back(indices.at(c));
+        }
+    }
+    /**
+     * Computes the dot positions of the given cell (unit: nm). The first and third dot are occupied by an electron if
+     * the cell has polarization \f$+1\f$.
+     *
+     * @param c The cell.
+     * @return Positions of the four quantum dots of `c`.
+     */
+    [[nodiscard]] std::array<std::array<double, 3>, 4> dot_positions(const qca_cell& c) const noexcept
+    {
+        static constexpr const double pitch_x = qca_technology::CELL_WIDTH + qca_technology::CELL_HSPACE;
+        static constexpr const double pitch_y = qca_technology::CELL_HEIGHT + qca_technology::CELL_VSPACE;
+        static constexpr const double offset  = qca_technology::CELL_WIDTH / 4.0;
+
+        const double x = static_cast<double>(c.x) * pitch_x;
+        const double y = static_cast<double>(c.y) * pitch_y;
+        const double z = static_cast<double>(c.layer) * ps.layer_separation;
+
+        if (c.rotated)
+        {
+            const double r = offset * std::sqrt(2.0);
+
+            return {{{x, y - r, z}, {x + r, y, z}, {x, y + r, z}, {x - r, y, z}}};
+        }
+
+        return {{{x + offset, y - offset, z}, {x + offset, y + offset, z}, {x - offset, y + offset, z},
+                 {x - offset, y - offset, z}}};
+    }
+    /**
+     * Computes the kink energy between two cells, i.e., the energy cost of them having opposite polarizations (unit:
+     * J). Each dot carries a charge of \f$\pm e/2\f$ relative to the neutralizing background.
+     *
+     * @param c1 First cell.
+     * @param c2 Second cell.
+     * @return Kink energy between `c1` and `c2`.
+     */
+    [[nodiscard]] double kink_energy(const qca_cell& c1, const qca_cell& c2) const noexcept
+    {
+        static constexpr const std::array<double, 4> charge_signs{{1.0, -1.0, 1.0, -1.0}};
+
+        const auto dots1 = dot_positions(c1);
+        const auto dots2 = dot_positions(c2);
+
+        double sum = 0.0;
+
+        for (auto i = 0u; i < 4; ++i)
+        {
+            for (auto j = 0u; j < 4; ++j)
+            {
+                const auto dx = dots1[i][0] - dots2[j][0];
+                const auto dy = dots1[i][1] - dots2[j][1];
+                const auto dz = dots1[i][2] - dots2[j][2];
+
+                sum += charge_signs[i] * charge_signs[j] / (std::sqrt(dx * dx + dy * dy + dz * dz) * 1e-9);
+            }
+        }
+
+        return -2.0 * physical_constants::K_E * physical_constants::ELEMENTARY_CHARGE *
+               physical_constants::ELEMENTARY_CHARGE / (4.0 * ps.epsilon_r) * sum;
+    }
+    /**
+     * Sets up the sparse neighbor kernel. Only cells whose centers are within the radius of effect of each other
+     * interact, which are found via a spatial lookup of all cells in the bounding box of the radius.
+     */
+    void set_up_kernel()
+    {
+        static constexpr const double pitch_x = qca_technology::CELL_WIDTH + qca_technology::CELL_HSPACE;
+        static constexpr const double pitch_y = qca_technology::CELL_HEIGHT + qca_technology::CELL_VSPACE;
+
+        std::map<std::tuple<int64_t, int64_t, int64_t>, uint32_t> positions{};
+        for (auto i = 0u; i < cells.size(); ++i)
+        {
+            positions[{cells[i].x, cells[i].y, cells[i].layer}] = i;
+        }
+
+        const auto reach_x   = static_cast<int64_t>(std::floor(ps.radius_of_effect / pitch_x));
+        const auto reach_y   = static_cast<int64_t>(std::floor(ps.radius_of_effect / pitch_y));
+        const auto max_layer = 2 * static_cast<int64_t>(lyt.z());
+
+        kernel_offsets.reserve(cells.size() + 1);
+        kernel_offsets.push_back(0);
+
+        for (const auto& c : cells)
+        {
+            for (auto y = c.y - reach_y; y <= c.y + reach_y; ++y)
+            {
+                for (auto x = c.x - reach_x; x <= c.x + reach_x; ++x)
+                {
+                    for (int64_t layer = 0; layer <= max_layer; ++layer)
+                    {
+                        const auto it = positions.find({x, y, layer});
+
+                        if (it == positions.cend() || (x == c.x && y == c.y && layer == c.layer))
+                        {
+                            continue;
+                        }
+
+                        const auto dx = static_cast<double>(x - c.x) * pitch_x;
+                        const auto dy = static_cast<double>(y - c.y) * pitch_y;
+                        const auto dz = static_cast<double>(layer - c.layer) * ps.layer_separation;
+
+                        if (std::sqrt(dx * dx + dy * dy + dz * dz) > ps.radius_of_effect)
+                        {
+                            continue;
+                        }
+
+                        kernel_neighbors.push_back(it->second);
+                        kernel_energies.push_back(kink_energy(c, cells[it->second]) / (2.0 * ps.clock_low));
+                    }
+                }
+            }
+
+            kernel_offsets.push_back(static_cast<uint32_t>(kernel_neighbors.size()));
+        }
+    }
+    /**
+     * Relaxes the given cells to their steady-state polarizations while the tunneling energy is lowered from
+     * `clock_high` to `clock_low`. The bistable response \f$P_i = x_i / \sqrt{1 + x_i^2}\f$ with
+     * \f$x_i = \sum_j E_{k,ij} P_j / 2\gamma\f$ is iterated in Jacobi fashion such that the result does not depend on
+     * the order of the cells.
+     *
+     * @param zone Indices of the cells to relax.
+     * @param polarization Current polarizations of all cells.
+     * @param buffer Scratch buffer.
+     * @return `true` iff all relaxations converged.
+     */
+    bool relax(const std::vector<uint32_t>& zone, std::vector<double>& polarization,
+               std::vector<double>& buffer) const noexcept
+    {
+        buffer.resize(zone.size());
+
+        bool converged = true;
+
+        for (uint64_t step = 0; step < ps.num_switching_steps; ++step)
+        {
+            // geometric interpolation of the tunneling energy from clock_high to clock_low
+            const auto fraction = ps.num_switching_steps > 1 ?
+                                      static_cast<double>(step) / static_cast<double>(ps.num_switching_steps - 1) :
+                                      1.0;
+            const auto gamma    = ps.clock_high * std::pow(ps.clock_low / ps.clock_high, fraction);
+            const auto scale    = ps.clock_low / gamma;
+
+            bool step_converged = false;
+
+            for (uint64_t iteration = 0; iteration < ps.max_iterations && !step_converged; ++iteration)
+            {
+                double max_delta = 0.0;
+
+                for (auto k = 0u; k < zone.size(); ++k)
+                {
+                    const auto i = zone[k];
+
+                    double x = 0.0;
+                    for (auto n = kernel_offsets[i]; n < kernel_offsets[i + 1]; ++n)
+                    {
+                        x += kernel_energies[n] * polarization[kernel_neighbors[n]];
+                    }
+                    x *= scale;
+
+                    buffer[k] = x / std::sqrt(1.0 + x * x);
+                    max_delta = std::max(max_delta, std::abs(buffer[k] - polarization[i]));
+                }
+
+                for (auto k = 0u; k < zone.size(); ++k)
+                {
+                    polarization[zone[k]] = buffer[k];
+                }
+
+                step_converged = max_delta < ps.convergence_tolerance;
+            }
+
+            converged &= step_converged;
+        }
+
+        return converged;
+    }
+    /**
+     * Simulates one input pattern by cycling through the clock phases until the polarizations of all clock zones
+     * repeat. In each step, the cells of one clock zone switch while the preceding zone holds its polarization and
+     * all other zones are relaxed, i.e., unpolarized.
+     *
+     * @param pattern Input pattern, where bit `i` is the value of the `i`-th input cell.
+     * @param polarization Scratch vector of current polarizations.
+     * @param settled Polarizations of all cells after their last switch phase.
+     * @param buffer Scratch buffer.
+     * @return `true` iff a steady state was reached and all relaxations converged.
+     */
+    bool simulate_pattern(const uint64_t pattern, std::vector<double>& polarization, std::vector<double>& settled,
+                          std::vector<double>& buffer) const noexcept
+    {
+        std::fill(polarization.begin(), polarization.end(), 0.0);
+        std::fill(settled.begin(), settled.end(), 0.0);
+
+        for (const auto& [i, p] : constant_cells)
+        {
+            polarization[i] = p;
+        }
+        for (auto i = 0u; i < input_indices.size(); ++i)
+        {
+            polarization[input_indices[i]] = ((pattern >> i) & 1u) != 0 ? 1.0 : -1.0;
+        }
+
+        bool     converged       = true;
+        uint64_t unchanged_steps = 0;
+
+        const auto max_steps = ps.max_clock_cycles * num_clocks;
+
+        for (uint64_t step = 0; step < max_steps && unchanged_steps < num_clocks; ++step)
+        {
+            const auto  zone          = step % num_clocks;
+            const auto& cells_in_zone = zone_cells[zone];
+
+            // release the zone that held in the previous step
+            if (num_clocks > 2)
+            {
+                for (const auto i : zone_cells[(zone + num_clocks - 2) % num_clocks])
+                {
+                    polarization[i] = 0.0;
+                }
+            }
+            for (const auto i : cells_in_zone)
+            {
+                polarization[i] = 0.0;
+            }
+
+            converged &= relax(cells_in_zone, polarization, buffer);
+
+            bool changed = false;
+            for (const auto i : cells_in_zone)
+            {
+                changed |= std::abs(polarization[i] - settled[i]) > ps.convergence_tolerance;
+                settled[i] = polarization[i];
+            }
+
+            unchanged_steps = changed ? 0 : unchanged_steps + 1;
+        }
+
+        return converged && unchanged_steps >= num_clocks;
+    }
+};
+
+/**
+ * Returns the input or output cells of the given layout in row-major order, i.e., sorted by row, column, and layer.
+ *
+ * @tparam Lyt QCA cell-level layout type.
+ * @param lyt The layout.
+ * @param inputs Whether to return the input or the output cells.
+ * @return Input or output cells of `lyt` in row-major order.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<cell<Lyt>> io_cells_in_row_major_order(const Lyt& lyt, const bool inputs) noexcept
+{
+    std::vector<cell<Lyt>> io{};
+
+    const auto collect = [&io](const auto& c) { io.push_back(c); };
+
+    if (inputs)
+    {
+        lyt.foreach_pi(collect);
+    }
+    else
+    {
+        lyt.foreach_po(collect);
+    }
+
+    std::sort(io.begin(), io.end(),
+              [](const auto& c1, const auto& c2)
+              {
+                  if (c1.y != c2.y)
+                  {
+                      return c1.y < c2.y;
+                  }
+                  if (c1.x != c2.x)
+                  {
+                      return c1.x < c2.x;
+                  }
+
+                  return c1.z < c2.z;
+              });
+
+    return io;
+}
+/**
+ * Orders the given input or output cells by the given names. If any name does not uniquely identify a cell, the order
+ * is not changed.
+ *
+ * @tparam Lyt QCA cell-level layout type.
+ * @param lyt The layout.
+ * @param io Input or output cells of `lyt`. Reordered if all names could be matched.
+ * @param names Names in the desired order.
+ */
+template <typename Lyt>
+void order_io_cells_by_name(const Lyt& lyt, std::vector<cell<Lyt>>& io, const std::vector<std::string>& names) noexcept
+{
+    if (names.size() != io.size())
+    {
+        return;
+    }
+
+    std::vector<cell<Lyt>> ordered{};
+    ordered.reserve(io.size());
+
+    for (const auto& name : names)
+    {
+        const auto has_name = [&lyt, &name](const auto& c) { return lyt.get_cell_name(c) == name; };
+
+        if (name.empty() || std::count_if(io.cbegin(), io.cend(), has_name) != 1)
+        {
+            return;
+        }
+
+        ordered.push_back(*std::find_if(io.cbegin(), io.cend(), has_name));
+    }
+
+    io = ordered;
+}
+
+}  // namespace detail
+
+/**
+ * Simulates all \f$2^n\f$ input patterns of a QCA cell-level layout with \f$n\f$ input cells using the bistable
+ * approximation as implemented in QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/).
+ *
+ * Each cell is modeled by its polarization \f$P \in [-1, 1]\f$, which responds to the polarizations of its neighbors
+ * weighted by their kink energies. Since the kink energy decays quickly with the distance, only cells within the radius
+ * of effect are considered, which results in a sparse neighbor kernel that is set up once and shared by all input
+ * patterns. The layout's clocking drives the simulation: clock zones switch one after another, each one driven by the
+ * preceding zone in its hold phase, while the tunneling barrier is lowered quasi-adiabatically. Vertically connected
+ * cells of adjacent layers are connected by via cells. Input patterns are distributed among multiple threads.
+ *
+ * Input cells and constant cells are fixed to polarization \f$+1\f$ (logic 1) or \f$-1\f$ (logic 0). An output cell
+ * reads logic 1 iff its polarization is positive after the simulation reached a steady state.
+ *
+ * This function throws an `std::invalid_argument` exception if more than `BISTABLE_QCA_SIMULATION_MAX_INPUTS` input
+ * cells are given.
+ *
+ * @tparam Lyt QCA cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param input_cells Input cells of `lyt`. The `i`-th input cell is the `i`-th variable of the resulting functions.
+ * @param output_cells Output cells of `lyt` whose functions are to be returned.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return The Boolean function of each output cell in the order of `output_cells`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<kitty::dynamic_truth_table>
+bistable_qca_simulation(const Lyt& lyt, const std::vector<cell<Lyt>>& input_cells,
+                        const std::vector<cell<Lyt>>& output_cells, const bistable_qca_simulation_params& ps = {},
+                        bistable_qca_simulation_stats* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_qca_technology_v<Lyt>, "Lyt must be a QCA layout");
+    static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
+
+    if (input_cells.size() > BISTABLE_QCA_SIMULATION_MAX_INPUTS)
+    {
+        throw std::invalid_argument(fmt::format("the bistable QCA simulation supports at most {} input cells, but {} "
+                                                "were given",
+                                                BISTABLE_QCA_SIMULATION_MAX_INPUTS, input_cells.size()));
+    }
+
+    bistable_qca_simulation_stats st{};
+
+    detail::bistable_qca_simulation_impl<Lyt> p{lyt, input_cells, output_cells, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+/**
+ * Simulates all \f$2^n\f$ input patterns of a QCA cell-level layout using the bistable approximation. Input and output
+ * cells are ordered row-major, i.e., by row, column, and layer. See the overload above for details.
+ *
+ * @tparam Lyt QCA cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return The Boolean function of each output cell in row-major order.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<kitty::dynamic_truth_table>
+bistable_qca_simulation(const Lyt& lyt, const bistable_qca_simulation_params& ps = {},
+                        bistable_qca_simulation_stats* pst = nullptr)
+{
+    return bistable_qca_simulation(lyt, detail::io_cells_in_row_major_order(lyt, true),
+                                   detail::io_cells_in_row_major_order(lyt, false), ps, pst);
+}
+/**
+ * Checks whether a QCA cell-level layout implements the given specification network by simulating all input patterns
+ * of the layout using `bistable_qca_simulation` and comparing the resulting output functions to the ones of `spec`.
+ * The specification can, e.g., be the gate-level layout from which the cell-level layout was created.
+ *
+ * Input and output cells are matched with the primary inputs and outputs of `spec` by their names. If the names do not
+ * match uniquely, input and output cells are considered in row-major order instead.
+ *
+ * @tparam Lyt QCA cell-level layout type.
+ * @tparam Ntk Logic network type.
+ * @param lyt The layout to verify.
+ * @param spec The specification.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return `true` iff `lyt` implements `spec` according to the simulation.
+ */
+template <typename Lyt, typename Ntk>
+[[nodiscard]] bool verify_qca_layout_by_simulation(const Lyt& lyt, const Ntk& spec,
+                                                   const bistable_qca_simulation_params& ps  = {},
+                                                   bistable_qca_simulation_stats*        pst = nullptr)
+{
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+    static_assert(mockturtle::has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi function");
+
+    if (lyt.num_pis() != spec.num_pis() || lyt.num_pos() != spec.num_pos())
+    {
+        return false;
+    }
+
+    auto input_cells  = detail::io_cells_in_row_major_order(lyt, true);
+    auto output_cells = detail::io_cells_in_row_major_order(lyt, false);
+
+    if constexpr (mockturtle::has_get_name_v<Ntk> && mockturtle::has_has_name_v<Ntk>)
+    {
+        std::vector<std::string> input_names{};
+        spec.foreach_pi(
+            [&spec, &input_names](const auto& pi)
+            {
+                const auto s = spec.make_signal(pi);
+                input_names.push_back(spec.has_name(s) ? spec.get_name(s) : std::string{});
+            });
+
+        detail::order_io_cells_by_name(lyt, input_cells, input_names);
+    }
+    if constexpr (mockturtle::has_get_output_name_v<Ntk> && mockturtle::has_has_output_name_v<Ntk>)
+    {
+        std::vector<std::string> output_names{};
+        for (auto i = 0u; i < spec.num_pos(); ++i)
+        {
+            output_names.push_back(spec.has_output_name(i) ? spec.get_output_name(i) : std::string{});
+        }
+
+        detail::order_io_cells_by_name(lyt, output_cells, output_names);
+    }
+
+    const auto functions = bistable_qca_simulation(lyt, input_cells, output_cells, ps, pst);
+
+    const auto spec_functions = mockturtle::simulate<kitty::dynamic_truth_table>(
+        spec, mockturtle::default_simulator<kitty::dynamic_truth_table>{static_cast<unsigned>(spec.num_pis())});
+
+    return functions == spec_functions;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_BISTABLE_QCA_SIMULATION_HPP
@@ -10,6 +10,7 @@
 #include "fiction/algorithms/simulation/sidb/can_positive_charges_occur.hpp"
 #include "fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp"
 #include "fiction/algorithms/simulation/sidb/energy_distribution.hpp"
+#include "fiction/algorithms/simulation/sidb/incremental_input_simulation.hpp"
 #include "fiction/algorithms/simulation/sidb/occupation_probability_of_excited_states.hpp"
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
@@ -30,6 +31,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -87,6 +89,10 @@ struct critical_temperature_params
      * Alpha parameter for the *QuickSim* algorithm (only applicable if engine == APPROXIMATE).
      */
     double alpha{0.7};
+    /**
+     * Mode to simulate the input patterns of gate layouts (only applicable if engine == EXACT).
+     */
+    input_simulation_mode input_sim_mode{input_simulation_mode::FULL_LAYOUT};
 };
 
 /**
@@ -173,46 +179,42 @@ class critical_temperature_impl
                 detect_bdl_pairs(layout, sidb_technology::cell_type::OUTPUT,
                                  params.input_iterator_params.bdl_wire_params.bdl_pairs_params);
 
+            if constexpr (!is_charge_distribution_surface_v<Lyt>)
+            {
+                if (params.input_sim_mode == input_simulation_mode::INCREMENTAL &&
+                    params.engine == critical_temperature_params::simulation_engine::EXACT)
+                {
+                    const auto input_bdl_pairs =
+                        detect_bdl_pairs(layout, sidb_technology::cell_type::INPUT,
+                                         params.input_iterator_params.bdl_wire_params.bdl_pairs_params);
+
+                    incremental_sim.emplace(layout, input_bdl_pairs, params.simulation_parameters);
+                }
+            }
+
             // number of different input combinations
             for (auto i = 0u; i < spec.front().num_bits(); ++i, ++bii)
             {
                 // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
-                if (can_positive_charges_occur(*bii, params.simulation_parameters))
+                if (incremental_sim.has_value() ? incremental_sim->can_positive_charges_occur(*bii) :
+                                                  can_positive_charges_occur(*bii, params.simulation_parameters))
                 {
                     critical_temperature = 0.0;
                     return;
                 }
 
                 // performs physical simulation of a given SiDB layout at a given input combination
-                const auto sim_result = physical_simulation_of_layout(bii);
-                if (sim_result.charge_distributions.empty())
+                const auto valid_charge_distributions_exist =
+                    incremental_sim.has_value() ?
+                        evaluate_input_pattern(physical_simulation_of_layout(incremental_sim->layout_of(*bii)),
+                                               output_bdl_pairs, spec, i) :
+                        evaluate_input_pattern(physical_simulation_of_layout(*bii), output_bdl_pairs, spec, i);
+
+                if (!valid_charge_distributions_exist)
                 {
                     critical_temperature = 0.0;
                     return;
                 }
-                stats.num_valid_lyt = sim_result.charge_distributions.size();
-                // The energy distribution of the physically valid charge configurations for the given layout is
-                // determined.
-                const auto distribution = energy_distribution(sim_result.charge_distributions);
-
-                // A label that indicates whether the state still fulfills the logic.
-                const auto energy_state_type = calculate_energy_and_state_type(
-                    distribution, sim_result.charge_distributions, output_bdl_pairs, spec, i);
-
-                const auto min_energy = energy_state_type.cbegin()->first;
-
-                auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
-
-                if (ground_state_is_transparent)
-                {
-                    this->determine_critical_temperature(energy_state_type);
-                }
-
-                else
-                {
-                    critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
-                                                 // Temperature is zero. May be worth it to change µ_.
-                }
             }
         }
     }
@@ -301,6 +303,53 @@ class critical_temperature_impl
     }
 
   private:
+    /**
+     * Evaluates the simulation results of one input pattern of a gate layout and updates the *Critical Temperature*
+     * accordingly.
+     *
+     * @tparam SimLyt SiDB cell-level layout type that was simulated.
+     * @tparam TT The type of the truth table specifying the gate behavior.
+     * @param sim_result Simulation results of the input pattern.
+     * @param output_bdl_pairs Output BDL pairs of the layout.
+     * @param spec Expected Boolean function of the layout given as a multi-output truth table.
+     * @param i Index of the input pattern.
+     * @return `false` iff no physically valid charge distributions were found.
+     */
+    template <typename SimLyt, typename TT>
+    [[nodiscard]] bool evaluate_input_pattern(const sidb_simulation_result<SimLyt>&   sim_result,
+                                              const std::vector<bdl_pair<cell<Lyt>>>& output_bdl_pairs,
+                                              const std::vector<TT>& spec, const uint64_t i) noexcept
+    {
+        if (sim_result.charge_distributions.empty())
+        {
+            return false;
+        }
+        stats.num_valid_lyt = sim_result.charge_distributions.size();
+        // The energy distribution of the physically valid charge configurations for the given layout is
+        // determined.
+        const auto distribution = energy_distribution(sim_result.charge_distributions);
+
+        // A label that indicates whether the state still fulfills the logic.
+        const auto energy_state_type =
+            calculate_energy_and_state_type(distribution, sim_result.charge_distributions, output_bdl_pairs, spec, i);
+
+        const auto min_energy = energy_state_type.cbegin()->first;
+
+        auto ground_state_is_transparent = is_ground_state_transparent(energy_state_type, min_energy);
+
+        if (ground_state_is_transparent)
+        {
+            this->determine_critical_temperature(energy_state_type);
+        }
+
+        else
+        {
+            critical_temperature = 0.0;  // If no ground state fulfills the logic, the Critical
+                                         // Temperature is zero. May be worth it to change µ_.
+        }
+
+        return true;
+    }
     /**
      * The energy difference between the ground state and the first erroneous state is determined. Additionally, the
      * state type of the ground state is determined and returned.
@@ -393,36 +442,43 @@ class critical_temperature_impl
      */
     double critical_temperature;
     /**
-     * This function conducts physical simulation of the given layout (gate layout with certain input combination). The
-     * simulation results are stored in the `sim_result_100` variable.
+     * Gate body and precomputed input perturber potentials if input patterns are simulated incrementally.
+     */
+    std::optional<incremental_input_simulation<Lyt>> incremental_sim{};
+    /**
+     * This function conducts physical simulation of the given layout (gate layout with certain input combination).
      *
-     * @param bdl_iterator A reference to a BDL input iterator representing the gate layout at a given input
-     * combination. The simulation is performed based on the configuration represented by the iterator.
+     * @tparam SimLyt SiDB cell-level layout type to simulate.
+     * @param lyt The gate layout at a given input combination, either including the input perturbers or as the gate
+     * body with the input perturbers as fixed charges.
      * @return Simulation results.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt>
-    physical_simulation_of_layout(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
+    template <typename SimLyt>
+    [[nodiscard]] sidb_simulation_result<SimLyt> physical_simulation_of_layout(const SimLyt& lyt) noexcept
     {
         assert(params.simulation_parameters.base == 2 && "base number has to be 2");
 
         if (params.engine == critical_temperature_params::simulation_engine::EXACT)
         {
             // perform exact simulation
-            const quickexact_params<cell<Lyt>> qe_params{
+            const quickexact_params<cell<SimLyt>> qe_params{
                 params.simulation_parameters,
-                fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-            return quickexact(*bdl_iterator, qe_params);
+                fiction::quickexact_params<cell<SimLyt>>::automatic_base_number_detection::OFF};
+            return quickexact(lyt, qe_params);
         }
 
-        if (params.engine == critical_temperature_params::simulation_engine::APPROXIMATE)
+        if constexpr (!is_sidb_defect_surface_v<SimLyt>)
         {
-            const quicksim_params qs_params{params.simulation_parameters, params.iteration_steps, params.alpha};
-            return quicksim(*bdl_iterator, qs_params);
+            if (params.engine == critical_temperature_params::simulation_engine::APPROXIMATE)
+            {
+                const quicksim_params qs_params{params.simulation_parameters, params.iteration_steps, params.alpha};
+                return quicksim(lyt, qs_params);
+            }
         }
 
         assert(false && "unsupported simulation engine");
 
-        return sidb_simulation_result<Lyt>{};
+        return sidb_simulation_result<SimLyt>{};
     }
 };
 
@@ -8,13 +8,525 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/physical_constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/utils/instrumentation.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace fiction
 {
 
+/**
+ * Parameters for *Exhaustive Ground State Simulation* (ExGS).
+ */
+struct exhaustive_ground_state_simulation_params
+{
+    /**
+     * Modes that determine which charge distributions are returned.
+     */
+    enum class result_mode : uint8_t
+    {
+        /**
+         * All physically valid charge distributions are returned.
+         */
+        ALL_PHYSICALLY_VALID,
+        /**
+         * Only the physically valid charge distributions of minimal energy, i.e., the (degenerate) ground states, are
+         * returned. This allows to additionally abandon partial charge assignments whose energy lower bound exceeds
+         * the energy of the best physically valid charge distribution found so far.
+         */
+        GROUND_STATES_ONLY
+    };
+    /**
+     * Physical parameters of the simulation.
+     */
+    sidb_simulation_parameters simulation_parameters{};
+    /**
+     * Charge distributions to return.
+     */
+    result_mode mode{result_mode::ALL_PHYSICALLY_VALID};
+    /**
+     * Number of threads that enumerate disjoint ranges of charge indices in parallel.
+     */
+    uint64_t num_threads{std::thread::hardware_concurrency()};
+};
+
+namespace detail
+{
+
+/**
+ * Branch-and-bound enumeration of charge distributions for ExGS. SiDBs are assigned charge states one after another in
+ * the order of their indices and in the order negative, neutral, positive, which corresponds to ascending charge
+ * indices. A partial assignment is abandoned if any of its assigned SiDBs cannot fulfill population stability for any
+ * completion of the assignment or, if only ground states are requested, if a lower bound on the energy of all its
+ * completions exceeds the energy of the best physically valid charge distribution found so far. The charge indices are
+ * partitioned into ranges of common charge index prefixes that are distributed among multiple threads.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+class exhaustive_ground_state_simulation_impl
+{
+  public:
+    exhaustive_ground_state_simulation_impl(const Lyt& lyt, const exhaustive_ground_state_simulation_params& p) :
+            ps{p},
+            charge_lyt{lyt},
+            num_sidbs{charge_lyt.num_cells()},
+            base{p.simulation_parameters.base}
+    {
+        charge_lyt.assign_physical_parameters(ps.simulation_parameters);
+        charge_lyt.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+    }
+
+    std::vector<charge_distribution_surface<Lyt>> run()
+    {
+        if (num_sidbs == 0)
+        {
+            charge_lyt.update_after_charge_change();
+
+            return charge_lyt.is_physically_valid() ? std::vector<charge_distribution_surface<Lyt>>{charge_lyt} :
+                                                      std::vector<charge_distribution_surface<Lyt>>{};
+        }
+
+        set_up_energy_model();
+
+        // number of leading SiDBs whose charge states determine a task
+        uint64_t prefix_length = 0;
+        uint64_t num_tasks     = 1;
+
+        const auto num_threads = std::max(ps.num_threads, uint64_t{1});
+
+        while (prefix_length < num_sidbs && num_tasks < 16 * num_threads)
+        {
+            ++prefix_length;
+            num_tasks *= base;
+        }
+
+        std::atomic<uint64_t> next_task{0};
+
+        std::vector<std::vector<std::pair<uint64_t, charge_distribution_surface<Lyt>>>> results(
+            std::min(num_threads, num_tasks));
+
+        const auto worker = [this, &next_task, &results, prefix_length, num_tasks](const uint64_t thread_id)
+        {
+            search_state state{num_sidbs, charge_lyt};
+
+            for (auto task = next_task++; task < num_tasks; task = next_task++)
+            {
+                // assign the charge states encoded by the task, most significant digit first
+                uint64_t divisor   = num_tasks;
+                uint64_t depth     = 0;
+                bool     promising = true;
+
+                while (promising && depth < prefix_length)
+                {
+                    divisor /= base;
+                    const auto digit = static_cast<int8_t>((task / divisor) % base);
+
+                    assign(state, depth, static_cast<int8_t>(digit - 1));
+                    ++depth;
+
+                    promising = is_promising(state, depth);
+                }
+
+                if (promising)
+                {
+                    search(state, prefix_length);
+                }
+
+                // undo the prefix
+                while (depth > 0)
+                {
+                    --depth;
+                    unassign(state, depth);
+                }
+            }
+
+            results[thread_id] = std::move(state.results);
+        };
+
+        if (results.size() == 1)
+        {
+            worker(0);
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(results.size());
+
+            for (auto i = 0u; i < results.size(); ++i)
+            {
+                threads.emplace_back(worker, i);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        // merge the results in ascending order of their charge indices
+        std::vector<std::pair<uint64_t, charge_distribution_surface<Lyt>>> merged{};
+        for (auto& thread_results : results)
+        {
+            std::move(thread_results.begin(), thread_results.end(), std::back_inserter(merged));
+        }
+
+        std::sort(merged.begin(), merged.end(),
+                  [](const auto& r1, const auto& r2) { return r1.first < r2.first; });
+
+        std::vector<charge_distribution_surface<Lyt>> charge_distributions{};
+        charge_distributions.reserve(merged.size());
+
+        const auto best = best_energy.load();
+
+        for (auto& result : merged)
+        {
+            if (ps.mode == exhaustive_ground_state_simulation_params::result_mode::ALL_PHYSICALLY_VALID ||
+                result.second.get_system_energy() <= best + physical_constants::POP_STABILITY_ERR)
+            {
+                charge_distributions.push_back(std::move(result.second));
+            }
+        }
+
+        return charge_distributions;
+    }
+
+  private:
+    /**
+     * Parameters.
+     */
+    const exhaustive_ground_state_simulation_params& ps;
+    /**
+     * Charge distribution surface of the layout to simulate.
+     */
+    charge_distribution_surface<Lyt> charge_lyt;
+    /**
+     * Number of SiDBs.
+     */
+    const uint64_t num_sidbs;
+    /**
+     * Number of charge states per SiDB.
+     */
+    const uint64_t base;
+    /**
+     * Chargeless electrostatic potentials between all pairs of SiDBs (unit: V).
+     */
+    std::vector<std::vector<double>> potentials{};
+    /**
+     * Local electrostatic potentials at all SiDBs caused by defects and external potentials (unit: V).
+     */
+    std::vector<double> external_potentials{};
+    /**
+     * Linear coefficients of the system energy, i.e., the energy of the system is \f$\sum_{i<j} V_{ij} q_i q_j +
+     * \sum_i h_i q_i + c\f$ for charges \f$q_i\f$ (unit: eV).
+     */
+    std::vector<double> linear_energies{};
+    /**
+     * Sum of the chargeless potentials of SiDB `i` to all SiDBs with an index of at least `k`, accessed as
+     * `remaining_potentials[k][i]` (unit: V).
+     */
+    std::vector<std::vector<double>> remaining_potentials{};
+    /**
+     * Lower bound on the pairwise interaction energy among all SiDBs with an index of at least `k` (unit: eV).
+     */
+    std::vector<double> remaining_interaction_bounds{};
+    /**
+     * Energy of the best physically valid charge distribution found so far (unit: eV).
+     */
+    std::atomic<double> best_energy{std::numeric_limits<double>::infinity()};
+    /**
+     * State of the depth-first search of one thread.
+     */
+    struct search_state
+    {
+        search_state(const uint64_t n, const charge_distribution_surface<Lyt>& cds) :
+                charges(n, 0),
+                local_potentials(n, 0.0),
+                charge_lyt{cds}
+        {}
+        /**
+         * Charges of the assigned SiDBs.
+         */
+        std::vector<int8_t> charges;
+        /**
+         * Local electrostatic potentials caused by the assigned SiDBs (unit: V).
+         */
+        std::vector<double> local_potentials;
+        /**
+         * Energy of the assigned SiDBs (unit: eV).
+         */
+        double energy{0.0};
+        /**
+         * Charge index of the assigned SiDBs.
+         */
+        uint64_t charge_index{0};
+        /**
+         * Charge distribution surface to check the physical validity of complete assignments.
+         */
+        charge_distribution_surface<Lyt> charge_lyt;
+        /**
+         * Physically valid charge distributions found by this thread and their charge indices.
+         */
+        std::vector<std::pair<uint64_t, charge_distribution_surface<Lyt>>> results{};
+    };
+    /**
+     * Extracts the coefficients of the system energy from the charge distribution surface.
+     */
+    void set_up_energy_model()
+    {
+        potentials.assign(num_sidbs, std::vector<double>(num_sidbs, 0.0));
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                potentials[i][j] = i == j ? 0.0 : charge_lyt.get_chargeless_potential_by_indices(i, j);
+            }
+        }
+
+        // with all SiDBs neutral, only defects and external potentials remain
+        charge_lyt.assign_all_charge_states(sidb_charge_state::NEUTRAL);
+        charge_lyt.update_after_charge_change();
+
+        const auto neutral_energy = charge_lyt.get_system_energy();
+
+        external_potentials.resize(num_sidbs);
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            external_potentials[i] = charge_lyt.get_local_potential_by_index(i).value_or(0.0);
+        }
+
+        // the energy of a single negative SiDB in an otherwise neutral layout yields its linear coefficient
+        linear_energies.resize(num_sidbs);
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            charge_lyt.assign_charge_state_by_cell_index(i, sidb_charge_state::NEGATIVE,
+                                                         charge_index_mode::KEEP_CHARGE_INDEX);
+            charge_lyt.update_after_charge_change();
+
+            linear_energies[i] = neutral_energy - charge_lyt.get_system_energy();
+
+            charge_lyt.assign_charge_state_by_cell_index(i, sidb_charge_state::NEUTRAL,
+                                                         charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        remaining_potentials.assign(num_sidbs + 1, std::vector<double>(num_sidbs, 0.0));
+        remaining_interaction_bounds.assign(num_sidbs + 1, 0.0);
+
+        for (auto k = num_sidbs; k-- > 0;)
+        {
+            double interactions = 0.0;
+
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                remaining_potentials[k][i] = remaining_potentials[k + 1][i] + potentials[i][k];
+
+                if (i > k)
+                {
+                    interactions += potentials[i][k];
+                }
+            }
+
+            // positive and negative SiDBs attract each other; otherwise, interaction energies are non-negative
+            remaining_interaction_bounds[k] =
+                remaining_interaction_bounds[k + 1] - (base == 3 ? interactions : 0.0);
+        }
+    }
+    /**
+     * Assigns a charge to an SiDB.
+     *
+     * @param state Search state.
+     * @param k Index of the SiDB.
+     * @param q Charge to assign.
+     */
+    void assign(search_state& state, const uint64_t k, const int8_t q) const noexcept
+    {
+        state.charges[k]   = q;
+        state.charge_index = state.charge_index * base + static_cast<uint64_t>(q + 1);
+        state.energy += q * (state.local_potentials[k] + linear_energies[k]);
+
+        if (q != 0)
+        {
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                state.local_potentials[i] += potentials[i][k] * q;
+            }
+        }
+    }
+    /**
+     * Removes the charge assigned to an SiDB, which has to be the most recently assigned one.
+     *
+     * @param state Search state.
+     * @param k Index of the SiDB.
+     */
+    void unassign(search_state& state, const uint64_t k) const noexcept
+    {
+        const auto q = state.charges[k];
+
+        if (q != 0)
+        {
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                state.local_potentials[i] -= potentials[i][k] * q;
+            }
+        }
+
+        state.energy -= q * (state.local_potentials[k] + linear_energies[k]);
+        state.charge_index /= base;
+        state.charges[k] = 0;
+    }
+    /**
+     * Checks whether any completion of the current partial assignment can be a requested charge distribution.
+     *
+     * @param state Search state.
+     * @param depth Number of assigned SiDBs.
+     * @return `false` if the partial assignment can be abandoned.
+     */
+    [[nodiscard]] bool is_promising(const search_state& state, const uint64_t depth) const noexcept
+    {
+        // small slack such that rounding never prunes a physically valid charge distribution
+        static constexpr const double slack = 1E-9;
+
+        const auto& sim   = ps.simulation_parameters;
+        const auto  mu_p  = sim.mu_plus();
+        const auto  error = physical_constants::POP_STABILITY_ERR;
+
+        // population stability of the assigned SiDBs given the range of their final local potentials
+        for (uint64_t i = 0; i < depth; ++i)
+        {
+            const auto pot       = external_potentials[i] + state.local_potentials[i];
+            const auto remaining = remaining_potentials[depth][i];
+            const auto lowest    = pot - remaining;
+            const auto highest   = pot + (base == 3 ? remaining : 0.0);
+
+            switch (state.charges[i])
+            {
+                case -1:
+                {
+                    if (highest + slack < sim.mu_minus - error)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+                case 1:
+                {
+                    if (lowest - slack > mu_p + error)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+                default:
+                {
+                    if (lowest - slack > sim.mu_minus - error || highest + slack < mu_p - error)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (ps.mode == exhaustive_ground_state_simulation_params::result_mode::GROUND_STATES_ONLY)
+        {
+            auto bound = state.energy + remaining_interaction_bounds[depth];
+
+            for (auto k = depth; k < num_sidbs; ++k)
+            {
+                const auto x = state.local_potentials[k] + linear_energies[k];
+
+                bound += base == 3 ? -std::abs(x) : std::min(0.0, -x);
+            }
+
+            if (bound - slack > best_energy.load(std::memory_order_relaxed) + physical_constants::POP_STABILITY_ERR)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Enumerates all promising completions of the current partial assignment.
+     *
+     * @param state Search state.
+     * @param depth Number of assigned SiDBs.
+     */
+    void search(search_state& state, const uint64_t depth)
+    {
+        if (depth == num_sidbs)
+        {
+            check_complete_assignment(state);
+
+            return;
+        }
+
+        for (int8_t q = -1; q < static_cast<int8_t>(base) - 1; ++q)
+        {
+            assign(state, depth, q);
+
+            if (is_promising(state, depth + 1))
+            {
+                search(state, depth + 1);
+            }
+
+            unassign(state, depth);
+        }
+    }
+    /**
+     * Checks the physical validity of a complete assignment and stores it if it is valid.
+     *
+     * @param state Search state.
+     */
+    void check_complete_assignment(search_state& state)
+    {
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            state.charge_lyt.assign_charge_state_by_cell_index(i, sign_to_charge_state(state.charges[i]),
+                                                               charge_index_mode::KEEP_CHARGE_INDEX);
+        }
+
+        state.charge_lyt.charge_distribution_to_index();
+        state.charge_lyt.update_after_charge_change();
+
+        if (!state.charge_lyt.is_physically_valid())
+        {
+            return;
+        }
+
+        const auto energy = state.charge_lyt.get_system_energy();
+
+        if (ps.mode == exhaustive_ground_state_simulation_params::result_mode::GROUND_STATES_ONLY)
+        {
+            auto best = best_energy.load();
+
+            if (energy > best + physical_constants::POP_STABILITY_ERR)
+            {
+                return;
+            }
+
+            while (energy < best && !best_energy.compare_exchange_weak(best, energy))
+            {}
+        }
+
+        state.results.emplace_back(state.charge_index, charge_distribution_surface<Lyt>{state.charge_lyt});
+    }
+};
+
+}  // namespace detail
+
 /**
  * *Exhaustive Ground State Simulation* (ExGS) which was proposed in \"Computer-Aided Design of Atomic Silicon Quantum
  * Dots and Computational Applications\" by S. S. H. Ng (https://dx.doi.org/10.14288/1.0392909) computes all physically
@@ -23,55 +535,65 @@ namespace fiction
  * only layouts with up to 30 SiDBs can be simulated in a reasonable time. However, since all charge configurations are
  * checked for validity, 100 % simulation accuracy is guaranteed.
  *
+ * Charge configurations are enumerated by a depth-first search that abandons partial configurations as soon as an
+ * already charged SiDB cannot fulfill population stability anymore. If only ground states are requested, partial
+ * configurations whose energy lower bound exceeds the energy of the best physically valid configuration found so far
+ * are abandoned as well. The search space is partitioned into disjoint charge index ranges that are processed by
+ * multiple threads. The physically valid charge distributions are returned in ascending order of their charge indices.
+ *
  * @note This was the first exact simulation approach. However, it is replaced by *QuickExact* due to the much
  * better runtimes and more functionality.
  *
  * @tparam Lyt SiDB cell-level layout type.
  * @param lyt The layout to simulate.
- * @param params Simulation parameters.
- * @param ps Simulation statistics.
+ * @param params Parameters.
  * @return sidb_simulation_result is returned with all results.
  */
 template <typename Lyt>
 sidb_simulation_result<Lyt>
-exhaustive_ground_state_simulation(const Lyt&                        lyt,
-                                   const sidb_simulation_parameters& params = sidb_simulation_parameters{}) noexcept
+exhaustive_ground_state_simulation(const Lyt& lyt, const exhaustive_ground_state_simulation_params& params) noexcept
 {
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
+    FICTION_PROFILE_SCOPE("exhaustive_ground_state_simulation");
+
     sidb_simulation_result<Lyt> simulation_result{};
     simulation_result.algorithm_name        = "ExGS";
-    simulation_result.simulation_parameters = params;
+    simulation_result.simulation_parameters = params.simulation_parameters;
     mockturtle::stopwatch<>::duration time_counter{};
     {
         const mockturtle::stopwatch stop{time_counter};
 
-        charge_distribution_surface<Lyt> charge_lyt{lyt};
+        detail::exhaustive_ground_state_simulation_impl<Lyt> p{lyt, params};
 
-        charge_lyt.assign_physical_parameters(params);
-        charge_lyt.assign_all_charge_states(sidb_charge_state::NEGATIVE);
-        charge_lyt.update_after_charge_change();
-
-        while (charge_lyt.get_charge_index_and_base().first < charge_lyt.get_max_charge_index())
-        {
-            if (charge_lyt.is_physically_valid())
-            {
-                simulation_result.charge_distributions.push_back(charge_distribution_surface<Lyt>{charge_lyt});
-            }
-
-            charge_lyt.increase_charge_index_by_one();
-        }
-
-        if (charge_lyt.is_physically_valid())
-        {
-            simulation_result.charge_distributions.push_back(charge_distribution_surface<Lyt>{charge_lyt});
-        }
+        simulation_result.charge_distributions = p.run();
     }
     simulation_result.simulation_runtime = time_counter;
 
     return simulation_result;
 }
+/**
+ * *Exhaustive Ground State Simulation* (ExGS) that returns all physically valid charge distributions of the given
+ * layout. The enumeration is performed by the calling thread only, which makes this overload safe to use from already
+ * parallelized contexts, e.g., operational domain computations.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param params Simulation parameters.
+ * @return sidb_simulation_result is returned with all results.
+ */
+template <typename Lyt>
+sidb_simulation_result<Lyt>
+exhaustive_ground_state_simulation(const Lyt&                        lyt,
+                                   const sidb_simulation_parameters& params = sidb_simulation_parameters{}) noexcept
+{
+    exhaustive_ground_state_simulation_params ps{};
+    ps.simulation_parameters = params;
+    ps.num_threads           = 1;
+
+    return exhaustive_ground_state_simulation(lyt, ps);
+}
 
 }  // namespace fiction
 
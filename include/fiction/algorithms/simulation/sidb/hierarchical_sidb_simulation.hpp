@@ -0,0 +1,1014 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
+#define FICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp"
+#include "fiction/algorithms/simulation/sidb/determine_groundstate_from_simulation_results.hpp"
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/quickexact.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/technology/cell_ports.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_defect_surface.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_nm_distance.hpp"
+#include "fiction/technology/sidb_nm_position.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/layout_utils.hpp"
+
+#include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Largest number of primary inputs that `hierarchical_sidb_simulation` accepts. All \f$2^n\f$ input patterns are
+ * simulated exhaustively, which bounds the runtime as well as the size of the resulting truth tables. Gate-level
+ * layouts with more primary inputs are rejected.
+ */
+inline constexpr uint32_t HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS = 24u;
+/**
+ * Parameters for the hierarchical SiDB simulation.
+ */
+struct hierarchical_sidb_simulation_params
+{
+    /**
+     * Physical parameters for the simulation of each tile.
+     */
+    sidb_simulation_parameters simulation_parameters{};
+    /**
+     * Exact simulation engine that simulates each tile.
+     */
+    exact_sidb_simulation_engine sim_engine{exact_sidb_simulation_engine::QUICKEXACT};
+    /**
+     * Parameters for the detection of the BDL pairs at the borders of each tile.
+     */
+    detect_bdl_pairs_params bdl_pairs_params{};
+    /**
+     * Number of threads that simulate independent tiles in parallel.
+     */
+    uint64_t num_threads{std::thread::hardware_concurrency()};
+    /**
+     * Number of input patterns that are propagated through the circuit at once. The output states of all tiles are only
+     * stored for one block of input patterns at a time, which bounds the memory consumption regardless of the number
+     * of primary inputs. Since simulated tiles are cached across blocks, smaller blocks hardly cause any additional
+     * tile simulations.
+     */
+    uint64_t pattern_block_size{4096};
+};
+/**
+ * Statistics of the hierarchical SiDB simulation.
+ */
+struct hierarchical_sidb_simulation_stats
+{
+    /**
+     * Total runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of simulated tiles. Crossings count as a single tile.
+     */
+    uint64_t num_tiles{0};
+    /**
+     * Number of levels of tiles that were simulated one after another.
+     */
+    uint64_t num_levels{0};
+    /**
+     * Number of simulated input patterns.
+     */
+    uint64_t num_input_patterns{0};
+    /**
+     * Number of physical simulations of tiles.
+     */
+    uint64_t num_tile_simulations{0};
+    /**
+     * Number of tile evaluations whose result was taken from the cache instead of being simulated.
+     */
+    uint64_t num_cache_hits{0};
+    /**
+     * Number of input patterns for which at least one primary output does not settle into a valid BDL state, e.g.,
+     * because a tile has a degenerate ground state.
+     */
+    uint64_t num_undefined_patterns{0};
+};
+
+namespace detail
+{
+
+template <typename GateLibrary, typename GateLyt, typename CellLyt>
+class hierarchical_sidb_simulation_impl
+{
+  public:
+    hierarchical_sidb_simulation_impl(const GateLyt& gate_layout, const CellLyt& cell_layout,
+                                      const hierarchical_sidb_simulation_params& p,
+                                      hierarchical_sidb_simulation_stats&        st) :
+            gate_lyt{gate_layout},
+            cell_lyt{cell_layout},
+            ps{p},
+            pst{st}
+    {}
+
+    std::vector<kitty::dynamic_truth_table> run()
+    {
+        const mockturtle::stopwatch stop{pst.time_total};
+
+        set_up_tiles();
+        set_up_ports();
+
+        const auto num_inputs   = static_cast<uint32_t>(gate_lyt.num_pis());
+        const auto num_patterns = uint64_t{1} << num_inputs;
+        const auto block_size   = std::clamp(ps.pattern_block_size, uint64_t{1}, num_patterns);
+
+        const auto num_levels = determine_levels();
+
+        // the primary output tiles
+        std::vector<std::size_t> po_tiles{};
+        gate_lyt.foreach_po(
+            [this, &po_tiles](const auto& po)
+            { po_tiles.push_back(tile_indices.at(ground_tile(gate_lyt.get_tile(gate_lyt.get_node(po))))); });
+
+        std::vector<kitty::dynamic_truth_table> functions(po_tiles.size(), kitty::dynamic_truth_table{num_inputs});
+
+        uint64_t num_undefined = 0;
+
+        tile_outputs.resize(tiles.size());
+
+        for (first_pattern = 0; first_pattern < num_patterns; first_pattern += block_size)
+        {
+            const auto num_block_patterns = std::min(block_size, num_patterns - first_pattern);
+
+            // output BDL states of all tiles in this block; std::nullopt if a state is not a valid BDL state
+            for (std::size_t i = 0; i < tiles.size(); ++i)
+            {
+                tile_outputs[i].assign(num_block_patterns * tiles[i].outputs.size(), std::nullopt);
+            }
+
+            for (uint64_t level = 0; level < num_levels; ++level)
+            {
+                simulate_level(level, num_block_patterns);
+            }
+
+            // read the output BDL states of the primary output tiles
+            for (uint64_t p = 0; p < num_block_patterns; ++p)
+            {
+                bool undefined = false;
+
+                for (std::size_t o = 0; o < po_tiles.size(); ++o)
+                {
+                    const auto i = po_tiles[o];
+                    if (tiles[i].outputs.empty())
+                    {
+                        undefined = true;
+                        continue;
+                    }
+
+                    const auto& bit = tile_outputs[i][p * tiles[i].outputs.size()];
+
+                    if (!bit.has_value())
+                    {
+                        undefined = true;
+                    }
+                    else if (*bit)
+                    {
+                        kitty::set_bit(functions[o], first_pattern + p);
+                    }
+                }
+
+                num_undefined += undefined ? 1 : 0;
+            }
+        }
+
+        pst.num_tiles              = tiles.size();
+        pst.num_levels             = num_levels;
+        pst.num_input_patterns     = num_patterns;
+        pst.num_undefined_patterns = num_undefined;
+
+        return functions;
+    }
+
+  private:
+    /**
+     * The gate-level layout that specifies the tiling.
+     */
+    const GateLyt& gate_lyt;
+    /**
+     * The SiDB cell-level layout that was obtained by applying `GateLibrary` to `gate_lyt`.
+     */
+    const CellLyt& cell_lyt;
+    /**
+     * Parameters.
+     */
+    const hierarchical_sidb_simulation_params& ps;
+    /**
+     * Statistics.
+     */
+    hierarchical_sidb_simulation_stats& pst;
+    /**
+     * Each tile is simulated in a local frame of cell coordinates in which the tile's top-left cell is offset by one
+     * tile width and height from the origin. This way, positions of neighboring tiles are non-negative as well.
+     */
+    static constexpr const int64_t margin_x = GateLibrary::gate_x_size();
+    /**
+     * Vertical offset of the local frame. Since it is even, the dimer row structure of the lattice is preserved.
+     */
+    static constexpr const int64_t margin_y = GateLibrary::gate_y_size();
+    /**
+     * A BDL pair at an output border of a tile.
+     */
+    struct output_port
+    {
+        /**
+         * Direction of the border.
+         */
+        port_direction::cardinal direction;
+        /**
+         * BDL pair closest to the border in the local frame.
+         */
+        bdl_pair<cell<CellLyt>> pair;
+        /**
+         * Negative charge that represents the input wire of the next tile, which is placed at the upper SiDB of the
+         * BDL pair that continues the output wire beyond the border. This mirrors the output perturbers of gate
+         * designs.
+         */
+        std::optional<cell<CellLyt>> load;
+    };
+    /**
+     * A BDL pair at an input border of a tile.
+     */
+    struct input_port
+    {
+        /**
+         * Index of the upstream tile and of its output port that drives this input, if any.
+         */
+        std::optional<std::pair<std::size_t, std::size_t>> upstream;
+        /**
+         * Index of the primary input that drives this input, if any.
+         */
+        std::optional<uint64_t> pi;
+        /**
+         * Virtual BDL pair that continues the input wire beyond the border in the local frame. It drives the inputs
+         * of primary input tiles.
+         */
+        std::optional<bdl_pair<cell<CellLyt>>> driver;
+    };
+    /**
+     * A tile of the gate-level layout that is simulated as a whole. Crossings, which occupy two tiles stacked on top
+     * of each other, are represented by their ground tile.
+     */
+    struct sim_tile
+    {
+        /**
+         * Ground tile in the gate-level layout.
+         */
+        tile<GateLyt> t;
+        /**
+         * Absolute position of the top-left cell of the tile.
+         */
+        int64_t origin_x, origin_y;
+        /**
+         * Index of the SiDB pattern of the tile. Tiles that host the same gate share their pattern.
+         */
+        std::size_t pattern;
+        /**
+         * SiDBs of the tile in the local frame.
+         */
+        std::vector<cell<CellLyt>> sidbs{};
+        /**
+         * BDL pairs of the tile in the local frame.
+         */
+        std::vector<bdl_pair<cell<CellLyt>>> pairs{};
+        /**
+         * Input ports.
+         */
+        std::vector<input_port> inputs{};
+        /**
+         * Output ports.
+         */
+        std::vector<output_port> outputs{};
+        /**
+         * Indices of the tiles that receive signals from this tile.
+         */
+        std::vector<std::size_t> downstream{};
+        /**
+         * Indices of the tiles that send signals to this tile.
+         */
+        std::vector<std::size_t> upstream{};
+        /**
+         * Level of the tile in the data flow.
+         */
+        uint64_t level{0};
+    };
+    /**
+     * All tiles to simulate.
+     */
+    std::vector<sim_tile> tiles{};
+    /**
+     * Maps ground tiles to their indices in `tiles`.
+     */
+    std::map<tile<GateLyt>, std::size_t> tile_indices{};
+    /**
+     * Maps SiDB patterns to their indices.
+     */
+    std::map<std::vector<cell<CellLyt>>, std::size_t> patterns{};
+    /**
+     * A tile simulation is fully determined by the SiDB pattern of the tile and the positions of the fixed charges at
+     * its borders, i.e., the boundary BDL states of its neighbors.
+     */
+    using tile_key = std::pair<std::size_t, std::vector<cell<CellLyt>>>;
+    /**
+     * Cached output BDL states of simulated tiles.
+     */
+    std::map<tile_key, std::vector<std::optional<bool>>> cache{};
+    /**
+     * First input pattern of the block that is currently simulated.
+     */
+    uint64_t first_pattern{0};
+    /**
+     * Output BDL states of each tile per input pattern of the current block and output port. The state of output port
+     * `o` in pattern `first_pattern + p` is stored at position `p * outputs.size() + o`.
+     */
+    std::vector<std::vector<std::optional<bool>>> tile_outputs{};
+
+    [[nodiscard]] static tile<GateLyt> ground_tile(const tile<GateLyt>& t) noexcept
+    {
+        return {t.x, t.y, 0};
+    }
+
+    [[nodiscard]] static cell<CellLyt> translate(const cell<CellLyt>& c, const int64_t dx, const int64_t dy) noexcept
+    {
+        return {static_cast<int64_t>(c.x) + dx, static_cast<int64_t>(c.y) + dy, c.z};
+    }
+    /**
+     * Collects the tiles and their SiDBs. The SiDBs of a tile are the ones of its gate in `GateLibrary` that are
+     * present in the cell-level layout.
+     */
+    void set_up_tiles()
+    {
+        gate_lyt.foreach_node(
+            [this](const auto& n)
+            {
+                if (gate_lyt.is_constant(n))
+                {
+                    return;
+                }
+
+                const auto t = ground_tile(gate_lyt.get_tile(n));
+
+                if (tile_indices.count(t) > 0)
+                {
+                    return;
+                }
+
+                const auto gate =
+                    GateLibrary::set_up_gate(gate_lyt, gate_lyt.is_empty_tile(t) ? gate_lyt.get_tile(n) : t);
+
+                const auto origin =
+                    relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(), GateLyt,
+                                                       CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+
+                sim_tile st{t, static_cast<int64_t>(origin.x), static_cast<int64_t>(origin.y), 0};
+
+                for (uint16_t y = 0u; y < GateLibrary::gate_y_size(); ++y)
+                {
+                    for (uint16_t x = 0u; x < GateLibrary::gate_x_size(); ++x)
+                    {
+                        if (gate[y][x] == technology<CellLyt>::cell_type::EMPTY)
+                        {
+                            continue;
+                        }
+
+                        if (!cell_lyt.is_empty_cell(translate(origin, x, y)))
+                        {
+                            st.sidbs.push_back(cell<CellLyt>{margin_x + x, margin_y + y});
+                        }
+                    }
+                }
+
+                std::sort(st.sidbs.begin(), st.sidbs.end());
+
+                st.pattern = patterns.emplace(st.sidbs, patterns.size()).first->second;
+                st.pairs   = detect_bdl_pairs(tile_layout(st.sidbs), technology<CellLyt>::cell_type::NORMAL,
+                                              ps.bdl_pairs_params);
+
+                tile_indices[t] = tiles.size();
+                tiles.push_back(std::move(st));
+            });
+
+        // connect the tiles via their data flow
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            const auto add_neighbors = [this, i](const tile<GateLyt>& t)
+            {
+                for (const auto& in : gate_lyt.incoming_data_flow(t))
+                {
+                    if (const auto j = tile_indices.at(ground_tile(in)); j != i)
+                    {
+                        tiles[i].upstream.push_back(j);
+                    }
+                }
+                for (const auto& out : gate_lyt.outgoing_data_flow(t))
+                {
+                    if (const auto j = tile_indices.at(ground_tile(out)); j != i)
+                    {
+                        tiles[i].downstream.push_back(j);
+                    }
+                }
+            };
+
+            const auto& t = tiles[i].t;
+
+            if (!gate_lyt.is_empty_tile(t))
+            {
+                add_neighbors(t);
+            }
+            if (const auto at = gate_lyt.above(t); at != t && !gate_lyt.is_empty_tile(at))
+            {
+                add_neighbors(at);
+            }
+
+            for (auto* neighbors : {&tiles[i].upstream, &tiles[i].downstream})
+            {
+                std::sort(neighbors->begin(), neighbors->end());
+                neighbors->erase(std::unique(neighbors->begin(), neighbors->end()), neighbors->end());
+            }
+        }
+    }
+    /**
+     * Creates a layout from the given SiDBs.
+     *
+     * @param sidbs SiDB positions.
+     * @return Layout that contains `sidbs` as normal SiDBs.
+     */
+    [[nodiscard]] static CellLyt tile_layout(const std::vector<cell<CellLyt>>& sidbs) noexcept
+    {
+        CellLyt lyt{};
+
+        for (const auto& c : sidbs)
+        {
+            lyt.assign_cell_type(c, technology<CellLyt>::cell_type::NORMAL);
+        }
+
+        return lyt;
+    }
+    /**
+     * Determines the BDL pair of the given tile that is closest to the border in the given direction.
+     *
+     * @param st The tile.
+     * @param dir Direction of the border.
+     * @return The BDL pair closest to the border, or `std::nullopt` if the tile has no BDL pairs.
+     */
+    [[nodiscard]] std::optional<bdl_pair<cell<CellLyt>>> border_pair(const sim_tile&                st,
+                                                                     const port_direction::cardinal dir) const noexcept
+    {
+        const auto x = (dir == port_direction::NORTH_WEST || dir == port_direction::SOUTH_WEST) ?
+                           GateLibrary::gate_x_size() / 4 :
+                           3 * GateLibrary::gate_x_size() / 4;
+        const auto y = (dir == port_direction::NORTH_WEST || dir == port_direction::NORTH_EAST) ?
+                           0 :
+                           GateLibrary::gate_y_size();
+
+        const auto anchor = sidb_nm_position(cell_lyt, cell<CellLyt>{margin_x + x, margin_y + y});
+
+        std::optional<bdl_pair<cell<CellLyt>>> closest{};
+        double                                 min_distance = std::numeric_limits<double>::infinity();
+
+        for (const auto& pair : st.pairs)
+        {
+            const auto upper = sidb_nm_position(cell_lyt, pair.upper);
+            const auto lower = sidb_nm_position(cell_lyt, pair.lower);
+
+            const auto distance = std::hypot((upper.first + lower.first) / 2.0 - anchor.first,
+                                             (upper.second + lower.second) / 2.0 - anchor.second);
+
+            if (distance < min_distance)
+            {
+                min_distance = distance;
+                closest      = pair;
+            }
+        }
+
+        return closest;
+    }
+    /**
+     * Continues the wire that ends in the given BDL pair by one BDL pair beyond the border of its tile. The step
+     * between two BDL pairs is taken from the given pair and its closest neighboring pair.
+     *
+     * @param st The tile.
+     * @param pair BDL pair at the border of `st`.
+     * @return The BDL pair that continues the wire beyond the border, or `std::nullopt` if `pair` is the only BDL pair
+     * of `st`.
+     */
+    [[nodiscard]] std::optional<bdl_pair<cell<CellLyt>>>
+    continue_wire(const sim_tile& st, const bdl_pair<cell<CellLyt>>& pair) const noexcept
+    {
+        std::optional<bdl_pair<cell<CellLyt>>> next{};
+        double                                  min_distance = std::numeric_limits<double>::infinity();
+
+        for (const auto& other : st.pairs)
+        {
+            if (other == pair)
+            {
+                continue;
+            }
+
+            if (const auto distance = sidb_nm_distance(cell_lyt, pair.upper, other.upper); distance < min_distance)
+            {
+                min_distance = distance;
+                next         = other;
+            }
+        }
+
+        if (!next.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto dx = static_cast<int64_t>(pair.upper.x) - static_cast<int64_t>(next->upper.x);
+        const auto dy = static_cast<int64_t>(pair.upper.y) - static_cast<int64_t>(next->upper.y);
+
+        return bdl_pair<cell<CellLyt>>{pair.type, translate(pair.upper, dx, dy), translate(pair.lower, dx, dy)};
+    }
+    /**
+     * Sets up the input and output ports of all tiles. The direction of a port is given by the relative position of
+     * the neighboring tile. Primary input tiles are driven from their north-western border and primary output tiles
+     * are read at their south-eastern border, which is the convention of the Bestagon library.
+     */
+    void set_up_ports()
+    {
+        for (auto& st : tiles)
+        {
+            std::vector<port_direction::cardinal> directions{};
+
+            for (const auto j : st.downstream)
+            {
+                directions.push_back(tiles[j].origin_x > st.origin_x ? port_direction::SOUTH_EAST :
+                                                                       port_direction::SOUTH_WEST);
+            }
+            if (directions.empty() && gate_lyt.is_po(gate_lyt.get_node(st.t)))
+            {
+                directions.push_back(port_direction::SOUTH_EAST);
+            }
+
+            std::sort(directions.begin(), directions.end());
+            directions.erase(std::unique(directions.begin(), directions.end()), directions.end());
+
+            for (const auto dir : directions)
+            {
+                if (const auto pair = border_pair(st, dir); pair.has_value())
+                {
+                    const auto extension = continue_wire(st, *pair);
+
+                    st.outputs.push_back(
+                        {dir, *pair, extension.has_value() ? std::optional{extension->upper} : std::nullopt});
+                }
+            }
+        }
+
+        std::map<std::size_t, uint64_t> pi_indices{};
+        gate_lyt.foreach_pi(
+            [this, &pi_indices](const auto& pi)
+            { pi_indices.emplace(tile_indices.at(ground_tile(gate_lyt.get_tile(pi))), pi_indices.size()); });
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            auto& st = tiles[i];
+
+            for (const auto j : st.upstream)
+            {
+                const auto dir = tiles[j].origin_x > st.origin_x ? port_direction::SOUTH_WEST :
+                                                                   port_direction::SOUTH_EAST;
+
+                const auto& outputs = tiles[j].outputs;
+
+                if (const auto it = std::find_if(outputs.cbegin(), outputs.cend(),
+                                                 [&dir](const auto& o) { return o.direction == dir; });
+                    it != outputs.cend())
+                {
+                    st.inputs.push_back(
+                        {std::pair{j, static_cast<std::size_t>(std::distance(outputs.cbegin(), it))}, std::nullopt,
+                         std::nullopt});
+                }
+            }
+
+            if (const auto it = pi_indices.find(i); it != pi_indices.cend())
+            {
+                if (const auto pair = border_pair(st, port_direction::NORTH_WEST); pair.has_value())
+                {
+                    st.inputs.push_back({std::nullopt, it->second, continue_wire(st, *pair)});
+                }
+            }
+        }
+    }
+    /**
+     * Assigns each tile its level in the data flow, i.e., the length of the longest path from any tile without
+     * upstream tiles. Since the data flow respects the clocking, tiles are simulated in clocking order level by level
+     * and all tiles of the same level are independent of each other.
+     *
+     * @return Number of levels.
+     */
+    uint64_t determine_levels() noexcept
+    {
+        std::vector<std::size_t> num_pending(tiles.size());
+        std::vector<std::size_t> ready{};
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            num_pending[i] = tiles[i].upstream.size();
+
+            if (num_pending[i] == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+
+        uint64_t num_levels = 0;
+
+        while (!ready.empty())
+        {
+            const auto i = ready.back();
+            ready.pop_back();
+
+            num_levels = std::max(num_levels, tiles[i].level + 1);
+
+            for (const auto j : tiles[i].downstream)
+            {
+                tiles[j].level = std::max(tiles[j].level, tiles[i].level + 1);
+
+                if (--num_pending[j] == 0)
+                {
+                    ready.push_back(j);
+                }
+            }
+        }
+
+        return num_levels;
+    }
+    /**
+     * Determines the fixed charges at the borders of the given tile in the given input pattern. Each input is
+     * represented by the negatively charged SiDB of the BDL pair that drives it, i.e., the lower SiDB for logic 1 and
+     * the upper SiDB for logic 0.
+     *
+     * @param st The tile.
+     * @param pattern The input pattern, which has to be part of the current block.
+     * @return The sorted positions of all fixed charges in the local frame of `st`, or `std::nullopt` if any input is
+     * not driven by a valid BDL state.
+     */
+    [[nodiscard]] std::optional<std::vector<cell<CellLyt>>> boundary_charges(const sim_tile& st,
+                                                                             const uint64_t  pattern) const noexcept
+    {
+        std::vector<cell<CellLyt>> charges{};
+
+        for (const auto& in : st.inputs)
+        {
+            if (in.upstream.has_value())
+            {
+                const auto& [j, o] = *in.upstream;
+                const auto& up     = tiles[j];
+                const auto& bit    = tile_outputs[j][(pattern - first_pattern) * up.outputs.size() + o];
+
+                if (!bit.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                const auto& pair = up.outputs[o].pair;
+
+                charges.push_back(
+                    translate(*bit ? pair.lower : pair.upper, up.origin_x - st.origin_x, up.origin_y - st.origin_y));
+            }
+            else if (in.pi.has_value() && in.driver.has_value())
+            {
+                charges.push_back(((pattern >> *in.pi) & 1u) != 0 ? in.driver->lower : in.driver->upper);
+            }
+        }
+
+        for (const auto& out : st.outputs)
+        {
+            if (out.load.has_value())
+            {
+                charges.push_back(*out.load);
+            }
+        }
+
+        std::sort(charges.begin(), charges.end());
+
+        return charges;
+    }
+    /**
+     * Simulates the given tile with the given fixed charges at its borders and reads the BDL states of its output
+     * ports. A BDL pair encodes logic 1 if its lower SiDB is negatively charged and its upper SiDB is neutral, and
+     * logic 0 vice versa.
+     *
+     * @param st The tile.
+     * @param charges Fixed charges in the local frame of `st`.
+     * @return The state of each output port of `st`, which is `std::nullopt` if no valid BDL state is reached in all
+     * ground states.
+     */
+    [[nodiscard]] std::vector<std::optional<bool>> simulate_tile(const sim_tile&                   st,
+                                                                 const std::vector<cell<CellLyt>>& charges) const
+    {
+        sidb_defect_surface<CellLyt> lyt{tile_layout(st.sidbs)};
+
+        const sidb_defect perturber{sidb_defect_type::UNKNOWN, -1, ps.simulation_parameters.epsilon_r,
+                                    ps.simulation_parameters.lambda_tf};
+
+        for (const auto& c : charges)
+        {
+            lyt.assign_sidb_defect(c, perturber);
+        }
+
+        const auto result =
+            ps.sim_engine == exact_sidb_simulation_engine::EXGS ?
+                exhaustive_ground_state_simulation(lyt, ps.simulation_parameters) :
+                quickexact(lyt, quickexact_params<cell<CellLyt>>{
+                                    ps.simulation_parameters,
+                                    quickexact_params<cell<CellLyt>>::automatic_base_number_detection::OFF});
+
+        std::vector<std::optional<bool>> states(st.outputs.size());
+
+        const auto ground_states = determine_groundstate_from_simulation_results(result);
+
+        for (std::size_t o = 0; o < st.outputs.size(); ++o)
+        {
+            std::optional<bool> state{};
+
+            for (auto g = 0u; g < ground_states.size(); ++g)
+            {
+                const auto upper = ground_states[g].get_charge_state(st.outputs[o].pair.upper);
+                const auto lower = ground_states[g].get_charge_state(st.outputs[o].pair.lower);
+
+                std::optional<bool> gs_state{};
+
+                if (upper == sidb_charge_state::NEUTRAL && lower == sidb_charge_state::NEGATIVE)
+                {
+                    gs_state = true;
+                }
+                else if (upper == sidb_charge_state::NEGATIVE && lower == sidb_charge_state::NEUTRAL)
+                {
+                    gs_state = false;
+                }
+
+                // degenerate ground states have to agree
+                if (!gs_state.has_value() || (g > 0 && gs_state != state))
+                {
+                    state = std::nullopt;
+                    break;
+                }
+
+                state = gs_state;
+            }
+
+            states[o] = state;
+        }
+
+        return states;
+    }
+    /**
+     * Simulates all tiles of the given level in all input patterns of the current block. Tile simulations whose results
+     * are not cached yet are distributed among multiple threads.
+     *
+     * @param level The level to simulate.
+     * @param num_block_patterns Number of input patterns in the current block.
+     */
+    void simulate_level(const uint64_t level, const uint64_t num_block_patterns)
+    {
+        // tile evaluations that wait for the simulation of a key
+        std::map<tile_key, std::vector<std::pair<std::size_t, uint64_t>>> pending{};
+
+        for (std::size_t i = 0; i < tiles.size(); ++i)
+        {
+            if (tiles[i].level != level || tiles[i].outputs.empty())
+            {
+                continue;
+            }
+
+            for (auto pattern = first_pattern; pattern < first_pattern + num_block_patterns; ++pattern)
+            {
+                auto charges = boundary_charges(tiles[i], pattern);
+
+                // undefined inputs lead to undefined outputs
+                if (!charges.has_value())
+                {
+                    continue;
+                }
+
+                tile_key key{tiles[i].pattern, std::move(*charges)};
+
+                if (const auto it = cache.find(key); it != cache.cend())
+                {
+                    store_outputs(i, pattern, it->second);
+                    ++pst.num_cache_hits;
+                }
+                else
+                {
+                    pending[std::move(key)].emplace_back(i, pattern);
+                }
+            }
+        }
+
+        std::vector<const tile_key*> keys{};
+        keys.reserve(pending.size());
+        for (const auto& [key, evaluations] : pending)
+        {
+            keys.push_back(&key);
+        }
+
+        std::vector<std::vector<std::optional<bool>>> results(keys.size());
+
+        std::atomic<std::size_t> next_key{0};
+
+        const auto worker = [this, &next_key, &keys, &results, &pending]
+        {
+            for (auto k = next_key++; k < keys.size(); k = next_key++)
+            {
+                results[k] = simulate_tile(tiles[pending.at(*keys[k]).front().first], keys[k]->second);
+            }
+        };
+
+        const auto num_threads =
+            std::clamp(ps.num_threads, uint64_t{1}, std::max(static_cast<uint64_t>(keys.size()), uint64_t{1}));
+
+        if (num_threads == 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads);
+
+            for (auto i = 0u; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        for (std::size_t k = 0; k < keys.size(); ++k)
+        {
+            const auto& evaluations = pending.at(*keys[k]);
+
+            for (const auto& [i, pattern] : evaluations)
+            {
+                store_outputs(i, pattern, results[k]);
+            }
+
+            pst.num_cache_hits += evaluations.size() - 1;
+            cache.emplace(*keys[k], std::move(results[k]));
+        }
+
+        pst.num_tile_simulations += keys.size();
+    }
+
+    void store_outputs(const std::size_t i, const uint64_t pattern, const std::vector<std::optional<bool>>& states)
+    {
+        const auto num_outputs = tiles[i].outputs.size();
+
+        std::copy(states.cbegin(), states.cend(),
+                  tile_outputs[i].begin() + static_cast<std::ptrdiff_t>((pattern - first_pattern) * num_outputs));
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Hierarchical simulation of an SiDB circuit that was obtained by applying a tile-based gate library such as
+ * `sidb_bestagon_library` to a gate-level layout. A full circuit is far beyond the reach of exact simulation, but its
+ * tiles are not: each tile is simulated on its own with the boundary BDL states of its upstream neighbors as fixed
+ * negative charges, and its resulting output BDL states are propagated to its downstream neighbors. Tiles are
+ * processed in the order of the data flow, which follows the clocking, such that all tiles of one level are
+ * independent of each other and simulated in parallel.
+ *
+ * A tile simulation only depends on the SiDB pattern of the tile and the positions of the fixed charges at its
+ * borders. Therefore, results are cached by these two, which makes each distinct gate type in each distinct boundary
+ * state a single simulation, regardless of how often it occurs in the circuit and in how many input patterns.
+ *
+ * The input borders of primary input tiles are driven by a virtual BDL pair that continues the input wire beyond the
+ * tile. Each output border is loaded by a negative charge that represents the input wire of the next tile, just like
+ * the output perturbers of gate designs. A BDL pair encodes logic 1 if its lower SiDB is negatively charged and its
+ * upper SiDB is neutral, and logic 0 vice versa. If a tile does not reach a valid BDL state at an output in all of its
+ * ground states, the state is undefined and so are the states of all tiles downstream of it.
+ *
+ * Input patterns are propagated through the circuit in blocks of `pattern_block_size` patterns such that the output
+ * states of all tiles only have to be stored for one block at a time. This function throws an `std::invalid_argument`
+ * exception if `gate_lyt` has more than `HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS` primary inputs.
+ *
+ * @note Interactions between tiles are restricted to the boundary BDL pairs of connected neighbors. This is the
+ * assumption under which tile-based gate libraries are designed.
+ *
+ * @tparam GateLibrary Tile-based SiDB gate library that was applied to `gate_lyt`, e.g., `sidb_bestagon_library`.
+ * @tparam GateLyt Pointy-top hexagonal gate-level layout type.
+ * @tparam CellLyt SiDB cell-level layout type.
+ * @param gate_lyt The gate-level layout that specifies the tiling.
+ * @param cell_lyt The SiDB cell-level layout obtained from `gate_lyt` via `apply_gate_library`.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return The Boolean function of each primary output of `gate_lyt` over its primary inputs. Undefined output states
+ * are represented as 0.
+ */
+template <typename GateLibrary, typename GateLyt, typename CellLyt>
+[[nodiscard]] std::vector<kitty::dynamic_truth_table>
+hierarchical_sidb_simulation(const GateLyt& gate_lyt, const CellLyt& cell_lyt,
+                             const hierarchical_sidb_simulation_params& ps  = {},
+                             hierarchical_sidb_simulation_stats*        pst = nullptr)
+{
+    static_assert(is_gate_level_layout_v<GateLyt>, "GateLyt is not a gate-level layout");
+    static_assert(is_hexagonal_layout_v<GateLyt>, "GateLyt must be a hexagonal layout");
+    static_assert(has_pointy_top_hex_orientation_v<GateLyt>, "GateLyt must be a pointy-top hexagonal layout");
+    static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<CellLyt>, "CellLyt is not an SiDB layout");
+    static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
+    static_assert(std::is_same_v<technology<CellLyt>, technology<GateLibrary>>,
+                  "CellLyt and GateLibrary must implement the same technology");
+
+    if (gate_lyt.num_pis() > HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS)
+    {
+        throw std::invalid_argument(fmt::format("the hierarchical SiDB simulation supports at most {} primary inputs, "
+                                                "but {} were given",
+                                                HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS, gate_lyt.num_pis()));
+    }
+
+    hierarchical_sidb_simulation_stats st{};
+
+    detail::hierarchical_sidb_simulation_impl<GateLibrary, GateLyt, CellLyt> p{gate_lyt, cell_lyt, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+/**
+ * Checks whether an SiDB circuit implements the gate-level layout it was obtained from by simulating it with
+ * `hierarchical_sidb_simulation` and comparing the resulting output functions to the ones of the gate-level layout.
+ *
+ * @tparam GateLibrary Tile-based SiDB gate library that was applied to `gate_lyt`, e.g., `sidb_bestagon_library`.
+ * @tparam GateLyt Pointy-top hexagonal gate-level layout type.
+ * @tparam CellLyt SiDB cell-level layout type.
+ * @param gate_lyt The gate-level layout that specifies the tiling and the expected functions.
+ * @param cell_lyt The SiDB cell-level layout obtained from `gate_lyt` via `apply_gate_library`.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return `true` iff all output states are defined and `cell_lyt` implements the functions of `gate_lyt`.
+ */
+template <typename GateLibrary, typename GateLyt, typename CellLyt>
+[[nodiscard]] bool verify_sidb_layout_by_hierarchical_simulation(const GateLyt& gate_lyt, const CellLyt& cell_lyt,
+                                                                 const hierarchical_sidb_simulation_params& ps = {},
+                                                                 hierarchical_sidb_simulation_stats* pst = nullptr)
+{
+    hierarchical_sidb_simulation_stats st{};
+
+    const auto functions = hierarchical_sidb_simulation<GateLibrary>(gate_lyt, cell_lyt, ps, &st);
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    if (st.num_undefined_patterns != 0)
+    {
+        return false;
+    }
+
+    const auto spec_functions = mockturtle::simulate<kitty::dynamic_truth_table>(
+        gate_lyt, mockturtle::default_simulator<kitty::dynamic_truth_table>{static_cast<unsigned>(gate_lyt.num_pis())});
+
+    return functions == spec_functions;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_HIERARCHICAL_SIDB_SIMULATION_HPP
@@ -0,0 +1,266 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INCREMENTAL_INPUT_SIMULATION_HPP
+#define FICTION_INCREMENTAL_INPUT_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/detect_bdl_pairs.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_defect_surface.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_nm_distance.hpp"
+#include "fiction/traits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Modes to simulate the \f$2^n\f$ input patterns of an \f$n\f$-input SiDB gate layout.
+ */
+enum class input_simulation_mode : uint8_t
+{
+    /**
+     * Each input pattern is simulated as an independent layout that includes the input perturbers.
+     */
+    FULL_LAYOUT,
+    /**
+     * The gate body, i.e., the layout without its input BDL pairs, is set up once. The electrostatic potentials of
+     * its SiDBs and of every input perturber at the gate body are precomputed. This makes the check for positively
+     * charged SiDBs of an input pattern run in \f$\mathcal{O}(N)\f$ instead of \f$\mathcal{O}(N^2)\f$ for \f$N\f$
+     * SiDBs. Each input pattern that is simulated is still passed to the simulation engine as a copy of the gate body
+     * in which the active input perturbers are fixed negative charges, i.e., SiDB defects. The engine rebuilds its
+     * charge distribution surface and thereby the distance and potential matrices of the gate body for every such
+     * pattern, so the simulation setup itself remains \f$\mathcal{O}(N^2)\f$ per pattern. The input perturbers are,
+     * however, no longer variables of the simulation. The results are identical to `FULL_LAYOUT` as long as the input
+     * perturbers are negatively charged, which is the case for the isolated perturbers used in gate designs.
+     *
+     * @note Only applicable to simulation engines that support SiDB defects, i.e., *QuickExact* and *ExGS*, and to
+     * layouts that are not charge distribution surfaces. Otherwise, `FULL_LAYOUT` is used.
+     */
+    INCREMENTAL
+};
+
+namespace detail
+{
+
+/**
+ * Helper for input-pattern-incremental SiDB simulation. It separates a gate layout into its gate body and the SiDBs of
+ * its input BDL pairs, which are the only SiDBs that change between input patterns (see `bdl_input_iterator`).
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ */
+template <typename Lyt>
+class incremental_input_simulation
+{
+  public:
+    /**
+     * Layout type to simulate the gate body with the active input perturbers of one input pattern.
+     */
+    using pattern_layout = sidb_defect_surface<Lyt>;
+    /**
+     * Standard constructor. Sets up the gate body and precomputes the electrostatic potentials of all possible input
+     * perturbers.
+     *
+     * @param lyt The SiDB gate layout.
+     * @param input_pairs The input BDL pairs of `lyt`.
+     * @param params Physical parameters used for the simulation.
+     */
+    incremental_input_simulation(const Lyt& lyt, const std::vector<bdl_pair<cell<Lyt>>>& input_pairs,
+                                 const sidb_simulation_parameters& params) :
+            body{lyt.clone()},
+            parameters{params}
+    {
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+        for (const auto& pair : input_pairs)
+        {
+            input_sidbs.push_back(pair.upper);
+            input_sidbs.push_back(pair.lower);
+        }
+
+        for (const auto& c : input_sidbs)
+        {
+            body.assign_cell_type(c, technology<Lyt>::cell_type::EMPTY);
+        }
+
+        // local electrostatic potentials of the gate body when all of its SiDBs are negatively charged
+        charge_distribution_surface<Lyt> charge_body{body};
+        charge_body.assign_physical_parameters(parameters);
+        charge_body.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+        charge_body.update_after_charge_change();
+
+        body_sidbs = charge_body.get_sidb_order();
+
+        body_potentials.reserve(body_sidbs.size());
+        for (uint64_t i = 0; i < body_sidbs.size(); ++i)
+        {
+            body_potentials.push_back(charge_body.get_local_potential_by_index(i).value_or(0.0));
+        }
+
+        // potentials of each (negatively charged) input perturber at the SiDBs of the gate body and at the other
+        // input perturbers
+        perturber_potentials.resize(input_sidbs.size());
+        perturber_interactions.resize(input_sidbs.size());
+        body_potentials_at_perturbers.resize(input_sidbs.size(), 0.0);
+
+        for (auto p = 0u; p < input_sidbs.size(); ++p)
+        {
+            perturber_potentials[p].reserve(body_sidbs.size());
+            for (const auto& c : body_sidbs)
+            {
+                const auto pot = -charge_body.chargeless_potential_at_given_distance(
+                    sidb_nm_distance<Lyt>(body, c, input_sidbs[p]));
+
+                perturber_potentials[p].push_back(pot);
+                body_potentials_at_perturbers[p] += pot;
+            }
+
+            perturber_interactions[p].reserve(input_sidbs.size());
+            for (const auto& q : input_sidbs)
+            {
+                const auto dist = sidb_nm_distance<Lyt>(body, input_sidbs[p], q);
+
+                perturber_interactions[p].push_back(-charge_body.chargeless_potential_at_given_distance(dist));
+            }
+        }
+    }
+    /**
+     * Checks whether positively charged SiDBs can occur in the given input pattern. This is equivalent to calling
+     * `can_positive_charges_occur` on the input pattern but runs in \f$\mathcal{O}(N)\f$ time.
+     *
+     * @param pattern Gate layout with the input perturbers of the current input pattern (see `bdl_input_iterator`).
+     * @return `true` iff positively charged SiDBs can occur.
+     */
+    [[nodiscard]] bool can_positive_charges_occur(const Lyt& pattern) const noexcept
+    {
+        const auto active  = active_perturbers(pattern);
+        const auto mu_plus = parameters.mu_plus();
+
+        const auto can_be_positive = [&mu_plus](const double local_pot) noexcept
+        { return (-local_pot + mu_plus) > -physical_constants::POP_STABILITY_ERR; };
+
+        for (uint64_t i = 0; i < body_sidbs.size(); ++i)
+        {
+            auto local_pot = body_potentials[i];
+
+            for (const auto p : active)
+            {
+                local_pot += perturber_potentials[p][i];
+            }
+
+            if (can_be_positive(local_pot))
+            {
+                return true;
+            }
+        }
+
+        for (const auto p : active)
+        {
+            auto local_pot = body_potentials_at_perturbers[p];
+
+            for (const auto q : active)
+            {
+                local_pot += perturber_interactions[p][q];
+            }
+
+            if (can_be_positive(local_pot))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Creates the layout to simulate for the given input pattern. It consists of a copy of the gate body and the active
+     * input perturbers, which are represented as negatively charged defects with the physical parameters of SiDBs. The
+     * simulation engine sets up its own charge distribution surface from this layout.
+     *
+     * @param pattern Gate layout with the input perturbers of the current input pattern (see `bdl_input_iterator`).
+     * @return The gate body with the active input perturbers of `pattern` as fixed charges.
+     */
+    [[nodiscard]] pattern_layout layout_of(const Lyt& pattern) const noexcept
+    {
+        const sidb_defect perturber{sidb_defect_type::UNKNOWN, -1, parameters.epsilon_r, parameters.lambda_tf};
+
+        pattern_layout lyt{body.clone()};
+
+        for (const auto p : active_perturbers(pattern))
+        {
+            lyt.assign_sidb_defect(input_sidbs[p], perturber);
+        }
+
+        return lyt;
+    }
+
+  private:
+    /**
+     * The gate layout without the SiDBs of its input BDL pairs.
+     */
+    Lyt body;
+    /**
+     * Physical parameters used for the simulation.
+     */
+    const sidb_simulation_parameters parameters;
+    /**
+     * All SiDB positions of the input BDL pairs.
+     */
+    std::vector<cell<Lyt>> input_sidbs{};
+    /**
+     * SiDBs of the gate body in the order of their indices in a charge distribution surface.
+     */
+    std::vector<cell<Lyt>> body_sidbs{};
+    /**
+     * Local electrostatic potentials at the SiDBs of the gate body if all of them are negatively charged (unit: V).
+     */
+    std::vector<double> body_potentials{};
+    /**
+     * Electrostatic potential of each negatively charged input perturber at each SiDB of the gate body (unit: V).
+     */
+    std::vector<std::vector<double>> perturber_potentials{};
+    /**
+     * Electrostatic potential of the negatively charged gate body at each input perturber (unit: V).
+     */
+    std::vector<double> body_potentials_at_perturbers{};
+    /**
+     * Electrostatic potential of each negatively charged input perturber at each other input perturber (unit: V).
+     */
+    std::vector<std::vector<double>> perturber_interactions{};
+    /**
+     * Determines the indices of the input perturbers that are present in the given input pattern.
+     *
+     * @param pattern Gate layout with the input perturbers of the current input pattern.
+     * @return Indices into `input_sidbs` of all present input perturbers.
+     */
+    [[nodiscard]] std::vector<std::size_t> active_perturbers(const Lyt& pattern) const noexcept
+    {
+        std::vector<std::size_t> active{};
+        active.reserve(input_sidbs.size() / 2);
+
+        for (auto p = 0u; p < input_sidbs.size(); ++p)
+        {
+            if (!pattern.is_empty_cell(input_sidbs[p]))
+            {
+                active.push_back(p);
+            }
+        }
+
+        return active;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace fiction
+
+#endif  // FICTION_INCREMENTAL_INPUT_SIMULATION_HPP
@@ -12,6 +12,7 @@
 #include "fiction/algorithms/simulation/sidb/determine_groundstate_from_simulation_results.hpp"
 #include "fiction/algorithms/simulation/sidb/energy_distribution.hpp"
 #include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/incremental_input_simulation.hpp"
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
@@ -22,6 +23,7 @@
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/instrumentation.hpp"
 
 #include <kitty/bit_operations.hpp>
 #include <kitty/traits.hpp>
@@ -89,6 +91,10 @@ struct is_operational_params
      * Condition which is used to decide if a layout is `operational` or `non-operational`.
      */
     operational_condition op_condition = operational_condition::TOLERATE_KINKS;
+    /**
+     * Mode to simulate the input patterns of the layout.
+     */
+    input_simulation_mode input_sim_mode = input_simulation_mode::FULL_LAYOUT;
 };
 
 namespace detail
@@ -126,7 +132,9 @@ class is_operational_impl
                 detect_bdl_wires(lyt, params.input_bdl_iterator_params.bdl_wire_params, bdl_wire_selection::INPUT)},
             output_bdl_wires{
                 detect_bdl_wires(lyt, params.input_bdl_iterator_params.bdl_wire_params, bdl_wire_selection::OUTPUT)}
-    {}
+    {
+        initialize_incremental_input_simulation();
+    }
     /**
      * Constructor to initialize the algorithm with a layout and parameters.
      *
@@ -147,7 +155,9 @@ class is_operational_impl
             bii{bdl_input_iterator<Lyt>{layout, params.input_bdl_iterator_params, input_wires}},
             input_bdl_wires{input_wires},
             output_bdl_wires{output_wires}
-    {}
+    {
+        initialize_incremental_input_simulation();
+    }
 
     /**
      * Run the `is_operational` algorithm.
@@ -169,63 +179,21 @@ class is_operational_impl
             ++simulator_invocations;
 
             // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
-            if (can_positive_charges_occur(*bii, parameters.simulation_parameters))
+            if (positive_charges_can_occur())
             {
                 return operational_status::NON_OPERATIONAL;
             }
 
             // performs physical simulation of a given SiDB layout at a given input combination
-            const auto simulation_results = physical_simulation_of_layout(bii);
+            const auto status =
+                incremental_sim.has_value() ?
+                    check_input_pattern(physical_simulation_of_layout(incremental_sim->layout_of(*bii)), i) :
+                    check_input_pattern(physical_simulation_of_layout(*bii), i);
 
-            // if no physically valid charge distributions were found, the layout is non-operational
-            if (simulation_results.charge_distributions.empty())
+            if (status == operational_status::NON_OPERATIONAL)
             {
                 return operational_status::NON_OPERATIONAL;
             }
-
-            const auto ground_states = determine_groundstate_from_simulation_results(simulation_results);
-
-            for (const auto& gs : ground_states)
-            {
-                // fetch the charge states of the output BDL pair
-                for (auto output = 0u; output < output_bdl_pairs.size(); output++)
-                {
-                    const auto charge_state_output_upper = gs.get_charge_state(output_bdl_pairs[output].upper);
-                    const auto charge_state_output_lower = gs.get_charge_state(output_bdl_pairs[output].lower);
-
-                    // if the output charge states are equal, the layout is not operational
-                    if (charge_state_output_lower == charge_state_output_upper)
-                    {
-                        return operational_status::NON_OPERATIONAL;
-                    }
-
-                    // if the expected output is 1, the expected charge states are (upper, lower) = (0, -1)
-                    if (kitty::get_bit(truth_table[output], i))
-                    {
-                        if (!encodes_bit_one(gs, output_bdl_pairs[output], output_bdl_wires[output].port))
-                        {
-                            return operational_status::NON_OPERATIONAL;
-                        }
-                    }
-                    // if the expected output is 0, the expected charge states are (upper, lower) = (-1, 0)
-                    else
-                    {
-                        if (!encodes_bit_zero(gs, output_bdl_pairs[output], output_bdl_wires[output].port))
-                        {
-                            return operational_status::NON_OPERATIONAL;
-                        }
-                    }
-                }
-
-                if (parameters.op_condition == operational_condition::REJECT_KINKS)
-                {
-                    if (check_existence_of_kinks_in_input_wires(gs, i) ||
-                        check_existence_of_kinks_in_output_wires(gs, i))
-                    {
-                        return operational_status::NON_OPERATIONAL;
-                    }
-                }
-            }
         }
 
         // if we made it here, the layout is operational
@@ -250,62 +218,16 @@ class is_operational_impl
             ++simulator_invocations;
 
             // if positively charged SiDBs can occur, the SiDB layout is considered as non-operational
-            if (can_positive_charges_occur(*bii, parameters.simulation_parameters))
+            if (positive_charges_can_occur())
             {
                 continue;
             }
 
             // performs physical simulation of a given SiDB layout at a given input combination
-            const auto simulation_results = physical_simulation_of_layout(bii);
-
-            // if no physically valid charge distributions were found, the layout is non-operational
-            if (simulation_results.charge_distributions.empty())
-            {
-                continue;
-            }
-
-            // find the ground state, which is the charge distribution with the lowest energy
-            const auto ground_state = std::min_element(
-                simulation_results.charge_distributions.cbegin(), simulation_results.charge_distributions.cend(),
-                [](const auto& lhs, const auto& rhs) { return lhs.get_system_energy() < rhs.get_system_energy(); });
-
-            // ground state is degenerate
-            if ((energy_distribution(simulation_results.charge_distributions).cbegin()->second) > 1)
-            {
-                continue;
-            }
-
-            bool correct_output = true;
-            // fetch the charge states of the output BDL pair
-            for (auto output = 0u; output < output_bdl_pairs.size(); output++)
-            {
-                const auto charge_state_output_upper = ground_state->get_charge_state(output_bdl_pairs[output].upper);
-                const auto charge_state_output_lower = ground_state->get_charge_state(output_bdl_pairs[output].lower);
-
-                // if the output charge states are equal, the layout is not operational
-                if (charge_state_output_lower == charge_state_output_upper)
-                {
-                    correct_output = false;
-                    break;
-                }
-
-                // if the expected output is 1, the expected charge states are (upper, lower) = (0, -1)
-                if (kitty::get_bit(truth_table[output], i))
-                {
-                    if (!encodes_bit_one(*ground_state, output_bdl_pairs[output], output_bdl_wires[output].port))
-                    {
-                        correct_output = false;
-                    }
-                }
-                // if the expected output is 0, the expected charge states are (upper, lower) = (-1, 0)
-                else
-                {
-                    if (!encodes_bit_zero(*ground_state, output_bdl_pairs[output], output_bdl_wires[output].port))
-                    {
-                        correct_output = false;
-                    }
-                }
-            }
+            const auto correct_output =
+                incremental_sim.has_value() ?
+                    is_ground_state_correct(physical_simulation_of_layout(incremental_sim->layout_of(*bii)), i) :
+                    is_ground_state_correct(physical_simulation_of_layout(*bii), i);
 
             if (correct_output)
             {
@@ -360,57 +282,224 @@ class is_operational_impl
      */
     std::size_t simulator_invocations{0};
     /**
-     * This function conducts physical simulation of the given layout (gate layout with certain input combination). The
-     * simulation results are stored in the `sim_result` variable.
+     * Gate body and precomputed input perturber potentials if input patterns are simulated incrementally.
+     */
+    std::optional<incremental_input_simulation<Lyt>> incremental_sim{};
+    /**
+     * Sets up the incremental simulation of input patterns if it is requested and supported by the simulation engine.
+     */
+    void initialize_incremental_input_simulation()
+    {
+        if constexpr (!is_charge_distribution_surface_v<Lyt>)
+        {
+            if (parameters.input_sim_mode == input_simulation_mode::INCREMENTAL &&
+                parameters.sim_engine != sidb_simulation_engine::QUICKSIM)
+            {
+                const auto input_bdl_pairs =
+                    detect_bdl_pairs(layout, sidb_technology::cell_type::INPUT,
+                                     parameters.input_bdl_iterator_params.bdl_wire_params.bdl_pairs_params);
+
+                incremental_sim.emplace(layout, input_bdl_pairs, parameters.simulation_parameters);
+            }
+        }
+    }
+    /**
+     * Checks whether positively charged SiDBs can occur in the current input pattern.
+     *
+     * @return `true` iff positively charged SiDBs can occur.
+     */
+    [[nodiscard]] bool positive_charges_can_occur() const noexcept
+    {
+        if (incremental_sim.has_value())
+        {
+            return incremental_sim->can_positive_charges_occur(*bii);
+        }
+
+        return can_positive_charges_occur(*bii, parameters.simulation_parameters);
+    }
+    /**
+     * Checks whether all ground states of the given simulation results of an input pattern encode the expected output.
+     *
+     * @tparam SimLyt SiDB cell-level layout type that was simulated.
+     * @param simulation_results Simulation results of the input pattern.
+     * @param i Index of the input pattern.
+     * @return `OPERATIONAL` iff all ground states encode the expected output.
+     */
+    template <typename SimLyt>
+    [[nodiscard]] operational_status check_input_pattern(const sidb_simulation_result<SimLyt>& simulation_results,
+                                                         const uint64_t                        i) const noexcept
+    {
+        // if no physically valid charge distributions were found, the layout is non-operational
+        if (simulation_results.charge_distributions.empty())
+        {
+            return operational_status::NON_OPERATIONAL;
+        }
+
+        const auto ground_states = determine_groundstate_from_simulation_results(simulation_results);
+
+        for (const auto& gs : ground_states)
+        {
+            // fetch the charge states of the output BDL pair
+            for (auto output = 0u; output < output_bdl_pairs.size(); output++)
+            {
+                const auto charge_state_output_upper = gs.get_charge_state(output_bdl_pairs[output].upper);
+                const auto charge_state_output_lower = gs.get_charge_state(output_bdl_pairs[output].lower);
+
+                // if the output charge states are equal, the layout is not operational
+                if (charge_state_output_lower == charge_state_output_upper)
+                {
+                    return operational_status::NON_OPERATIONAL;
+                }
+
+                // if the expected output is 1, the expected charge states are (upper, lower) = (0, -1)
+                if (kitty::get_bit(truth_table[output], i))
+                {
+                    if (!encodes_bit_one(gs, output_bdl_pairs[output], output_bdl_wires[output].port))
+                    {
+                        return operational_status::NON_OPERATIONAL;
+                    }
+                }
+                // if the expected output is 0, the expected charge states are (upper, lower) = (-1, 0)
+                else
+                {
+                    if (!encodes_bit_zero(gs, output_bdl_pairs[output], output_bdl_wires[output].port))
+                    {
+                        return operational_status::NON_OPERATIONAL;
+                    }
+                }
+            }
+
+            if (parameters.op_condition == operational_condition::REJECT_KINKS)
+            {
+                if (check_existence_of_kinks_in_input_wires(gs, i) ||
+                    check_existence_of_kinks_in_output_wires(gs, i))
+                {
+                    return operational_status::NON_OPERATIONAL;
+                }
+            }
+        }
+
+        return operational_status::OPERATIONAL;
+    }
+    /**
+     * Checks whether the given simulation results of an input pattern have a unique ground state that encodes the
+     * expected output.
      *
-     * @param bdl_iterator A reference to a BDL input iterator representing the gate layout at a given input
-     * combination. The simulation is performed based on the configuration represented by the iterator.
+     * @tparam SimLyt SiDB cell-level layout type that was simulated.
+     * @param simulation_results Simulation results of the input pattern.
+     * @param i Index of the input pattern.
+     * @return `true` iff the ground state is unique and encodes the expected output.
+     */
+    template <typename SimLyt>
+    [[nodiscard]] bool is_ground_state_correct(const sidb_simulation_result<SimLyt>& simulation_results,
+                                               const uint64_t                        i) const noexcept
+    {
+        // if no physically valid charge distributions were found, the layout is non-operational
+        if (simulation_results.charge_distributions.empty())
+        {
+            return false;
+        }
+
+        // find the ground state, which is the charge distribution with the lowest energy
+        const auto ground_state = std::min_element(
+            simulation_results.charge_distributions.cbegin(), simulation_results.charge_distributions.cend(),
+            [](const auto& lhs, const auto& rhs) { return lhs.get_system_energy() < rhs.get_system_energy(); });
+
+        // ground state is degenerate
+        if ((energy_distribution(simulation_results.charge_distributions).cbegin()->second) > 1)
+        {
+            return false;
+        }
+
+        bool correct_output = true;
+        // fetch the charge states of the output BDL pair
+        for (auto output = 0u; output < output_bdl_pairs.size(); output++)
+        {
+            const auto charge_state_output_upper = ground_state->get_charge_state(output_bdl_pairs[output].upper);
+            const auto charge_state_output_lower = ground_state->get_charge_state(output_bdl_pairs[output].lower);
+
+            // if the output charge states are equal, the layout is not operational
+            if (charge_state_output_lower == charge_state_output_upper)
+            {
+                correct_output = false;
+                break;
+            }
+
+            // if the expected output is 1, the expected charge states are (upper, lower) = (0, -1)
+            if (kitty::get_bit(truth_table[output], i))
+            {
+                if (!encodes_bit_one(*ground_state, output_bdl_pairs[output], output_bdl_wires[output].port))
+                {
+                    correct_output = false;
+                }
+            }
+            // if the expected output is 0, the expected charge states are (upper, lower) = (-1, 0)
+            else
+            {
+                if (!encodes_bit_zero(*ground_state, output_bdl_pairs[output], output_bdl_wires[output].port))
+                {
+                    correct_output = false;
+                }
+            }
+        }
+
+        return correct_output;
+    }
+    /**
+     * This function conducts physical simulation of the given layout (gate layout with certain input combination).
+     *
+     * @tparam SimLyt SiDB cell-level layout type to simulate.
+     * @param lyt The gate layout at a given input combination, either including the input perturbers or as the gate
+     * body with the input perturbers as fixed charges.
      * @return Simulation results.
      */
-    [[nodiscard]] sidb_simulation_result<Lyt>
-    physical_simulation_of_layout(const bdl_input_iterator<Lyt>& bdl_iterator) noexcept
+    template <typename SimLyt>
+    [[nodiscard]] sidb_simulation_result<SimLyt> physical_simulation_of_layout(const SimLyt& lyt) noexcept
     {
         assert(parameters.simulation_parameters.base == 2 && "base number is set to 3");
 
+        FICTION_PROFILE_SCOPE("is_operational: simulator invocation");
+
         if (parameters.sim_engine == sidb_simulation_engine::EXGS)
         {
             // perform an exhaustive ground state simulation
-            return exhaustive_ground_state_simulation(*bdl_iterator, parameters.simulation_parameters);
+            return exhaustive_ground_state_simulation(lyt, parameters.simulation_parameters);
         }
-        if constexpr (!is_sidb_defect_surface_v<Lyt>)
+        if constexpr (!is_sidb_defect_surface_v<SimLyt>)
         {
             if (parameters.sim_engine == sidb_simulation_engine::QUICKSIM)
             {
                 // perform a heuristic simulation
                 const quicksim_params qs_params{parameters.simulation_parameters, 500, 0.6};
-                return quicksim(*bdl_iterator, qs_params);
+                return quicksim(lyt, qs_params);
             }
         }
         if (parameters.sim_engine == sidb_simulation_engine::QUICKEXACT)
         {
             // perform exact simulation
-            const quickexact_params<cell<Lyt>> quickexact_params{
+            const quickexact_params<cell<SimLyt>> quickexact_params{
                 parameters.simulation_parameters,
-                fiction::quickexact_params<cell<Lyt>>::automatic_base_number_detection::OFF};
-            return quickexact(*bdl_iterator, quickexact_params);
+                fiction::quickexact_params<cell<SimLyt>>::automatic_base_number_detection::OFF};
+            return quickexact(lyt, quickexact_params);
         }
 
         assert(false && "unsupported simulation engine");
 
-        return sidb_simulation_result<Lyt>{};
+        return sidb_simulation_result<SimLyt>{};
     }
     /**
      * This function iterates through the input wires and evaluates their charge states against the expected
      * states derived from the input pattern. A kink is considered to exist if an input wire's charge state does not
      * match the expected value (i.e., bit one or bit zero) for the given input index.
      *
-     * @tparam Lyt SiDB cell-level layout type
+     * @tparam ChargeLyt Charge distribution surface type.
      * @param ground_state The ground state charge distribution surface.
      * @param current_input_index The current input index used to retrieve the expected output from the truth table.
      * @return `true` if any input wire contains a kink (i.e., an unexpected charge state), `false` otherwise.
      */
-    [[nodiscard]] bool check_existence_of_kinks_in_input_wires(const charge_distribution_surface<Lyt>& ground_state,
-                                                               const uint64_t current_input_index) const noexcept
+    template <typename ChargeLyt>
+    [[nodiscard]] bool check_existence_of_kinks_in_input_wires(const ChargeLyt& ground_state,
+                                                               const uint64_t   current_input_index) const noexcept
     {
         for (auto i = 0u; i < input_bdl_wires.size(); i++)
         {
@@ -486,13 +575,14 @@ class is_operational_impl
      * states derived from the truth table. A kink is considered to exist if an output wire's charge state does not
      * match the expected value (i.e., bit one or bit zero) for the given input index.
      *
-     * @tparam Lyt SiDB cell-level layout type
+     * @tparam ChargeLyt Charge distribution surface type.
      * @param ground_state The ground state charge distribution surface.
      * @param current_input_index The current input index used to retrieve the expected output from the truth table.
      * @return `true` if any output wire contains a kink (i.e., an unexpected charge state), `false` otherwise.
      */
-    [[nodiscard]] bool check_existence_of_kinks_in_output_wires(const charge_distribution_surface<Lyt>& ground_state,
-                                                                const uint64_t current_input_index) const noexcept
+    template <typename ChargeLyt>
+    [[nodiscard]] bool check_existence_of_kinks_in_output_wires(const ChargeLyt& ground_state,
+                                                                const uint64_t   current_input_index) const noexcept
     {
         for (auto i = 0u; i < output_bdl_wires.size(); i++)
         {
@@ -520,13 +610,14 @@ class is_operational_impl
     /**
      * This function returns `true` if `0` is encoded in the charge state of the given BDL pair. `false` otherwise.
      *
-     * @tparam Lyt SiDB cell-level layout type.
+     * @tparam ChargeLyt Charge distribution surface type.
      * @param ground_state The ground state charge distribution surface.
      * @param bdl BDL pair to be evaluated.
      * @return `true` if `0` is encoded, `false` otherwise.
      */
-    [[nodiscard]] bool encodes_bit_zero(const charge_distribution_surface<Lyt>& ground_state,
-                                        const bdl_pair<cell<Lyt>>& bdl, const port_direction port) const noexcept
+    template <typename ChargeLyt>
+    [[nodiscard]] bool encodes_bit_zero(const ChargeLyt& ground_state, const bdl_pair<cell<Lyt>>& bdl,
+                                        const port_direction port) const noexcept
     {
         if (port.dir == port_direction::SOUTH || port.dir == port_direction::EAST || port.dir == port_direction::NONE)
         {
@@ -540,13 +631,14 @@ class is_operational_impl
     /**
      * This function returns `true` if `1` is encoded in the charge state of the given BDL pair. `false` otherwise.
      *
-     * @tparam Lyt SiDB cell-level layout type.
+     * @tparam ChargeLyt Charge distribution surface type.
      * @param ground_state The ground state charge distribution surface.
      * @param bdl BDL pair to be evaluated.
      * @return `true` if `1` is encoded, `false` otherwise.
      */
-    [[nodiscard]] bool encodes_bit_one(const charge_distribution_surface<Lyt>& ground_state,
-                                       const bdl_pair<cell<Lyt>>& bdl, const port_direction port) const noexcept
+    template <typename ChargeLyt>
+    [[nodiscard]] bool encodes_bit_one(const ChargeLyt& ground_state, const bdl_pair<cell<Lyt>>& bdl,
+                                       const port_direction port) const noexcept
     {
         if (port.dir == port_direction::SOUTH || port.dir == port_direction::EAST || port.dir == port_direction::NONE)
         {
@@ -597,6 +689,8 @@ is_operational(const Lyt& lyt, const std::vector<TT>& spec, const is_operational
     assert(std::adjacent_find(spec.cbegin(), spec.cend(), [](const auto& a, const auto& b)
                               { return a.num_vars() != b.num_vars(); }) == spec.cend());
 
+    FICTION_PROFILE_SCOPE("is_operational");
+
     if (input_bdl_wire.has_value() && output_bdl_wire.has_value())
     {
         detail::is_operational_impl<Lyt, TT> p{lyt, spec, params, input_bdl_wire.value(), output_bdl_wire.value()};
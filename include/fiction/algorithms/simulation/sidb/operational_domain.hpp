@@ -15,6 +15,7 @@
 #include "fiction/technology/physical_constants.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/hash.hpp"
+#include "fiction/utils/instrumentation.hpp"
 #include "fiction/utils/math_utils.hpp"
 #include "fiction/utils/phmap_utils.hpp"
 
@@ -1088,6 +1089,7 @@ class operational_domain_impl
         const auto& [status, sim_calls] = is_operational(layout, truth_table, op_params_set_dimension_values);
 
         num_simulator_invocations += sim_calls;
+        FICTION_PROFILE_HISTOGRAM("operational_domain: simulator invocations per parameter point", sim_calls);
 
         if (status == operational_status::NON_OPERATIONAL)
         {
@@ -10,12 +10,15 @@
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/instrumentation.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
 #include <cstdint>
 #include <mutex>
+#include <optional>
+#include <random>
 #include <thread>
 #include <vector>
 
@@ -43,6 +46,19 @@ struct quicksim_params
      * Number of threads to spawn. By default the number of threads is set to the number of available hardware threads.
      */
     uint64_t number_threads{std::thread::hardware_concurrency()};
+    /**
+     * Seed for the random number generators of all threads. If no seed is given, the generators are seeded
+     * non-deterministically. With a seed, the set of found charge distributions is reproducible for a fixed number of
+     * threads.
+     */
+    std::optional<uint64_t> seed{};
+    /**
+     * If set, SiDBs only interact within this radius, which reduces the memory and runtime of the simulation of large
+     * layouts from quadratic to linear in the number of SiDBs. Since the screened Coulomb interaction decays
+     * exponentially, a radius of a few screening lengths `lambda_tf` suffices. The resulting bound on the system energy
+     * error is reported in the simulation result (unit: nm).
+     */
+    std::optional<double> interaction_cutoff{};
 };
 
 /**
@@ -68,6 +84,8 @@ sidb_simulation_result<Lyt> quicksim(const Lyt& lyt, const quicksim_params& ps =
     static_assert(!is_sidb_defect_surface_v<Lyt>,
                   "Lyt cannot be an SiDB defect surface, defects are not supported by the QuickSim algorithm");
 
+    FICTION_PROFILE_SCOPE("quicksim");
+
     if (ps.iteration_steps == 0)
     {
         return sidb_simulation_result<Lyt>{};
@@ -86,7 +104,20 @@ sidb_simulation_result<Lyt> quicksim(const Lyt& lyt, const quicksim_params& ps =
     {
         const mockturtle::stopwatch stop{time_counter};
 
-        charge_distribution_surface<Lyt> charge_lyt{lyt};
+        // with an interaction cutoff, the dense potential matrix is never constructed
+        charge_distribution_surface<Lyt> charge_lyt{lyt, ps.simulation_parameters, sidb_charge_state::NEGATIVE,
+                                                    ps.interaction_cutoff.has_value() ?
+                                                        cds_configuration::CHARGE_LOCATION_ONLY :
+                                                        cds_configuration::CHARGE_LOCATION_AND_ELECTROSTATIC};
+
+        if (ps.interaction_cutoff.has_value())
+        {
+            charge_lyt.assign_interaction_cutoff(ps.interaction_cutoff);
+
+            st.additional_simulation_parameters.emplace("interaction_cutoff", *ps.interaction_cutoff);
+            st.additional_simulation_parameters.emplace("energy_error_bound",
+                                                        charge_lyt.get_system_energy_error_bound());
+        }
 
         // set the given physical parameters
         charge_lyt.assign_physical_parameters(ps.simulation_parameters);
@@ -144,10 +175,21 @@ sidb_simulation_result<Lyt> quicksim(const Lyt& lyt, const quicksim_params& ps =
         for (uint64_t z = 0ul; z < num_threads; z++)
         {
             threads.emplace_back(
-                [&]
+                [&, z]
                 {
                     charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
 
+                    std::mt19937_64 generator{};
+                    if (ps.seed.has_value())
+                    {
+                        std::seed_seq seq{*ps.seed & 0xffffffffu, *ps.seed >> 32u, z};
+                        generator.seed(seq);
+                    }
+                    else
+                    {
+                        generator.seed(std::random_device{}());
+                    }
+
                     for (uint64_t l = 0ul; l < iter_per_thread; ++l)
                     {
                         for (uint64_t i = 0ul; i < charge_lyt.num_cells(); ++i)
@@ -187,7 +229,7 @@ sidb_simulation_result<Lyt> quicksim(const Lyt& lyt, const quicksim_params& ps =
 
                             for (uint64_t num = 0ul; num < upper_limit; num++)
                             {
-                                charge_lyt_copy.adjacent_search(ps.alpha, index_start);
+                                charge_lyt_copy.adjacent_search(ps.alpha, index_start, generator);
                                 charge_lyt_copy.validity_check();
 
                                 if (charge_lyt_copy.is_physically_valid())
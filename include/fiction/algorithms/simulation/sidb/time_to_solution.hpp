@@ -15,12 +15,16 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -44,6 +48,11 @@ struct time_to_solution_params
      * value.
      */
     double confidence_level = 0.997;
+    /**
+     * Number of threads that run the *QuickSim* repetitions in parallel. Each repetition is still timed individually.
+     * To avoid oversubscription, the number of threads used by each *QuickSim* run should be reduced accordingly.
+     */
+    uint64_t num_threads = 1;
 };
 
 /**
@@ -73,6 +82,10 @@ struct time_to_solution_stats
      * Exact simulation algorithm used to simulate the ground state as reference.
      */
     std::string algorithm;
+    /**
+     * Runtimes of all single *QuickSim* runs in seconds in the order of their repetitions.
+     */
+    std::vector<double> single_runtimes{};
     /**
      * Print the results to the given output stream.
      *
@@ -85,45 +98,80 @@ struct time_to_solution_stats
     }
 };
 /**
- * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm.
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm with respect
+ * to a given exact simulation result. This allows to reuse the exact reference simulation of a layout for multiple
+ * *QuickSim* parameter variants.
+ *
+ * The repetitions are distributed among `tts_params.num_threads` threads. If `quicksim_params.seed` is set, the seed
+ * of each repetition is derived from it and the repetition's index, which makes the results reproducible
+ * independently of the number of threads.
  *
  * @tparam Lyt SiDB cell-level layout type.
  * @param lyt Layout that is used for the simulation.
+ * @param results_exact Simulation results of an exact algorithm for `lyt`.
  * @param quicksim_params Parameters required for the *QuickSim* algorithm.
- * @param tts_params Parameters used for the time-to-solution calculation.
+ * @param tts_params Parameters used for the time-to-solution calculation. `engine` is ignored.
  * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
  */
 template <typename Lyt>
-void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
-                      const time_to_solution_params& tts_params = {}, time_to_solution_stats* ps = nullptr) noexcept
+void time_to_solution(const Lyt& lyt, const sidb_simulation_result<Lyt>& results_exact,
+                      const quicksim_params& quicksim_params, const time_to_solution_params& tts_params = {},
+                      time_to_solution_stats* ps = nullptr) noexcept
 {
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
 
     time_to_solution_stats st{};
+    st.algorithm = results_exact.algorithm_name;
 
-    sidb_simulation_result<Lyt> simulation_result{};
-    if (tts_params.engine == exact_sidb_simulation_engine::QUICKEXACT)
+    std::vector<fiction::quicksim_params> repetition_params(tts_params.repetitions, quicksim_params);
+
+    if (quicksim_params.seed.has_value())
     {
-        const quickexact_params<cell<Lyt>> params{quicksim_params.simulation_parameters};
-        st.algorithm      = "QuickExact";
-        simulation_result = quickexact(lyt, params);
+        std::mt19937_64 generator{*quicksim_params.seed};
+
+        for (auto& p : repetition_params)
+        {
+            p.seed = generator();
+        }
     }
-    else
+
+    std::vector<sidb_simulation_result<Lyt>> simulation_results_quicksim(tts_params.repetitions);
+
+    std::atomic<uint64_t> next_repetition{0};
+
+    const auto worker = [&]
     {
-        st.algorithm      = "ExGS";
-        simulation_result = exhaustive_ground_state_simulation(lyt, quicksim_params.simulation_parameters);
-    }
+        for (auto i = next_repetition++; i < tts_params.repetitions; i = next_repetition++)
+        {
+            simulation_results_quicksim[i] = quicksim<Lyt>(lyt, repetition_params[i]);
+        }
+    };
 
-    std::vector<sidb_simulation_result<Lyt>> simulation_results_quicksim{};
-    simulation_results_quicksim.reserve(tts_params.repetitions);
+    const auto num_threads =
+        std::clamp(tts_params.num_threads, uint64_t{1}, std::max(tts_params.repetitions, uint64_t{1}));
 
-    for (auto i = 0u; i < tts_params.repetitions; ++i)
+    if (num_threads == 1)
+    {
+        worker();
+    }
+    else
     {
-        simulation_results_quicksim.push_back(quicksim<Lyt>(lyt, quicksim_params));
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (auto i = 0u; i < num_threads; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
     }
 
-    time_to_solution_for_given_simulation_results(simulation_result, simulation_results_quicksim,
+    time_to_solution_for_given_simulation_results(results_exact, simulation_results_quicksim,
                                                   tts_params.confidence_level, &st);
 
     if (ps)
@@ -131,6 +179,35 @@ void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
         *ps = st;
     }
 }
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm.
+ *
+ * @tparam Lyt SiDB cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param quicksim_params Parameters required for the *QuickSim* algorithm.
+ * @param tts_params Parameters used for the time-to-solution calculation.
+ * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
+ */
+template <typename Lyt>
+void time_to_solution(const Lyt& lyt, const quicksim_params& quicksim_params,
+                      const time_to_solution_params& tts_params = {}, time_to_solution_stats* ps = nullptr) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    sidb_simulation_result<Lyt> simulation_result{};
+    if (tts_params.engine == exact_sidb_simulation_engine::QUICKEXACT)
+    {
+        const quickexact_params<cell<Lyt>> params{quicksim_params.simulation_parameters};
+        simulation_result = quickexact(lyt, params);
+    }
+    else
+    {
+        simulation_result = exhaustive_ground_state_simulation(lyt, quicksim_params.simulation_parameters);
+    }
+
+    time_to_solution(lyt, simulation_result, quicksim_params, tts_params, ps);
+}
 
 /**
  * This function calculates the Time-to-Solution (TTS) by analyzing the simulation results of a heuristic algorithm
@@ -161,13 +238,17 @@ void time_to_solution_for_given_simulation_results(const sidb_simulation_result<
     auto        total_runtime_heuristic = 0.0;
     std::size_t gs_count                = 0;
 
+    st.single_runtimes.reserve(results_heuristic.size());
+
     for (const auto& heuristic : results_heuristic)
     {
         if (is_ground_state(heuristic, results_exact))
         {
             ++gs_count;
         }
-        total_runtime_heuristic += mockturtle::to_seconds(heuristic.simulation_runtime);
+
+        st.single_runtimes.push_back(mockturtle::to_seconds(heuristic.simulation_runtime));
+        total_runtime_heuristic += st.single_runtimes.back();
     }
 
     const auto single_runtime_heuristic_average =
@@ -11,15 +11,26 @@
 #include "fiction/utils/name_utils.hpp"
 
 #include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
 #include <mockturtle/algorithms/equivalence_checking.hpp>
 #include <mockturtle/algorithms/miter.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <optional>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -43,6 +54,66 @@ enum class eq_type
     STRONG
 };
 
+/**
+ * Parameters for equivalence checking.
+ */
+struct equivalence_checking_params
+{
+    /**
+     * Strategies to prove logical equivalence.
+     */
+    enum class checking_mode : uint8_t
+    {
+        /**
+         * A single miter over all outputs of `Spec` and `Impl` is handed to one SAT call.
+         */
+        MONOLITHIC,
+        /**
+         * Bit-parallel random simulation is applied first to cheaply find counter examples. Afterward, the miter is
+         * split into one miter per pair of primary outputs, each restricted to the transitive fan-in cones of both
+         * outputs. The remaining output miters are solved by independent SAT calls in parallel.
+         */
+        OUTPUT_PARTITIONED
+    };
+    /**
+     * Strategy to prove logical equivalence.
+     */
+    checking_mode mode{checking_mode::MONOLITHIC};
+    /**
+     * Number of rounds of random simulation in `OUTPUT_PARTITIONED` mode. Each round simulates 64 random input
+     * patterns at once.
+     */
+    uint64_t num_simulation_rounds{16ull};
+    /**
+     * Seed of the random input patterns. If none is given, a random seed is used.
+     */
+    std::optional<uint64_t> seed{};
+    /**
+     * Maximum number of threads to solve output miters in `OUTPUT_PARTITIONED` mode. Gate-level design rule checks of
+     * `Spec` and `Impl` are run concurrently in this mode as well.
+     */
+    uint64_t num_threads{std::thread::hardware_concurrency()};
+};
+/**
+ * Per-output results of equivalence checking in `OUTPUT_PARTITIONED` mode.
+ */
+struct equivalence_checking_output_stats
+{
+    /**
+     * Whether the output pair is equivalent. `std::nullopt` if it could not be decided, e.g., because the resource
+     * limit was exceeded or because a counter example for another output was found first.
+     */
+    std::optional<bool> equivalent{};
+    /**
+     * `true` iff the output pair was shown to be non-equivalent by random simulation.
+     */
+    bool decided_by_simulation{false};
+    /**
+     * Runtime of the SAT call for the output pair.
+     */
+    mockturtle::stopwatch<>::duration runtime{0};
+};
+
 struct equivalence_checking_stats
 {
     /**
@@ -65,6 +136,14 @@ struct equivalence_checking_stats
      * Stores DRVs.
      */
     fiction::gate_level_drv_stats spec_drv_stats{}, impl_drv_stats{};
+    /**
+     * Per-output results in `OUTPUT_PARTITIONED` mode.
+     */
+    std::vector<equivalence_checking_output_stats> output_stats{};
+    /**
+     * Runtime of the random simulation in `OUTPUT_PARTITIONED` mode.
+     */
+    mockturtle::stopwatch<>::duration simulation_runtime{0};
 };
 
 namespace detail
@@ -79,13 +158,14 @@ class equivalence_checking_impl
      *
      * @param specification Logical specification of intended functionality.
      * @param implementation Implementation of specified functionality.
-     * @param p Parameters.
+     * @param ps Parameters.
      * @param st Statistics.
      */
     explicit equivalence_checking_impl(const Spec& specification, const Impl& implementation,
-                                       equivalence_checking_stats& st) :
+                                       const equivalence_checking_params& ps, equivalence_checking_stats& st) :
             spec{specification},
             impl{implementation},
+            params{ps},
             pst{st}
     {}
 
@@ -93,82 +173,62 @@ class equivalence_checking_impl
     {
         mockturtle::stopwatch stop{pst.runtime};
 
-        if constexpr (is_gate_level_layout_v<Spec>)
-        {
-            if (has_drvs(spec, &pst.spec_drv_stats))
-            {
-                return eq_type::NO;
-            }
-        }
-        if constexpr (is_gate_level_layout_v<Impl>)
+        if (has_any_drvs())
         {
-            if (has_drvs(impl, &pst.impl_drv_stats))
-            {
-                return eq_type::NO;
-            }
+            return eq_type::NO;
         }
 
-        const auto miter = mockturtle::miter<mockturtle::klut_network>(spec, impl);
-
-        if (miter)
+        if (spec.num_pis() != impl.num_pis() || spec.num_pos() != impl.num_pos())
         {
-            mockturtle::equivalence_checking_stats st;
-
-            const auto eq = mockturtle::equivalence_checking(*miter, {}, &st);
+            std::cout << "[w] both networks/layouts must have the same number of primary inputs and outputs"
+                      << std::endl;
 
-            if (eq.has_value())
-            {
-                pst.eq = *eq ? eq_type::STRONG : eq_type::NO;
+            return eq_type::NO;
+        }
 
-                if (pst.eq == eq_type::STRONG)
-                {
-                    // compute TP of specification
-                    if constexpr (fiction::is_gate_level_layout_v<Spec>)
-                    {
-                        const auto cp_tp = fiction::critical_path_length_and_throughput(spec);
+        const auto eq = params.mode == equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED ?
+                            check_output_partitioned() :
+                            check_monolithic();
 
-                        pst.tp_spec = static_cast<int64_t>(cp_tp.throughput);
-                    }
-                    // compute TP of implementation
-                    if constexpr (fiction::is_gate_level_layout_v<Impl>)
-                    {
-                        const auto cp_tp = fiction::critical_path_length_and_throughput(impl);
+        if (!eq.has_value())
+        {
+            std::cout << "[e] resource limit exceeded" << std::endl;
 
-                        pst.tp_impl = static_cast<int64_t>(cp_tp.throughput);
-                    }
+            return eq_type::NO;
+        }
 
-                    pst.tp_diff = std::abs(pst.tp_spec - pst.tp_impl);
+        pst.eq = *eq ? eq_type::STRONG : eq_type::NO;
 
-                    if (pst.tp_diff != 0)
-                    {
-                        pst.eq = eq_type::WEAK;
-                    }
-                }
+        if (pst.eq == eq_type::STRONG)
+        {
+            // compute TP of specification
+            if constexpr (fiction::is_gate_level_layout_v<Spec>)
+            {
+                const auto cp_tp = fiction::critical_path_length_and_throughput(spec);
 
-                if (!(*eq))
-                {
-                    pst.counter_example = st.counter_example;
-                }
+                pst.tp_spec = static_cast<int64_t>(cp_tp.throughput);
             }
-            else
+            // compute TP of implementation
+            if constexpr (fiction::is_gate_level_layout_v<Impl>)
             {
-                std::cout << "[e] resource limit exceeded" << std::endl;
+                const auto cp_tp = fiction::critical_path_length_and_throughput(impl);
 
-                return eq_type::NO;
+                pst.tp_impl = static_cast<int64_t>(cp_tp.throughput);
             }
-        }
-        else
-        {
-            std::cout << "[w] both networks/layouts must have the same number of primary inputs and outputs"
-                      << std::endl;
 
-            return eq_type::NO;
+            pst.tp_diff = std::abs(pst.tp_spec - pst.tp_impl);
+
+            if (pst.tp_diff != 0)
+            {
+                pst.eq = eq_type::WEAK;
+            }
         }
 
         return pst.eq;
     }
 
   private:
+    using klut_signal = mockturtle::klut_network::signal;
     /**
      * Specification.
      */
@@ -177,6 +237,10 @@ class equivalence_checking_impl
      * Implementation.
      */
     const Impl impl;
+    /**
+     * Parameters.
+     */
+    const equivalence_checking_params params;
 
     equivalence_checking_stats& pst;
 
@@ -193,6 +257,378 @@ class equivalence_checking_impl
 
         return stats->drvs != 0;
     }
+    /**
+     * Checks specification and implementation for DRVs if they are gate-level layouts. In `OUTPUT_PARTITIONED` mode,
+     * both checks are run concurrently.
+     *
+     * @return `true` iff any of the two has DRVs.
+     */
+    [[nodiscard]] bool has_any_drvs() noexcept
+    {
+        bool spec_has_drvs = false;
+        bool impl_has_drvs = false;
+
+        const auto check_spec = [this, &spec_has_drvs]
+        {
+            if constexpr (is_gate_level_layout_v<Spec>)
+            {
+                spec_has_drvs = has_drvs(spec, &pst.spec_drv_stats);
+            }
+        };
+        const auto check_impl = [this, &impl_has_drvs]
+        {
+            if constexpr (is_gate_level_layout_v<Impl>)
+            {
+                impl_has_drvs = has_drvs(impl, &pst.impl_drv_stats);
+            }
+        };
+
+        if (params.mode == equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED &&
+            is_gate_level_layout_v<Spec> && is_gate_level_layout_v<Impl>)
+        {
+            std::thread impl_thread{check_impl};
+            check_spec();
+            impl_thread.join();
+        }
+        else
+        {
+            check_spec();
+
+            if (!spec_has_drvs)
+            {
+                check_impl();
+            }
+        }
+
+        return spec_has_drvs || impl_has_drvs;
+    }
+    /**
+     * Proves equivalence with a single miter over all outputs.
+     *
+     * @return `true` iff `spec` and `impl` are logically equivalent or `std::nullopt` if the SAT call exceeded its
+     * resource limit.
+     */
+    [[nodiscard]] std::optional<bool> check_monolithic() noexcept
+    {
+        const auto miter = mockturtle::miter<mockturtle::klut_network>(spec, impl);
+
+        assert(miter.has_value() && "The number of primary inputs and outputs has been checked before");
+
+        mockturtle::equivalence_checking_stats st;
+
+        const auto eq = mockturtle::equivalence_checking(*miter, {}, &st);
+
+        if (eq.has_value() && !(*eq))
+        {
+            pst.counter_example = st.counter_example;
+        }
+
+        return eq;
+    }
+    /**
+     * Proves equivalence by random simulation followed by one SAT call per output pair.
+     *
+     * @return `true` iff `spec` and `impl` are logically equivalent or `std::nullopt` if any of the SAT calls exceeded
+     * its resource limit.
+     */
+    [[nodiscard]] std::optional<bool> check_output_partitioned() noexcept
+    {
+        // build spec and impl on shared primary inputs but keep their outputs separate
+        mockturtle::klut_network ntk{};
+
+        std::vector<klut_signal> pis{};
+        pis.reserve(spec.num_pis());
+
+        for (auto i = 0u; i < spec.num_pis(); ++i)
+        {
+            pis.push_back(ntk.create_pi());
+        }
+
+        const auto spec_pos = mockturtle::cleanup_dangling(spec, ntk, pis.cbegin(), pis.cend());
+        const auto impl_pos = mockturtle::cleanup_dangling(impl, ntk, pis.cbegin(), pis.cend());
+
+        pst.output_stats.assign(spec_pos.size(), equivalence_checking_output_stats{});
+
+        if (refute_by_simulation(ntk, spec_pos, impl_pos))
+        {
+            return false;
+        }
+
+        std::vector<std::size_t> open_outputs{};
+
+        for (auto o = 0u; o < spec_pos.size(); ++o)
+        {
+            // structurally hashed to the same node
+            if (spec_pos[o] == impl_pos[o])
+            {
+                pst.output_stats[o].equivalent = true;
+            }
+            else
+            {
+                open_outputs.push_back(o);
+            }
+        }
+
+        prove_outputs(ntk, spec_pos, impl_pos, open_outputs);
+
+        if (std::any_of(pst.output_stats.cbegin(), pst.output_stats.cend(),
+                        [](const auto& os) { return os.equivalent.has_value() && !(*os.equivalent); }))
+        {
+            return false;
+        }
+        if (std::any_of(pst.output_stats.cbegin(), pst.output_stats.cend(),
+                        [](const auto& os) { return !os.equivalent.has_value(); }))
+        {
+            return std::nullopt;
+        }
+
+        return true;
+    }
+    /**
+     * Simulates random input patterns 64 at a time and marks all output pairs that differ for any pattern as
+     * non-equivalent. The first differing pattern is stored as counter example.
+     *
+     * @param ntk Network that contains both specification and implementation.
+     * @param spec_pos Outputs of the specification in `ntk`.
+     * @param impl_pos Outputs of the implementation in `ntk`.
+     * @return `true` iff a counter example was found.
+     */
+    [[nodiscard]] bool refute_by_simulation(const mockturtle::klut_network& ntk,
+                                            const std::vector<klut_signal>& spec_pos,
+                                            const std::vector<klut_signal>& impl_pos) noexcept
+    {
+        mockturtle::stopwatch stop{pst.simulation_runtime};
+
+        std::mt19937_64 generator{params.seed.value_or(std::random_device{}())};
+
+        std::vector<uint64_t> pi_words(ntk.num_pis(), 0);
+        std::vector<uint64_t> node_words(ntk.size(), 0);
+
+        bool refuted = false;
+
+        for (auto r = 0ull; r < params.num_simulation_rounds && !refuted; ++r)
+        {
+            std::generate(pi_words.begin(), pi_words.end(), generator);
+
+            simulate(ntk, pi_words, node_words);
+
+            for (auto o = 0u; o < spec_pos.size(); ++o)
+            {
+                const auto diff = node_words[ntk.node_to_index(ntk.get_node(spec_pos[o]))] ^
+                                  node_words[ntk.node_to_index(ntk.get_node(impl_pos[o]))];
+
+                if (diff == 0)
+                {
+                    continue;
+                }
+
+                pst.output_stats[o].equivalent            = false;
+                pst.output_stats[o].decided_by_simulation = true;
+
+                if (!refuted)
+                {
+                    // extract the first differing input pattern
+                    auto bit = 0ull;
+                    while (((diff >> bit) & 1ull) == 0)
+                    {
+                        ++bit;
+                    }
+
+                    pst.counter_example.clear();
+                    for (const auto w : pi_words)
+                    {
+                        pst.counter_example.push_back(((w >> bit) & 1ull) != 0);
+                    }
+
+                    refuted = true;
+                }
+            }
+        }
+
+        return refuted;
+    }
+    /**
+     * Bit-parallel simulation of 64 input patterns.
+     *
+     * @param ntk Network to simulate.
+     * @param pi_words One 64-bit word of input values per primary input.
+     * @param node_words Output values of all nodes of `ntk`, indexed by node index.
+     */
+    static void simulate(const mockturtle::klut_network& ntk, const std::vector<uint64_t>& pi_words,
+                         std::vector<uint64_t>& node_words) noexcept
+    {
+        node_words[ntk.node_to_index(ntk.get_node(ntk.get_constant(false)))] = 0ull;
+        node_words[ntk.node_to_index(ntk.get_node(ntk.get_constant(true)))]  = ~0ull;
+
+        ntk.foreach_pi([&ntk, &pi_words, &node_words](const auto& pi, const auto i)
+                       { node_words[ntk.node_to_index(pi)] = pi_words[i]; });
+
+        std::vector<uint64_t> fanin_words{};
+
+        // node indices in a k-LUT network are in topological order
+        ntk.foreach_gate(
+            [&ntk, &node_words, &fanin_words](const auto& n)
+            {
+                fanin_words.clear();
+                ntk.foreach_fanin(n, [&ntk, &node_words, &fanin_words](const auto& f)
+                                  { fanin_words.push_back(node_words[ntk.node_to_index(ntk.get_node(f))]); });
+
+                const auto func = ntk.node_function(n);
+
+                // sum of the minterms of the node function
+                uint64_t word = 0ull;
+
+                for (uint64_t m = 0ull; m < func.num_bits(); ++m)
+                {
+                    if (!kitty::get_bit(func, m))
+                    {
+                        continue;
+                    }
+
+                    uint64_t minterm = ~0ull;
+
+                    for (auto j = 0u; j < fanin_words.size(); ++j)
+                    {
+                        minterm &= ((m >> j) & 1ull) != 0 ? fanin_words[j] : ~fanin_words[j];
+                    }
+
+                    word |= minterm;
+                }
+
+                node_words[ntk.node_to_index(n)] = word;
+            });
+    }
+    /**
+     * Solves the miters of the given output pairs in parallel. A counter example stops all remaining SAT calls.
+     *
+     * @param ntk Network that contains both specification and implementation.
+     * @param spec_pos Outputs of the specification in `ntk`.
+     * @param impl_pos Outputs of the implementation in `ntk`.
+     * @param outputs Indices of the output pairs to prove.
+     */
+    void prove_outputs(const mockturtle::klut_network& ntk, const std::vector<klut_signal>& spec_pos,
+                       const std::vector<klut_signal>& impl_pos, const std::vector<std::size_t>& outputs) noexcept
+    {
+        if (outputs.empty())
+        {
+            return;
+        }
+
+        std::atomic<std::size_t> next_output{0};
+        std::atomic<bool>        counter_example_found{false};
+        std::mutex               counter_example_mutex{};
+
+        const auto worker = [&]
+        {
+            for (auto i = next_output++; i < outputs.size() && !counter_example_found; i = next_output++)
+            {
+                const auto o = outputs[i];
+
+                auto& os = pst.output_stats[o];
+
+                mockturtle::stopwatch stop{os.runtime};
+
+                const auto miter = output_miter(ntk, spec_pos[o], impl_pos[o]);
+
+                mockturtle::equivalence_checking_stats st{};
+
+                os.equivalent = mockturtle::equivalence_checking(miter, {}, &st);
+
+                if (os.equivalent.has_value() && !(*os.equivalent))
+                {
+                    const std::lock_guard lock{counter_example_mutex};
+
+                    if (!counter_example_found)
+                    {
+                        pst.counter_example   = st.counter_example;
+                        counter_example_found = true;
+                    }
+                }
+            }
+        };
+
+        const auto num_threads = static_cast<std::size_t>(
+            std::clamp(params.num_threads, uint64_t{1}, static_cast<uint64_t>(outputs.size())));
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    /**
+     * Creates the miter of a single output pair that only contains the transitive fan-in cones of both outputs. All
+     * primary inputs are kept such that counter examples refer to the primary inputs of the full networks.
+     *
+     * @param ntk Network that contains both specification and implementation.
+     * @param spec_po Output of the specification in `ntk`.
+     * @param impl_po Output of the implementation in `ntk`.
+     * @return Single-output miter of `spec_po` and `impl_po`.
+     */
+    [[nodiscard]] static mockturtle::klut_network output_miter(const mockturtle::klut_network& ntk,
+                                                               const klut_signal spec_po, const klut_signal impl_po)
+    {
+        // mark the transitive fan-in cones
+        std::vector<bool> in_cone(ntk.size(), false);
+
+        std::vector<mockturtle::klut_network::node> stack{ntk.get_node(spec_po), ntk.get_node(impl_po)};
+
+        while (!stack.empty())
+        {
+            const auto n = stack.back();
+            stack.pop_back();
+
+            if (in_cone[ntk.node_to_index(n)])
+            {
+                continue;
+            }
+
+            in_cone[ntk.node_to_index(n)] = true;
+
+            if (!ntk.is_constant(n) && !ntk.is_pi(n))
+            {
+                ntk.foreach_fanin(n, [&ntk, &stack](const auto& f) { stack.push_back(ntk.get_node(f)); });
+            }
+        }
+
+        // copy the cones
+        mockturtle::klut_network miter{};
+
+        std::vector<klut_signal> old_to_new(ntk.size());
+
+        old_to_new[ntk.node_to_index(ntk.get_node(ntk.get_constant(false)))] = miter.get_constant(false);
+        old_to_new[ntk.node_to_index(ntk.get_node(ntk.get_constant(true)))]  = miter.get_constant(true);
+
+        ntk.foreach_pi([&ntk, &miter, &old_to_new](const auto& pi)
+                       { old_to_new[ntk.node_to_index(pi)] = miter.create_pi(); });
+
+        ntk.foreach_gate(
+            [&ntk, &miter, &old_to_new, &in_cone](const auto& n)
+            {
+                if (!in_cone[ntk.node_to_index(n)])
+                {
+                    return;
+                }
+
+                std::vector<klut_signal> children{};
+                ntk.foreach_fanin(n, [&ntk, &old_to_new, &children](const auto& f)
+                                  { children.push_back(old_to_new[ntk.node_to_index(ntk.get_node(f))]); });
+
+                old_to_new[ntk.node_to_index(n)] = miter.create_node(children, ntk.node_function(n));
+            });
+
+        miter.create_po(miter.create_xor(old_to_new[ntk.node_to_index(ntk.get_node(spec_po))],
+                                         old_to_new[ntk.node_to_index(ntk.get_node(impl_po))]));
+
+        return miter;
+    }
 };
 
 }  // namespace detail
@@ -222,17 +658,19 @@ class equivalence_checking_impl
  * @tparam Impl Implementation type.
  * @param spec The specification.
  * @param impl The implementation.
+ * @param ps Parameters.
  * @param pst Statistics.
  * @return The equivalence type of `spec` and `impl`.
  */
 template <typename Spec, typename Impl>
-eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, const equivalence_checking_params& ps,
+                             equivalence_checking_stats* pst = nullptr)
 {
     static_assert(mockturtle::is_network_type_v<Spec>, "Spec is not a network type");
     static_assert(mockturtle::is_network_type_v<Impl>, "Impl is not a network type");
 
     equivalence_checking_stats        st{};
-    detail::equivalence_checking_impl p{spec, impl, st};
+    detail::equivalence_checking_impl p{spec, impl, ps, st};
 
     const auto result = p.run();
 
@@ -243,6 +681,22 @@ eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_che
 
     return result;
 }
+/**
+ * Performs SAT-based equivalence checking between a specification of type `Spec` and an implementation of type `Impl`
+ * using default parameters, i.e., a single miter over all outputs. See the overload above for details.
+ *
+ * @tparam Spec Specification type.
+ * @tparam Impl Implementation type.
+ * @param spec The specification.
+ * @param impl The implementation.
+ * @param pst Statistics.
+ * @return The equivalence type of `spec` and `impl`.
+ */
+template <typename Spec, typename Impl>
+eq_type equivalence_checking(const Spec& spec, const Impl& impl, equivalence_checking_stats* pst = nullptr)
+{
+    return equivalence_checking(spec, impl, equivalence_checking_params{}, pst);
+}
 
 }  // namespace fiction
 
@@ -0,0 +1,20 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTANTIATIONS_HPP
+#define FICTION_INSTANTIATIONS_HPP
+
+/**
+ * Declares explicit instantiations of frequently used algorithms for the layout and network types in
+ * `fiction/types.hpp`. Including this header in a translation unit prevents the compiler from implicitly instantiating
+ * the declared specializations there. Instead, they are provided by the precompiled `fiction_instantiations` library,
+ * which is built and linked if the CMake option `FICTION_EXPLICIT_INSTANTIATIONS` is enabled.
+ */
+
+#include "fiction/instantiations/io.hpp"
+#include "fiction/instantiations/physical_design.hpp"
+#include "fiction/instantiations/simulation.hpp"
+#include "fiction/instantiations/verification.hpp"
+
+#endif  // FICTION_INSTANTIATIONS_HPP
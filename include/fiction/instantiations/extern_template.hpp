@@ -0,0 +1,48 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_EXTERN_TEMPLATE_HPP
+#define FICTION_EXTERN_TEMPLATE_HPP
+
+#include "fiction/types.hpp"
+
+/**
+ * Prefix of all explicit instantiations in `fiction/instantiations/`. By default, it expands to `extern template` such
+ * that the respective headers declare the instantiations, which suppresses their implicit instantiation in every
+ * translation unit that includes them. The translation units of the `fiction_instantiations` library define it as
+ * `template` before including the headers to provide the corresponding explicit instantiation definitions.
+ */
+#ifndef FICTION_EXTERN_TEMPLATE
+#define FICTION_EXTERN_TEMPLATE extern template
+#endif
+
+/**
+ * Applies the given macro to the given layout type paired with each logic network type in `fiction/types.hpp`.
+ */
+#define FICTION_FOR_EACH_LOGIC_NETWORK(M, Lyt)                                                                         \
+    M(Lyt, aig_nt)                                                                                                     \
+    M(Lyt, xag_nt)                                                                                                     \
+    M(Lyt, mig_nt)                                                                                                     \
+    M(Lyt, tec_nt)
+/**
+ * Applies the given macro to each gate-level layout type in `fiction/types.hpp`.
+ */
+#define FICTION_FOR_EACH_GATE_LAYOUT(M)                                                                                \
+    M(cart_gate_clk_lyt)                                                                                               \
+    M(cart_odd_row_gate_clk_lyt)                                                                                       \
+    M(cart_even_row_gate_clk_lyt)                                                                                      \
+    M(cart_odd_col_gate_clk_lyt)                                                                                       \
+    M(cart_even_col_gate_clk_lyt)                                                                                      \
+    M(hex_odd_row_gate_clk_lyt)                                                                                        \
+    M(hex_even_row_gate_clk_lyt)                                                                                       \
+    M(hex_odd_col_gate_clk_lyt)                                                                                        \
+    M(hex_even_col_gate_clk_lyt)
+/**
+ * Applies the given macro to each SiDB cell-level layout type that is stored by the CLI.
+ */
+#define FICTION_FOR_EACH_SIDB_LAYOUT(M)                                                                                \
+    M(sidb_100_cell_clk_lyt)                                                                                           \
+    M(sidb_111_cell_clk_lyt)
+
+#endif  // FICTION_EXTERN_TEMPLATE_HPP
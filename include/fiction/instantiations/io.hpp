@@ -0,0 +1,42 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTANTIATIONS_IO_HPP
+#define FICTION_INSTANTIATIONS_IO_HPP
+
+#include "fiction/instantiations/extern_template.hpp"
+#include "fiction/io/read_fgl_layout.hpp"
+#include "fiction/io/read_sqd_layout.hpp"
+#include "fiction/io/write_fgl_layout.hpp"
+#include "fiction/io/write_sqd_layout.hpp"
+#include "fiction/types.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string_view>
+
+namespace fiction
+{
+
+#define FICTION_FGL_IO(Lyt)                                                                                            \
+    FICTION_EXTERN_TEMPLATE void write_fgl_layout<Lyt>(const Lyt&, std::ostream&);                                     \
+    FICTION_EXTERN_TEMPLATE void write_fgl_layout<Lyt>(const Lyt&, const std::string_view&);                           \
+    FICTION_EXTERN_TEMPLATE Lyt  read_fgl_layout<Lyt>(std::istream&, const std::string_view&);                         \
+    FICTION_EXTERN_TEMPLATE Lyt  read_fgl_layout<Lyt>(const std::string_view&, const std::string_view&);
+#define FICTION_SQD_IO(Lyt)                                                                                            \
+    FICTION_EXTERN_TEMPLATE void write_sqd_layout<Lyt>(const Lyt&, std::ostream&);                                     \
+    FICTION_EXTERN_TEMPLATE void write_sqd_layout<Lyt>(const Lyt&, const std::string_view&);                           \
+    FICTION_EXTERN_TEMPLATE Lyt  read_sqd_layout<Lyt>(std::istream&, const std::string_view&);                         \
+    FICTION_EXTERN_TEMPLATE Lyt  read_sqd_layout<Lyt>(const std::string_view&, const std::string_view&);
+
+FICTION_FOR_EACH_GATE_LAYOUT(FICTION_FGL_IO)
+
+FICTION_FOR_EACH_SIDB_LAYOUT(FICTION_SQD_IO)
+
+#undef FICTION_FGL_IO
+#undef FICTION_SQD_IO
+
+}  // namespace fiction
+
+#endif  // FICTION_INSTANTIATIONS_IO_HPP
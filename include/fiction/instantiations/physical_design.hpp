@@ -0,0 +1,81 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTANTIATIONS_PHYSICAL_DESIGN_HPP
+#define FICTION_INSTANTIATIONS_PHYSICAL_DESIGN_HPP
+
+#include "fiction/algorithms/physical_design/apply_gate_library.hpp"
+#include "fiction/algorithms/physical_design/exact.hpp"
+#include "fiction/algorithms/physical_design/graph_oriented_layout_design.hpp"
+#include "fiction/algorithms/physical_design/hexagonalization.hpp"
+#include "fiction/algorithms/physical_design/orthogonal.hpp"
+#include "fiction/algorithms/physical_design/post_layout_optimization.hpp"
+#include "fiction/algorithms/physical_design/wiring_reduction.hpp"
+#include "fiction/instantiations/extern_template.hpp"
+#include "fiction/technology/qca_one_library.hpp"
+#include "fiction/technology/sidb_bestagon_library.hpp"
+#include "fiction/types.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace fiction
+{
+
+#define FICTION_ORTHOGONAL(Lyt, Ntk)                                                                                   \
+    FICTION_EXTERN_TEMPLATE Lyt orthogonal<Lyt, Ntk>(const Ntk&, orthogonal_physical_design_params,                    \
+                                                     orthogonal_physical_design_stats*);
+#define FICTION_GRAPH_ORIENTED_LAYOUT_DESIGN(Lyt, Ntk)                                                                 \
+    FICTION_EXTERN_TEMPLATE std::optional<Lyt> graph_oriented_layout_design<Lyt, Ntk>(                                 \
+        Ntk&, graph_oriented_layout_design_params, graph_oriented_layout_design_stats*,                                \
+        std::function<uint64_t(const Lyt&)>);
+
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_ORTHOGONAL, cart_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_ORTHOGONAL, hex_odd_row_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_ORTHOGONAL, hex_even_row_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_ORTHOGONAL, hex_odd_col_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_ORTHOGONAL, hex_even_col_gate_clk_lyt)
+
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_GRAPH_ORIENTED_LAYOUT_DESIGN, cart_gate_clk_lyt)
+
+#if (FICTION_Z3_SOLVER)
+
+#define FICTION_EXACT(Lyt, Ntk)                                                                                        \
+    FICTION_EXTERN_TEMPLATE std::optional<Lyt> exact<Lyt, Ntk>(const Ntk&, const exact_physical_design_params&,        \
+                                                               exact_physical_design_stats*);
+
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_EXACT, cart_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_EXACT, hex_even_row_gate_clk_lyt)
+
+#undef FICTION_EXACT
+
+#endif  // FICTION_Z3_SOLVER
+
+FICTION_EXTERN_TEMPLATE hex_even_row_gate_clk_lyt
+hexagonalization<hex_even_row_gate_clk_lyt, cart_gate_clk_lyt>(const cart_gate_clk_lyt&,
+                                                               hexagonalization_stats*) noexcept;
+
+FICTION_EXTERN_TEMPLATE void post_layout_optimization<cart_gate_clk_lyt>(const cart_gate_clk_lyt&,
+                                                                         post_layout_optimization_params,
+                                                                         post_layout_optimization_stats*) noexcept;
+
+FICTION_EXTERN_TEMPLATE void wiring_reduction<cart_gate_clk_lyt>(const cart_gate_clk_lyt&, wiring_reduction_params,
+                                                                 wiring_reduction_stats*) noexcept;
+
+FICTION_EXTERN_TEMPLATE qca_cell_clk_lyt
+apply_gate_library<qca_cell_clk_lyt, qca_one_library, cart_gate_clk_lyt>(const cart_gate_clk_lyt&);
+FICTION_EXTERN_TEMPLATE sidb_100_cell_clk_lyt
+apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library, hex_odd_row_gate_clk_lyt>(
+    const hex_odd_row_gate_clk_lyt&);
+FICTION_EXTERN_TEMPLATE sidb_100_cell_clk_lyt
+apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library, hex_even_row_gate_clk_lyt>(
+    const hex_even_row_gate_clk_lyt&);
+
+#undef FICTION_ORTHOGONAL
+#undef FICTION_GRAPH_ORIENTED_LAYOUT_DESIGN
+
+}  // namespace fiction
+
+#endif  // FICTION_INSTANTIATIONS_PHYSICAL_DESIGN_HPP
@@ -0,0 +1,61 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTANTIATIONS_SIMULATION_HPP
+#define FICTION_INSTANTIATIONS_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/critical_temperature.hpp"
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/is_operational.hpp"
+#include "fiction/algorithms/simulation/sidb/operational_domain.hpp"
+#include "fiction/algorithms/simulation/sidb/quickexact.hpp"
+#include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/instantiations/extern_template.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/types.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+#define FICTION_SIDB_SIMULATION(Lyt)                                                                                   \
+    FICTION_EXTERN_TEMPLATE sidb_simulation_result<Lyt> quickexact<Lyt>(const Lyt&,                                    \
+                                                                        const quickexact_params<cell<Lyt>>&) noexcept; \
+    FICTION_EXTERN_TEMPLATE sidb_simulation_result<Lyt> quicksim<Lyt>(const Lyt&, const quicksim_params&);             \
+    FICTION_EXTERN_TEMPLATE sidb_simulation_result<Lyt> exhaustive_ground_state_simulation<Lyt>(                       \
+        const Lyt&, const sidb_simulation_parameters&) noexcept;                                                       \
+    FICTION_EXTERN_TEMPLATE sidb_simulation_result<Lyt> exhaustive_ground_state_simulation<Lyt>(                       \
+        const Lyt&, const exhaustive_ground_state_simulation_params&) noexcept;                                        \
+    FICTION_EXTERN_TEMPLATE std::pair<operational_status, std::size_t> is_operational<Lyt, tt>(                        \
+        const Lyt&, const std::vector<tt>&, const is_operational_params&,                                              \
+        const std::optional<std::vector<bdl_wire<Lyt>>>&, const std::optional<std::vector<bdl_wire<Lyt>>>&);           \
+    FICTION_EXTERN_TEMPLATE double critical_temperature_gate_based<Lyt, tt>(                                           \
+        const Lyt&, const std::vector<tt>&, const critical_temperature_params&, critical_temperature_stats*);          \
+    FICTION_EXTERN_TEMPLATE operational_domain<parameter_point, operational_status>                                    \
+    operational_domain_grid_search<Lyt, tt>(const Lyt&, const std::vector<tt>&, const operational_domain_params&,      \
+                                            operational_domain_stats*);                                                \
+    FICTION_EXTERN_TEMPLATE operational_domain<parameter_point, operational_status>                                    \
+    operational_domain_random_sampling<Lyt, tt>(const Lyt&, const std::vector<tt>&, std::size_t,                       \
+                                                const operational_domain_params&, operational_domain_stats*);          \
+    FICTION_EXTERN_TEMPLATE operational_domain<parameter_point, operational_status>                                    \
+    operational_domain_flood_fill<Lyt, tt>(const Lyt&, const std::vector<tt>&, std::size_t,                            \
+                                           const operational_domain_params&, operational_domain_stats*);               \
+    FICTION_EXTERN_TEMPLATE operational_domain<parameter_point, operational_status>                                    \
+    operational_domain_contour_tracing<Lyt, tt>(const Lyt&, const std::vector<tt>&, std::size_t,                       \
+                                                const operational_domain_params&, operational_domain_stats*);
+
+FICTION_FOR_EACH_SIDB_LAYOUT(FICTION_SIDB_SIMULATION)
+
+#undef FICTION_SIDB_SIMULATION
+
+}  // namespace fiction
+
+#endif  // FICTION_INSTANTIATIONS_SIMULATION_HPP
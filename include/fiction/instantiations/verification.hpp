@@ -0,0 +1,31 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTANTIATIONS_VERIFICATION_HPP
+#define FICTION_INSTANTIATIONS_VERIFICATION_HPP
+
+#include "fiction/algorithms/verification/design_rule_violations.hpp"
+#include "fiction/algorithms/verification/equivalence_checking.hpp"
+#include "fiction/instantiations/extern_template.hpp"
+#include "fiction/types.hpp"
+
+namespace fiction
+{
+
+#define FICTION_GATE_LEVEL_DRVS(Lyt)                                                                                   \
+    FICTION_EXTERN_TEMPLATE void gate_level_drvs<Lyt>(const Lyt&, const gate_level_drv_params&, gate_level_drv_stats*);
+#define FICTION_EQUIVALENCE_CHECKING(Lyt, Ntk)                                                                         \
+    FICTION_EXTERN_TEMPLATE eq_type equivalence_checking<Ntk, Lyt>(const Ntk&, const Lyt&, equivalence_checking_stats*);
+
+FICTION_FOR_EACH_GATE_LAYOUT(FICTION_GATE_LEVEL_DRVS)
+
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_EQUIVALENCE_CHECKING, cart_gate_clk_lyt)
+FICTION_FOR_EACH_LOGIC_NETWORK(FICTION_EQUIVALENCE_CHECKING, hex_even_row_gate_clk_lyt)
+
+#undef FICTION_GATE_LEVEL_DRVS
+#undef FICTION_EQUIVALENCE_CHECKING
+
+}  // namespace fiction
+
+#endif  // FICTION_INSTANTIATIONS_VERIFICATION_HPP
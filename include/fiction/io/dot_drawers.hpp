@@ -1074,45 +1074,40 @@ void write_dot_layout(const Lyt& lyt, std::ostream& os, const Drawer& drawer = {
     static_assert(mockturtle::has_foreach_node_v<Lyt>, "Lyt does not implement the foreach_node function");
     static_assert(mockturtle::has_foreach_fanin_v<Lyt>, "Lyt does not implement the foreach_fanin function");
 
-    std::stringstream nodes{}, edges{}, topology{};
+    // nodes and edges are streamed directly to os instead of being buffered
+    os << fmt::format("digraph layout {{  // Generated by {} ({})\n{};\n\n", FICTION_VERSION, FICTION_REPO,
+                      fmt::join(drawer.additional_graph_attributes(), ";\n"));
 
     auto node_attributes = drawer.additional_node_attributes();
     node_attributes.emplace_back("style=filled");
 
-    nodes << fmt::format("node [{}];\n", fmt::join(node_attributes, ", "));
+    os << fmt::format("node [{}];\n", fmt::join(node_attributes, ", "));
 
     // draw tiles
     lyt.foreach_ground_tile(
-        [&lyt, &drawer, &nodes](const auto& t)
+        [&lyt, &drawer, &os](const auto& t)
         {
-            nodes << fmt::format("{} [label=\"{}\", fillcolor={}];\n", drawer.tile_id(t), drawer.tile_label(lyt, t),
-                                 drawer.tile_fillcolor(lyt, t));
+            os << fmt::format("{} [label=\"{}\", fillcolor={}];\n", drawer.tile_id(t), drawer.tile_label(lyt, t),
+                              drawer.tile_fillcolor(lyt, t));
         });
 
-    edges << "edge [constraint=false];\n";
+    os << "\nedge [constraint=false];\n";
 
     // draw connections
     lyt.foreach_node(
-        [&lyt, &drawer, &edges](const auto& n)
+        [&lyt, &drawer, &os](const auto& n)
         {
             lyt.foreach_fanin(n,
-                              [&lyt, &drawer, &edges, &n](const auto& f)
+                              [&lyt, &drawer, &os, &n](const auto& f)
                               {
-                                  edges << fmt::format("{} -> {} [style={}];\n",
-                                                       drawer.tile_id(static_cast<tile<Lyt>>(f)),
-                                                       drawer.tile_id(lyt.get_tile(n)), drawer.signal_style(lyt, f));
+                                  os << fmt::format("{} -> {} [style={}];\n",
+                                                    drawer.tile_id(static_cast<tile<Lyt>>(f)),
+                                                    drawer.tile_id(lyt.get_tile(n)), drawer.signal_style(lyt, f));
                               });
         });
 
     // enforce topological structure
-    topology << drawer.enforce_topology(lyt);
-
-    // draw layout
-    os << fmt::format("digraph layout {{  // Generated by {} ({})\n{};\n\n", FICTION_VERSION, FICTION_REPO,
-                      fmt::join(drawer.additional_graph_attributes(), ";\n"))
-       << nodes.rdbuf() << '\n'
-       << edges.rdbuf() << '\n'
-       << topology.rdbuf() << "}\n";
+    os << '\n' << drawer.enforce_topology(lyt) << "}\n";
 }
 /*! \brief Writes layout in DOT format into a file
  *
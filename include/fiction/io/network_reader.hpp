@@ -6,7 +6,10 @@
 #define FICTION_NETWORK_READER_HPP
 
 #include "fiction/algorithms/network_transformation/network_conversion.hpp"
+#include "fiction/io/technology_network_cache.hpp"
+#include "fiction/networks/technology_network.hpp"
 
+#include <fmt/format.h>
 #include <lorina/aiger.hpp>
 #include <lorina/blif.hpp>
 #include <lorina/common.hpp>
@@ -21,15 +24,52 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace fiction
 {
+/**
+ * Parameters for the network reader.
+ */
+struct network_reader_params
+{
+    /**
+     * Parse multiple files concurrently. Each file is parsed into a separate network by one of the worker threads. The
+     * resulting networks and all status updates are nevertheless reported in the same deterministic order as in the
+     * sequential mode.
+     */
+    bool parallel = false;
+    /**
+     * Maximum number of worker threads to use if `parallel` is set.
+     */
+    uint64_t num_threads = std::thread::hardware_concurrency();
+    /**
+     * Directory in which parsed technology networks are cached in a binary format (see
+     * `write_technology_network_cache`). Cache entries are keyed by a hash of the respective source file's content such
+     * that subsequent reads of unchanged files skip parsing altogether. An empty string disables the cache. The cache
+     * is only used if the network type is derived from `technology_network`.
+     */
+    std::string cache_directory{};
+};
 /**
  * Helper class to read directories of mockturtle networks of certain types.
  *
@@ -42,10 +82,15 @@ class network_reader
     /**
      * Standard constructor. Reads and constructs logic networks. May throw.
      *
+     * Files in a given folder are processed in lexicographical order of their paths.
+     *
      * @param filename Path to the file or folder of files to read.
      * @param out Output stream to write status updates into.
+     * @param ps Parameters.
      */
-    network_reader(const std::string_view& filename, std::ostream& o) : out{o}
+    network_reader(const std::string_view& filename, std::ostream& o, network_reader_params ps = {}) :
+            out{o},
+            params{std::move(ps)}
     {
         constexpr const char* verilog_ext = ".v";
         constexpr const char* aig_ext     = ".aig";
@@ -99,47 +144,24 @@ class network_reader
             out << "[e] given file name does not exist" << std::endl;
         }
 
-        // handle collected files
-        for (const auto& p : paths)
+        // process files in a deterministic order independent of the file system
+        std::sort(paths.begin(), paths.end());
+
+        prepare_cache_directory();
+
+        if (params.parallel && paths.size() > 1)
         {
-            // parse Verilog
-            if (std::filesystem::path(p).extension() == verilog_ext)
-            {
-                read<mockturtle::verilog_reader<Ntk>,
-                     lorina::return_code(const std::string&, const lorina::verilog_reader&,
-                                         lorina::diagnostic_engine*)>(p, lorina::read_verilog);
-            }
-            // parse AIGER
-            else if (std::filesystem::path(p).extension() == aig_ext)
-            {
-                read<mockturtle::aiger_reader<Ntk>,
-                     lorina::return_code(const std::string&, const lorina::aiger_reader&, lorina::diagnostic_engine*)>(
-                    p, lorina::read_aiger);
-            }
-            // parse BLIF
-            else if (std::filesystem::path(p).extension() == blif_ext)
+            read_in_parallel(paths);
+        }
+        else
+        {
+            for (const auto& p : paths)
             {
-                if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::aig_network>)
-                {
-                    out << "[e] AIGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::xag_network>)
+                if (auto ntk = read_file(p, out); ntk != nullptr)
                 {
-                    out << "[e] XAGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::mig_network>)
-                {
-                    out << "[e] MIGs do not support the full feature set of BLIF files" << std::endl;
-                }
-                else
-                {
-                    read<mockturtle::blif_reader<Ntk>,
-                         lorina::return_code(const std::string&, const lorina::blif_reader&,
-                                             lorina::diagnostic_engine*)>(p, lorina::read_blif);
+                    networks.push_back(std::move(ntk));
                 }
             }
-            // parse ...
-            // else if (std::filesystem::path(p).extension() == ...)
         }
     }
     /**
@@ -169,19 +191,154 @@ class network_reader
      * Vector of logic networks read from files given at construction.
      */
     std::vector<NtkPtr> networks;
+    /**
+     * Parameters.
+     */
+    const network_reader_params params;
+    /**
+     * Flag to indicate that the cache directory turned out to be unusable.
+     */
+    bool cache_disabled = false;
 
     using Ntk = typename NtkPtr::element_type;
     /**
-     * Actual read function that constructs the logic network from a file.
+     * Flag to indicate whether parsed networks can be cached.
+     */
+    static constexpr const bool cacheable = std::is_base_of_v<technology_network, Ntk>;
+    /**
+     * Distributes the given files over a pool of worker threads. Each worker repeatedly claims the next unprocessed
+     * file and parses it into its own network. Status updates are buffered per file and written to `out` in the order
+     * of `paths` after all workers have finished such that the output does not depend on thread scheduling.
+     *
+     * @param paths Files to read.
+     */
+    void read_in_parallel(const std::vector<std::string>& paths)
+    {
+        std::vector<NtkPtr>             results(paths.size());
+        std::vector<std::ostringstream> logs(paths.size());
+
+        std::atomic<std::size_t> next_path{0};
+
+        const auto worker = [this, &paths, &results, &logs, &next_path]
+        {
+            for (auto i = next_path++; i < paths.size(); i = next_path++)
+            {
+                results[i] = read_file(paths[i], logs[i]);
+            }
+        };
+
+        const auto num_threads =
+            static_cast<std::size_t>(std::clamp(params.num_threads, uint64_t{1}, static_cast<uint64_t>(paths.size())));
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            out << logs[i].str();
+
+            if (results[i] != nullptr)
+            {
+                networks.push_back(std::move(results[i]));
+            }
+        }
+
+        out.flush();
+    }
+    /**
+     * Reads a single file by choosing the parser according to its extension.
+     *
+     * @param p Path to the file.
+     * @param log Output stream to write status updates into.
+     * @return The constructed logic network or `nullptr` if the file could not be read.
+     */
+    NtkPtr read_file(const std::string& p, std::ostream& log) const noexcept
+    {
+        const auto extension = std::filesystem::path(p).extension();
+
+        // parse Verilog
+        if (extension == ".v")
+        {
+            return read<mockturtle::verilog_reader<Ntk>,
+                        lorina::return_code(const std::string&, const lorina::verilog_reader&,
+                                            lorina::diagnostic_engine*)>(p, lorina::read_verilog, log);
+        }
+        // parse AIGER
+        if (extension == ".aig")
+        {
+            return read<mockturtle::aiger_reader<Ntk>,
+                        lorina::return_code(const std::string&, const lorina::aiger_reader&,
+                                            lorina::diagnostic_engine*)>(p, lorina::read_aiger, log);
+        }
+        // parse BLIF
+        if (extension == ".blif")
+        {
+            if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::aig_network>)
+            {
+                log << "[e] AIGs do not support the full feature set of BLIF files" << std::endl;
+            }
+            else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::xag_network>)
+            {
+                log << "[e] XAGs do not support the full feature set of BLIF files" << std::endl;
+            }
+            else if constexpr (std::is_same_v<typename Ntk::base_type, mockturtle::mig_network>)
+            {
+                log << "[e] MIGs do not support the full feature set of BLIF files" << std::endl;
+            }
+            else
+            {
+                return read<mockturtle::blif_reader<Ntk>,
+                            lorina::return_code(const std::string&, const lorina::blif_reader&,
+                                                lorina::diagnostic_engine*)>(p, lorina::read_blif, log);
+            }
+        }
+        // parse ...
+        // else if (extension == ...)
+
+        return nullptr;
+    }
+    /**
+     * Actual read function that constructs the logic network from a file. If caching is enabled, a cached version of
+     * the network is returned instead of parsing the file if available, and freshly parsed networks are added to the
+     * cache.
      *
      * @tparam Reader The functor type which constructs the network, i.e. handles the callbacks.
      * @tparam ReadFun The file parser type.
      * @param file The file name.
      * @param rfun The actual parsing function.
+     * @param log Output stream to write status updates into.
+     * @return The constructed logic network or `nullptr` if the file could not be read.
      */
     template <class Reader, class ReadFun>
-    void read(const std::string_view& file, ReadFun rfun) noexcept
+    NtkPtr read(const std::string_view& file, ReadFun rfun, std::ostream& log) const noexcept
     {
+        const auto name = std::filesystem::path{file}.stem().string();
+
+        std::string cache_file{};
+
+        if constexpr (cacheable)
+        {
+            if (!params.cache_directory.empty())
+            {
+                cache_file = cache_file_name(file);
+
+                if (auto cached = read_from_cache(cache_file, name); cached != nullptr)
+                {
+                    return cached;
+                }
+            }
+        }
+
         Ntk ntk{};
 
         try
@@ -190,23 +347,172 @@ class network_reader
             if (lorina::diagnostic_engine diag{&client};
                 rfun(file.data(), Reader{ntk}, &diag) == lorina::return_code::success)
             {
-                const auto name = std::filesystem::path{file}.stem().string();
-
                 if constexpr (mockturtle::has_set_network_name_v<Ntk>)
                 {
                     ntk.set_network_name(name);
                 }
 
-                networks.push_back(std::make_shared<Ntk>(convert_network<Ntk>(ntk)));
+                auto result = std::make_shared<Ntk>(convert_network<Ntk>(ntk));
+
+                if constexpr (cacheable)
+                {
+                    if (!cache_file.empty())
+                    {
+                        write_to_cache(*result, cache_file, log);
+                    }
+                }
+
+                return result;
             }
-            else
+
+            log << "[e] parsing error in " << file << std::endl;
+        }
+        catch (...)
+        {
+            log << "[e] " << file << " contains unsupported features" << std::endl;
+        }
+
+        return nullptr;
+    }
+    /**
+     * Creates the cache directory if caching is enabled. Disables the cache if the directory cannot be created.
+     */
+    void prepare_cache_directory() noexcept
+    {
+        if constexpr (cacheable)
+        {
+            if (!params.cache_directory.empty())
             {
-                out << "[e] parsing error in " << file << std::endl;
+                std::error_code ec{};
+                std::filesystem::create_directories(params.cache_directory, ec);
+
+                if (ec)
+                {
+                    out << fmt::format("[w] could not create cache directory {}; caching is disabled",
+                                       params.cache_directory)
+                        << std::endl;
+
+                    cache_disabled = true;
+                }
             }
         }
+    }
+    /**
+     * Computes the cache file name for the given source file from the 64-bit FNV-1a hash of its content. The network
+     * type and the version of the cache format are part of the key such that entries written for another network type
+     * or by another version are never read back.
+     *
+     * @param file Source file.
+     * @return Path to the cache file or an empty string if caching is disabled or the file cannot be hashed.
+     */
+    [[nodiscard]] std::string cache_file_name(const std::string_view& file) const noexcept
+    {
+        if (cache_disabled)
+        {
+            return {};
+        }
+
+        try
+        {
+            std::ifstream is{file.data(), std::ifstream::in | std::ifstream::binary};
+
+            if (!is.is_open())
+            {
+                return {};
+            }
+
+            uint64_t hash = 0xcbf29ce484222325ull;
+
+            const auto fnv1a = [&hash](const char c)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            };
+
+            const std::string_view type_name{typeid(Ntk).name()};
+            std::for_each(type_name.cbegin(), type_name.cend(), fnv1a);
+            std::for_each(std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}, fnv1a);
+
+            return (std::filesystem::path{params.cache_directory} /
+                    fmt::format("{:016x}.v{}.tec", hash, detail::TECHNOLOGY_NETWORK_CACHE_VERSION))
+                .string();
+        }
+        catch (...)
+        {
+            return {};
+        }
+    }
+    /**
+     * Attempts to restore a network from the given cache file. Missing or corrupted cache files are ignored.
+     *
+     * @param cache_file Path to the cache file.
+     * @param name Name to assign to the restored network.
+     * @return The restored network or `nullptr` if no valid cache entry exists.
+     */
+    [[nodiscard]] NtkPtr read_from_cache(const std::string& cache_file, const std::string& name) const noexcept
+    {
+        if (cache_file.empty())
+        {
+            return nullptr;
+        }
+
+        if (std::error_code ec{}; !std::filesystem::is_regular_file(cache_file, ec))
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            auto ntk = std::make_shared<Ntk>(read_technology_network_cache<Ntk>(cache_file));
+
+            // identical files may be stored under different names
+            if constexpr (mockturtle::has_set_network_name_v<Ntk>)
+            {
+                ntk->set_network_name(name);
+            }
+
+            return ntk;
+        }
+        catch (const technology_network_cache_error&)
+        {
+            // invalid entries are replaced by parsing the source file again
+        }
+        catch (const std::ios_base::failure&)
+        {
+            // as are unreadable ones
+        }
+        catch (const std::bad_alloc&)
+        {
+            // and ones that are too large to be restored
+        }
+
+        return nullptr;
+    }
+    /**
+     * Stores the given network in the cache. The entry is first written to a temporary file that is then renamed such
+     * that concurrent readers never observe partially written entries.
+     *
+     * @param ntk Network to cache.
+     * @param cache_file Path to the cache file.
+     * @param log Output stream to write status updates into.
+     */
+    void write_to_cache(const Ntk& ntk, const std::string& cache_file, std::ostream& log) const noexcept
+    {
+        std::string tmp_file{};
+
+        try
+        {
+            tmp_file = fmt::format("{}.{}.tmp", cache_file, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+            write_technology_network_cache(ntk, tmp_file);
+            std::filesystem::rename(tmp_file, cache_file);
+        }
         catch (...)
         {
-            out << "[e] " << file << " contains unsupported features" << std::endl;
+            std::error_code ec{};
+            std::filesystem::remove(tmp_file, ec);
+
+            log << "[w] could not write cache file " << cache_file << std::endl;
         }
     }
 };
@@ -0,0 +1,492 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_TECHNOLOGY_NETWORK_CACHE_HPP
+#define FICTION_TECHNOLOGY_NETWORK_CACHE_HPP
+
+#include "fiction/networks/technology_network.hpp"
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Exception thrown when an error occurs while reading a cached technology network.
+ */
+class technology_network_cache_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `technology_network_cache_error` object with the given error message.
+     *
+     * @param msg The error message describing the error.
+     */
+    explicit technology_network_cache_error(const std::string_view& msg) noexcept : std::runtime_error(msg.data()) {}
+};
+
+namespace detail
+{
+
+/**
+ * Identifies files written by `write_technology_network_cache`.
+ */
+inline constexpr std::array<char, 4> TECHNOLOGY_NETWORK_CACHE_MAGIC{{'F', 'T', 'N', 'C'}};
+/**
+ * Version of the binary format. Cached files of a different version are rejected.
+ */
+inline constexpr uint32_t TECHNOLOGY_NETWORK_CACHE_VERSION = 2u;
+/**
+ * Largest fan-in size of a cached gate. Technology networks consist of gates with at most three inputs. Larger gates
+ * are accepted as long as their function fits into a single 64-bit block of a truth table.
+ */
+inline constexpr uint32_t TECHNOLOGY_NETWORK_CACHE_MAX_FANIN_SIZE = 6u;
+/**
+ * Largest number of bytes that a single length field may announce if the size of the input stream cannot be
+ * determined, e.g., because it is not seekable.
+ */
+inline constexpr uint64_t TECHNOLOGY_NETWORK_CACHE_MAX_UNCHECKED_LENGTH = uint64_t{1} << 26u;
+
+template <typename Ntk>
+class write_technology_network_cache_impl
+{
+  public:
+    write_technology_network_cache_impl(const Ntk& src, std::ostream& s) : ntk{src}, os{s} {}
+
+    void run()
+    {
+        os.write(TECHNOLOGY_NETWORK_CACHE_MAGIC.data(), TECHNOLOGY_NETWORK_CACHE_MAGIC.size());
+        write_value(TECHNOLOGY_NETWORK_CACHE_VERSION);
+
+        if constexpr (mockturtle::has_get_network_name_v<Ntk>)
+        {
+            write_string(ntk.get_network_name());
+        }
+        else
+        {
+            write_string("");
+        }
+
+        // nodes are referenced by consecutive indices in the order of their creation during restoration, i.e., the
+        // constants first, then the primary inputs, and then the gates
+        index_map.assign(ntk.size(), 0);
+        index_map[ntk.node_to_index(ntk.get_node(ntk.get_constant(true)))] = 1;
+
+        uint64_t next_index = 2;
+
+        write_value(static_cast<uint64_t>(ntk.num_pis()));
+        ntk.foreach_pi(
+            [this, &next_index](const auto& pi)
+            {
+                index_map[ntk.node_to_index(pi)] = next_index++;
+                write_signal_name(ntk.make_signal(pi));
+            });
+
+        write_value(static_cast<uint64_t>(ntk.num_gates()));
+        ntk.foreach_gate(
+            [this, &next_index](const auto& g)
+            {
+                if (ntk.fanin_size(g) > TECHNOLOGY_NETWORK_CACHE_MAX_FANIN_SIZE)
+                {
+                    throw technology_network_cache_error(
+                        "Error writing technology network cache: gate exceeds the maximum fan-in size");
+                }
+
+                index_map[ntk.node_to_index(g)] = next_index++;
+
+                write_value(static_cast<uint32_t>(ntk.fanin_size(g)));
+                ntk.foreach_fanin(g, [this](const auto& fi)
+                                  { write_value(index_map[ntk.node_to_index(ntk.get_node(fi))]); });
+
+                const auto tt = ntk.node_function(g);
+                std::for_each(tt.cbegin(), tt.cend(), [this](const uint64_t block) { write_value(block); });
+
+                write_signal_name(ntk.make_signal(g));
+            });
+
+        write_value(static_cast<uint64_t>(ntk.num_pos()));
+        ntk.foreach_po(
+            [this](const auto& po, const auto i)
+            {
+                write_value(index_map[ntk.node_to_index(ntk.get_node(po))]);
+
+                if constexpr (mockturtle::has_get_output_name_v<Ntk>)
+                {
+                    write_optional_string(ntk.has_output_name(static_cast<uint32_t>(i)),
+                                          ntk.get_output_name(static_cast<uint32_t>(i)));
+                }
+                else
+                {
+                    write_optional_string(false, "");
+                }
+            });
+    }
+
+  private:
+    /**
+     * The network to write.
+     */
+    const Ntk& ntk;
+    /**
+     * The output stream to write into.
+     */
+    std::ostream& os;
+    /**
+     * Maps node indices of the network to the consecutive indices under which they are referenced in the cache.
+     */
+    std::vector<uint64_t> index_map{};
+
+    template <typename T>
+    void write_value(const T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T is not trivially copyable");
+
+        os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write_string(const std::string& str)
+    {
+        write_value(static_cast<uint64_t>(str.size()));
+        os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+
+    void write_optional_string(const bool present, const std::string& str)
+    {
+        write_value(static_cast<uint8_t>(present));
+
+        if (present)
+        {
+            write_string(str);
+        }
+    }
+
+    template <typename Signal>
+    void write_signal_name(const Signal& s)
+    {
+        if constexpr (mockturtle::has_get_name_v<Ntk>)
+        {
+            const auto has_name = ntk.has_name(s);
+            write_optional_string(has_name, has_name ? ntk.get_name(s) : std::string{});
+        }
+        else
+        {
+            write_optional_string(false, "");
+        }
+    }
+};
+
+template <typename Ntk>
+class read_technology_network_cache_impl
+{
+  public:
+    explicit read_technology_network_cache_impl(std::istream& s) : is{s}
+    {
+        // determine the size of the stream to validate length fields before allocating memory for them
+        if (const auto begin = is.tellg(); begin != std::streampos{-1})
+        {
+            if (is.seekg(0, std::ios_base::end); is)
+            {
+                stream_end = is.tellg();
+            }
+
+            is.clear();
+            is.seekg(begin);
+        }
+    }
+
+    Ntk run()
+    {
+        std::array<char, 4> magic{};
+        is.read(magic.data(), magic.size());
+
+        if (!is || magic != TECHNOLOGY_NETWORK_CACHE_MAGIC)
+        {
+            throw technology_network_cache_error("Error reading technology network cache: invalid header");
+        }
+        if (read_value<uint32_t>() != TECHNOLOGY_NETWORK_CACHE_VERSION)
+        {
+            throw technology_network_cache_error("Error reading technology network cache: unsupported version");
+        }
+
+        const auto network_name = read_string();
+
+        if constexpr (mockturtle::has_set_network_name_v<Ntk>)
+        {
+            ntk.set_network_name(network_name);
+        }
+
+        // maps the consecutive node indices of the cache to signals of the restored network
+        std::vector<mockturtle::signal<Ntk>> node_map{ntk.get_constant(false), ntk.get_constant(true)};
+
+        const auto fetch = [&node_map](const uint64_t index)
+        {
+            if (index >= node_map.size())
+            {
+                throw technology_network_cache_error("Error reading technology network cache: invalid node reference");
+            }
+
+            return node_map[index];
+        };
+
+        // each primary input occupies at least its name flag
+        const auto num_pis = read_value<uint64_t>();
+        check_length(num_pis, sizeof(uint8_t));
+        node_map.reserve(2 + num_pis);
+
+        for (uint64_t i = 0; i < num_pis; ++i)
+        {
+            const auto pi = ntk.create_pi();
+
+            node_map.push_back(pi);
+            read_signal_name(pi);
+        }
+
+        // each gate occupies at least its fan-in size, one truth table block, and its name flag
+        const auto num_gates = read_value<uint64_t>();
+        check_length(num_gates, sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint8_t));
+        node_map.reserve(node_map.size() + num_gates);
+
+        for (uint64_t i = 0; i < num_gates; ++i)
+        {
+            const auto fanin_size = read_value<uint32_t>();
+
+            if (fanin_size > TECHNOLOGY_NETWORK_CACHE_MAX_FANIN_SIZE)
+            {
+                throw technology_network_cache_error("Error reading technology network cache: unsupported fan-in size");
+            }
+
+            std::vector<mockturtle::signal<Ntk>> children(fanin_size);
+            std::generate(children.begin(), children.end(), [this, &fetch] { return fetch(read_value<uint64_t>()); });
+
+            kitty::dynamic_truth_table tt(fanin_size);
+            std::generate(tt.begin(), tt.end(), [this] { return read_value<uint64_t>(); });
+
+            const auto g = ntk.create_node(children, tt);
+
+            node_map.push_back(g);
+            read_signal_name(g);
+        }
+
+        // each primary output occupies at least its driver and its name flag
+        const auto num_pos = read_value<uint64_t>();
+        check_length(num_pos, sizeof(uint64_t) + sizeof(uint8_t));
+
+        for (uint64_t i = 0; i < num_pos; ++i)
+        {
+            const auto driver = fetch(read_value<uint64_t>());
+            ntk.create_po(driver);
+
+            if (read_value<uint8_t>() != 0)
+            {
+                const auto name = read_string();
+
+                if constexpr (mockturtle::has_set_output_name_v<Ntk>)
+                {
+                    ntk.set_output_name(static_cast<uint32_t>(i), name);
+                }
+            }
+        }
+
+        return ntk;
+    }
+
+  private:
+    /**
+     * The network to restore.
+     */
+    Ntk ntk{};
+    /**
+     * The input stream to read from.
+     */
+    std::istream& is;
+    /**
+     * End position of the input stream or -1 if it cannot be determined.
+     */
+    std::streampos stream_end{-1};
+    /**
+     * Ensures that the input stream holds at least `count` further elements of `element_size` bytes each. This way,
+     * corrupt or truncated files cannot trigger excessive memory allocations via their length fields.
+     *
+     * @param count Number of elements.
+     * @param element_size Minimum size of each element in bytes.
+     */
+    void check_length(const uint64_t count, const uint64_t element_size)
+    {
+        auto remaining = TECHNOLOGY_NETWORK_CACHE_MAX_UNCHECKED_LENGTH;
+
+        if (const auto pos = is.tellg(); stream_end != std::streampos{-1} && pos != std::streampos{-1})
+        {
+            remaining = static_cast<uint64_t>(stream_end - pos);
+        }
+
+        if (count > remaining / element_size)
+        {
+            throw technology_network_cache_error(
+                "Error reading technology network cache: length exceeds the file size");
+        }
+    }
+
+    template <typename T>
+    T read_value()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T is not trivially copyable");
+
+        T value{};
+        is.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+        if (!is)
+        {
+            throw technology_network_cache_error("Error reading technology network cache: unexpected end of file");
+        }
+
+        return value;
+    }
+
+    std::string read_string()
+    {
+        const auto length = read_value<uint64_t>();
+        check_length(length, sizeof(char));
+
+        std::string str(length, '\0');
+        is.read(str.data(), static_cast<std::streamsize>(str.size()));
+
+        if (!is)
+        {
+            throw technology_network_cache_error("Error reading technology network cache: unexpected end of file");
+        }
+
+        return str;
+    }
+
+    template <typename Signal>
+    void read_signal_name(const Signal& s)
+    {
+        if (read_value<uint8_t>() != 0)
+        {
+            const auto name = read_string();
+
+            if constexpr (mockturtle::has_set_name_v<Ntk>)
+            {
+                ntk.set_name(s, name);
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Writes a technology network into a compact binary format that can be restored via `read_technology_network_cache`
+ * considerably faster than the network could be parsed from its original source file. It preserves the network's
+ * structure including the order of its primary inputs, gates, and primary outputs as well as its network name, signal
+ * names, and output names if `Ntk` provides them.
+ *
+ * The format stores all values in the host's byte order. It is, therefore, intended for caching purposes only and not
+ * as an exchange format between different machines.
+ *
+ * May throw a `technology_network_cache_error` if a gate has more than `TECHNOLOGY_NETWORK_CACHE_MAX_FANIN_SIZE`
+ * inputs.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @tparam Ntk Technology network type, e.g., `tec_nt`.
+ * @param ntk The network to be written.
+ * @param os The output stream to write into. Should be opened in binary mode.
+ */
+template <typename Ntk>
+void write_technology_network_cache(const Ntk& ntk, std::ostream& os)
+{
+    static_assert(std::is_base_of_v<technology_network, Ntk>, "Ntk is not a technology network");
+
+    detail::write_technology_network_cache_impl p{ntk, os};
+
+    p.run();
+}
+/**
+ * Writes a technology network into a compact binary format that can be restored via `read_technology_network_cache`.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam Ntk Technology network type, e.g., `tec_nt`.
+ * @param ntk The network to be written.
+ * @param filename The file name to create and write into.
+ */
+template <typename Ntk>
+void write_technology_network_cache(const Ntk& ntk, const std::string_view& filename)
+{
+    std::ofstream os{filename.data(), std::ofstream::out | std::ofstream::binary};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_technology_network_cache(ntk, os);
+    os.close();
+}
+/**
+ * Reads a technology network that was written via `write_technology_network_cache`.
+ *
+ * May throw a `technology_network_cache_error` if the input is malformed or was written by an incompatible version.
+ *
+ * This overload uses an input stream to read from.
+ *
+ * @tparam Ntk Technology network type, e.g., `tec_nt`.
+ * @param is The input stream to read from. Should be opened in binary mode.
+ * @return The restored network.
+ */
+template <typename Ntk>
+[[nodiscard]] Ntk read_technology_network_cache(std::istream& is)
+{
+    static_assert(std::is_base_of_v<technology_network, Ntk>, "Ntk is not a technology network");
+
+    detail::read_technology_network_cache_impl<Ntk> p{is};
+
+    return p.run();
+}
+/**
+ * Reads a technology network that was written via `write_technology_network_cache`.
+ *
+ * May throw a `technology_network_cache_error` if the file is malformed or was written by an incompatible version.
+ *
+ * This overload uses a file name to read from.
+ *
+ * @tparam Ntk Technology network type, e.g., `tec_nt`.
+ * @param filename The file name to open and read from.
+ * @return The restored network.
+ */
+template <typename Ntk>
+[[nodiscard]] Ntk read_technology_network_cache(const std::string_view& filename)
+{
+    std::ifstream is{filename.data(), std::ifstream::in | std::ifstream::binary};
+
+    if (!is.is_open())
+    {
+        throw std::ifstream::failure("could not open file");
+    }
+
+    auto ntk = read_technology_network_cache<Ntk>(is);
+    is.close();
+
+    return ntk;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_TECHNOLOGY_NETWORK_CACHE_HPP
@@ -13,9 +13,10 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <exception>
 #include <iostream>
-#include <sstream>
+#include <map>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -99,6 +100,7 @@ inline constexpr const char* HEADER = "<?xml version=\"1.0\" encoding=\"UTF-8\"
                                       "xmlns:cc=\"http://creativecommons.org/ns#\"\n"
                                       "xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
                                       "xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
+                                      "xmlns:xlink=\"http://www.w3.org/1999/xlink\"\n"
                                       "xmlns=\"http://www.w3.org/2000/svg\"\n"
                                       "viewBox=\"0 0 {} {}\"\n"
                                       "version=\"1.1\">\n"
@@ -112,11 +114,23 @@ inline constexpr const char* HEADER = "<?xml version=\"1.0\" encoding=\"UTF-8\"
                                       "<dc:title></dc:title>\n"
                                       "</cc:Work>\n"
                                       "</rdf:RDF>\n"
-                                      "</metadata>\n"
-                                      "<g>\n"
-                                      "{}\n"
-                                      "</g>\n"
-                                      "</svg>";
+                                      "</metadata>\n";
+
+inline constexpr const char* DEFS_BEGIN = "<defs>\n";
+inline constexpr const char* DEFS_END   = "</defs>\n";
+inline constexpr const char* BODY_BEGIN = "<g>\n";
+inline constexpr const char* FOOTER     = "</g>\n"
+                                          "</svg>";
+
+// reusable symbols and their instances
+inline constexpr const char* SYMBOL = "<g\n"
+                                      "id=\"{0}\">\n"
+                                      "{1}\n"
+                                      "</g>\n";
+inline constexpr const char* USE    = "<use\n"
+                                      "xlink:href=\"#{0}\"\n"
+                                      "x=\"{1}\"\n"
+                                      "y=\"{2}\" />\n";
 
 inline constexpr const char* TILE =
     "<g\n"
@@ -370,36 +384,35 @@ class write_qca_layout_svg_impl
     write_qca_layout_svg_params ps;
 
     /**
-     * Alias for an SVG description of a tile containing also its clock zone.
-     */
-    using tile_description = std::pair<std::string, typename Lyt::clock_number_t>;
-    /**
-     * Maps coordinates of tiles to their string representation and their clock zone.
-     */
-    using coord_to_tile_mapping = std::unordered_map<coordinate<Lyt>, tile_description>;
-    /**
-     * Maps coordinates of tiles to a string representation of the cells contained within them.
-     */
-    using coord_to_cell_list_mapping = std::unordered_map<coordinate<Lyt>, std::string>;
-    /**
-     * Alias for an SVG description of a latch tile containing also its clock zone and its offset.
+     * Alias for an SVG description template of a cell and its color.
      */
-    using svg_latch = std::tuple<std::string, typename Lyt::clock_number_t, uint32_t>;
+    using description_color = std::pair<const char*, const char*>;
     /**
-     * Maps coordinates of latch tiles to tuples containing their string representation, their clock zone,
-     * and their latch offset.
+     * Position of an instance of a reusable SVG symbol.
      */
-    using coord_to_latch_mapping = std::unordered_map<coordinate<Lyt>, svg_latch>;
+    struct symbol_instance
+    {
+        /**
+         * Index of the symbol.
+         */
+        uint32_t symbol;
+        /**
+         * Position of the instance.
+         */
+        double x, y;
+    };
 
     /**
-     * Generates and returns a pair of strings representing the description and color of the given cell.
+     * Generates and returns a pair of strings representing the description and color of the given cell. The
+     * description is empty if the cell is not to be drawn.
      *
      * @param c The cell for which to generate the description and color.
      * @return A pair of strings representing the description and color of the given cell `c`.
      */
-    std::pair<std::string, std::string> generate_description_color(const cell<Lyt>& c)
+    description_color generate_description_color(const cell<Lyt>& c)
     {
-        std::string cell_description, cell_color{};
+        const char* cell_description = "";
+        const char* cell_color       = "";
 
         static constexpr const std::array<const char*, 4> cell_colors{
             {svg::CLOCK_ZONE_1_CELL, svg::CLOCK_ZONE_2_CELL, svg::CLOCK_ZONE_3_CELL, svg::CLOCK_ZONE_4_CELL}};
@@ -473,237 +486,254 @@ class write_qca_layout_svg_impl
             throw unsupported_cell_type_exception(c);
         }
 
-        return std::make_pair(cell_description, cell_color);
+        return {cell_description, cell_color};
     }
+    /**
+     * Writes the SVG header and the definitions of all given symbols to the output stream.
+     *
+     * @tparam Symbols Iterable container of pairs of symbol identifiers and SVG descriptions.
+     * @param viewbox_x Width of the view box.
+     * @param viewbox_y Height of the view box.
+     * @param symbols Symbols to define.
+     */
+    template <typename Symbols>
+    void write_header_and_symbols(const double viewbox_x, const double viewbox_y, const Symbols& symbols)
+    {
+        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y) << svg::DEFS_BEGIN;
 
+        for (const auto& [id, description] : symbols)
+        {
+            os << fmt::format(svg::SYMBOL, id, description);
+        }
+
+        os << svg::DEFS_END << svg::BODY_BEGIN;
+    }
     /**
-     * Generates an SVG string representing the cell-based clocked cell layout and appends it to the output stream.
+     * Generates an SVG representation of the cell-based clocked cell layout and streams it to the output stream. Each
+     * distinct combination of cell description and color is defined once as a symbol that is instantiated per cell.
      */
     void generate_cell_based_svg()
     {
-        std::stringstream cell_descriptions{};
+        // distinct symbol descriptions, identified in order of their first use to keep the output deterministic
+        std::unordered_map<std::string, uint32_t> symbol_ids{};
+        std::vector<const std::string*>           symbol_descriptions{};
+
+        // avoids formatting the description of each cell; equal templates may not share their addresses, which is why
+        // this cache only forwards to the identifiers above
+        std::map<description_color, uint32_t> cached_ids{};
+
+        const auto symbol_id = [&symbol_ids, &symbol_descriptions, &cached_ids](const description_color& desc_col)
+        {
+            if (const auto cached = cached_ids.find(desc_col); cached != cached_ids.cend())
+            {
+                return cached->second;
+            }
+
+            const auto [it, inserted] =
+                symbol_ids.try_emplace(fmt::format(desc_col.first, desc_col.second, 0, 0),
+                                       static_cast<uint32_t>(symbol_descriptions.size()));
+
+            if (inserted)
+            {
+                symbol_descriptions.push_back(&it->first);
+            }
+
+            cached_ids.emplace(desc_col, it->second);
+
+            return it->second;
+        };
 
         lyt.foreach_cell_position(
-            [this, &cell_descriptions](const auto& c)
+            [this, &symbol_id](const auto& c)
             {
-                if (!lyt.is_empty_cell(c))
+                if (lyt.is_empty_cell(c))
                 {
-                    // Determines cell type and color
-                    const auto desc_col = generate_description_color(c);
+                    return;
+                }
 
-                    bool is_sync_elem = false;
-                    // Current cell-description can now be appended to the description of all cells
-                    if constexpr (has_synchronization_elements_v<Lyt>)
-                    {
-                        if (lyt.is_synchronization_element(c))
-                        {
-                            cell_descriptions
-                                << fmt::format(desc_col.first, desc_col.second,
-                                               svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_LATCH_CELL_X +
-                                                   c.x * svg::CELL_DISTANCE,
-                                               svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_LATCH_CELL_Y +
-                                                   c.y * svg::CELL_DISTANCE);
-
-                            is_sync_elem = true;
-                        }
-                    }
-                    if (!is_sync_elem)
-                    {
-                        cell_descriptions << fmt::format(
-                            desc_col.first, desc_col.second,
-                            svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_CELL_X + c.x * svg::CELL_DISTANCE,
-                            svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_CELL_Y + c.y * svg::CELL_DISTANCE);
-                    }
+                // cells that are not drawn do not need a symbol
+                if (const auto desc_col = generate_description_color(c); *desc_col.first != '\0')
+                {
+                    symbol_id(desc_col);
                 }
             });
 
+        std::vector<std::pair<std::string, std::string>> symbols{};
+        symbols.reserve(symbol_descriptions.size());
+
+        for (auto i = 0u; i < symbol_descriptions.size(); ++i)
+        {
+            symbols.emplace_back(fmt::format("c{}", i), *symbol_descriptions[i]);
+        }
+
         const double viewbox_x = 2 * svg::VIEWBOX_DISTANCE + static_cast<double>(lyt.x() + 1) * svg::CELL_DISTANCE;
         const double viewbox_y = 2 * svg::VIEWBOX_DISTANCE + static_cast<double>(lyt.y() + 1) * svg::CELL_DISTANCE;
 
-        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y, cell_descriptions.str());
-    }
+        write_header_and_symbols(viewbox_x, viewbox_y, symbols);
+
+        lyt.foreach_cell_position(
+            [this, &symbol_id](const auto& c)
+            {
+                if (lyt.is_empty_cell(c))
+                {
+                    return;
+                }
+
+                const auto desc_col = generate_description_color(c);
 
+                // skip cells that are not drawn
+                if (*desc_col.first == '\0')
+                {
+                    return;
+                }
+
+                double x_offset = svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_CELL_X;
+                double y_offset = svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_CELL_Y;
+
+                if constexpr (has_synchronization_elements_v<Lyt>)
+                {
+                    if (lyt.is_synchronization_element(c))
+                    {
+                        x_offset = svg::STARTING_OFFSET_TILE_X + svg::STARTING_OFFSET_LATCH_CELL_X;
+                        y_offset = svg::STARTING_OFFSET_TILE_Y + svg::STARTING_OFFSET_LATCH_CELL_Y;
+                    }
+                }
+
+                os << fmt::format(svg::USE, fmt::format("c{}", symbol_id(desc_col)),
+                                  x_offset + c.x * svg::CELL_DISTANCE, y_offset + c.y * svg::CELL_DISTANCE);
+            });
+
+        os << svg::FOOTER;
+    }
     /**
-     * Generates an SVG string representing the tile-based clocked cell layout and appends it to the output stream.
+     * Generates an SVG representation of the tile-based clocked cell layout and streams it to the output stream. Tiles
+     * are processed one at a time. Each distinct tile, i.e., each distinct combination of clock zone and contained
+     * cells, is defined once as a symbol that is instantiated for every tile that looks alike. Memory consumption and
+     * file size therefore scale with the number of distinct tiles instead of the number of cells.
      */
     void generate_tile_based_svg()
     {
-        // Collects ALL tile-descriptions
-        std::stringstream tile_descriptions{};
-
-        // Used for generating tile-descriptions with information about the tile's coordinates and clock zone
-        // It is needed because cells may not be in "tile-order" when read from a cell layout
-        coord_to_tile_mapping      coord_to_tile{};
-        coord_to_cell_list_mapping coord_to_cells{};
-        coord_to_latch_mapping     coord_to_latch_tile{};
-        coord_to_cell_list_mapping coord_to_latch_cells{};
-
         // Used to determine the color of cells, tiles and text based on its clock zone
         static constexpr const std::array<const char*, 4> tile_colors{
             {svg::CLOCK_ZONE_1_TILE, svg::CLOCK_ZONE_2_TILE, svg::CLOCK_ZONE_3_TILE, svg::CLOCK_ZONE_4_TILE}};
         static constexpr const std::array<const char*, 4> text_colors{
             {svg::CLOCK_ZONE_12_TEXT, svg::CLOCK_ZONE_12_TEXT, svg::CLOCK_ZONE_34_TEXT, svg::CLOCK_ZONE_34_TEXT}};
 
-        // Adds all non-empty cells from the layout to their correct tiles; it generates the "body"
-        // of all the tile-descriptions to be used later
-        lyt.foreach_cell_position(
-            [this, &coord_to_tile, &coord_to_cells, &coord_to_latch_cells, &coord_to_latch_tile](const auto& c)
+        // distinct tile descriptions and their instances
+        std::unordered_map<std::string, uint32_t> symbol_ids{};
+        std::vector<const std::string*>           symbol_descriptions{};
+        std::vector<symbol_instance>              instances{};
+
+        const auto instantiate = [&symbol_ids, &symbol_descriptions, &instances](std::string&& description,
+                                                                                 const double x, const double y)
+        {
+            const auto [it, inserted] =
+                symbol_ids.try_emplace(std::move(description), static_cast<uint32_t>(symbol_descriptions.size()));
+
+            if (inserted)
             {
-                const auto clock_zone = lyt.get_clock_number(c);
-                const auto tile_coords =
-                    coordinate<Lyt>{std::ceil(c.x / lyt.get_tile_size_x()), std::ceil(c.y / lyt.get_tile_size_y())};
-                std::string current_cells{};
+                symbol_descriptions.push_back(&it->first);
+            }
 
-                bool is_sync_elem = false;
+            instances.push_back({it->second, x, y});
+        };
 
-                if constexpr (has_synchronization_elements_v<Lyt>)
-                {
-                    if (const auto latch_delay = lyt.get_synchronization_element(c); latch_delay > 0)
-                    {
-                        if (auto latch_it = coord_to_latch_cells.find(tile_coords);
-                            latch_it != coord_to_latch_cells.end())
-                        {
-                            current_cells = latch_it->second;
-                        }
-                        else
-                        {
-                            // If this is called then there is no tile for the current cell yet
-                            // It also makes sure that all required tiles are created
-                            coord_to_latch_tile[tile_coords] = {svg::LATCH, clock_zone,
-                                                                static_cast<uint32_t>(latch_delay)};
-                        }
+        const uint64_t tile_size_x = lyt.get_tile_size_x();
+        const uint64_t tile_size_y = lyt.get_tile_size_y();
 
-                        is_sync_elem = true;
-                    }
-                }
+        std::string cell_descriptions{};
+        std::string latch_cell_descriptions{};
 
-                if (!is_sync_elem)
-                {
-                    if (auto cell_it = coord_to_cells.find(tile_coords); cell_it != coord_to_cells.end())
-                    {
-                        current_cells = cell_it->second;
-                    }
-                    else
-                    {
-                        // If this is called, then there is no tile for the current cell yet
-                        // It also makes sure that all required tiles are created
-                        coord_to_tile[tile_coords] = {svg::TILE, clock_zone};
-                    }
-                }
+        for (uint64_t ty = 0; ty * tile_size_y <= lyt.y(); ++ty)
+        {
+            for (uint64_t tx = 0; tx * tile_size_x <= lyt.x(); ++tx)
+            {
+                cell_descriptions.clear();
+                latch_cell_descriptions.clear();
 
-                // Represent the x- and y-coordinates inside the c's tile
-                const coordinate<Lyt> in_tile{c.x % lyt.get_tile_size_x(), c.y % lyt.get_tile_size_y()};
+                const auto clock_zone = lyt.get_clock_number(cell<Lyt>{tx * tile_size_x, ty * tile_size_y});
 
-                // Determines cell type and color
-                const auto desc_col = generate_description_color(c);
+                bool                         has_cells       = false;
+                bool                         has_latch_cells = false;
+                typename Lyt::clock_number_t latch_zone{};
+                uint32_t                     latch_delay{0};
 
-                // Only add cell description if the cell is not empty
-                if (!(lyt.is_empty_cell(c)))
+                // ground layer first such that crossings are drawn on top
+                for (uint64_t z = 0; z <= lyt.z(); ++z)
                 {
-                    //  Current cell-description can now be appended to the description of all cells in the current tile
-                    if constexpr (has_synchronization_elements_v<Lyt>)
+                    for (uint64_t y = 0; y < tile_size_y && ty * tile_size_y + y <= lyt.y(); ++y)
                     {
-                        if (const auto latch_delay = lyt.get_synchronization_element(c); latch_delay > 0)
+                        for (uint64_t x = 0; x < tile_size_x && tx * tile_size_x + x <= lyt.x(); ++x)
                         {
-                            coord_to_latch_cells[tile_coords] = current_cells.append(
-                                fmt::format(desc_col.first, desc_col.second,
-                                            svg::STARTING_OFFSET_LATCH_CELL_X + in_tile.x * svg::CELL_DISTANCE,
-                                            svg::STARTING_OFFSET_LATCH_CELL_Y + in_tile.y * svg::CELL_DISTANCE));
+                            const cell<Lyt> c{tx * tile_size_x + x, ty * tile_size_y + y, z};
 
-                            is_sync_elem = true;
-                        }
-                    }
+                            if (lyt.is_empty_cell(c))
+                            {
+                                continue;
+                            }
 
-                    if (!is_sync_elem)
-                    {
-                        coord_to_cells[tile_coords] = current_cells.append(
-                            fmt::format(desc_col.first, desc_col.second,
-                                        svg::STARTING_OFFSET_CELL_X + in_tile.x * svg::CELL_DISTANCE,
-                                        svg::STARTING_OFFSET_CELL_Y + in_tile.y * svg::CELL_DISTANCE));
-                    }
-                }
-            });
+                            const auto desc_col = generate_description_color(c);
 
-        // All cell-descriptions are done and tiles have been created
+                            if constexpr (has_synchronization_elements_v<Lyt>)
+                            {
+                                if (const auto delay = lyt.get_synchronization_element(c); delay > 0)
+                                {
+                                    if (!has_latch_cells)
+                                    {
+                                        latch_zone  = lyt.get_clock_number(c);
+                                        latch_delay = static_cast<uint32_t>(delay);
+                                    }
 
-        // Delete empty tiles in simple designs
-        if (ps.simple)
-        {
-            std::vector<coordinate<Lyt>> empty_tiles{};
+                                    has_latch_cells = true;
 
-            // Find empty tiles via missing cell-descriptions for their coordinates
-            for (const auto& [coord, tdscr] : coord_to_tile)
-            {
-                if (coord_to_cells.count(coord) == 0)
-                {
-                    empty_tiles.emplace_back(coord);
-                }
-            }
+                                    latch_cell_descriptions.append(
+                                        fmt::format(desc_col.first, desc_col.second,
+                                                    svg::STARTING_OFFSET_LATCH_CELL_X + x * svg::CELL_DISTANCE,
+                                                    svg::STARTING_OFFSET_LATCH_CELL_Y + y * svg::CELL_DISTANCE));
 
-            // Delete empty tiles
-            for (const auto& coord : empty_tiles)
-            {
-                coord_to_tile.erase(coord);
-            }
+                                    continue;
+                                }
+                            }
 
-            if constexpr (has_synchronization_elements_v<Lyt>)
-            {
-                std::vector<coordinate<Lyt>> empty_latches{};
+                            has_cells = true;
 
-                // Find empty latches via missing cell-descriptions for their coordinates
-                for (const auto& [coord, ldscr] : coord_to_latch_tile)
-                {
-                    if (auto cell_it = coord_to_latch_cells.find(coord); cell_it == coord_to_latch_cells.end())
-                    {
-                        empty_latches.emplace_back(coord);
+                            cell_descriptions.append(fmt::format(desc_col.first, desc_col.second,
+                                                                 svg::STARTING_OFFSET_CELL_X + x * svg::CELL_DISTANCE,
+                                                                 svg::STARTING_OFFSET_CELL_Y + y * svg::CELL_DISTANCE));
+                        }
                     }
                 }
 
-                // Delete empty latches
-                for (const auto& coord : empty_latches)
+                // empty tiles are omitted in simple designs
+                if (has_cells || !ps.simple)
                 {
-                    coord_to_latch_tile.erase(coord);
+                    instantiate(fmt::format(svg::TILE, 0, 0, tile_colors[clock_zone], cell_descriptions,
+                                            ps.simple ? "" : text_colors[clock_zone],
+                                            ps.simple ? "" : std::to_string(clock_zone + 1)),
+                                svg::STARTING_OFFSET_TILE_X + static_cast<double>(tx) * svg::TILE_DISTANCE,
+                                svg::STARTING_OFFSET_TILE_Y + static_cast<double>(ty) * svg::TILE_DISTANCE);
+                }
+
+                if (has_latch_cells)
+                {
+                    const auto latch_zone_lo = latch_zone + latch_delay % lyt.num_clocks();
+
+                    instantiate(fmt::format(svg::LATCH, 0, 0, tile_colors[latch_zone_lo], tile_colors[latch_zone],
+                                            latch_cell_descriptions, text_colors[latch_zone],
+                                            ps.simple ? "" : std::to_string(latch_zone + 1), text_colors[latch_zone_lo],
+                                            ps.simple ? "" : std::to_string(latch_zone_lo + 1)),
+                                svg::STARTING_OFFSET_LATCH_X + static_cast<double>(tx) * svg::TILE_DISTANCE,
+                                svg::STARTING_OFFSET_LATCH_Y + static_cast<double>(ty) * svg::TILE_DISTANCE);
                 }
             }
         }
 
-        // Associate tiles with cell-descriptions now; coordinates of tiles are used for tile- and cell-descriptions
-        for (const auto& [coord, tdscr] : coord_to_tile)
-        {
-            const auto [descr, czone] = tdscr;
-
-            const auto cell_descriptions = coord_to_cells[coord];
+        std::vector<std::pair<std::string, std::string_view>> symbols{};
+        symbols.reserve(symbol_descriptions.size());
 
-            const double x_pos = svg::STARTING_OFFSET_TILE_X + coord.x * svg::TILE_DISTANCE;
-            const double y_pos = svg::STARTING_OFFSET_TILE_Y + coord.y * svg::TILE_DISTANCE;
-
-            const auto c_descr =
-                fmt::format(descr, x_pos, y_pos, tile_colors[czone], cell_descriptions,
-                            ps.simple ? "" : text_colors[czone], ps.simple ? "" : std::to_string(czone + 1));
-
-            tile_descriptions << c_descr;
-        }
-
-        if constexpr (has_synchronization_elements_v<Lyt>)
+        for (auto i = 0u; i < symbol_descriptions.size(); ++i)
         {
-            // Add the descriptions of latch-tiles to the whole image
-            for (const auto& [coord, ldscr] : coord_to_latch_tile)
-            {
-                const auto [descr, czone_up, latch_delay] = ldscr;
-                const auto czone_lo                       = czone_up + latch_delay % lyt.num_clocks();
-
-                const auto cell_descriptions = coord_to_latch_cells[coord];
-
-                const double x_pos = svg::STARTING_OFFSET_LATCH_X + coord.x * svg::TILE_DISTANCE;
-                const double y_pos = svg::STARTING_OFFSET_LATCH_Y + coord.y * svg::TILE_DISTANCE;
-
-                const auto t_descr =
-                    fmt::format(descr, x_pos, y_pos, tile_colors[czone_lo], tile_colors[czone_up], cell_descriptions,
-                                text_colors[czone_up], ps.simple ? "" : std::to_string(czone_up + 1),
-                                text_colors[czone_lo], ps.simple ? "" : std::to_string(czone_lo + 1));
-
-                tile_descriptions << t_descr;
-            }
+            symbols.emplace_back(fmt::format("t{}", i), *symbol_descriptions[i]);
         }
 
         const coordinate<Lyt> length = {(lyt.x() + 1) / lyt.get_tile_size_x(), (lyt.y() + 1) / lyt.get_tile_size_y()};
@@ -711,7 +741,14 @@ class write_qca_layout_svg_impl
         const double viewbox_x = 2 * svg::VIEWBOX_DISTANCE + length.x * svg::TILE_DISTANCE;
         const double viewbox_y = 2 * svg::VIEWBOX_DISTANCE + length.y * svg::TILE_DISTANCE;
 
-        os << fmt::format(svg::HEADER, FICTION_VERSION, FICTION_REPO, viewbox_x, viewbox_y, tile_descriptions.str());
+        write_header_and_symbols(viewbox_x, viewbox_y, symbols);
+
+        for (const auto& [symbol, x, y] : instances)
+        {
+            os << fmt::format(svg::USE, fmt::format("t{}", symbol), x, y);
+        }
+
+        os << svg::FOOTER;
     }
 };
 
@@ -724,6 +761,10 @@ class write_qca_layout_svg_impl
  * The utilized color scheme is based on the standard scheme used in QCADesigner
  * (https://waluslab.ece.ubc.ca/qcadesigner/).
  *
+ * The SVG is streamed into `os`. Identical tiles (or cells in cell-based layouts) are defined only once as a symbol in
+ * the SVG's `<defs>` section and instantiated via `<use>` elements. Hence, file size and memory consumption scale with
+ * the number of distinct tiles rather than with the number of cells.
+ *
  * May throw an `unsupported_cell_type_exception` if it encounters unsupported cell types in the layout.
  *
  * @tparam Lyt Cell-level QCA layout type.
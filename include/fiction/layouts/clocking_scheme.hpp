@@ -7,17 +7,21 @@
 
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
 
 #include <phmap.h>
 
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace fiction
@@ -44,6 +48,11 @@ class clocking_scheme
     using clock_number   = uint8_t;
     using degree         = uint8_t;
     using clock_function = std::function<clock_number(clock_zone)>;
+    /**
+     * Plain function pointer type that assigns a clock number to each clock zone. Unlike `clock_function`, calling it
+     * does not involve type erasure.
+     */
+    using clock_lookup = clock_number (*)(const clock_zone&);
 
     /**
      * Standard constructor.
@@ -54,15 +63,18 @@ class clocking_scheme
      * @param out_deg Maximum possible out-degree in the provided scheme.
      * @param cn Number of clock phases that make up one clock cycle, i.e., the number of different clock numbers.
      * @param r Flag to identify the scheme as regular.
+     * @param l Optional plain function that is equivalent to `f`. If provided, it is called instead of `f` to avoid the
+     * overhead of `std::function` on every clock number lookup.
      */
     explicit clocking_scheme(std::string_view n, clock_function f, const degree in_deg, const degree out_deg,
-                             const clock_number cn = 4, const bool r = true) noexcept :
+                             const clock_number cn = 4, const bool r = true, const clock_lookup l = nullptr) noexcept :
             name{std::move(n)},
             max_in_degree{in_deg},
             max_out_degree{out_deg},
             num_clocks{cn},
             regular{r},
-            fn{std::move(f)}
+            fn{std::move(f)},
+            lookup{l}
     {}
     /**
      * Accesses the clock function to determine the clock number of the given clock zone if the scheme is regular.
@@ -74,14 +86,17 @@ class clocking_scheme
      */
     clock_number operator()(clock_zone cz) const noexcept
     {
-        if (regular)
+        if (!regular)
         {
-            return std::invoke(fn, cz);
+            if (const auto* const cn = find_override(cz); cn != nullptr)
+            {
+                return *cn;
+            }
         }
 
-        if (const auto it = override.find(cz); it != override.cend())
+        if (lookup != nullptr)
         {
-            return it->second;
+            return lookup(cz);
         }
 
         return std::invoke(fn, cz);
@@ -116,7 +131,7 @@ class clocking_scheme
     {
         regular = false;
 
-        override[cz] = cn % num_clocks;
+        override.insert_or_assign(cz, static_cast<clock_number>(cn % num_clocks));
     }
     /**
      * Name of the clocking scheme.
@@ -145,13 +160,42 @@ class clocking_scheme
      */
     const clock_function fn;
     /**
-     * Alias for a hash map that overrides clock zones.
+     * A plain function equivalent to `fn` that is preferred if available.
+     */
+    const clock_lookup lookup;
+    /**
+     * Alias for a map that overrides clock zones. Clock zones that can be densely indexed are stored in a flat array,
+     * all others in a hash map.
      */
-    using clocking_map = phmap::parallel_flat_hash_map<clock_zone, clock_number>;
+    using clocking_map = std::conditional_t<is_densely_indexable_coordinate_v<clock_zone>,
+                                            dense_coordinate_map<clock_number>,
+                                            phmap::parallel_flat_hash_map<clock_zone, clock_number>>;
     /**
      * Stores mappings clock_zone -> clock_number to override clock zones.
      */
     clocking_map override{};
+    /**
+     * Looks up the overridden clock number of the given clock zone.
+     *
+     * @param cz Clock zone whose overridden clock number is desired.
+     * @return Pointer to the overridden clock number of `cz` or `nullptr` if `cz` has not been overridden.
+     */
+    [[nodiscard]] const clock_number* find_override(const clock_zone& cz) const noexcept
+    {
+        if constexpr (is_densely_indexable_coordinate_v<clock_zone>)
+        {
+            return override.find(cz);
+        }
+        else
+        {
+            if (const auto it = override.find(cz); it != override.cend())
+            {
+                return &it->second;
+            }
+
+            return nullptr;
+        }
+    }
 };
 
 namespace clock_name
@@ -184,6 +228,112 @@ enum class num_clks : uint8_t
 };
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsign-conversion"
+
+namespace detail
+{
+
+/**
+ * Cutout of a regular clocking scheme that is repeated in all directions. It is stored row by row.
+ *
+ * @tparam Rows Number of rows of the cutout.
+ * @tparam Columns Number of columns of the cutout.
+ */
+template <std::size_t Rows, std::size_t Columns>
+using clock_cutout = std::array<std::array<uint8_t, Columns>, Rows>;
+
+// clang-format off
+
+inline constexpr clock_cutout<3u, 3u> columnar_3_cutout{{{{0, 1, 2}},
+                                                         {{0, 1, 2}},
+                                                         {{0, 1, 2}}}};
+
+inline constexpr clock_cutout<4u, 4u> columnar_4_cutout{{{{0, 1, 2, 3}},
+                                                         {{0, 1, 2, 3}},
+                                                         {{0, 1, 2, 3}},
+                                                         {{0, 1, 2, 3}}}};
+
+inline constexpr clock_cutout<3u, 3u> row_3_cutout{{{{0, 0, 0}},
+                                                    {{1, 1, 1}},
+                                                    {{2, 2, 2}}}};
+
+inline constexpr clock_cutout<4u, 4u> row_4_cutout{{{{0, 0, 0, 0}},
+                                                    {{1, 1, 1, 1}},
+                                                    {{2, 2, 2, 2}},
+                                                    {{3, 3, 3, 3}}}};
+
+inline constexpr clock_cutout<3u, 3u> twoddwave_3_cutout{{{{0, 1, 2}},
+                                                          {{1, 2, 0}},
+                                                          {{2, 0, 1}}}};
+
+inline constexpr clock_cutout<4u, 4u> twoddwave_4_cutout{{{{0, 1, 2, 3}},
+                                                          {{1, 2, 3, 0}},
+                                                          {{2, 3, 0, 1}},
+                                                          {{3, 0, 1, 2}}}};
+
+inline constexpr clock_cutout<4u, 4u> use_cutout{{{{0, 1, 2, 3}},
+                                                  {{3, 2, 1, 0}},
+                                                  {{2, 3, 0, 1}},
+                                                  {{1, 0, 3, 2}}}};
+
+inline constexpr clock_cutout<4u, 4u> res_cutout{{{{3, 0, 1, 2}},
+                                                  {{0, 1, 0, 3}},
+                                                  {{1, 2, 3, 0}},
+                                                  {{0, 3, 2, 1}}}};
+
+inline constexpr clock_cutout<4u, 4u> esr_cutout{{{{3, 0, 1, 2}},
+                                                  {{0, 1, 2, 3}},
+                                                  {{1, 2, 3, 0}},
+                                                  {{0, 3, 2, 1}}}};
+
+inline constexpr clock_cutout<4u, 4u> cfe_cutout{{{{0, 1, 0, 1}},
+                                                  {{3, 2, 3, 2}},
+                                                  {{0, 1, 0, 1}},
+                                                  {{3, 2, 3, 2}}}};
+
+inline constexpr clock_cutout<4u, 4u> ripple_cutout{{{{0, 1, 2, 3}},
+                                                     {{3, 2, 1, 0}},
+                                                     {{0, 1, 2, 3}},
+                                                     {{3, 2, 1, 0}}}};
+
+inline constexpr clock_cutout<6u, 3u> bancs_cutout{{{{0, 1, 2}},
+                                                    {{2, 1, 0}},
+                                                    {{2, 0, 1}},
+                                                    {{1, 0, 2}},
+                                                    {{1, 2, 0}},
+                                                    {{0, 2, 1}}}};
+
+// clang-format on
+
+/**
+ * Determines the clock number of a clock zone by indexing the given cutout. Since the cutout and its dimensions are
+ * template parameters, each instantiation compiles to a branch-free table access with constant modulo operations.
+ *
+ * @tparam ClockZone Clock zone type.
+ * @tparam Rows Number of rows of the cutout.
+ * @tparam Columns Number of columns of the cutout.
+ * @tparam Cutout Cutout of the clocking scheme.
+ * @param cz Clock zone whose clock number is desired.
+ * @return Clock number of `cz`.
+ */
+template <typename ClockZone, std::size_t Rows, std::size_t Columns, const clock_cutout<Rows, Columns>& Cutout>
+constexpr uint8_t cutout_clock_number(const ClockZone& cz) noexcept
+{
+    return Cutout[cz.y % Rows][cz.x % Columns];
+}
+/**
+ * Assigns the standard clock number 0 to each clock zone.
+ *
+ * @tparam ClockZone Clock zone type.
+ * @return 0.
+ */
+template <typename ClockZone>
+constexpr uint8_t open_clock_number([[maybe_unused]] const ClockZone& cz) noexcept
+{
+    return 0;
+}
+
+}  // namespace detail
+
 /**
  * Returns an irregular clocking that maps every coordinate to the standard clock. It is intended to be overridden.
  *
@@ -194,26 +344,37 @@ enum class num_clks : uint8_t
 template <typename Lyt>
 static auto open_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function open_clock_function =
-        []([[maybe_unused]] const clock_zone<Lyt>& cz) noexcept
-    { return typename clocking_scheme<clock_zone<Lyt>>::clock_number{}; };
+    static constexpr auto open_clock_lookup = &detail::open_clock_number<clock_zone<Lyt>>;
+
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function open_clock_function = open_clock_lookup;
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::OPEN, open_clock_function, Lyt::max_fanin_size, Lyt::max_fanin_size, 3u, false};
+            return clocking_scheme{clock_name::OPEN,
+                                   open_clock_function,
+                                   Lyt::max_fanin_size,
+                                   Lyt::max_fanin_size,
+                                   3u,
+                                   false,
+                                   open_clock_lookup};
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::OPEN, open_clock_function, Lyt::max_fanin_size, Lyt::max_fanin_size, 4u, false};
+            return clocking_scheme{clock_name::OPEN,
+                                   open_clock_function,
+                                   Lyt::max_fanin_size,
+                                   Lyt::max_fanin_size,
+                                   4u,
+                                   false,
+                                   open_clock_lookup};
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{clock_name::OPEN, open_clock_function, Lyt::max_fanin_size, Lyt::max_fanin_size, 4u, false};
+    return clocking_scheme{
+        clock_name::OPEN, open_clock_function, Lyt::max_fanin_size, Lyt::max_fanin_size, 4u, false, open_clock_lookup};
 }
 /**
  * Returns a linear 1D clocking as originally introduced in \"A device architecture for computing with quantum dots\" by
@@ -226,41 +387,50 @@ static auto open_clocking(const num_clks& n = num_clks::FOUR) noexcept
 template <typename Lyt>
 static auto columnar_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
+    static constexpr auto columnar_3_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 3u, 3u, detail::columnar_3_cutout>;
+
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function columnar_3_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 1, 2}}, {{0, 1, 2}}, {{0, 1, 2}}}};
+        columnar_3_clock_lookup;
 
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    static constexpr auto columnar_4_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::columnar_4_cutout>;
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function columnar_4_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}}, {{0, 1, 2, 3}}, {{0, 1, 2, 3}}, {{0, 1, 2, 3}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+        columnar_4_clock_lookup;
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::COLUMNAR, columnar_3_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 3u, true};
+            return clocking_scheme{clock_name::COLUMNAR,
+                                   columnar_3_clock_function,
+                                   std::min(Lyt::max_fanin_size, 3u),
+                                   2u,
+                                   3u,
+                                   true,
+                                   columnar_3_clock_lookup};
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::COLUMNAR, columnar_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+            return clocking_scheme{clock_name::COLUMNAR,
+                                   columnar_4_clock_function,
+                                   std::min(Lyt::max_fanin_size, 3u),
+                                   2u,
+                                   4u,
+                                   true,
+                                   columnar_4_clock_lookup};
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{
-        clock_name::COLUMNAR, columnar_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+    return clocking_scheme{clock_name::COLUMNAR,
+                           columnar_4_clock_function,
+                           std::min(Lyt::max_fanin_size, 3u),
+                           2u,
+                           4u,
+                           true,
+                           columnar_4_clock_lookup};
 }
 /**
  * Returns a 90° rotated linear 1D clocking based on the one originally introduced in \"A device architecture for
@@ -273,40 +443,43 @@ static auto columnar_clocking(const num_clks& n = num_clks::FOUR) noexcept
 template <typename Lyt>
 static auto row_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_3_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 0, 0}}, {{1, 1, 1}}, {{2, 2, 2}}}};
+    static constexpr auto row_3_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 3u, 3u, detail::row_3_cutout>;
 
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_3_clock_function = row_3_clock_lookup;
 
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_4_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 0, 0, 0}}, {{1, 1, 1, 1}}, {{2, 2, 2, 2}}, {{3, 3, 3, 3}}}};
+    static constexpr auto row_4_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::row_4_cutout>;
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function row_4_clock_function = row_4_clock_lookup;
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::ROW, row_3_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 3u, true};
+            return clocking_scheme{clock_name::ROW,
+                                   row_3_clock_function,
+                                   std::min(Lyt::max_fanin_size, 3u),
+                                   2u,
+                                   3u,
+                                   true,
+                                   row_3_clock_lookup};
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::ROW, row_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+            return clocking_scheme{clock_name::ROW,
+                                   row_4_clock_function,
+                                   std::min(Lyt::max_fanin_size, 3u),
+                                   2u,
+                                   4u,
+                                   true,
+                                   row_4_clock_lookup};
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{clock_name::ROW, row_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true};
+    return clocking_scheme{
+        clock_name::ROW, row_4_clock_function, std::min(Lyt::max_fanin_size, 3u), 2u, 4u, true, row_4_clock_lookup};
 }
 /**
  * Returns the 2DDWave clocking as defined in \"Clocking and Cell Placement for QCA\" by V. Vankamamidi, M. Ottavi,
@@ -319,41 +492,50 @@ static auto row_clocking(const num_clks& n = num_clks::FOUR) noexcept
 template <typename Lyt>
 static auto twoddwave_clocking(const num_clks& n = num_clks::FOUR) noexcept
 {
+    static constexpr auto twoddwave_3_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 3u, 3u, detail::twoddwave_3_cutout>;
+
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function twoddwave_3_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 3u> cutout{
-            {{{0, 1, 2}}, {{1, 2, 0}}, {{2, 0, 1}}}};
+        twoddwave_3_clock_lookup;
 
-        return cutout[cz.y % 3ul][cz.x % 3ul];
-    };
+    static constexpr auto twoddwave_4_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::twoddwave_4_cutout>;
 
     static const typename clocking_scheme<clock_zone<Lyt>>::clock_function twoddwave_4_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}}, {{1, 2, 3, 0}}, {{2, 3, 0, 1}}, {{3, 0, 1, 2}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+        twoddwave_4_clock_lookup;
 
     switch (n)
     {
         case num_clks::THREE:
         {
-            return clocking_scheme{
-                clock_name::TWODDWAVE, twoddwave_3_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 3u, true};
+            return clocking_scheme{clock_name::TWODDWAVE,
+                                   twoddwave_3_clock_function,
+                                   std::min(Lyt::max_fanin_size, 2u),
+                                   2u,
+                                   3u,
+                                   true,
+                                   twoddwave_3_clock_lookup};
         }
         case num_clks::FOUR:
         {
-            return clocking_scheme{
-                clock_name::TWODDWAVE, twoddwave_4_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
+            return clocking_scheme{clock_name::TWODDWAVE,
+                                   twoddwave_4_clock_function,
+                                   std::min(Lyt::max_fanin_size, 2u),
+                                   2u,
+                                   4u,
+                                   true,
+                                   twoddwave_4_clock_lookup};
         }
     }
 
     // fix -Wreturn-type warning
-    return clocking_scheme{
-        clock_name::TWODDWAVE, twoddwave_4_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
+    return clocking_scheme{clock_name::TWODDWAVE,
+                           twoddwave_4_clock_function,
+                           std::min(Lyt::max_fanin_size, 2u),
+                           2u,
+                           4u,
+                           true,
+                           twoddwave_4_clock_lookup};
 }
 /**
  * Returns a hexagonal variation of the 2DDWave clocking as originally defined in \"Clocking and Cell Placement for
@@ -547,23 +729,12 @@ static auto twoddwave_hex_clocking(const num_clks& n = num_clks::FOUR) noexcept
 template <typename Lyt>
 static auto use_clocking() noexcept
 {
-    // clang-format off
-
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function use_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 2, 3}},
-             {{3, 2, 1, 0}},
-             {{2, 3, 0, 1}},
-             {{1, 0, 3, 2}}}};
+    static constexpr auto use_clock_lookup = &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::use_cutout>;
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function use_clock_function = use_clock_lookup;
 
-    return clocking_scheme{clock_name::USE, use_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true};
-
-    // clang-format on
+    return clocking_scheme{
+        clock_name::USE, use_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 4u, true, use_clock_lookup};
 }
 /**
  * Returns the RES clocking as defined in \"An efficient clocking scheme for quantum-dot cellular automata\" by
@@ -576,23 +747,12 @@ static auto use_clocking() noexcept
 template <typename Lyt>
 static auto res_clocking() noexcept
 {
-    // clang-format off
-
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function res_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{3, 0, 1, 2}},
-             {{0, 1, 0, 3}},
-             {{1, 2, 3, 0}},
-             {{0, 3, 2, 1}}}};
+    static constexpr auto res_clock_lookup = &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::res_cutout>;
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function res_clock_function = res_clock_lookup;
 
-    return clocking_scheme{clock_name::RES, res_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
-
-    // clang-format on
+    return clocking_scheme{
+        clock_name::RES, res_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true, res_clock_lookup};
 }
 /**
  * Returns the ESR clocking as defined in \"An efficient, scalable, regular clocking scheme based on quantum dot
@@ -605,23 +765,12 @@ static auto res_clocking() noexcept
 template <typename Lyt>
 static auto esr_clocking() noexcept
 {
-    // clang-format off
-
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function esr_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{3, 0, 1, 2}},
-             {{0, 1, 2, 3}},
-             {{1, 2, 3, 0}},
-             {{0, 3, 2, 1}}}};
-
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
+    static constexpr auto esr_clock_lookup = &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::esr_cutout>;
 
-    return clocking_scheme{clock_name::ESR, esr_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function esr_clock_function = esr_clock_lookup;
 
-    // clang-format on
+    return clocking_scheme{
+        clock_name::ESR, esr_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true, esr_clock_lookup};
 }
 /**
  * Returns the CFE clocking as defined in \"CFE: a convenient, flexible, and efficient clocking scheme for quantum-dot
@@ -634,23 +783,12 @@ static auto esr_clocking() noexcept
 template <typename Lyt>
 static auto cfe_clocking() noexcept
 {
-    // clang-format off
+    static constexpr auto cfe_clock_lookup = &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::cfe_cutout>;
 
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function cfe_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-            {{{0, 1, 0, 1}},
-             {{3, 2, 3, 2}},
-             {{0, 1, 0, 1}},
-             {{3, 2, 3, 2}}}};
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function cfe_clock_function = cfe_clock_lookup;
 
-        return cutout[cz.y % 4ul][cz.x % 4ul];
-    };
-
-    return clocking_scheme{clock_name::CFE, cfe_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
-
-    // clang-format on
+    return clocking_scheme{
+        clock_name::CFE, cfe_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true, cfe_clock_lookup};
 }
 /**
  * Returns the Ripple clocking as defined in \"Ripple Clock Schemes for Quantum-dot Cellular Automata Circuits\" by
@@ -662,23 +800,18 @@ static auto cfe_clocking() noexcept
 template <typename Lyt>
 static auto ripple_clocking() noexcept
 {
-    // clang-format off
-
-   static const typename clocking_scheme<clock_zone<Lyt>>::clock_function ripple_clock_function =
-       [](const clock_zone<Lyt>& cz) noexcept
-   {
-       static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 4u>, 4u> cutout{
-           {{{0, 1, 2, 3}},
-            {{3, 2, 1, 0}},
-            {{0, 1, 2, 3}},
-            {{3, 2, 1, 0}}}};
-
-       return cutout[cz.y % 4ul][cz.x % 4ul];
-   };
-
-   return clocking_scheme{clock_name::RIPPLE, ripple_clock_function, std::min(Lyt::max_fanin_size, 3u), 3u, 4u, true};
-
-    // clang-format on
+    static constexpr auto ripple_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 4u, 4u, detail::ripple_cutout>;
+
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function ripple_clock_function = ripple_clock_lookup;
+
+    return clocking_scheme{clock_name::RIPPLE,
+                           ripple_clock_function,
+                           std::min(Lyt::max_fanin_size, 3u),
+                           3u,
+                           4u,
+                           true,
+                           ripple_clock_lookup};
 }
 /**
  * Returns the BANCS clocking as defined in \"BANCS: Bidirectional Alternating Nanomagnetic Clocking Scheme\" by
@@ -690,25 +823,13 @@ static auto ripple_clocking() noexcept
 template <typename Lyt>
 static auto bancs_clocking() noexcept
 {
-    // clang-format off
+    static constexpr auto bancs_clock_lookup =
+        &detail::cutout_clock_number<clock_zone<Lyt>, 6u, 3u, detail::bancs_cutout>;
 
-    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function bancs_clock_function =
-        [](const clock_zone<Lyt>& cz) noexcept
-    {
-        static constexpr std::array<std::array<typename clocking_scheme<clock_zone<Lyt>>::clock_number, 3u>, 6u> cutout{
-            {{{0, 1, 2}},
-             {{2, 1, 0}},
-             {{2, 0, 1}},
-             {{1, 0, 2}},
-             {{1, 2, 0}},
-             {{0, 2, 1}}}};
-
-        return cutout[cz.y % 6ul][cz.x % 3ul];
-    };
-
-    return clocking_scheme{clock_name::BANCS, bancs_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 3u, true};
+    static const typename clocking_scheme<clock_zone<Lyt>>::clock_function bancs_clock_function = bancs_clock_lookup;
 
-    // clang-format on
+    return clocking_scheme{
+        clock_name::BANCS, bancs_clock_function, std::min(Lyt::max_fanin_size, 2u), 2u, 3u, true, bancs_clock_lookup};
 }
 #pragma GCC diagnostic pop
 /**
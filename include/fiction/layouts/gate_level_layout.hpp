@@ -22,6 +22,8 @@
 #include <phmap.h>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
@@ -71,6 +73,11 @@ namespace fiction
  * - nodes can be moved via the `move_node` function. This function can also be used to update their children, i.e.,
  * incoming signals.
  *
+ * - registered network events (see `events`) are invoked on every modification: `on_add` after each `create_...` call
+ * including `create_pi` and `create_po`, `on_modified` after each call to `move_node` and `connect` with the node's
+ * previous children, and `on_delete` before `clear_tile` removes a node. Moving a node invokes neither `on_delete` nor
+ * `on_add`.
+ *
  * Most implementation details regarding `mockturtle`-specific functions are borrowed from
  * `mockturtle/networks/klut.hpp`. Therefore, `mockturtle` API functions are only sporadically documented where their
  * behavior might differ. Information on their functionality can be found in `mockturtle`'s docs.
@@ -85,6 +92,105 @@ class gate_level_layout : public ClockedLayout
 
     using tile = typename ClockedLayout::clock_zone;
 
+    /**
+     * Entry of the optional fanout index (see `enable_fanout_index`) that is kept for each node. It stores the node's
+     * tile as well as all nodes that are connected to it as fanouts together with their tiles. Since most nodes in a
+     * layout have very few fanouts, the first ones are stored inline and only excess ones are spilled to the heap.
+     */
+    template <typename Node, typename Tile>
+    struct gate_level_layout_fanout_record
+    {
+        static constexpr std::size_t inline_capacity = 4u;  // NOLINT(*-identifier-naming)
+
+        using fanout_entry = std::pair<Node, Tile>;
+
+        Tile tile{};
+        bool placed{false};
+
+        uint8_t                                   num_inline{0};
+        std::array<fanout_entry, inline_capacity> inline_fanouts{};
+        std::vector<fanout_entry>                 spilled_fanouts{};
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return num_inline == 0;
+        }
+        /**
+         * Returns the fanout node that is placed on the given tile or `0` if there is none.
+         */
+        [[nodiscard]] Node fanout_at(const Tile& t) const noexcept
+        {
+            for (auto i = 0u; i < num_inline; ++i)
+            {
+                if (inline_fanouts[i].second == t)
+                {
+                    return inline_fanouts[i].first;
+                }
+            }
+            for (const auto& [n, nt] : spilled_fanouts)
+            {
+                if (nt == t)
+                {
+                    return n;
+                }
+            }
+
+            return 0;
+        }
+
+        void add(const Node n, const Tile& t)
+        {
+            const auto has_n = [&n](const auto& e) { return e.first == n; };
+
+            if (std::any_of(inline_fanouts.cbegin(), inline_fanouts.cbegin() + num_inline, has_n) ||
+                std::any_of(spilled_fanouts.cbegin(), spilled_fanouts.cend(), has_n))
+            {
+                return;
+            }
+
+            if (num_inline < inline_capacity)
+            {
+                inline_fanouts[num_inline++] = {n, t};
+            }
+            else
+            {
+                spilled_fanouts.emplace_back(n, t);
+            }
+        }
+
+        void remove(const Node n) noexcept
+        {
+            for (auto i = 0u; i < num_inline; ++i)
+            {
+                if (inline_fanouts[i].first == n)
+                {
+                    // refill the inline slot so that entries are only spilled if all inline ones are occupied
+                    if (!spilled_fanouts.empty())
+                    {
+                        inline_fanouts[i] = spilled_fanouts.back();
+                        spilled_fanouts.pop_back();
+                    }
+                    else
+                    {
+                        inline_fanouts[i] = inline_fanouts[--num_inline];
+                    }
+
+                    return;
+                }
+            }
+
+            spilled_fanouts.erase(std::remove_if(spilled_fanouts.begin(), spilled_fanouts.end(),
+                                                 [&n](const auto& e) { return e.first == n; }),
+                                  spilled_fanouts.end());
+        }
+
+        void clear() noexcept
+        {
+            num_inline = 0;
+            spilled_fanouts.clear();
+        }
+    };
+
     template <typename Node, typename Tile>
     struct gate_level_layout_storage_data
     {
@@ -109,6 +215,13 @@ class gate_level_layout : public ClockedLayout
 
         // usually quite a small map, use flat_hash_map
         phmap::flat_hash_map<Node, std::string> node_names{};
+
+        // optional fanout index, see enable_fanout_index
+        bool fanout_index = false;
+        // indexed by node
+        std::vector<gate_level_layout_fanout_record<Node, Tile>> fanout_records{};
+        // all placed nodes that have a given tile as a child; only accessed when the layout is modified
+        phmap::flat_hash_map<Tile, std::vector<Node>> tile_parents{};
     };
 
     /*! \brief gate-level layout node
@@ -253,6 +366,11 @@ class gate_level_layout : public ClockedLayout
         strg->data.node_names[n] = name.empty() ? fmt::format("pi{}", num_pis()) : name;
         assign_node(t, n);
 
+        for (auto const& fn : evnts->on_add)
+        {
+            (*fn)(n);
+        }
+
         return static_cast<signal>(t);
     }
 
@@ -269,6 +387,13 @@ class gate_level_layout : public ClockedLayout
         strg->nodes[get_node(s)].data[0].h1++;
         strg->nodes[n].children.push_back(s);
 
+        index_fanins(n);
+
+        for (auto const& fn : evnts->on_add)
+        {
+            (*fn)(n);
+        }
+
         return static_cast<signal>(t);
     }
 
@@ -648,6 +773,15 @@ class gate_level_layout : public ClockedLayout
      */
     [[nodiscard]] tile get_tile(const node n) const noexcept
     {
+        if (const auto* const record = fanout_record(n); record != nullptr)
+        {
+            return static_cast<tile>(record->tile);
+        }
+        if (has_fanout_index() && !is_constant(n))
+        {
+            return {};  // all placed nodes have a fanout record
+        }
+
         if (auto it = strg->data.node_tile_map.find(n); it != strg->data.node_tile_map.cend())
         {
             return static_cast<tile>(it->second);
@@ -679,7 +813,8 @@ class gate_level_layout : public ClockedLayout
         return static_cast<signal>(get_tile(n));
     }
     /**
-     * Moves a given node to a new position and also updates its children, i.e., incoming signals.
+     * Moves a given node to a new position and also updates its children, i.e., incoming signals. Afterward, all
+     * registered `on_modified` events are invoked with `n` and its previous children.
      *
      * @param n Node to move.
      * @param t Tile to move `n` to.
@@ -692,6 +827,10 @@ class gate_level_layout : public ClockedLayout
         const auto old_t = get_tile(n);
         // n's children
         auto& children = strg->nodes[n].children;
+        // store n's children for the modification events
+        const auto previous_children = children_for_events(n);
+        // remove n from the fanout index of its children
+        unindex_fanins(n);
         // decrease ref-count of children
         std::for_each(children.cbegin(), children.cend(),
                       [this](const auto& c) { strg->nodes[get_node(c.index)].data[0].h1--; });
@@ -708,8 +847,8 @@ class gate_level_layout : public ClockedLayout
                              static_cast<signal>(t));
             }
 
-            // clear n's position
-            clear_tile(old_t);
+            // clear n's position without invoking deletion events because n is not deleted but moved
+            unassign_tile(old_t);
             // assign n to its new position
             assign_node(t, n);
             // since clear_tile marks n as dead, it has to be revived
@@ -721,13 +860,21 @@ class gate_level_layout : public ClockedLayout
         // increase ref-count to new children
         std::for_each(new_children.cbegin(), new_children.cend(),
                       [this](const auto& nc) { strg->nodes[get_node(nc)].data[0].h1++; });
+        // add n to the fanout index of its new children
+        index_fanins(n);
+
+        for (auto const& fn : evnts->on_modified)
+        {
+            (*fn)(n, previous_children);
+        }
 
         return static_cast<signal>(t);
     }
     /**
      * Connects the given signal `s` to the given node `n` as a child. The new child `s` is appended at the end of `n`'s
      * list of children. Thus, if the order of children is important, `move_node()` should be used instead. Otherwise,
-     * this function has a smaller overhead and is to be preferred.
+     * this function has a smaller overhead and is to be preferred. Afterward, all registered `on_modified` events are
+     * invoked with `n` and its previous children.
      *
      * @param s New incoming signal to `n`.
      * @param n Node that should add `s` as its child.
@@ -737,7 +884,16 @@ class gate_level_layout : public ClockedLayout
     {
         if (!is_constant(n))
         {
+            const auto previous_children = children_for_events(n);
+
             strg->nodes[n].children.push_back(s);
+
+            index_fanin(n, s);
+
+            for (auto const& fn : evnts->on_modified)
+            {
+                (*fn)(n, previous_children);
+            }
         }
 
         return make_signal(n);
@@ -750,49 +906,24 @@ class gate_level_layout : public ClockedLayout
      * reduced if the tile to clear is an output tile. While this seems counter-intuitive and inconsistent, it is in
      * line with mockturtle's understanding of nodes and primary outputs.
      *
+     * Before the node is removed, all registered `on_delete` events are invoked with it.
+     *
      * @param t Tile whose nodes are to be removed.
      */
     void clear_tile(const tile& t) noexcept
     {
-        if (const auto it = strg->data.tile_node_map.find(static_cast<signal>(t)); it != strg->data.tile_node_map.end())
+        if (!evnts->on_delete.empty())
         {
-            const auto n = it->second;
-
-            if (!t.is_dead())
+            if (const auto n = get_node(t); !is_constant(n))
             {
-                // decrease wire count
-                if (is_wire(n))
-                {
-                    strg->data.num_wires--;
-
-                    // decrease crossing count
-                    if (ClockedLayout::is_crossing_layer(t) && !is_empty_tile(ClockedLayout::below(t)))
-                    {
-                        strg->data.num_crossings--;
-                    }
-
-                    // find PO entry and remove it if present
-                    if (const auto po_it =
-                            std::find_if(strg->outputs.cbegin(), strg->outputs.cend(),
-                                         [this, &n](const auto& p) { return this->get_node(p.index) == n; });
-                        po_it != strg->outputs.cend())
-                    {
-                        strg->outputs.erase(po_it);
-                    }
-                }
-                else  // decrease gate count
+                for (auto const& fn : evnts->on_delete)
                 {
-                    strg->data.num_gates--;
+                    (*fn)(n);
                 }
             }
-            // mark node as dead
-            kill_node(n);
-
-            // remove node-tile
-            strg->data.node_tile_map.erase(n);
-            // remove tile-node
-            strg->data.tile_node_map.erase(it);
         }
+
+        unassign_tile(t);
     }
     /**
      * Necessary function in the `mockturtle` API. However, in this layout type, signals cannot be complemented.
@@ -1121,9 +1252,17 @@ class gate_level_layout : public ClockedLayout
             return;
         }
 
+        // if available, the fanout index knows all fanouts and their tiles such that no lookups are required
+        const auto* const record = fanout_record(n);
+
+        if (record != nullptr && record->empty())
+        {
+            return;
+        }
+
         const auto nt = get_tile(n);
 
-        auto fanout_collector = [this, &fn, &nt](const auto& out_t)
+        auto fanout_collector = [this, &fn, &nt, record](const auto& out_t)
         {
             const auto apply_functor = [this, &fn](const auto& parent_t)
             {
@@ -1135,9 +1274,16 @@ class gate_level_layout : public ClockedLayout
                     std::forward<Fn>(fn));
             };
 
-            const auto apply_if_parent = [this, &nt, &apply_functor](const auto& adj_t)
+            const auto apply_if_parent = [this, &nt, &apply_functor, record](const auto& adj_t)
             {
-                if (const auto adj_n = get_node(adj_t); is_child(adj_n, static_cast<signal>(nt)))
+                if (record != nullptr)
+                {
+                    if (const auto adj_n = record->fanout_at(static_cast<signal>(adj_t)); adj_n != 0)
+                    {
+                        apply_functor(adj_n);
+                    }
+                }
+                else if (const auto adj_n = get_node(adj_t); is_child(adj_n, static_cast<signal>(nt)))
                 {
                     apply_functor(adj_n);
                 }
@@ -1621,6 +1767,71 @@ class gate_level_layout : public ClockedLayout
 
 #pragma endregion
 
+#pragma region Fanout index
+
+    /**
+     * Enables the fanout index of this layout and builds it from scratch. By default, fanouts are determined by looking
+     * up the nodes placed on all outgoing clock zones (+/- one layer to include crossings) of a given node and checking
+     * whether they have the node as a child. With the fanout index enabled, each node additionally keeps track of its
+     * tile and all of its fanouts and their tiles such that `get_tile`, `foreach_fanout`, `fanout_size`,
+     * `outgoing_data_flow`, etc. no longer require any hash map lookups. The index is updated on every call to
+     * `create_...`, `move_node`, `connect`, and `clear_tile` and is, thus, suited for algorithms that query fanouts
+     * much more frequently than they modify the layout.
+     *
+     * Enabling the fanout index does not alter the results of any of the layout's functions, including the order in
+     * which fanouts are visited. Since the index is part of the layout's storage, it is shared by all shallow copies
+     * and duplicated by `clone`.
+     */
+    void enable_fanout_index()
+    {
+        auto& data = strg->data;
+
+        data.fanout_index = true;
+        data.fanout_records.assign(strg->nodes.size(), {});
+        data.tile_parents.clear();
+
+        // first, register all placed nodes such that their fanouts can be assigned to them afterward
+        for (const auto& [n, t] : data.node_tile_map)
+        {
+            if (!is_constant(n))
+            {
+                data.fanout_records[n].tile   = t;
+                data.fanout_records[n].placed = true;
+            }
+        }
+
+        for (const auto& [n, t] : data.node_tile_map)
+        {
+            if (!is_constant(n))
+            {
+                index_fanins(n);
+            }
+        }
+    }
+    /**
+     * Disables the fanout index of this layout and frees its memory. Fanouts are determined via lookups afterward.
+     */
+    void disable_fanout_index() noexcept
+    {
+        auto& data = strg->data;
+
+        data.fanout_index = false;
+        data.fanout_records.clear();
+        data.fanout_records.shrink_to_fit();
+        data.tile_parents.clear();
+    }
+    /**
+     * Checks whether the fanout index of this layout is enabled.
+     *
+     * @return `true` iff `enable_fanout_index` was called and the index has not been disabled since.
+     */
+    [[nodiscard]] bool has_fanout_index() const noexcept
+    {
+        return strg->data.fanout_index;
+    }
+
+#pragma endregion
+
 #pragma region General methods
 
     auto& events() const
@@ -1681,6 +1892,8 @@ class gate_level_layout : public ClockedLayout
 
             strg->data.node_tile_map[n] = static_cast<signal>(t);
 
+            index_node(t, n);
+
             // keep track of number of gates and wire segments
             if (is_wire(n))
             {
@@ -1698,6 +1911,56 @@ class gate_level_layout : public ClockedLayout
         }
     }
 
+    /**
+     * Removes the node assigned to the given tile and marks it as dead without invoking any events.
+     *
+     * @param t Tile whose node is to be removed.
+     */
+    void unassign_tile(const tile& t) noexcept
+    {
+        if (const auto it = strg->data.tile_node_map.find(static_cast<signal>(t)); it != strg->data.tile_node_map.end())
+        {
+            const auto n = it->second;
+
+            if (!t.is_dead())
+            {
+                // decrease wire count
+                if (is_wire(n))
+                {
+                    strg->data.num_wires--;
+
+                    // decrease crossing count
+                    if (ClockedLayout::is_crossing_layer(t) && !is_empty_tile(ClockedLayout::below(t)))
+                    {
+                        strg->data.num_crossings--;
+                    }
+
+                    // find PO entry and remove it if present
+                    if (const auto po_it =
+                            std::find_if(strg->outputs.cbegin(), strg->outputs.cend(),
+                                         [this, &n](const auto& p) { return this->get_node(p.index) == n; });
+                        po_it != strg->outputs.cend())
+                    {
+                        strg->outputs.erase(po_it);
+                    }
+                }
+                else  // decrease gate count
+                {
+                    strg->data.num_gates--;
+                }
+            }
+            // remove node from the fanout index
+            unindex_node(n);
+            // mark node as dead
+            kill_node(n);
+
+            // remove node-tile
+            strg->data.node_tile_map.erase(n);
+            // remove tile-node
+            strg->data.tile_node_map.erase(it);
+        }
+    }
+
     void kill_node(const node n)
     {
         if (!is_constant(n))
@@ -1733,6 +1996,8 @@ class gate_level_layout : public ClockedLayout
 
         assign_node(t, n);
 
+        index_fanins(n);
+
         for (auto const& fn : evnts->on_add)
         {
             (*fn)(n);
@@ -1741,6 +2006,164 @@ class gate_level_layout : public ClockedLayout
         return static_cast<signal>(t);
     }
 
+    /**
+     * Returns the fanout record of the given node if the fanout index is enabled and the node is placed.
+     *
+     * @param n Node whose fanout record is desired.
+     * @return Pointer to `n`'s fanout record or `nullptr` if there is none.
+     */
+    [[nodiscard]] const gate_level_layout_fanout_record<node, signal>* fanout_record(const node n) const noexcept
+    {
+        if (const auto& data = strg->data; data.fanout_index && n < data.fanout_records.size())
+        {
+            if (const auto& record = data.fanout_records[n]; record.placed)
+            {
+                return &record;
+            }
+        }
+
+        return nullptr;
+    }
+    /**
+     * Registers node `n` on tile `t` in the fanout index and collects all placed nodes that have `t` as a child.
+     */
+    void index_node(const tile& t, const node n)
+    {
+        auto& data = strg->data;
+
+        if (!data.fanout_index || is_constant(n))
+        {
+            return;
+        }
+
+        if (data.fanout_records.size() < strg->nodes.size())
+        {
+            data.fanout_records.resize(strg->nodes.size());
+        }
+
+        auto& record = data.fanout_records[n];
+
+        record.tile   = static_cast<signal>(t);
+        record.placed = true;
+        record.clear();
+
+        if (const auto it = data.tile_parents.find(static_cast<signal>(t)); it != data.tile_parents.cend())
+        {
+            for (const auto p : it->second)
+            {
+                record.add(p, data.fanout_records[p].tile);
+            }
+        }
+    }
+    /**
+     * Removes node `n` from the fanout index, i.e., marks it as not placed and removes it from its children's fanouts.
+     */
+    void unindex_node(const node n) noexcept
+    {
+        if (fanout_record(n) == nullptr)
+        {
+            return;
+        }
+
+        unindex_fanins(n);
+
+        auto& record = strg->data.fanout_records[n];
+
+        record.placed = false;
+        record.clear();
+    }
+    /**
+     * Adds node `p` as a fanout to the node its child `c` points to if `p` is placed.
+     */
+    void index_fanin(const node p, const signal& c)
+    {
+        const auto* const record = fanout_record(p);
+
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        auto& parents = strg->data.tile_parents[c];
+
+        if (std::find(parents.cbegin(), parents.cend(), p) == parents.cend())
+        {
+            parents.push_back(p);
+        }
+
+        if (const auto cn = get_node(c); !is_constant(cn))
+        {
+            strg->data.fanout_records[cn].add(p, record->tile);
+        }
+    }
+    /**
+     * Adds node `p` as a fanout to the nodes all of its children point to.
+     */
+    void index_fanins(const node p)
+    {
+        if (fanout_record(p) == nullptr)
+        {
+            return;
+        }
+
+        for (const auto& c : strg->nodes[p].children)
+        {
+            index_fanin(p, c.index);
+        }
+    }
+    /**
+     * Removes node `p` as a fanout from the nodes all of its children point to.
+     */
+    void unindex_fanins(const node p) noexcept
+    {
+        if (fanout_record(p) == nullptr)
+        {
+            return;
+        }
+
+        auto& data = strg->data;
+
+        for (const auto& c : strg->nodes[p].children)
+        {
+            if (const auto it = data.tile_parents.find(c.index); it != data.tile_parents.end())
+            {
+                it->second.erase(std::remove(it->second.begin(), it->second.end(), p), it->second.end());
+
+                if (it->second.empty())
+                {
+                    data.tile_parents.erase(it);
+                }
+            }
+
+            if (const auto cn = get_node(c.index); !is_constant(cn))
+            {
+                data.fanout_records[cn].remove(p);
+            }
+        }
+    }
+
+    /**
+     * Returns a copy of `n`'s children if any `on_modified` events are registered that require them. Otherwise, an
+     * empty container is returned to avoid unnecessary allocations.
+     *
+     * @param n Node whose children are desired.
+     * @return `n`'s children if `on_modified` events are registered.
+     */
+    [[nodiscard]] std::vector<signal> children_for_events(const node n) const
+    {
+        std::vector<signal> children{};
+
+        if (!evnts->on_modified.empty())
+        {
+            const auto& node_data = strg->nodes[n];
+            children.reserve(node_data.children.size());
+            std::transform(node_data.children.cbegin(), node_data.children.cend(), std::back_inserter(children),
+                           [](const auto& c) { return static_cast<signal>(c.index); });
+        }
+
+        return children;
+    }
+
     [[nodiscard]] bool is_child(const node n, const signal& s) const noexcept
     {
         const auto& node_data = strg->nodes[n];
@@ -6,10 +6,12 @@
 #define FICTION_OBSTRUCTION_LAYOUT_HPP
 
 #include "fiction/traits.hpp"
+#include "fiction/utils/dense_coordinate_utils.hpp"
 #include "fiction/utils/hash.hpp"
 
 #include <phmap.h>
 
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -17,6 +19,23 @@
 namespace fiction
 {
 
+/**
+ * Storage backends for manually obstructed coordinates in `obstruction_layout`.
+ */
+enum class obstruction_storage : uint8_t
+{
+    /**
+     * Obstructed coordinates are stored in a hash set. Applicable to all coordinate types.
+     */
+    HASHED,
+    /**
+     * Obstructed coordinates are stored in a bit vector that is addressed by coordinate index. Only applicable to
+     * bounded layouts with unsigned offset coordinates (see `is_densely_indexable_coordinate_v`). Other coordinate
+     * types fall back to `HASHED`.
+     */
+    DENSE
+};
+
 /**
  * A layout type to layer on top of any coordinate layout. It implements a unified obstruction interface that determines
  * whether a coordinate is blocked by something. That could either be due to prior placement of cells, gates, and wires
@@ -24,6 +43,10 @@ namespace fiction
  *
  * Currently, this layout type supports obstruction rules for gate_level_layout and cell_level_layout.
  *
+ * Manually obstructed coordinates are kept in a hash set by default. For bounded layouts with unsigned offset
+ * coordinates, a dense bit vector can be selected instead (see `obstruction_storage`), which turns each obstruction
+ * query into a single bit lookup. This is beneficial for path finding, which queries obstructions in every expansion.
+ *
  * @tparam Lyt Any coordinate layout type that is to be extended by an obstruction interface.
  * @tparam has_obstruction_interface Automatically determines whether an obstruction interface is already present.
  */
@@ -36,7 +59,17 @@ template <typename Lyt>
 class obstruction_layout<Lyt, true> : public Lyt
 {
   public:
-    explicit obstruction_layout(const Lyt& lyt) : Lyt(lyt) {}
+    explicit obstruction_layout(const Lyt& lyt, [[maybe_unused]] const obstruction_storage strg_type = {}) : Lyt(lyt)
+    {}
+    /**
+     * Clones the layout returning a deep copy.
+     *
+     * @return Deep copy of the layout.
+     */
+    [[nodiscard]] obstruction_layout clone() const noexcept
+    {
+        return obstruction_layout{Lyt::clone()};
+    }
 };
 
 template <typename Lyt>
@@ -45,8 +78,20 @@ class obstruction_layout<Lyt, false> : public Lyt
   public:
     struct obstruction_layout_storage
     {
+        explicit obstruction_layout_storage(const obstruction_storage strg_type = obstruction_storage::HASHED) :
+                dense{is_densely_indexable_coordinate_v<typename Lyt::coordinate> &&
+                      strg_type == obstruction_storage::DENSE}
+        {}
+
+        /**
+         * Whether the dense bit vector or the hash set is used to store obstructed coordinates.
+         */
+        const bool dense;
+
         phmap::parallel_flat_hash_set<typename Lyt::coordinate> obstructed_coordinates{};
 
+        dense_coordinate_set dense_obstructed_coordinates{};
+
         phmap::parallel_flat_hash_set<std::pair<typename Lyt::coordinate, typename Lyt::coordinate>>
             obstructed_connections{};
     };
@@ -60,15 +105,41 @@ class obstruction_layout<Lyt, false> : public Lyt
     {
         static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
     }
+    /**
+     * Standard constructor for empty layouts that uses the given storage backend for obstructed coordinates.
+     *
+     * @param strg_type Storage backend for obstructed coordinates.
+     */
+    explicit obstruction_layout(const obstruction_storage strg_type) :
+            Lyt(),
+            obstr_strg{std::make_shared<obstruction_layout_storage>(strg_type)}
+    {
+        static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+    }
     /**
      * Standard constructor that layers the obstruction interface onto an existing layout.
      *
      * @param lyt Existing layout that is to be extended by an obstruction interface.
+     * @param strg_type Storage backend for obstructed coordinates.
      */
-    explicit obstruction_layout(const Lyt& lyt) : Lyt(lyt), obstr_strg{std::make_shared<obstruction_layout_storage>()}
+    explicit obstruction_layout(const Lyt& lyt, const obstruction_storage strg_type = obstruction_storage::HASHED) :
+            Lyt(lyt),
+            obstr_strg{std::make_shared<obstruction_layout_storage>(strg_type)}
     {
         static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
     }
+    /**
+     * Clones the layout returning a deep copy that includes all manually obstructed coordinates and connections.
+     *
+     * @return Deep copy of the layout.
+     */
+    [[nodiscard]] obstruction_layout clone() const noexcept
+    {
+        obstruction_layout copy{Lyt::clone()};
+        copy.obstr_strg = std::make_shared<obstruction_layout_storage>(*obstr_strg);
+
+        return copy;
+    }
     /**
      * Marks the given coordinate as obstructed.
      *
@@ -76,6 +147,15 @@ class obstruction_layout<Lyt, false> : public Lyt
      */
     void obstruct_coordinate(const typename Lyt::coordinate& c) noexcept
     {
+        if constexpr (is_densely_indexable_coordinate_v<typename Lyt::coordinate>)
+        {
+            if (obstr_strg->dense)
+            {
+                obstr_strg->dense_obstructed_coordinates.insert(c);
+                return;
+            }
+        }
+
         obstr_strg->obstructed_coordinates.insert(c);
     }
     /**
@@ -98,6 +178,15 @@ class obstruction_layout<Lyt, false> : public Lyt
      */
     void clear_obstructed_coordinate(const typename Lyt::coordinate& c) noexcept
     {
+        if constexpr (is_densely_indexable_coordinate_v<typename Lyt::coordinate>)
+        {
+            if (obstr_strg->dense)
+            {
+                obstr_strg->dense_obstructed_coordinates.erase(c);
+                return;
+            }
+        }
+
         obstr_strg->obstructed_coordinates.erase(c);
     }
     /**
@@ -117,6 +206,7 @@ class obstruction_layout<Lyt, false> : public Lyt
     void clear_obstructed_coordinates() noexcept
     {
         obstr_strg->obstructed_coordinates.clear();
+        obstr_strg->dense_obstructed_coordinates.clear();
     }
     /**
      * Clears all obstructed connections that were manually marked via `obstruct_connection`.
@@ -133,7 +223,7 @@ class obstruction_layout<Lyt, false> : public Lyt
      */
     [[nodiscard]] bool is_obstructed_coordinate(const typename Lyt::coordinate& c) const noexcept
     {
-        if (obstr_strg->obstructed_coordinates.count(c) > 0)
+        if (is_manually_obstructed_coordinate(c))
         {
             return true;
         }
@@ -160,7 +250,8 @@ class obstruction_layout<Lyt, false> : public Lyt
     [[nodiscard]] bool is_obstructed_connection(const typename Lyt::coordinate& src,
                                                 const typename Lyt::coordinate& tgt) const noexcept
     {
-        if (obstr_strg->obstructed_connections.count({src, tgt}) > 0)
+        // skip hashing entirely if no connection has been obstructed manually
+        if (!obstr_strg->obstructed_connections.empty() && obstr_strg->obstructed_connections.count({src, tgt}) > 0)
         {
             return true;
         }
@@ -177,11 +268,32 @@ class obstruction_layout<Lyt, false> : public Lyt
 
   private:
     storage obstr_strg;
+    /**
+     * Checks if the given coordinate has been marked as obstructed via `obstruct_coordinate`.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` has been obstructed manually.
+     */
+    [[nodiscard]] bool is_manually_obstructed_coordinate(const typename Lyt::coordinate& c) const noexcept
+    {
+        if constexpr (is_densely_indexable_coordinate_v<typename Lyt::coordinate>)
+        {
+            if (obstr_strg->dense)
+            {
+                return obstr_strg->dense_obstructed_coordinates.count(c) > 0;
+            }
+        }
+
+        return obstr_strg->obstructed_coordinates.count(c) > 0;
+    }
 };
 
 template <class T>
 obstruction_layout(const T&) -> obstruction_layout<T>;
 
+template <class T>
+obstruction_layout(const T&, const obstruction_storage) -> obstruction_layout<T>;
+
 }  // namespace fiction
 
 #endif  // FICTION_OBSTRUCTION_LAYOUT_HPP
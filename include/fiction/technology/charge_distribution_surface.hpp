@@ -9,12 +9,15 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/technology/physical_constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_defect_potential_field.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/technology/sidb_nm_distance.hpp"
 #include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/instrumentation.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cassert>
 #include <cmath>
@@ -220,9 +223,20 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          */
         potential_matrix pot_mat{};
         /**
-         * Electrostatic potential at each SiDB position which is generated by defects (unit: eV).
+         * Electrostatic potential at each SiDB position which is generated by defects. Corresponding cells are stored
+         * in `sidb_order`. It is empty as long as no defect was added (unit: V).
          */
-        std::unordered_map<typename Lyt::cell, double> defect_local_pot{};
+        local_potential defect_local_pot{};
+        /**
+         * Electrostatic interaction energy among all defects (unit: eV).
+         */
+        double defect_interaction_energy{0.0};
+        /**
+         * Potential field of the underlying defect surface from which `defect_local_pot` was derived. It is shared
+         * with all other charge distribution surfaces on the same defect surface and reset as soon as defects are
+         * added or erased individually.
+         */
+        std::shared_ptr<const sidb_defect_potential_field> defect_field{};
         /**
          * External electrostatic potential in V at each SiDB position (can be used when different potentials are
          * applied to different SiDBs).
@@ -292,6 +306,48 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          * True indicates that the dependent SiDB is in the sublayout.
          */
         bool dependent_cell_in_sub_layout{};
+        /**
+         * Symmetric matrix of the charge-less electrostatic potentials between all SiDBs within the interaction cutoff
+         * in compressed sparse row (CSR) format (unit: V).
+         */
+        struct sparse_potential_matrix
+        {
+            /**
+             * The entries of row `i` are stored at the positions `row_offsets[i]` to `row_offsets[i + 1] - 1`.
+             */
+            std::vector<uint64_t> row_offsets{};
+            /**
+             * Column, i.e., SiDB index of each entry. They are sorted in ascending order within each row.
+             */
+            std::vector<uint64_t> column_indices{};
+            /**
+             * Charge-less electrostatic potential of each entry (unit: V).
+             */
+            std::vector<double> potentials{};
+        };
+        /**
+         * If set, SiDBs only interact within this distance, and the sparse potential matrix is used instead of the
+         * dense distance and potential matrices (unit: nm).
+         */
+        std::optional<double> interaction_cutoff{};
+        /**
+         * Sparse potential matrix that is used if an interaction cutoff is set. It is shared among copies.
+         */
+        std::shared_ptr<const sparse_potential_matrix> sparse_pot_mat{};
+        /**
+         * Positions of the SiDBs if an interaction cutoff is set. Corresponding cells are stored in `sidb_order`
+         * (unit: nm).
+         */
+        std::vector<std::pair<double, double>> nm_positions{};
+        /**
+         * Upper bound on the error of the local electrostatic potential at any SiDB that is caused by the interaction
+         * cutoff (unit: V).
+         */
+        double local_potential_error_bound{0.0};
+        /**
+         * Upper bound on the error of the system energy that is caused by the interaction cutoff (unit: eV).
+         */
+        double system_energy_error_bound{0.0};
     };
 
     using storage = std::shared_ptr<charge_distribution_storage>;
@@ -400,6 +456,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         strg->max_charge_index =
             static_cast<uint64_t>(std::pow(strg->simulation_parameters.base, this->num_cells())) - 1;
         this->initialize_potential_matrix();
+        this->update_defect_interaction_energy();
         this->update_local_potential();
         this->recompute_system_energy();
         this->validity_check();
@@ -413,6 +470,77 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         return strg->simulation_parameters;
     }
+    /**
+     * This function restricts the electrostatic interaction between SiDBs to the given cutoff radius. Since the
+     * screened Coulomb potential decays exponentially with the Thomas-Fermi screening length, interactions beyond a few
+     * screening lengths are negligible. With a cutoff, only the interactions between SiDBs within the cutoff radius are
+     * stored in a sparse matrix, which reduces memory and the time per potential update from quadratic to linear in
+     * the number of SiDBs for layouts of bounded density. The error that is caused by the cutoff is bounded (see
+     * `get_local_potential_error_bound` and `get_system_energy_error_bound`).
+     *
+     * All important attributes of the charge layout are updated automatically.
+     *
+     * @param cutoff_radius Interaction cutoff radius, which has to be positive. `std::nullopt` restores the dense
+     * interaction of all SiDB pairs (unit: nm).
+     */
+    void assign_interaction_cutoff(const std::optional<double>& cutoff_radius) noexcept
+    {
+        assert((!cutoff_radius.has_value() || *cutoff_radius > 0.0) && "the cutoff radius has to be positive");
+
+        strg->interaction_cutoff = cutoff_radius;
+
+        if (!cutoff_radius.has_value())
+        {
+            strg->sparse_pot_mat.reset();
+            strg->nm_positions                = {};
+            strg->local_potential_error_bound = 0.0;
+            strg->system_energy_error_bound   = 0.0;
+
+            this->initialize_nm_distance_matrix();
+        }
+
+        this->initialize_potential_matrix();
+        // the surface might have been created without its electrostatics, i.e., without the defect potentials
+        if constexpr (is_sidb_defect_surface_v<Lyt>)
+        {
+            if (strg->defect_local_pot.empty())
+            {
+                this->initialize_defect_potentials();
+            }
+        }
+        this->update_local_potential();
+        this->recompute_system_energy();
+        this->validity_check();
+    }
+    /**
+     * This function returns the interaction cutoff radius.
+     *
+     * @return Interaction cutoff radius if one is set, `std::nullopt` otherwise (unit: nm).
+     */
+    [[nodiscard]] std::optional<double> get_interaction_cutoff() const noexcept
+    {
+        return strg->interaction_cutoff;
+    }
+    /**
+     * This function returns an upper bound on the deviation of the local electrostatic potential at any SiDB from its
+     * value without interaction cutoff. It is 0 if no cutoff is set.
+     *
+     * @return Upper bound on the local electrostatic potential error (unit: V).
+     */
+    [[nodiscard]] double get_local_potential_error_bound() const noexcept
+    {
+        return strg->local_potential_error_bound;
+    }
+    /**
+     * This function returns an upper bound on the deviation of the system energy of any charge distribution from its
+     * value without interaction cutoff. It is 0 if no cutoff is set.
+     *
+     * @return Upper bound on the system energy error (unit: eV).
+     */
+    [[nodiscard]] double get_system_energy_error_bound() const noexcept
+    {
+        return strg->system_energy_error_bound;
+    }
 
     /**
      * This function checks if any SiDB exhibits the given charge state.
@@ -539,41 +667,40 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         if (std::find(strg->sidb_order.cbegin(), strg->sidb_order.cend(), c) == strg->sidb_order.end() &&
             is_charged_defect_type(defect))
         {
-            // check if defect was not added yet.
-            if (strg->defects.find(c) == strg->defects.end())
+            if (strg->defect_local_pot.empty())
             {
-                strg->defects.insert({c, defect});
-                this->foreach_cell(
-                    [this, &c, &defect](const auto& c1)
-                    {
-                        const auto dist = sidb_nm_distance<Lyt>(*this, c1, c);
-                        const auto pot  = chargeless_potential_generated_by_defect_at_given_distance(dist, defect);
+                strg->defect_local_pot.assign(strg->sidb_order.size(), 0.0);
+            }
 
-                        strg->defect_local_pot[c1] += pot * static_cast<double>(defect.charge);
-                    });
+            // a defect that was already added at this position is replaced
+            const auto previous = strg->defects.find(c);
 
-                this->update_after_charge_change(dependent_cell_mode::FIXED);
-            }
-            else
+            for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
             {
-                Lyt::foreach_cell(
-                    [this, &c, &defect](const auto& c1)
-                    {
-                        const auto dist = sidb_nm_distance<Lyt>(*this, c1, c);
+                const auto dist = sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], c);
 
-                        strg->defect_local_pot[c1] =
-                            strg->defect_local_pot[c1] +
-                            chargeless_potential_generated_by_defect_at_given_distance(dist, defect) *
-                                static_cast<double>(defect.charge) -
-                            chargeless_potential_generated_by_defect_at_given_distance(dist, strg->defects[c]) *
-                                static_cast<double>(strg->defects[c].charge);
-                    });
+                strg->defect_local_pot[i] += chargeless_potential_generated_by_defect_at_given_distance(dist, defect) *
+                                             static_cast<double>(defect.charge);
 
-                strg->defects.erase(c);
-                strg->defects.insert({c, defect});
+                if (previous != strg->defects.cend())
+                {
+                    strg->defect_local_pot[i] -=
+                        chargeless_potential_generated_by_defect_at_given_distance(dist, previous->second) *
+                        static_cast<double>(previous->second.charge);
+                }
+            }
 
-                this->update_after_charge_change(dependent_cell_mode::FIXED);
+            if (previous != strg->defects.cend())
+            {
+                strg->defects.erase(previous);
             }
+            strg->defects.insert({c, defect});
+
+            // the defect potentials no longer correspond to the defect surface
+            strg->defect_field.reset();
+            this->update_defect_interaction_energy();
+
+            this->update_after_charge_change(dependent_cell_mode::FIXED);
         }
     }
     /**
@@ -583,20 +710,22 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     void erase_defect(const typename Lyt::cell& c) noexcept
     {
-        if (strg->defects.find(c) != strg->defects.cend())
+        if (const auto it = strg->defects.find(c); it != strg->defects.cend())
         {
-            this->foreach_cell(
-                [this, &c](const auto& c1)
-                {
-                    strg->local_pot[static_cast<uint64_t>(cell_to_index(c1))] -=
-                        chargeless_potential_generated_by_defect_at_given_distance(sidb_nm_distance<Lyt>(*this, c1, c),
-                                                                                   strg->defects[c]) *
-                        static_cast<double>(strg->defects[c].charge);
-                    strg->defect_local_pot[c1] -= chargeless_potential_generated_by_defect_at_given_distance(
-                                                      sidb_nm_distance<Lyt>(*this, c1, c), strg->defects[c]) *
-                                                  static_cast<double>(strg->defects[c].charge);
-                });
-            strg->defects.erase(c);
+            for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+            {
+                const auto pot = chargeless_potential_generated_by_defect_at_given_distance(
+                                     sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], c), it->second) *
+                                 static_cast<double>(it->second.charge);
+
+                strg->local_pot[i] -= pot;
+                strg->defect_local_pot[i] -= pot;
+            }
+
+            strg->defects.erase(it);
+
+            strg->defect_field.reset();
+            this->update_defect_interaction_energy();
         }
     }
     /**
@@ -694,7 +823,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->nm_dist_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return get_nm_distance_by_indices(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2));
         }
 
         return 0.0;
@@ -709,6 +838,12 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] double get_nm_distance_by_indices(const uint64_t index1, const uint64_t index2) const noexcept
     {
+        if (strg->interaction_cutoff.has_value())
+        {
+            return std::hypot(strg->nm_positions[index1].first - strg->nm_positions[index2].first,
+                              strg->nm_positions[index1].second - strg->nm_positions[index2].second);
+        }
+
         return strg->nm_dist_mat[index1][index2];
     }
     /**
@@ -724,14 +859,15 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         assert(strg->simulation_parameters.lambda_tf > 0.0 && "lambda_tf has to be > 0.0");
 
-        if (strg->nm_dist_mat[index1][index2] == 0.0)
+        const auto distance = get_nm_distance_by_indices(index1, index2);
+
+        if (distance == 0.0)
         {
             return 0.0;
         }
 
-        return (strg->simulation_parameters.k() / (strg->nm_dist_mat[index1][index2] * 1E-9) *
-                std::exp(-strg->nm_dist_mat[index1][index2] / strg->simulation_parameters.lambda_tf) *
-                physical_constants::ELEMENTARY_CHARGE);
+        return (strg->simulation_parameters.k() / (distance * 1E-9) *
+                std::exp(-distance / strg->simulation_parameters.lambda_tf) * physical_constants::ELEMENTARY_CHARGE);
     }
     /**
      * This function calculates and returns the chargeless potential in Volt of a pair of cells based on their distance
@@ -764,7 +900,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return get_chargeless_potential_by_indices(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2));
         }
 
         return 0.0;
@@ -779,6 +915,21 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] double get_chargeless_potential_by_indices(const uint64_t index1,
                                                              const uint64_t index2) const noexcept
     {
+        if (strg->sparse_pot_mat != nullptr)
+        {
+            const auto& mat   = *strg->sparse_pot_mat;
+            const auto  first = mat.column_indices.cbegin() + static_cast<int64_t>(mat.row_offsets[index1]);
+            const auto  last  = mat.column_indices.cbegin() + static_cast<int64_t>(mat.row_offsets[index1 + 1]);
+
+            if (const auto it = std::lower_bound(first, last, index2); it != last && *it == index2)
+            {
+                return mat.potentials[static_cast<uint64_t>(std::distance(mat.column_indices.cbegin(), it))];
+            }
+
+            // SiDBs beyond the interaction cutoff do not interact
+            return 0.0;
+        }
+
         return strg->pot_mat[index1][index2];
     }
     /**
@@ -797,7 +948,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)] *
+            return get_chargeless_potential_by_indices(static_cast<uint64_t>(index1), static_cast<uint64_t>(index2)) *
                    charge_state_to_sign(get_charge_state(c2));
         }
 
@@ -816,22 +967,23 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (history_mode == charge_distribution_history::NEGLECT)
         {
+            FICTION_PROFILE_COUNT("charge_distribution_surface: full potential updates", 1);
+
             strg->local_pot.resize(this->num_cells(), 0);
 
             for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
             {
                 double collect = 0.0;
-                for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                {
-                    collect += strg->pot_mat[i][j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
-                }
+                foreach_interaction(
+                    i, [this, &collect](const uint64_t j, const double pot)
+                    { collect += pot * static_cast<double>(charge_state_to_sign(strg->cell_charge[j])); });
 
                 strg->local_pot[i] = collect;
             }
 
-            for (const auto& [c, defect_pot] : strg->defect_local_pot)
+            for (uint64_t i = 0u; i < strg->defect_local_pot.size(); ++i)
             {
-                strg->local_pot[static_cast<uint64_t>(cell_to_index(c))] += defect_pot;
+                strg->local_pot[i] += strg->defect_local_pot[i];
             }
 
             for (const auto& [c, external_pot] : strg->local_external_pot)
@@ -841,6 +993,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
         else
         {
+            FICTION_PROFILE_COUNT("charge_distribution_surface: incremental potential updates", 1);
+
             if (strg->simulation_parameters.base == 2)
             {
                 if (strg->cell_history_gray_code.first != -1)
@@ -848,23 +1002,22 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                     const auto cell_charge = charge_state_to_sign(
                         strg->cell_charge[static_cast<uint64_t>(strg->cell_history_gray_code.first)]);
                     const auto charge_diff = static_cast<double>(cell_charge - strg->cell_history_gray_code.second);
-                    for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                    {
-                        strg->local_pot[j] +=
-                            strg->pot_mat[static_cast<uint64_t>(strg->cell_history_gray_code.first)][j] * charge_diff;
-                    }
+                    foreach_interaction(static_cast<uint64_t>(strg->cell_history_gray_code.first),
+                                        [this, &charge_diff](const uint64_t j, const double pot)
+                                        { strg->local_pot[j] += pot * charge_diff; });
                 }
             }
             else
             {
+                FICTION_PROFILE_HISTOGRAM("charge_distribution_surface: changed SiDBs per incremental update",
+                                          strg->cell_history.size());
+
                 for (const auto& [changed_cell, charge] : strg->cell_history)
                 {
-                    for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-                    {
-                        strg->local_pot[j] +=
-                            strg->pot_mat[changed_cell][j] *
-                            (static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge);
-                    }
+                    const auto charge_diff =
+                        static_cast<double>(charge_state_to_sign(strg->cell_charge[changed_cell])) - charge;
+                    foreach_interaction(changed_cell, [this, &charge_diff](const uint64_t j, const double pot)
+                                        { strg->local_pot[j] += pot * charge_diff; });
                 }
             }
         }
@@ -923,23 +1076,13 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
 
         double defect_energy = 0;
-        for (const auto& [c, pot] : strg->defect_local_pot)
+        for (uint64_t i = 0; i < strg->defect_local_pot.size(); ++i)
         {
             defect_energy +=
-                pot *
-                static_cast<double>(charge_state_to_sign(strg->cell_charge[static_cast<uint64_t>(cell_to_index(c))]));
+                strg->defect_local_pot[i] * static_cast<double>(charge_state_to_sign(strg->cell_charge[i]));
         }
 
-        double defect_interaction = 0;
-        for (const auto& [cell1, defect1] : strg->defects)
-        {
-            for (const auto& [cell2, defect2] : strg->defects)
-            {
-                defect_interaction +=
-                    chargeless_potential_at_given_distance(sidb_nm_distance<Lyt>(*this, cell1, cell2));
-            }
-        }
-        strg->system_energy = total_potential + 0.5 * defect_energy + 0.5 * defect_interaction;
+        strg->system_energy = total_potential + 0.5 * defect_energy + 0.5 * strg->defect_interaction_energy;
     }
     /**
      * This function returns the currently stored system's total electrostatic potential energy in eV.
@@ -1006,9 +1149,14 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             }
         }
 
-        if ((population_stability_not_fulfilled_counter == 0) &&
-            (for_loop_counter >
-             0))  // if population stability is fulfilled for all SiDBs, the "configuration stability" is checked.
+        if ((population_stability_not_fulfilled_counter == 0) && (for_loop_counter > 0) &&
+            strg->sparse_pot_mat != nullptr)
+        {
+            strg->validity = !sparse_energetically_favored_hop_exists();
+        }
+        else if ((population_stability_not_fulfilled_counter == 0) &&
+                 (for_loop_counter >
+                  0))  // if population stability is fulfilled for all SiDBs, the "configuration stability" is checked.
         {
             const auto hop_del =
                 [this](const uint64_t c1, const uint64_t c2)  // energy change when charge hops between two SiDBs.
@@ -1256,6 +1404,21 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      * @param negative_indices Vector of SiDBs indices that are already negatively charged (double occupied).
      */
     void adjacent_search(const double alpha, std::vector<uint64_t>& negative_indices) noexcept
+    {
+        static thread_local std::mt19937_64 generator(std::random_device{}());
+
+        adjacent_search(alpha, negative_indices, generator);
+    }
+    /**
+     * Same as `adjacent_search` above but draws the selected SiDB from the given random number generator, which allows
+     * reproducible *QuickSim* runs.
+     *
+     * @param alpha A parameter for the algorithm (default: 0.7).
+     * @param negative_indices Vector of SiDBs indices that are already negatively charged (double occupied).
+     * @param generator Random number generator used to select among equally distant SiDBs.
+     */
+    void adjacent_search(const double alpha, std::vector<uint64_t>& negative_indices,
+                         std::mt19937_64& generator) noexcept
     {
         double     dist_max     = 0.0;
         const auto reserve_size = this->num_cells() - negative_indices.size();
@@ -1299,7 +1462,6 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         if (!candidates.empty())
         {
-            static std::mt19937_64                  generator(std::random_device{}());
             std::uniform_int_distribution<uint64_t> dist(0, candidates.size() - 1);
             const auto                              random_element = index_vector[candidates[dist(generator)]];
             strg->cell_charge[random_element]                      = sidb_charge_state::NEGATIVE;
@@ -1307,10 +1469,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
             strg->system_energy += -(*this->get_local_potential_by_index(random_element));
 
-            for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-            {
-                strg->local_pot[i] += -(this->get_chargeless_potential_by_indices(i, random_element));
-            }
+            foreach_interaction(random_element,
+                                [this](const uint64_t i, const double pot) { strg->local_pot[i] += -pot; });
         }
     }
     /**
@@ -1605,7 +1765,15 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     std::unordered_map<typename Lyt::cell, double> get_local_defect_potentials() noexcept
     {
-        return strg->defect_local_pot;
+        std::unordered_map<typename Lyt::cell, double> defect_potentials{};
+        defect_potentials.reserve(strg->defect_local_pot.size());
+
+        for (uint64_t i = 0u; i < strg->defect_local_pot.size(); ++i)
+        {
+            defect_potentials.emplace(strg->sidb_order[i], strg->defect_local_pot[i]);
+        }
+
+        return defect_potentials;
     }
     /**
      * This function returns the defects.
@@ -1631,15 +1799,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                 if (strg->cell_charge[strg->dependent_cell_index] != sidb_charge_state::NEGATIVE)
                 {
                     const auto charge_diff = (-charge_state_to_sign(strg->cell_charge[strg->dependent_cell_index]) - 1);
-                    for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-                    {
-                        if (i != strg->dependent_cell_index)
-                        {
-                            strg->local_pot[i] +=
-                                (this->get_chargeless_potential_by_indices(i, strg->dependent_cell_index)) *
-                                charge_diff;
-                        }
-                    }
+                    this->update_local_potential_after_dependent_cell_change(charge_diff);
                     strg->cell_charge[strg->dependent_cell_index] = sidb_charge_state::NEGATIVE;
                 }
             }
@@ -1654,15 +1814,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                         const auto charge_diff =
                             (-charge_state_to_sign(strg->cell_charge[strg->dependent_cell_index]) + 1);
                         strg->cell_charge[strg->dependent_cell_index] = sidb_charge_state::POSITIVE;
-                        for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-                        {
-                            if (i != strg->dependent_cell_index)
-                            {
-                                strg->local_pot[i] +=
-                                    (this->get_chargeless_potential_by_indices(i, strg->dependent_cell_index)) *
-                                    charge_diff;
-                            }
-                        }
+                        this->update_local_potential_after_dependent_cell_change(charge_diff);
                     }
                 }
             }
@@ -1672,15 +1824,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                 if (strg->cell_charge[strg->dependent_cell_index] != sidb_charge_state::NEUTRAL)
                 {
                     const auto charge_diff = (-charge_state_to_sign(strg->cell_charge[strg->dependent_cell_index]));
-                    for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-                    {
-                        if (i != strg->dependent_cell_index)
-                        {
-                            strg->local_pot[i] +=
-                                (this->get_chargeless_potential_by_indices(i, strg->dependent_cell_index)) *
-                                charge_diff;
-                        }
-                    }
+                    this->update_local_potential_after_dependent_cell_change(charge_diff);
                     strg->cell_charge[strg->dependent_cell_index] = sidb_charge_state::NEUTRAL;
                 }
             }
@@ -1899,8 +2043,10 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                const cds_configuration configuration = cds_configuration::CHARGE_LOCATION_AND_ELECTROSTATIC) noexcept
     {
         const auto param_copy       = strg->simulation_parameters;
+        const auto cutoff_copy      = strg->interaction_cutoff;
         strg                        = std::make_shared<charge_distribution_storage>();
         strg->simulation_parameters = param_copy;
+        strg->interaction_cutoff    = cutoff_copy;
         strg->sidb_order.reserve(this->num_cells());
         strg->cell_charge.reserve(this->num_cells());
         this->foreach_cell([this](const auto& c1) { strg->sidb_order.push_back(c1); });
@@ -1915,18 +2061,111 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         if (configuration == cds_configuration::CHARGE_LOCATION_AND_ELECTROSTATIC)
         {
-            this->initialize_nm_distance_matrix();
+            if (!strg->interaction_cutoff.has_value())
+            {
+                this->initialize_nm_distance_matrix();
+            }
             this->initialize_potential_matrix();
             if constexpr (is_sidb_defect_surface_v<Lyt>)
             {
-                Lyt::foreach_sidb_defect([this](const auto cd)
-                                         { add_sidb_defect_to_potential_landscape(cd.first, cd.second); });
+                this->initialize_defect_potentials();
             }
             this->update_local_potential();
             this->recompute_system_energy();
             this->validity_check();
         }
     };
+    /**
+     * Initializes the electrostatic potentials generated by the defects of the underlying defect surface at all SiDB
+     * positions at once. If no charged defect is placed on an SiDB position, the precomputed potential field of the
+     * defect surface is evaluated such that it is shared with all other charge distribution surfaces on the same
+     * surface. Otherwise, the contributions of the defects are summed directly.
+     */
+    void initialize_defect_potentials() noexcept
+    {
+        bool defect_on_sidb = false;
+
+        Lyt::foreach_sidb_defect(
+            [this, &defect_on_sidb](const auto& cd)
+            {
+                if (is_charged_defect_type(cd.second))
+                {
+                    if (std::find(strg->sidb_order.cbegin(), strg->sidb_order.cend(), cd.first) !=
+                        strg->sidb_order.cend())
+                    {
+                        // defects on SiDB positions are not considered
+                        defect_on_sidb = true;
+                    }
+                    else
+                    {
+                        strg->defects.insert({cd.first, cd.second});
+                    }
+                }
+            });
+
+        if (strg->defects.empty())
+        {
+            return;
+        }
+
+        strg->defect_local_pot.assign(strg->sidb_order.size(), 0.0);
+
+        // the defect surface determines the defect positions on the H-Si(100)-2x1 surface by default
+        if constexpr (has_defect_potential_field_v<Lyt> && !is_sidb_lattice_111_v<Lyt>)
+        {
+            if (!defect_on_sidb)
+            {
+                strg->defect_field = Lyt::defect_potential_field();
+
+                for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+                {
+                    strg->defect_local_pot[i] =
+                        strg->defect_field->potential_at(sidb_nm_position<Lyt>(*this, strg->sidb_order[i]));
+                }
+            }
+        }
+
+        if (strg->defect_field == nullptr)
+        {
+            for (const auto& [c, defect] : strg->defects)
+            {
+                for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+                {
+                    strg->defect_local_pot[i] += chargeless_potential_generated_by_defect_at_given_distance(
+                                                     sidb_nm_distance<Lyt>(*this, strg->sidb_order[i], c), defect) *
+                                                 static_cast<double>(defect.charge);
+                }
+            }
+        }
+
+        this->update_defect_interaction_energy();
+    }
+    /**
+     * Updates the electrostatic interaction energy among all defects. It is taken from the memoized values of the
+     * defect potential field if possible.
+     */
+    void update_defect_interaction_energy() noexcept
+    {
+        if (strg->defect_field != nullptr)
+        {
+            strg->defect_interaction_energy = strg->defect_field->interaction_energy(
+                strg->simulation_parameters.k(), strg->simulation_parameters.lambda_tf);
+
+            return;
+        }
+
+        double defect_interaction = 0;
+        for (const auto& [cell1, defect1] : strg->defects)
+        {
+            for (const auto& [cell2, defect2] : strg->defects)
+            {
+                defect_interaction +=
+                    chargeless_potential_at_given_distance(sidb_nm_distance<Lyt>(*this, cell1, cell2));
+            }
+        }
+
+        strg->defect_interaction_energy = defect_interaction;
+    }
     /**
      * This function is used when three state simulations are required (i.e., is_three_state_simulation_required =
      * true) to set the base number to three. However, it is distinguished between the cells that can be positively
@@ -1977,10 +2216,18 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
     }
     /**
-     * Initializes the potential matrix between all the cells of the layout.
+     * Initializes the potential matrix between all the cells of the layout. If an interaction cutoff is set, the sparse
+     * potential matrix is initialized instead.
      */
     void initialize_potential_matrix() noexcept
     {
+        if (strg->interaction_cutoff.has_value())
+        {
+            this->initialize_sparse_potential_matrix();
+
+            return;
+        }
+
         strg->pot_mat =
             std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0.0));
 
@@ -1992,6 +2239,327 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             }
         }
     }
+    /**
+     * Initializes the sparse potential matrix of all SiDB pairs within the interaction cutoff. The SiDBs are binned
+     * into a uniform grid whose bins are at least as large as the cutoff radius such that only adjacent bins have to
+     * be searched. The grid is also used to bound the potential that is neglected at each SiDB.
+     */
+    void initialize_sparse_potential_matrix() noexcept
+    {
+        const auto cutoff    = *strg->interaction_cutoff;
+        const auto num_sidbs = strg->sidb_order.size();
+
+        // the dense matrices are not needed with an interaction cutoff
+        strg->nm_dist_mat = {};
+        strg->pot_mat     = {};
+
+        strg->nm_positions.clear();
+        strg->nm_positions.reserve(num_sidbs);
+        for (const auto& c : strg->sidb_order)
+        {
+            strg->nm_positions.push_back(sidb_nm_position<Lyt>(*this, c));
+        }
+
+        auto mat = std::make_shared<typename charge_distribution_storage::sparse_potential_matrix>();
+        mat->row_offsets.reserve(num_sidbs + 1);
+        mat->row_offsets.push_back(0);
+
+        strg->local_potential_error_bound = 0.0;
+        strg->system_energy_error_bound   = 0.0;
+
+        if (num_sidbs == 0)
+        {
+            strg->sparse_pot_mat = std::move(mat);
+
+            return;
+        }
+
+        auto min_x = std::numeric_limits<double>::max();
+        auto min_y = std::numeric_limits<double>::max();
+        auto max_x = std::numeric_limits<double>::lowest();
+        auto max_y = std::numeric_limits<double>::lowest();
+
+        for (const auto& [x, y] : strg->nm_positions)
+        {
+            min_x = std::min(min_x, x);
+            min_y = std::min(min_y, y);
+            max_x = std::max(max_x, x);
+            max_y = std::max(max_y, y);
+        }
+
+        // the number of bins is limited for layouts that are very large compared to the cutoff radius
+        static constexpr const double max_bins_per_dimension = 256.0;
+
+        const auto bin_size =
+            std::max({cutoff, (max_x - min_x) / max_bins_per_dimension, (max_y - min_y) / max_bins_per_dimension});
+        const auto num_bins_x = static_cast<int64_t>((max_x - min_x) / bin_size) + 1;
+        const auto num_bins_y = static_cast<int64_t>((max_y - min_y) / bin_size) + 1;
+
+        const auto bin_of = [&](const uint64_t i) -> std::pair<int64_t, int64_t>
+        {
+            return {std::min(static_cast<int64_t>((strg->nm_positions[i].first - min_x) / bin_size), num_bins_x - 1),
+                    std::min(static_cast<int64_t>((strg->nm_positions[i].second - min_y) / bin_size), num_bins_y - 1)};
+        };
+
+        std::vector<std::vector<uint64_t>> bins(static_cast<uint64_t>(num_bins_x * num_bins_y));
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            const auto [bx, by] = bin_of(i);
+            bins[static_cast<uint64_t>(by * num_bins_x + bx)].push_back(i);
+        }
+
+        const auto cutoff_potential = chargeless_potential_at_given_distance(cutoff);
+
+        // SiDBs in non-adjacent bins are farther apart than the cutoff radius. Their potential is bounded by the one at
+        // the smallest distance between the bins for all bins within a stencil around each bin. SiDBs beyond the
+        // stencil are bounded at once by a tail term. The stencil grows until that tail is negligible compared to the
+        // potential at the cutoff radius, which keeps the effort linear in the number of occupied bins.
+        static constexpr const int64_t max_stencil_radius = 32;
+        static constexpr const double  tail_tolerance     = 1E-3;
+
+        const auto max_bin_distance = std::max(num_bins_x, num_bins_y) - 1;
+
+        const auto tail_potential = [&](const int64_t radius)
+        {
+            // bins beyond the given radius are separated by at least `radius` bins
+            return radius >= max_bin_distance ?
+                       0.0 :
+                       static_cast<double>(num_sidbs) *
+                           chargeless_potential_at_given_distance(static_cast<double>(radius) * bin_size);
+        };
+
+        auto stencil_radius = std::min(int64_t{2}, max_bin_distance);
+        while (stencil_radius < std::min(max_stencil_radius, max_bin_distance) &&
+               tail_potential(stencil_radius) > tail_tolerance * cutoff_potential)
+        {
+            ++stencil_radius;
+        }
+
+        const auto tail = tail_potential(stencil_radius);
+
+        // potential bound per SiDB at the given bin offsets within the stencil
+        const auto          stencil_size = static_cast<uint64_t>(stencil_radius + 1);
+        std::vector<double> stencil_potential(stencil_size * stencil_size, 0.0);
+        for (int64_t dy = 0; dy <= stencil_radius; ++dy)
+        {
+            for (int64_t dx = 0; dx <= stencil_radius; ++dx)
+            {
+                if (dx <= 1 && dy <= 1)
+                {
+                    continue;
+                }
+
+                const auto gap = std::hypot(static_cast<double>(std::max(dx - 1, int64_t{0})) * bin_size,
+                                            static_cast<double>(std::max(dy - 1, int64_t{0})) * bin_size);
+
+                stencil_potential[static_cast<uint64_t>(dy) * stencil_size + static_cast<uint64_t>(dx)] =
+                    chargeless_potential_at_given_distance(std::max(gap, cutoff));
+            }
+        }
+
+        std::vector<double> far_potential(bins.size(), 0.0);
+
+        for (int64_t by = 0; by < num_bins_y; ++by)
+        {
+            for (int64_t bx = 0; bx < num_bins_x; ++bx)
+            {
+                const auto b = static_cast<uint64_t>(by * num_bins_x + bx);
+
+                if (bins[b].empty())
+                {
+                    continue;
+                }
+
+                auto potential = tail;
+
+                for (auto y = std::max(by - stencil_radius, int64_t{0});
+                     y <= std::min(by + stencil_radius, num_bins_y - 1); ++y)
+                {
+                    for (auto x = std::max(bx - stencil_radius, int64_t{0});
+                         x <= std::min(bx + stencil_radius, num_bins_x - 1); ++x)
+                    {
+                        const auto dx = static_cast<uint64_t>(std::abs(x - bx));
+                        const auto dy = static_cast<uint64_t>(std::abs(y - by));
+
+                        potential += static_cast<double>(bins[static_cast<uint64_t>(y * num_bins_x + x)].size()) *
+                                     stencil_potential[dy * stencil_size + dx];
+                    }
+                }
+
+                far_potential[b] = potential;
+            }
+        }
+
+        std::vector<uint64_t> neighbors{};
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            const auto [bx, by] = bin_of(i);
+
+            neighbors.clear();
+            uint64_t num_searched = 0;
+
+            for (auto y = std::max(by - 1, int64_t{0}); y <= std::min(by + 1, num_bins_y - 1); ++y)
+            {
+                for (auto x = std::max(bx - 1, int64_t{0}); x <= std::min(bx + 1, num_bins_x - 1); ++x)
+                {
+                    for (const auto j : bins[static_cast<uint64_t>(y * num_bins_x + x)])
+                    {
+                        ++num_searched;
+
+                        if (j != i && get_nm_distance_by_indices(i, j) <= cutoff)
+                        {
+                            neighbors.push_back(j);
+                        }
+                    }
+                }
+            }
+
+            std::sort(neighbors.begin(), neighbors.end());
+
+            for (const auto j : neighbors)
+            {
+                mat->column_indices.push_back(j);
+                mat->potentials.push_back(calculate_chargeless_potential_between_sidbs_by_index(i, j));
+            }
+            mat->row_offsets.push_back(mat->column_indices.size());
+
+            // searched SiDBs beyond the cutoff radius contribute at most the potential at the cutoff radius each
+            const auto error = far_potential[static_cast<uint64_t>(by * num_bins_x + bx)] +
+                               static_cast<double>(num_searched - 1 - neighbors.size()) * cutoff_potential;
+
+            strg->local_potential_error_bound = std::max(strg->local_potential_error_bound, error);
+            strg->system_energy_error_bound += 0.5 * error;
+        }
+
+        strg->sparse_pot_mat = std::move(mat);
+    }
+    /**
+     * Applies a function to all SiDBs that interact with the SiDB at the given index, i.e., to all SiDBs if no
+     * interaction cutoff is set and to all SiDBs within the cutoff radius otherwise.
+     *
+     * @tparam Fn Functor type that receives the index of the interacting SiDB and the charge-less electrostatic
+     * potential between both SiDBs.
+     * @param index Index of the SiDB.
+     * @param fn Functor to apply to each interacting SiDB.
+     */
+    template <typename Fn>
+    void foreach_interaction(const uint64_t index, Fn&& fn) const noexcept
+    {
+        if (strg->sparse_pot_mat != nullptr)
+        {
+            const auto& mat = *strg->sparse_pot_mat;
+
+            for (auto k = mat.row_offsets[index]; k < mat.row_offsets[index + 1]; ++k)
+            {
+                fn(mat.column_indices[k], mat.potentials[k]);
+            }
+        }
+        else
+        {
+            const auto& row = strg->pot_mat[index];
+
+            for (uint64_t j = 0u; j < row.size(); ++j)
+            {
+                fn(j, row[j]);
+            }
+        }
+    }
+    /**
+     * Updates the local electrostatic potentials of all other SiDBs after the charge state of the dependent SiDB has
+     * changed.
+     *
+     * @param charge_diff Change of the charge of the dependent SiDB.
+     */
+    void update_local_potential_after_dependent_cell_change(const double charge_diff) noexcept
+    {
+        foreach_interaction(strg->dependent_cell_index,
+                            [this, &charge_diff](const uint64_t i, const double pot)
+                            {
+                                if (i != strg->dependent_cell_index)
+                                {
+                                    strg->local_pot[i] += pot * charge_diff;
+                                }
+                            });
+    }
+    /**
+     * Checks the configuration stability using the sparse potential matrix. Hops between interacting SiDBs are checked
+     * explicitly. SiDBs beyond the cutoff radius do not interact, i.e., a hop between them is energetically favored if
+     * it increases the local potential of the electron. Such hops are found by scanning the SiDBs that can accept an
+     * electron in the order of decreasing local potential.
+     *
+     * @return `true` if a hop exists that decreases the system energy.
+     */
+    [[nodiscard]] bool sparse_energetically_favored_hop_exists() const noexcept
+    {
+        const auto& mat = *strg->sparse_pot_mat;
+
+        // neutrally and positively charged SiDBs, respectively, in the order of decreasing local potential
+        std::array<std::vector<uint64_t>, 2> acceptors{};
+
+        for (uint64_t i = 0u; i < strg->local_pot.size(); ++i)
+        {
+            if (strg->cell_charge[i] == sidb_charge_state::NEUTRAL)
+            {
+                acceptors[0].push_back(i);
+            }
+            else if (strg->cell_charge[i] == sidb_charge_state::POSITIVE)
+            {
+                acceptors[1].push_back(i);
+            }
+        }
+
+        for (auto& acc : acceptors)
+        {
+            std::sort(acc.begin(), acc.end(),
+                      [this](const uint64_t i, const uint64_t j) { return strg->local_pot[i] > strg->local_pot[j]; });
+        }
+
+        for (uint64_t i = 0u; i < strg->local_pot.size(); ++i)
+        {
+            const auto sign_i = charge_state_to_sign(strg->cell_charge[i]);
+
+            if (strg->cell_charge[i] == sidb_charge_state::POSITIVE)  // we do nothing with SiDB+
+            {
+                continue;
+            }
+
+            const auto first = mat.column_indices.cbegin() + static_cast<int64_t>(mat.row_offsets[i]);
+            const auto last  = mat.column_indices.cbegin() + static_cast<int64_t>(mat.row_offsets[i + 1]);
+
+            for (auto k = mat.row_offsets[i]; k < mat.row_offsets[i + 1]; ++k)
+            {
+                const auto j = mat.column_indices[k];
+
+                if (const auto e_del = strg->local_pot[i] - strg->local_pot[j] - mat.potentials[k];
+                    (charge_state_to_sign(strg->cell_charge[j]) > sign_i) &&
+                    (e_del < -physical_constants::POP_STABILITY_ERR))
+                {
+                    return true;
+                }
+            }
+
+            // negatively charged SiDBs can hop to neutral and positive ones, neutral SiDBs only to positive ones
+            for (auto a = static_cast<std::size_t>(sign_i + 1); a < acceptors.size(); ++a)
+            {
+                for (const auto j : acceptors[a])
+                {
+                    if (strg->local_pot[i] - strg->local_pot[j] >= -physical_constants::POP_STABILITY_ERR)
+                    {
+                        break;
+                    }
+
+                    if (!std::binary_search(first, last, j))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
 
     /**
      *  The stored unique index is converted to a charge distribution.
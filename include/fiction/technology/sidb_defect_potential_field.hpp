@@ -0,0 +1,239 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_SIDB_DEFECT_POTENTIAL_FIELD_HPP
+#define FICTION_SIDB_DEFECT_POTENTIAL_FIELD_HPP
+
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * The summed electrostatic potential field of all charged defects on an SiDB surface. It is computed once per surface
+ * and can be evaluated at arbitrary positions, which allows all charge distribution surfaces of layouts on the same
+ * surface to share it.
+ *
+ * The screened Coulomb potential of a defect decays exponentially with its Thomas-Fermi screening distance. Therefore,
+ * each defect is only considered up to the distance at which its potential falls below `cutoff_potential`. Defects are
+ * sorted by their x-position such that only those within the cutoff window of a position have to be visited.
+ */
+class sidb_defect_potential_field
+{
+  public:
+    /**
+     * A charged defect at a position in nm from the layout origin.
+     */
+    struct positioned_defect
+    {
+        /**
+         * Position of the defect (unit: nm).
+         */
+        std::pair<double, double> position;
+        /**
+         * The defect.
+         */
+        sidb_defect defect;
+        /**
+         * Distance beyond which the potential of the defect is neglected (unit: nm).
+         */
+        double cutoff;
+    };
+    /**
+     * Standard constructor. Uncharged defects are ignored.
+     *
+     * @param defects Defects and their positions in nm from the layout origin.
+     * @param cutoff_pot Potential below which the contribution of a defect is neglected (unit: V).
+     */
+    explicit sidb_defect_potential_field(const std::vector<std::pair<std::pair<double, double>, sidb_defect>>& defects,
+                                         const double cutoff_pot = 1E-9) :
+            cutoff_potential{cutoff_pot}
+    {
+        entries.reserve(defects.size());
+
+        for (const auto& [position, defect] : defects)
+        {
+            if (is_charged_defect_type(defect))
+            {
+                const auto cutoff = cutoff_distance(defect);
+
+                entries.push_back({position, defect, cutoff});
+                max_cutoff = std::max(max_cutoff, cutoff);
+            }
+        }
+
+        std::sort(entries.begin(), entries.end(),
+                  [](const auto& e1, const auto& e2) { return e1.position.first < e2.position.first; });
+    }
+    /**
+     * Returns the electrostatic potential that a defect generates at the given distance.
+     *
+     * @param defect The defect.
+     * @param distance Distance to the defect (unit: nm).
+     * @return The electrostatic potential of `defect` at `distance`, which is 0 at the defect's position itself (unit:
+     * V).
+     */
+    [[nodiscard]] static double potential(const sidb_defect& defect, const double distance) noexcept
+    {
+        if (distance == 0.0)
+        {
+            return 0.0;
+        }
+
+        return physical_constants::K_E / defect.epsilon_r / (distance * 1E-9) * std::exp(-distance / defect.lambda_tf) *
+               physical_constants::ELEMENTARY_CHARGE * static_cast<double>(defect.charge);
+    }
+    /**
+     * Determines the distance beyond which the potential of the given defect falls below `cutoff_potential`.
+     *
+     * @param defect The defect.
+     * @return Cutoff distance of `defect`, which is infinite if its potential is not screened (unit: nm).
+     */
+    [[nodiscard]] double cutoff_distance(const sidb_defect& defect) const noexcept
+    {
+        if (!(defect.epsilon_r > 0.0 && defect.lambda_tf > 0.0 && std::isfinite(defect.lambda_tf) &&
+              cutoff_potential > 0.0))
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        const auto magnitude = [&defect](const double distance) { return std::abs(potential(defect, distance)); };
+
+        // bracket the cutoff distance and refine it by bisection, exploiting that the potential decays monotonically
+        double lower = 0.0;
+        double upper = defect.lambda_tf;
+
+        while (magnitude(upper) >= cutoff_potential)
+        {
+            lower = upper;
+            upper *= 2.0;
+        }
+
+        for (auto i = 0u; i < 64 && upper - lower > 1E-6; ++i)
+        {
+            const auto mid = 0.5 * (lower + upper);
+            (magnitude(mid) >= cutoff_potential ? lower : upper) = mid;
+        }
+
+        return upper;
+    }
+    /**
+     * Evaluates the summed potential of all defects at the given position.
+     *
+     * @param position Position in nm from the layout origin.
+     * @return Summed electrostatic potential of all defects within their cutoff distance of `position` (unit: V).
+     */
+    [[nodiscard]] double potential_at(const std::pair<double, double>& position) const noexcept
+    {
+        auto it = entries.cbegin();
+
+        if (std::isfinite(max_cutoff))
+        {
+            it = std::lower_bound(entries.cbegin(), entries.cend(), position.first - max_cutoff,
+                                  [](const auto& e, const double x) { return e.position.first < x; });
+        }
+
+        double pot = 0.0;
+
+        for (; it != entries.cend() && it->position.first <= position.first + max_cutoff; ++it)
+        {
+            const auto distance =
+                std::hypot(it->position.first - position.first, it->position.second - position.second);
+
+            if (distance <= it->cutoff)
+            {
+                pot += potential(it->defect, distance);
+            }
+        }
+
+        return pot;
+    }
+    /**
+     * Computes the interaction energy among all defects as it is considered in the system energy of a charge
+     * distribution surface, i.e., the sum of the chargeless screened Coulomb potentials over all ordered pairs of
+     * defects using the given physical parameters. The result is memoized per parameter combination.
+     *
+     * @param k Coulomb constant divided by the relative permittivity (unit: N·m²/C²).
+     * @param lambda_tf Thomas-Fermi screening distance (unit: nm).
+     * @return Interaction energy among all defects (unit: eV).
+     */
+    [[nodiscard]] double interaction_energy(const double k, const double lambda_tf) const noexcept
+    {
+        const std::lock_guard lock{memo_mutex};
+
+        if (const auto it = std::find_if(interaction_energies.cbegin(), interaction_energies.cend(),
+                                         [&k, &lambda_tf](const auto& memo)
+                                         { return std::get<0>(memo) == k && std::get<1>(memo) == lambda_tf; });
+            it != interaction_energies.cend())
+        {
+            return std::get<2>(*it);
+        }
+
+        double energy = 0.0;
+
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < entries.size(); ++j)
+            {
+                const auto distance = std::hypot(entries[i].position.first - entries[j].position.first,
+                                                 entries[i].position.second - entries[j].position.second);
+
+                if (distance != 0.0)
+                {
+                    energy += 2.0 * k / (distance * 1E-9) * std::exp(-distance / lambda_tf) *
+                              physical_constants::ELEMENTARY_CHARGE;
+                }
+            }
+        }
+
+        interaction_energies.emplace_back(k, lambda_tf, energy);
+
+        return energy;
+    }
+    /**
+     * Returns the number of charged defects.
+     *
+     * @return Number of charged defects that contribute to the field.
+     */
+    [[nodiscard]] std::size_t num_defects() const noexcept
+    {
+        return entries.size();
+    }
+
+  private:
+    /**
+     * Potential below which the contribution of a defect is neglected (unit: V).
+     */
+    const double cutoff_potential;
+    /**
+     * Charged defects sorted by their x-positions.
+     */
+    std::vector<positioned_defect> entries{};
+    /**
+     * Largest cutoff distance of all defects (unit: nm).
+     */
+    double max_cutoff{0.0};
+    /**
+     * Mutex to guard the memoized interaction energies.
+     */
+    mutable std::mutex memo_mutex{};
+    /**
+     * Memoized interaction energies as tuples of `k`, `lambda_tf`, and the energy.
+     */
+    mutable std::vector<std::tuple<double, double, double>> interaction_energies{};
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_DEFECT_POTENTIAL_FIELD_HPP
@@ -5,7 +5,9 @@
 #ifndef FICTION_SIDB_DEFECT_SURFACE_HPP
 #define FICTION_SIDB_DEFECT_SURFACE_HPP
 
+#include "fiction/technology/sidb_defect_potential_field.hpp"
 #include "fiction/technology/sidb_defects.hpp"
+#include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
 
 #include <phmap.h>
@@ -17,6 +19,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace fiction
 {
@@ -64,6 +67,11 @@ class sidb_defect_surface<Lyt, false> : public Lyt
         sidb_defect_surface_params params{};
 
         phmap::parallel_flat_hash_map<typename Lyt::coordinate, sidb_defect> defective_coordinates{};
+        /**
+         * Lazily computed potential field of all charged defects. It is shared by copies of the surface and reset
+         * whenever a defect is assigned.
+         */
+        std::shared_ptr<const sidb_defect_potential_field> potential_field{};
     };
 
     using storage = std::shared_ptr<sidb_surface_storage>;
@@ -136,6 +144,8 @@ class sidb_defect_surface<Lyt, false> : public Lyt
     {
         // delete defect at the coordinate
         strg->defective_coordinates.erase(c);
+        // the potential field has to be recomputed
+        std::atomic_store(&strg->potential_field, std::shared_ptr<const sidb_defect_potential_field>{});
 
         if (d.type != sidb_defect_type::NONE &&
             strg->params.ignore.count(d.type) == 0)  // add defect if this type is not ignored and is not NONE
@@ -180,6 +190,31 @@ class sidb_defect_surface<Lyt, false> : public Lyt
         mockturtle::detail::foreach_element(strg->defective_coordinates.cbegin(), strg->defective_coordinates.cend(),
                                             std::forward<Fn>(fn));
     }
+    /**
+     * Returns the summed electrostatic potential field of all charged defects on the surface. It is computed on first
+     * access and then shared by all charge distribution surfaces that are constructed on top of this surface until a
+     * defect is assigned.
+     *
+     * @return Potential field of all charged defects on the surface.
+     */
+    [[nodiscard]] std::shared_ptr<const sidb_defect_potential_field> defect_potential_field() const
+    {
+        if (auto field = std::atomic_load(&strg->potential_field); field)
+        {
+            return field;
+        }
+
+        std::vector<std::pair<std::pair<double, double>, sidb_defect>> defects{};
+        defects.reserve(strg->defective_coordinates.size());
+
+        foreach_sidb_defect([this, &defects](const auto& cd)
+                            { defects.emplace_back(sidb_nm_position<Lyt>(*this, cd.first), cd.second); });
+
+        auto field = std::make_shared<const sidb_defect_potential_field>(defects);
+        std::atomic_store(&strg->potential_field, field);
+
+        return field;
+    }
     /**
      * Returns all SiDB positions affected by the defect at the given coordinate. This function relies on the
      * defect_extent function defined in sidb_defects.hpp that computes the extent of charged and neutral defect types.
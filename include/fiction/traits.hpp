@@ -804,6 +804,20 @@ template <class Lyt>
 inline constexpr bool has_foreach_sidb_defect_v = has_foreach_sidb_defect<Lyt>::value;
 #pragma endregion
 
+#pragma region has_defect_potential_field
+template <class Lyt, class = void>
+struct has_defect_potential_field : std::false_type
+{};
+
+template <class Lyt>
+struct has_defect_potential_field<Lyt, std::void_t<decltype(std::declval<Lyt>().defect_potential_field())>>
+        : std::true_type
+{};
+
+template <class Lyt>
+inline constexpr bool has_defect_potential_field_v = has_defect_potential_field<Lyt>::value;
+#pragma endregion
+
 /**
  * Charge distribution surfaces
  */
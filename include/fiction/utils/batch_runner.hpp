@@ -0,0 +1,597 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_BATCH_RUNNER_HPP
+#define FICTION_BATCH_RUNNER_HPP
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FICTION_BATCH_RUNNER_POSIX 1
+#include <csignal>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#else
+#define FICTION_BATCH_RUNNER_POSIX 0
+#endif
+
+namespace fiction
+{
+
+/**
+ * Parameters for the batch runner.
+ */
+struct batch_runner_params
+{
+    /**
+     * Number of benchmarks that are processed concurrently.
+     */
+    uint64_t num_jobs = 1;
+    /**
+     * Process each benchmark in a forked child process instead of a worker thread. Only in this mode, stages that
+     * exceed their timeout are forcefully terminated, memory limits are enforced, and peak memory consumption is
+     * reported per benchmark. Crashes of a stage are isolated from the remaining benchmarks as well. Only supported on
+     * POSIX systems; threads are used otherwise.
+     */
+    bool isolate_processes = false;
+    /**
+     * Per-stage timeout in milliseconds. 0 means no timeout. Stages are expected to forward the remaining time to the
+     * algorithms they call (see `batch_stage_context`). In thread mode, exceeding stages are merely reported as timed
+     * out, while in process mode, they are terminated.
+     */
+    uint64_t stage_timeout = 0;
+    /**
+     * Address space limit per benchmark in MiB. 0 means no limit. Only enforced in process mode.
+     */
+    uint64_t memory_limit = 0;
+};
+/**
+ * Information handed to each stage.
+ */
+struct batch_stage_context
+{
+    /**
+     * Name of the benchmark that is processed.
+     */
+    std::string benchmark;
+    /**
+     * Timeout in milliseconds that the stage should respect. 0 means no timeout.
+     */
+    uint64_t timeout;
+};
+/**
+ * Exception that stages throw to indicate that they could not produce a result, e.g., because a physical design
+ * algorithm did not find a layout. All subsequent stages of the affected benchmark are skipped.
+ */
+class batch_stage_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `batch_stage_error` object with the given error message.
+     *
+     * @param msg The error message describing the error.
+     */
+    explicit batch_stage_error(const std::string_view& msg) noexcept : std::runtime_error(msg.data()) {}
+};
+/**
+ * A single step of a pipeline. It operates on a benchmark-specific state that is passed from stage to stage and
+ * returns quality metrics to report.
+ *
+ * @tparam State Type of the data handed from stage to stage.
+ */
+template <typename State>
+struct batch_stage
+{
+    /**
+     * Name of the stage.
+     */
+    std::string name;
+    /**
+     * Function to execute.
+     */
+    std::function<nlohmann::json(State&, const batch_stage_context&)> run;
+};
+/**
+ * Writes stage records as JSON lines and, optionally, as CSV rows. Each record is flushed immediately such that results
+ * are available even if the batch is aborted. Thread-safe.
+ */
+class batch_record_writer
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param jsonl Output stream for JSON lines.
+     * @param csv Optional output stream for CSV rows.
+     */
+    explicit batch_record_writer(std::ostream& jsonl, std::ostream* csv = nullptr) : jsonl_os{jsonl}, csv_os{csv}
+    {
+        if (csv_os != nullptr)
+        {
+            *csv_os << "revision,benchmark,stage,status,runtime (in sec),peak RSS (in KiB),metrics" << std::endl;
+        }
+    }
+    /**
+     * Writes a record that has to contain the keys `benchmark`, `stage`, `status`, `runtime`, `peak_rss`, and
+     * `metrics`.
+     *
+     * @param record The record to write.
+     */
+    void operator()(nlohmann::json record)
+    {
+        record["revision"] = revision();
+
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        jsonl_os << record.dump() << std::endl;
+
+        if (csv_os != nullptr)
+        {
+            *csv_os << fmt::format("{},{},{},{},{},{},{}", record["revision"].get<std::string>(),
+                                   csv_escape(record["benchmark"].get<std::string>()),
+                                   csv_escape(record["stage"].get<std::string>()), record["status"].get<std::string>(),
+                                   record["runtime"].get<double>(), record["peak_rss"].get<uint64_t>(),
+                                   csv_escape(record["metrics"].dump()))
+                    << std::endl;
+        }
+    }
+
+  private:
+    std::ostream& jsonl_os;
+    std::ostream* csv_os;
+
+    std::mutex mutex{};
+
+    [[nodiscard]] static std::string revision() noexcept
+    {
+#ifdef GIT_SHORT_REVISION
+        return GIT_SHORT_REVISION;
+#else
+        return "unknown";
+#endif
+    }
+
+    [[nodiscard]] static std::string csv_escape(const std::string& str)
+    {
+        std::string escaped{"\""};
+
+        for (const auto c : str)
+        {
+            escaped += c;
+
+            if (c == '"')
+            {
+                escaped += c;
+            }
+        }
+
+        return escaped + '"';
+    }
+};
+/**
+ * Runs a pipeline of stages, e.g., reading, technology mapping, physical design, optimization, gate library
+ * application, and verification, over a set of benchmarks. Benchmarks are processed concurrently in worker threads or
+ * isolated child processes. For each executed stage, a record containing its status, runtime, peak resident set size,
+ * and the quality metrics it returned is streamed to a `batch_record_writer` as soon as the stage finishes.
+ *
+ * The status of a stage is one of `success`, `failure` (the stage threw), `timeout`, `memory_limit` (an allocation
+ * failed), or `crash` (the child process terminated abnormally). Stages after an unsuccessful one are skipped.
+ *
+ * @tparam State Type of the data handed from stage to stage. Each benchmark starts with a default-constructed state.
+ */
+template <typename State>
+class batch_runner
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param pipeline Stages to execute in order.
+     * @param ps Parameters.
+     */
+    explicit batch_runner(std::vector<batch_stage<State>> pipeline, batch_runner_params ps = {}) :
+            stages{std::move(pipeline)},
+            params{std::move(ps)}
+    {}
+    /**
+     * Processes all given benchmarks.
+     *
+     * @param benchmarks Names of the benchmarks to process. They are handed to the stages via `batch_stage_context`.
+     * @param writer Writer to stream the records to.
+     */
+    void run(const std::vector<std::string>& benchmarks, batch_record_writer& writer)
+    {
+#if FICTION_BATCH_RUNNER_POSIX
+        if (params.isolate_processes)
+        {
+            run_in_processes(benchmarks, writer);
+
+            return;
+        }
+#endif
+        run_in_threads(benchmarks, writer);
+    }
+
+  private:
+    const std::vector<batch_stage<State>> stages;
+
+    const batch_runner_params params;
+
+    using clock = std::chrono::steady_clock;
+
+    [[nodiscard]] static nlohmann::json make_record(const std::string& benchmark, const std::string& stage,
+                                                    const std::string& status, const double runtime,
+                                                    nlohmann::json metrics = nlohmann::json::object())
+    {
+        return {{"benchmark", benchmark}, {"stage", stage},          {"status", status},
+                {"runtime", runtime},     {"peak_rss", peak_rss()}, {"metrics", std::move(metrics)}};
+    }
+    /**
+     * Returns the peak resident set size of the current process in KiB or 0 if it cannot be determined.
+     */
+    [[nodiscard]] static uint64_t peak_rss() noexcept
+    {
+#if FICTION_BATCH_RUNNER_POSIX
+        rusage usage{};
+
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+#if defined(__APPLE__)
+            return static_cast<uint64_t>(usage.ru_maxrss) / 1024u;  // bytes on macOS
+#else
+            return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+        }
+#endif
+        return 0;
+    }
+    /**
+     * Executes all stages on one benchmark and reports each record via `report`.
+     *
+     * @param benchmark Benchmark name.
+     * @param report Function that is called with each record.
+     * @param started Function that is called with the index of each stage before it is started.
+     */
+    void process_benchmark(const std::string& benchmark, const std::function<void(nlohmann::json)>& report,
+                           const std::function<void(std::size_t)>& started = {}) const
+    {
+        State state{};
+
+        for (std::size_t i = 0; i < stages.size(); ++i)
+        {
+            if (started)
+            {
+                started(i);
+            }
+
+            const auto& stage = stages[i];
+            const auto  start = clock::now();
+
+            const auto elapsed = [&start]
+            { return std::chrono::duration<double>(clock::now() - start).count(); };
+
+            std::string    status{"success"};
+            nlohmann::json metrics = nlohmann::json::object();
+
+            try
+            {
+                metrics = stage.run(state, batch_stage_context{benchmark, params.stage_timeout});
+            }
+            catch (const std::bad_alloc&)
+            {
+                status = "memory_limit";
+            }
+            catch (const std::exception& e)
+            {
+                status  = "failure";
+                metrics = {{"error", e.what()}};
+            }
+            catch (...)
+            {
+                status = "failure";
+            }
+
+            const auto runtime = elapsed();
+
+            if (status == "success" && params.stage_timeout != 0 &&
+                runtime * 1000.0 > static_cast<double>(params.stage_timeout))
+            {
+                status = "timeout";
+            }
+
+            report(make_record(benchmark, stage.name, status, runtime, std::move(metrics)));
+
+            if (status != "success")
+            {
+                return;
+            }
+        }
+    }
+
+    void run_in_threads(const std::vector<std::string>& benchmarks, batch_record_writer& writer) const
+    {
+        std::atomic<std::size_t> next_benchmark{0};
+
+        const auto num_benchmarks = static_cast<uint64_t>(benchmarks.size());
+
+        const auto worker = [this, &benchmarks, &writer, &next_benchmark]
+        {
+            for (auto i = next_benchmark++; i < benchmarks.size(); i = next_benchmark++)
+            {
+                process_benchmark(benchmarks[i], [&writer](nlohmann::json record) { writer(std::move(record)); });
+            }
+        };
+
+        const auto num_threads =
+            static_cast<std::size_t>(std::clamp(params.num_jobs, uint64_t{1}, std::max(uint64_t{1}, num_benchmarks)));
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+#if FICTION_BATCH_RUNNER_POSIX
+    /**
+     * Book-keeping of a running child process.
+     */
+    struct child_process
+    {
+        pid_t                          pid;
+        int                            fd;
+        std::string                    benchmark;
+        std::string                    buffer{};
+        std::optional<std::size_t>     running_stage{};
+        clock::time_point              stage_start{};
+        std::optional<std::string>     kill_reason{};
+    };
+    /**
+     * Executed in the child process. Records are sent to the parent as JSON lines. Before each stage, a marker line is
+     * sent such that the parent can supervise its runtime.
+     */
+    [[noreturn]] void child_main(const std::string& benchmark, const int fd) const
+    {
+        if (params.memory_limit != 0)
+        {
+            const auto bytes = static_cast<rlim_t>(params.memory_limit) * 1024u * 1024u;
+
+            rlimit limit{bytes, bytes};
+            setrlimit(RLIMIT_AS, &limit);
+        }
+
+        const auto send = [fd](const std::string& line)
+        {
+            const auto msg = line + '\n';
+
+            for (std::size_t written = 0; written < msg.size();)
+            {
+                const auto n = ::write(fd, msg.data() + written, msg.size() - written);
+
+                if (n <= 0)
+                {
+                    return;
+                }
+
+                written += static_cast<std::size_t>(n);
+            }
+        };
+
+        try
+        {
+            process_benchmark(
+                benchmark, [&send](const nlohmann::json& record) { send(record.dump()); },
+                [&send](const std::size_t i) { send(nlohmann::json{{"started", i}}.dump()); });
+        }
+        catch (...)
+        {
+            std::fflush(nullptr);
+            ::close(fd);
+            _exit(EXIT_FAILURE);
+        }
+
+        std::fflush(nullptr);
+        ::close(fd);
+        _exit(EXIT_SUCCESS);
+    }
+
+    [[nodiscard]] std::optional<child_process> spawn(const std::string& benchmark) const
+    {
+        int fds[2];  // NOLINT
+
+        if (pipe(fds) != 0)
+        {
+            return std::nullopt;
+        }
+
+        // prevent buffered output from being duplicated in the child
+        std::fflush(nullptr);
+
+        const auto pid = fork();
+
+        if (pid < 0)
+        {
+            ::close(fds[0]);
+            ::close(fds[1]);
+
+            return std::nullopt;
+        }
+
+        if (pid == 0)
+        {
+            ::close(fds[0]);
+            child_main(benchmark, fds[1]);
+        }
+
+        ::close(fds[1]);
+
+        return child_process{pid, fds[0], benchmark};
+    }
+    /**
+     * Forwards all complete lines received from a child to the writer.
+     */
+    static void handle_lines(child_process& child, batch_record_writer& writer)
+    {
+        for (auto pos = child.buffer.find('\n'); pos != std::string::npos; pos = child.buffer.find('\n'))
+        {
+            const auto line = child.buffer.substr(0, pos);
+            child.buffer.erase(0, pos + 1);
+
+            nlohmann::json msg = nlohmann::json::parse(line, nullptr, false);
+
+            if (msg.is_discarded())
+            {
+                continue;
+            }
+
+            if (msg.contains("started"))
+            {
+                child.running_stage = msg["started"].get<std::size_t>();
+                child.stage_start   = clock::now();
+            }
+            else
+            {
+                child.running_stage = std::nullopt;
+                writer(std::move(msg));
+            }
+        }
+    }
+    /**
+     * Reports the stage that was running when the child terminated abnormally.
+     */
+    void finalize(child_process& child, const int wait_status, batch_record_writer& writer) const
+    {
+        ::close(child.fd);
+
+        if (!child.running_stage.has_value())
+        {
+            return;
+        }
+
+        const auto status = child.kill_reason.value_or(WIFSIGNALED(wait_status) ? "crash" : "failure");
+
+        auto record =
+            make_record(child.benchmark, stages[*child.running_stage].name, status,
+                        std::chrono::duration<double>(clock::now() - child.stage_start).count(),
+                        WIFSIGNALED(wait_status) ? nlohmann::json{{"signal", WTERMSIG(wait_status)}} :
+                                                   nlohmann::json::object());
+
+        // the parent's peak memory consumption is meaningless for the child
+        record["peak_rss"] = 0u;
+
+        writer(std::move(record));
+    }
+
+    void run_in_processes(const std::vector<std::string>& benchmarks, batch_record_writer& writer) const
+    {
+        const auto num_jobs = std::max(params.num_jobs, uint64_t{1});
+
+        std::vector<child_process> children{};
+        std::size_t                next_benchmark = 0;
+
+        while (next_benchmark < benchmarks.size() || !children.empty())
+        {
+            // keep the pool filled
+            while (next_benchmark < benchmarks.size() && children.size() < num_jobs)
+            {
+                if (auto child = spawn(benchmarks[next_benchmark]); child.has_value())
+                {
+                    children.push_back(std::move(*child));
+                }
+                else
+                {
+                    writer(make_record(benchmarks[next_benchmark], "spawn", "failure", 0.0));
+                }
+
+                ++next_benchmark;
+            }
+
+            std::vector<pollfd> fds{};
+            fds.reserve(children.size());
+
+            for (const auto& child : children)
+            {
+                fds.push_back({child.fd, POLLIN, 0});
+            }
+
+            poll(fds.data(), fds.size(), 100);
+
+            for (std::size_t i = 0; i < children.size(); ++i)
+            {
+                auto& child = children[i];
+
+                if ((fds[i].revents & (POLLIN | POLLHUP)) != 0)
+                {
+                    std::array<char, 4096> chunk{};
+
+                    if (const auto n = ::read(child.fd, chunk.data(), chunk.size()); n > 0)
+                    {
+                        child.buffer.append(chunk.data(), static_cast<std::size_t>(n));
+                        handle_lines(child, writer);
+                    }
+                    else if (n == 0)
+                    {
+                        // end of file: the child has terminated
+                        int wait_status = 0;
+                        waitpid(child.pid, &wait_status, 0);
+
+                        finalize(child, wait_status, writer);
+
+                        child.pid = -1;
+
+                        continue;
+                    }
+                }
+
+                // supervise the running stage
+                if (params.stage_timeout != 0 && child.running_stage.has_value() && !child.kill_reason.has_value() &&
+                    clock::now() - child.stage_start > std::chrono::milliseconds(params.stage_timeout))
+                {
+                    child.kill_reason = "timeout";
+                    kill(child.pid, SIGKILL);
+                }
+            }
+
+            children.erase(std::remove_if(children.begin(), children.end(),
+                                          [](const auto& child) { return child.pid == -1; }),
+                           children.end());
+        }
+    }
+#endif
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_BATCH_RUNNER_HPP
@@ -0,0 +1,403 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_DENSE_COORDINATE_UTILS_HPP
+#define FICTION_DENSE_COORDINATE_UTILS_HPP
+
+#include "fiction/layouts/coordinates.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Checks whether coordinates of the given type can be mapped onto a dense, contiguous index range. This is the case for
+ * unsigned offset coordinates, which are bounded from below by `(0,0,0)` and from above by the layout's dimension.
+ *
+ * @tparam CoordinateType Coordinate type to check.
+ */
+template <typename CoordinateType>
+inline constexpr const bool is_densely_indexable_coordinate_v = std::is_same_v<CoordinateType, offset::ucoord_t>;
+
+/**
+ * Maps unsigned offset coordinates within a bounding dimension onto the contiguous index range
+ * \f$[0, (x + 1) \cdot (y + 1) \cdot (z + 1))\f$. The x-dimension is the fastest-changing one such that row-wise
+ * traversals touch neighboring indices.
+ */
+class dense_coordinate_indexer
+{
+  public:
+    /**
+     * Standard constructor. Creates an indexer for an empty index range.
+     */
+    dense_coordinate_indexer() noexcept = default;
+    /**
+     * Standard constructor. Creates an indexer for all coordinates from `(0,0,0)` up to and including `dimension`.
+     *
+     * @param dimension Largest coordinate that belongs to the index range.
+     */
+    explicit dense_coordinate_indexer(const offset::ucoord_t& dimension) noexcept :
+            x_extent{static_cast<std::size_t>(dimension.x) + 1},
+            y_extent{static_cast<std::size_t>(dimension.y) + 1},
+            z_extent{static_cast<std::size_t>(dimension.z) + 1}
+    {}
+    /**
+     * Checks whether the given coordinate lies within the index range.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is not dead and within the index range.
+     */
+    [[nodiscard]] bool contains(const offset::ucoord_t& c) const noexcept
+    {
+        return !c.is_dead() && c.x < x_extent && c.y < y_extent && c.z < z_extent;
+    }
+    /**
+     * Returns the index of the given coordinate.
+     *
+     * @param c Coordinate whose index is desired. Must be contained in the index range.
+     * @return Index of `c`.
+     */
+    [[nodiscard]] std::size_t operator()(const offset::ucoord_t& c) const noexcept
+    {
+        assert(contains(c) && "Coordinate is not within the index range");
+
+        return (static_cast<std::size_t>(c.z) * y_extent + static_cast<std::size_t>(c.y)) * x_extent +
+               static_cast<std::size_t>(c.x);
+    }
+    /**
+     * Returns the coordinate that belongs to the given index.
+     *
+     * @param i Index within the index range.
+     * @return Coordinate whose index is `i`.
+     */
+    [[nodiscard]] offset::ucoord_t coordinate_at(const std::size_t i) const noexcept
+    {
+        assert(i < size() && "Index is out of range");
+
+        return {i % x_extent, (i / x_extent) % y_extent, i / (x_extent * y_extent)};
+    }
+    /**
+     * Returns the number of indices in the range.
+     *
+     * @return Number of coordinates that can be indexed.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return x_extent * y_extent * z_extent;
+    }
+    /**
+     * Checks whether this indexer covers exactly the coordinates up to and including `dimension`.
+     *
+     * @param dimension Dimension to compare with.
+     * @return `true` iff this indexer was created for `dimension`.
+     */
+    [[nodiscard]] bool matches(const offset::ucoord_t& dimension) const noexcept
+    {
+        return x_extent == static_cast<std::size_t>(dimension.x) + 1 &&
+               y_extent == static_cast<std::size_t>(dimension.y) + 1 &&
+               z_extent == static_cast<std::size_t>(dimension.z) + 1;
+    }
+    /**
+     * Returns the largest coordinate that is contained in the index range.
+     *
+     * @return Dimension of the index range. Returns a dead coordinate if the index range is empty.
+     */
+    [[nodiscard]] offset::ucoord_t dimension() const noexcept
+    {
+        if (size() == 0)
+        {
+            return {};
+        }
+
+        return {x_extent - 1, y_extent - 1, z_extent - 1};
+    }
+    /**
+     * Returns an indexer whose range contains this indexer's range as well as the given coordinate. The range is at
+     * least doubled in the x- and y-dimension to amortize repeated growth.
+     *
+     * @param c Coordinate that has to be contained in the enlarged index range.
+     * @return Indexer for the enlarged index range.
+     */
+    [[nodiscard]] dense_coordinate_indexer grown_to(const offset::ucoord_t& c) const noexcept
+    {
+        const auto old_dimension = dimension();
+        const auto empty         = size() == 0;
+
+        const auto x_max = std::max(static_cast<uint64_t>(c.x), empty ? 0ul : 2ul * old_dimension.x + 1);
+        const auto y_max = std::max(static_cast<uint64_t>(c.y), empty ? 0ul : 2ul * old_dimension.y + 1);
+        const auto z_max = std::max(static_cast<uint64_t>(c.z), empty ? 0ul : uint64_t{old_dimension.z});
+
+        return dense_coordinate_indexer{offset::ucoord_t{x_max, y_max, z_max}};
+    }
+
+  private:
+    /**
+     * Number of indexable values per dimension.
+     */
+    std::size_t x_extent{0}, y_extent{0}, z_extent{0};
+};
+
+/**
+ * A set of unsigned offset coordinates that is represented as a bit vector over a dense coordinate index range.
+ * Lookups, insertions, and deletions are single bit operations instead of hash table probes.
+ *
+ * The index range grows automatically when a coordinate outside the current range is inserted. Therefore, the set stays
+ * valid if the layout whose coordinates it stores is resized.
+ */
+class dense_coordinate_set
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty set.
+     */
+    dense_coordinate_set() noexcept = default;
+    /**
+     * Standard constructor. Creates an empty set whose index range initially covers all coordinates up to and including
+     * `dimension`.
+     *
+     * @param dimension Largest coordinate to reserve space for.
+     */
+    explicit dense_coordinate_set(const offset::ucoord_t& dimension) :
+            indexer{dimension},
+            bits(indexer.size(), false)
+    {}
+    /**
+     * Adds the given coordinate to the set.
+     *
+     * @param c Coordinate to add.
+     */
+    void insert(const offset::ucoord_t& c)
+    {
+        assert(!c.is_dead() && "Dead coordinates cannot be stored");
+
+        if (!indexer.contains(c))
+        {
+            grow(c);
+        }
+
+        if (const auto i = indexer(c); !bits[i])
+        {
+            bits[i] = true;
+            ++num_elements;
+        }
+    }
+    /**
+     * Removes the given coordinate from the set.
+     *
+     * @param c Coordinate to remove.
+     */
+    void erase(const offset::ucoord_t& c) noexcept
+    {
+        if (!indexer.contains(c))
+        {
+            return;
+        }
+
+        if (const auto i = indexer(c); bits[i])
+        {
+            bits[i] = false;
+            --num_elements;
+        }
+    }
+    /**
+     * Checks whether the given coordinate is contained in the set.
+     *
+     * @param c Coordinate to check.
+     * @return `1` if `c` is contained in the set, `0` otherwise. The return type mimics `count` of standard sets.
+     */
+    [[nodiscard]] std::size_t count(const offset::ucoord_t& c) const noexcept
+    {
+        return indexer.contains(c) && bits[indexer(c)] ? 1ul : 0ul;
+    }
+    /**
+     * Removes all coordinates from the set while keeping the allocated index range.
+     */
+    void clear() noexcept
+    {
+        std::fill(bits.begin(), bits.end(), false);
+        num_elements = 0;
+    }
+    /**
+     * Returns the number of stored coordinates.
+     *
+     * @return Size of the set.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return num_elements;
+    }
+    /**
+     * Checks whether the set is empty.
+     *
+     * @return `true` iff no coordinate is stored.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return num_elements == 0;
+    }
+
+  private:
+    /**
+     * Maps coordinates to bit positions.
+     */
+    dense_coordinate_indexer indexer{};
+    /**
+     * One bit per indexable coordinate.
+     */
+    std::vector<bool> bits{};
+    /**
+     * Number of set bits.
+     */
+    std::size_t num_elements{0};
+    /**
+     * Enlarges the index range such that it contains `c` and re-maps all stored coordinates.
+     *
+     * @param c Coordinate that has to be contained in the enlarged index range.
+     */
+    void grow(const offset::ucoord_t& c)
+    {
+        const auto old_size = indexer.size();
+
+        const auto        new_indexer = indexer.grown_to(c);
+        std::vector<bool> new_bits(new_indexer.size(), false);
+
+        for (std::size_t i = 0; i < old_size; ++i)
+        {
+            if (bits[i])
+            {
+                new_bits[new_indexer(indexer.coordinate_at(i))] = true;
+            }
+        }
+
+        indexer = new_indexer;
+        bits    = std::move(new_bits);
+    }
+};
+
+/**
+ * A map from unsigned offset coordinates to values that is represented as a flat array over a dense coordinate index
+ * range. Lookups and assignments are plain array accesses instead of hash table probes.
+ *
+ * Like `dense_coordinate_set`, the index range grows automatically when a coordinate outside the current range is
+ * assigned.
+ *
+ * @tparam Value Type of the mapped values.
+ */
+template <typename Value>
+class dense_coordinate_map
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty map.
+     */
+    dense_coordinate_map() noexcept = default;
+    /**
+     * Assigns a value to the given coordinate. An existing value is overwritten.
+     *
+     * @param c Coordinate to assign a value to.
+     * @param v Value to assign.
+     */
+    void insert_or_assign(const offset::ucoord_t& c, const Value& v)
+    {
+        assert(!c.is_dead() && "Dead coordinates cannot be stored");
+
+        if (!indexer.contains(c))
+        {
+            grow(c);
+        }
+
+        auto& e = entries[indexer(c)];
+
+        if (!e.has_value())
+        {
+            ++num_elements;
+        }
+
+        e = v;
+    }
+    /**
+     * Returns a pointer to the value that is assigned to the given coordinate.
+     *
+     * @param c Coordinate to look up.
+     * @return Pointer to the value of `c` or `nullptr` if no value is assigned to `c`.
+     */
+    [[nodiscard]] const Value* find(const offset::ucoord_t& c) const noexcept
+    {
+        if (!indexer.contains(c))
+        {
+            return nullptr;
+        }
+
+        const auto& e = entries[indexer(c)];
+
+        return e.has_value() ? &*e : nullptr;
+    }
+    /**
+     * Returns the number of coordinates that have a value assigned.
+     *
+     * @return Size of the map.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return num_elements;
+    }
+    /**
+     * Checks whether the map is empty.
+     *
+     * @return `true` iff no coordinate has a value assigned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return num_elements == 0;
+    }
+
+  private:
+    /**
+     * Maps coordinates to array positions.
+     */
+    dense_coordinate_indexer indexer{};
+    /**
+     * One optional value per indexable coordinate.
+     */
+    std::vector<std::optional<Value>> entries{};
+    /**
+     * Number of assigned values.
+     */
+    std::size_t num_elements{0};
+    /**
+     * Enlarges the index range such that it contains `c` and re-maps all stored values.
+     *
+     * @param c Coordinate that has to be contained in the enlarged index range.
+     */
+    void grow(const offset::ucoord_t& c)
+    {
+        const auto old_size = indexer.size();
+
+        const auto                        new_indexer = indexer.grown_to(c);
+        std::vector<std::optional<Value>> new_entries(new_indexer.size());
+
+        for (std::size_t i = 0; i < old_size; ++i)
+        {
+            if (entries[i].has_value())
+            {
+                new_entries[new_indexer(indexer.coordinate_at(i))] = std::move(entries[i]);
+            }
+        }
+
+        indexer = new_indexer;
+        entries = std::move(new_entries);
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_DENSE_COORDINATE_UTILS_HPP
@@ -0,0 +1,669 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#ifndef FICTION_INSTRUMENTATION_HPP
+#define FICTION_INSTRUMENTATION_HPP
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Accumulated run-time information of a named code region that is measured via `scoped_profile_timer`. All members
+ * may be updated concurrently.
+ */
+struct profile_timer
+{
+    /**
+     * Constructs a timer with the given name.
+     *
+     * @param n Name of the timer.
+     */
+    explicit profile_timer(std::string n) noexcept : name{std::move(n)} {}
+    /**
+     * Name of the measured code region.
+     */
+    const std::string name;
+    /**
+     * Number of times the code region was entered.
+     */
+    std::atomic<uint64_t> calls{0};
+    /**
+     * Total time spent in the code region (unit: ns).
+     */
+    std::atomic<uint64_t> total_ns{0};
+    /**
+     * Shortest time spent in the code region during a single call (unit: ns).
+     */
+    std::atomic<uint64_t> min_ns{std::numeric_limits<uint64_t>::max()};
+    /**
+     * Longest time spent in the code region during a single call (unit: ns).
+     */
+    std::atomic<uint64_t> max_ns{0};
+};
+/**
+ * A histogram of non-negative integral values with logarithmically sized buckets. Bucket 0 counts all zeros and bucket
+ * \f$i > 0\f$ counts all values in \f$[2^{i-1}, 2^i)\f$. All members may be updated concurrently.
+ */
+struct profile_histogram
+{
+    /**
+     * Number of buckets, which suffices to represent all 64-bit values.
+     */
+    static constexpr std::size_t NUM_BUCKETS = 65;
+    /**
+     * Constructs a histogram with the given name.
+     *
+     * @param n Name of the histogram.
+     */
+    explicit profile_histogram(std::string n) noexcept : name{std::move(n)} {}
+    /**
+     * Name of the histogram.
+     */
+    const std::string name;
+    /**
+     * Number of recorded values per bucket.
+     */
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+    /**
+     * Number of recorded values.
+     */
+    std::atomic<uint64_t> count{0};
+    /**
+     * Sum of all recorded values.
+     */
+    std::atomic<uint64_t> sum{0};
+    /**
+     * Returns the bucket that the given value is counted in.
+     *
+     * @param value Value to classify.
+     * @return Index of the bucket `value` belongs to.
+     */
+    [[nodiscard]] static constexpr std::size_t bucket_of(uint64_t value) noexcept
+    {
+        std::size_t bucket = 0;
+
+        while (value != 0)
+        {
+            value >>= 1u;
+            ++bucket;
+        }
+
+        return bucket;
+    }
+    /**
+     * Records a value.
+     *
+     * @param value Value to record.
+     */
+    void record(const uint64_t value) noexcept
+    {
+        buckets[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+    }
+};
+/**
+ * A single timed occurrence of a code region that is exported as a complete event in the Chrome trace-event format.
+ */
+struct profile_trace_event
+{
+    /**
+     * Timer that measured the event.
+     */
+    const profile_timer* timer;
+    /**
+     * Start of the event relative to the profiler's epoch (unit: ns).
+     */
+    uint64_t start_ns;
+    /**
+     * Duration of the event (unit: ns).
+     */
+    uint64_t duration_ns;
+    /**
+     * Identifier of the thread that the event occurred in.
+     */
+    uint32_t thread_id;
+};
+/**
+ * A process-wide registry of named timers, counters, and histograms that are used to instrument the hot paths of
+ * *fiction*'s algorithms, e.g., simulator invocations, A* expansions, SMT checks, charge distribution surface potential
+ * updates, and hash map probes. Its contents can be exported as a flat profile or in the Chrome trace-event format,
+ * which can be inspected via `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * Instrumentation points are usually not placed via this class directly but via the macros `FICTION_PROFILE_SCOPE`,
+ * `FICTION_PROFILE_COUNT`, and `FICTION_PROFILE_HISTOGRAM`, which expand to nothing unless *fiction* was configured
+ * with `-DFICTION_INSTRUMENTATION=ON`. Consequently, instrumented algorithms do not pay for it in regular builds.
+ *
+ * Timers, counters, and histograms are created on first use and live until the end of the program. Looking them up by
+ * name requires a lock. Updating them, however, is lock-free such that the macros, which cache the lookup in a static
+ * variable, can be used in code that is executed concurrently. Recording individual trace events is disabled by default
+ * because it may produce large amounts of data. It can be enabled via `enable_tracing`.
+ *
+ * Example:
+ * @code{.cpp}
+ * fiction::profiler::instance().enable_tracing(true);
+ *
+ * const auto layout = fiction::exact<cart_gate_clk_lyt>(network, params);
+ *
+ * fiction::profiler::instance().write_flat_profile(std::cout);
+ * fiction::profiler::instance().write_chrome_trace("exact.trace.json");
+ * @endcode
+ */
+class profiler
+{
+  public:
+    /**
+     * Returns the process-wide profiler.
+     *
+     * @return Reference to the profiler.
+     */
+    [[nodiscard]] static profiler& instance() noexcept
+    {
+        static profiler p{};
+
+        return p;
+    }
+    /**
+     * Returns the timer with the given name. It is created if it does not exist yet. The returned reference remains
+     * valid until the end of the program.
+     *
+     * @param name Name of the timer.
+     * @return Reference to the timer called `name`.
+     */
+    [[nodiscard]] profile_timer& timer(const std::string_view& name)
+    {
+        return fetch(timers, name);
+    }
+    /**
+     * Returns the counter with the given name. It is created if it does not exist yet. The returned reference remains
+     * valid until the end of the program.
+     *
+     * @param name Name of the counter.
+     * @return Reference to the counter called `name`.
+     */
+    [[nodiscard]] std::atomic<uint64_t>& counter(const std::string_view& name)
+    {
+        return fetch(counters, name).value;
+    }
+    /**
+     * Returns the histogram with the given name. It is created if it does not exist yet. The returned reference remains
+     * valid until the end of the program.
+     *
+     * @param name Name of the histogram.
+     * @return Reference to the histogram called `name`.
+     */
+    [[nodiscard]] profile_histogram& histogram(const std::string_view& name)
+    {
+        return fetch(histograms, name);
+    }
+    /**
+     * Enables or disables the recording of individual trace events. While disabled, timers only accumulate their
+     * totals.
+     *
+     * @param enable `true` to record trace events, `false` to stop doing so.
+     * @param max_events Maximum number of trace events to keep. Any further events are discarded.
+     */
+    void enable_tracing(const bool enable, const std::size_t max_events = 1'000'000) noexcept
+    {
+        max_trace_events.store(max_events, std::memory_order_relaxed);
+        tracing.store(enable, std::memory_order_release);
+    }
+    /**
+     * Checks whether individual trace events are currently recorded.
+     *
+     * @return `true` iff tracing is enabled.
+     */
+    [[nodiscard]] bool is_tracing() const noexcept
+    {
+        return tracing.load(std::memory_order_acquire);
+    }
+    /**
+     * Returns the time that has passed since the profiler's epoch, i.e., its creation or the last call to `reset`.
+     *
+     * @return Elapsed time since the epoch (unit: ns).
+     */
+    [[nodiscard]] uint64_t now_ns() const noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now() - epoch.load(std::memory_order_relaxed))
+                                         .count());
+    }
+    /**
+     * Adds a measurement to the given timer and records a trace event for it if tracing is enabled.
+     *
+     * @param t Timer to update.
+     * @param start_ns Start of the measured region relative to the profiler's epoch (unit: ns).
+     * @param duration_ns Duration of the measured region (unit: ns).
+     */
+    void record(profile_timer& t, const uint64_t start_ns, const uint64_t duration_ns) noexcept
+    {
+        t.calls.fetch_add(1, std::memory_order_relaxed);
+        t.total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+
+        for (auto min = t.min_ns.load(std::memory_order_relaxed);
+             duration_ns < min && !t.min_ns.compare_exchange_weak(min, duration_ns, std::memory_order_relaxed);)
+        {}
+        for (auto max = t.max_ns.load(std::memory_order_relaxed);
+             duration_ns > max && !t.max_ns.compare_exchange_weak(max, duration_ns, std::memory_order_relaxed);)
+        {}
+
+        if (is_tracing())
+        {
+            const std::lock_guard<std::mutex> lock{trace_mutex};
+
+            if (trace.size() < max_trace_events.load(std::memory_order_relaxed))
+            {
+                trace.push_back({&t, start_ns, duration_ns, current_thread_id()});
+            }
+        }
+    }
+    /**
+     * Resets all timers, counters, and histograms to zero, discards all trace events, and restarts the epoch.
+     * Previously returned references remain valid.
+     */
+    void reset() noexcept
+    {
+        const std::lock_guard<std::mutex> registry_lock{registry_mutex};
+        const std::lock_guard<std::mutex> trace_lock{trace_mutex};
+
+        for (auto& [name, t] : timers)
+        {
+            t->calls.store(0, std::memory_order_relaxed);
+            t->total_ns.store(0, std::memory_order_relaxed);
+            t->min_ns.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+            t->max_ns.store(0, std::memory_order_relaxed);
+        }
+        for (auto& [name, c] : counters)
+        {
+            c->value.store(0, std::memory_order_relaxed);
+        }
+        for (auto& [name, h] : histograms)
+        {
+            std::for_each(h->buckets.begin(), h->buckets.end(),
+                          [](auto& b) { b.store(0, std::memory_order_relaxed); });
+            h->count.store(0, std::memory_order_relaxed);
+            h->sum.store(0, std::memory_order_relaxed);
+        }
+
+        trace.clear();
+        epoch.store(std::chrono::steady_clock::now(), std::memory_order_relaxed);
+    }
+    /**
+     * Writes a human-readable flat profile of all timers, counters, and histograms that were used at least once. Timers
+     * are sorted by their total run time in descending order.
+     *
+     * @param os The output stream to write into.
+     */
+    void write_flat_profile(std::ostream& os) const
+    {
+        const std::lock_guard<std::mutex> lock{registry_mutex};
+
+        std::vector<const profile_timer*> used_timers{};
+        for (const auto& [name, t] : timers)
+        {
+            if (t->calls.load(std::memory_order_relaxed) != 0)
+            {
+                used_timers.push_back(t.get());
+            }
+        }
+
+        std::sort(used_timers.begin(), used_timers.end(),
+                  [](const auto* t1, const auto* t2)
+                  {
+                      return t1->total_ns.load(std::memory_order_relaxed) >
+                             t2->total_ns.load(std::memory_order_relaxed);
+                  });
+
+        os << fmt::format("{:<60} {:>12} {:>14} {:>12} {:>12} {:>12}\n", "timer", "calls", "total [ms]", "mean [us]",
+                          "min [us]", "max [us]");
+
+        for (const auto* t : used_timers)
+        {
+            const auto calls = t->calls.load(std::memory_order_relaxed);
+            const auto total = static_cast<double>(t->total_ns.load(std::memory_order_relaxed));
+
+            os << fmt::format("{:<60} {:>12} {:>14.3f} {:>12.3f} {:>12.3f} {:>12.3f}\n", t->name, calls, total / 1e6,
+                              total / static_cast<double>(calls) / 1e3,
+                              static_cast<double>(t->min_ns.load(std::memory_order_relaxed)) / 1e3,
+                              static_cast<double>(t->max_ns.load(std::memory_order_relaxed)) / 1e3);
+        }
+
+        os << fmt::format("\n{:<60} {:>12}\n", "counter", "value");
+
+        for (const auto& [name, c] : counters)
+        {
+            if (const auto value = c->value.load(std::memory_order_relaxed); value != 0)
+            {
+                os << fmt::format("{:<60} {:>12}\n", name, value);
+            }
+        }
+
+        for (const auto& [name, h] : histograms)
+        {
+            const auto count = h->count.load(std::memory_order_relaxed);
+
+            if (count == 0)
+            {
+                continue;
+            }
+
+            os << fmt::format("\nhistogram: {} (count: {}, mean: {:.3f})\n", name, count,
+                              static_cast<double>(h->sum.load(std::memory_order_relaxed)) /
+                                  static_cast<double>(count));
+
+            for (std::size_t i = 0; i < profile_histogram::NUM_BUCKETS; ++i)
+            {
+                if (const auto num = h->buckets[i].load(std::memory_order_relaxed); num != 0)
+                {
+                    os << fmt::format("  {:>24} {:>12}\n", bucket_label(i), num);
+                }
+            }
+        }
+    }
+    /**
+     * Writes a flat profile (see above) into the given file.
+     *
+     * @param filename The file name to create and write into.
+     */
+    void write_flat_profile(const std::string_view& filename) const
+    {
+        std::ofstream os{filename.data(), std::ofstream::out};
+
+        if (!os.is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+
+        write_flat_profile(os);
+        os.close();
+    }
+    /**
+     * Writes all recorded trace events in the Chrome trace-event format. Each event is represented as a complete event
+     * (phase `X`). Additionally, the final value of each counter is represented as a counter event (phase `C`) and the
+     * accumulated timer statistics are attached as `otherData` such that the profile is available even if tracing was
+     * disabled.
+     *
+     * @param os The output stream to write into.
+     */
+    void write_chrome_trace(std::ostream& os) const
+    {
+        const std::lock_guard<std::mutex> registry_lock{registry_mutex};
+        const std::lock_guard<std::mutex> trace_lock{trace_mutex};
+
+        auto events = nlohmann::json::array();
+
+        for (const auto& e : trace)
+        {
+            events.push_back({{"name", e.timer->name},
+                              {"cat", "fiction"},
+                              {"ph", "X"},
+                              {"ts", static_cast<double>(e.start_ns) / 1e3},
+                              {"dur", static_cast<double>(e.duration_ns) / 1e3},
+                              {"pid", 0},
+                              {"tid", e.thread_id}});
+        }
+
+        const auto end_ts = static_cast<double>(now_ns()) / 1e3;
+
+        for (const auto& [name, c] : counters)
+        {
+            events.push_back({{"name", name},
+                              {"cat", "fiction"},
+                              {"ph", "C"},
+                              {"ts", end_ts},
+                              {"pid", 0},
+                              {"args", {{"value", c->value.load(std::memory_order_relaxed)}}}});
+        }
+
+        auto timer_stats = nlohmann::json::object();
+
+        for (const auto& [name, t] : timers)
+        {
+            timer_stats[name] = {{"calls", t->calls.load(std::memory_order_relaxed)},
+                                 {"total_ns", t->total_ns.load(std::memory_order_relaxed)}};
+        }
+
+        nlohmann::json trace_json{{"traceEvents", events},
+                                  {"displayTimeUnit", "ms"},
+                                  {"otherData", {{"timers", timer_stats}}}};
+
+        os << trace_json.dump() << '\n';
+    }
+    /**
+     * Writes all recorded trace events in the Chrome trace-event format (see above) into the given file.
+     *
+     * @param filename The file name to create and write into.
+     */
+    void write_chrome_trace(const std::string_view& filename) const
+    {
+        std::ofstream os{filename.data(), std::ofstream::out};
+
+        if (!os.is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+
+        write_chrome_trace(os);
+        os.close();
+    }
+
+  private:
+    /**
+     * Wraps an atomic counter such that it can be stored alongside timers and histograms.
+     */
+    struct profile_counter
+    {
+        explicit profile_counter([[maybe_unused]] const std::string& n) noexcept {}
+
+        std::atomic<uint64_t> value{0};
+    };
+    /**
+     * Timers, counters, and histograms by name. They are heap-allocated such that references to them remain stable.
+     */
+    std::map<std::string, std::unique_ptr<profile_timer>, std::less<>>     timers{};
+    std::map<std::string, std::unique_ptr<profile_counter>, std::less<>>   counters{};
+    std::map<std::string, std::unique_ptr<profile_histogram>, std::less<>> histograms{};
+    /**
+     * Guards the creation of timers, counters, and histograms.
+     */
+    mutable std::mutex registry_mutex{};
+    /**
+     * Recorded trace events.
+     */
+    std::vector<profile_trace_event> trace{};
+    /**
+     * Guards the trace events.
+     */
+    mutable std::mutex trace_mutex{};
+    /**
+     * Flag to indicate whether trace events are recorded.
+     */
+    std::atomic<bool> tracing{false};
+    /**
+     * Maximum number of trace events to keep.
+     */
+    std::atomic<std::size_t> max_trace_events{1'000'000};
+    /**
+     * Point in time that all trace events are relative to.
+     */
+    std::atomic<std::chrono::steady_clock::time_point> epoch{std::chrono::steady_clock::now()};
+
+    profiler() noexcept = default;
+
+    template <typename T>
+    T& fetch(std::map<std::string, std::unique_ptr<T>, std::less<>>& registry, const std::string_view& name)
+    {
+        const std::lock_guard<std::mutex> lock{registry_mutex};
+
+        if (const auto it = registry.find(name); it != registry.end())
+        {
+            return *it->second;
+        }
+
+        const auto [it, _] = registry.emplace(std::string{name}, std::make_unique<T>(std::string{name}));
+
+        return *it->second;
+    }
+    /**
+     * Returns a small, process-unique identifier of the calling thread.
+     *
+     * @return Identifier of the calling thread.
+     */
+    [[nodiscard]] static uint32_t current_thread_id() noexcept
+    {
+        static std::atomic<uint32_t> next_id{0};
+        thread_local const uint32_t  id = next_id.fetch_add(1, std::memory_order_relaxed);
+
+        return id;
+    }
+    /**
+     * Returns a label for the range of values that the given histogram bucket counts.
+     *
+     * @param bucket Index of the bucket.
+     * @return Label of the bucket.
+     */
+    [[nodiscard]] static std::string bucket_label(const std::size_t bucket)
+    {
+        if (bucket == 0)
+        {
+            return "0";
+        }
+        if (bucket == profile_histogram::NUM_BUCKETS - 1)
+        {
+            return fmt::format("[{}, inf)", uint64_t{1} << (bucket - 1));
+        }
+
+        return fmt::format("[{}, {})", uint64_t{1} << (bucket - 1), uint64_t{1} << bucket);
+    }
+};
+/**
+ * Measures the time between its construction and destruction and adds it to a `profile_timer` of the process-wide
+ * `profiler`.
+ */
+class scoped_profile_timer
+{
+  public:
+    /**
+     * Starts the measurement.
+     *
+     * @param t Timer to add the measurement to.
+     */
+    explicit scoped_profile_timer(profile_timer& t) noexcept : timer{t}, start{profiler::instance().now_ns()} {}
+    /**
+     * Stops the measurement and records it.
+     */
+    ~scoped_profile_timer() noexcept
+    {
+        auto& p = profiler::instance();
+
+        p.record(timer, start, p.now_ns() - start);
+    }
+
+    scoped_profile_timer(const scoped_profile_timer&)            = delete;
+    scoped_profile_timer(scoped_profile_timer&&)                 = delete;
+    scoped_profile_timer& operator=(const scoped_profile_timer&) = delete;
+    scoped_profile_timer& operator=(scoped_profile_timer&&)      = delete;
+
+  private:
+    /**
+     * Timer to add the measurement to.
+     */
+    profile_timer& timer;
+    /**
+     * Start of the measurement relative to the profiler's epoch (unit: ns).
+     */
+    const uint64_t start;
+};
+
+}  // namespace fiction
+
+#define FICTION_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FICTION_PROFILE_CONCAT(a, b) FICTION_PROFILE_CONCAT_IMPL(a, b)
+
+#if (FICTION_INSTRUMENTATION)
+
+/**
+ * Measures the run time of the enclosing scope and adds it to the timer called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`.
+ */
+#define FICTION_PROFILE_SCOPE(name)                                                                                    \
+    static auto& FICTION_PROFILE_CONCAT(fiction_profile_timer_, __LINE__) =                                            \
+        ::fiction::profiler::instance().timer(name);                                                                   \
+    const ::fiction::scoped_profile_timer FICTION_PROFILE_CONCAT(fiction_profile_scope_, __LINE__)                     \
+    {                                                                                                                  \
+        FICTION_PROFILE_CONCAT(fiction_profile_timer_, __LINE__)                                                       \
+    }
+/**
+ * Adds `n` to the counter called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`. Otherwise, `n` is not evaluated.
+ */
+#define FICTION_PROFILE_COUNT(name, n)                                                                                 \
+    do {                                                                                                               \
+        static auto& fiction_profile_counter = ::fiction::profiler::instance().counter(name);                          \
+        fiction_profile_counter.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);                        \
+    } while (false)
+/**
+ * Records `value` in the histogram called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`. Otherwise, `value` is not evaluated.
+ */
+#define FICTION_PROFILE_HISTOGRAM(name, value)                                                                         \
+    do {                                                                                                               \
+        static auto& fiction_profile_histogram = ::fiction::profiler::instance().histogram(name);                      \
+        fiction_profile_histogram.record(static_cast<uint64_t>(value));                                                \
+    } while (false)
+
+#else
+
+/**
+ * Measures the run time of the enclosing scope and adds it to the timer called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`.
+ */
+#define FICTION_PROFILE_SCOPE(name) static_cast<void>(0)
+/**
+ * Adds `n` to the counter called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`. Otherwise, `n` is not evaluated.
+ */
+#define FICTION_PROFILE_COUNT(name, n) static_cast<void>(0)
+/**
+ * Records `value` in the histogram called `name`.
+ *
+ * @note This macro expands to nothing unless `FICTION_INSTRUMENTATION` is defined, which is the case if *fiction* was
+ * configured with `-DFICTION_INSTRUMENTATION=ON`. Otherwise, `value` is not evaluated.
+ */
+#define FICTION_PROFILE_HISTOGRAM(name, value) static_cast<void>(0)
+
+#endif
+
+#endif  // FICTION_INSTRUMENTATION_HPP
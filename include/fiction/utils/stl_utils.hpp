@@ -152,6 +152,14 @@ class searchable_priority_queue : public std::priority_queue<T, Container, Compa
     {
         return find(val) != this->c.cend();
     }
+    /**
+     * Removes all elements from the priority queue while keeping the capacity of the underlying container. This allows
+     * for reusing the queue without reallocation.
+     */
+    void clear() noexcept
+    {
+        this->c.clear();
+    }
 };
 
 }  // namespace fiction
@@ -0,0 +1,8 @@
+//
+// Created by agent on 18.10.26.
+//
+
+// turn the explicit instantiation declarations into explicit instantiation definitions
+#define FICTION_EXTERN_TEMPLATE template
+
+#include <fiction/instantiations/physical_design.hpp>
@@ -283,3 +283,40 @@ TEMPLATE_TEST_CASE("Name conservation after technology mapping", "[technology-ma
     CHECK(mapped_maj.get_network_name() == "maj");
     map_and_check_all_standard_func(blueprints::maj4_network<TestType>());
 }
+
+TEST_CASE("Technology library caching", "[technology-mapping]")
+{
+    const auto ntk = blueprints::maj4_network<mockturtle::aig_network>();
+
+    clear_technology_mapping_library_cache();
+
+    technology_mapping_stats first_stats{};
+    technology_mapping_stats second_stats{};
+    technology_mapping_stats uncached_stats{};
+
+    auto params = all_supported_functions();
+
+    const auto first_mapped_ntk = technology_mapping(ntk, params, &first_stats);
+    CHECK(!first_stats.library_cache_hit);
+
+    const auto second_mapped_ntk = technology_mapping(ntk, params, &second_stats);
+    CHECK(second_stats.library_cache_hit);
+
+    params.cache_library = false;
+
+    const auto uncached_mapped_ntk = technology_mapping(ntk, params, &uncached_stats);
+    CHECK(!uncached_stats.library_cache_hit);
+
+    // a different gate set is not served from the cache
+    technology_mapping_stats other_stats{};
+    technology_mapping(ntk, all_standard_3_input_functions(), &other_stats);
+    CHECK(!other_stats.library_cache_hit);
+
+    CHECK(first_mapped_ntk.num_gates() == second_mapped_ntk.num_gates());
+    CHECK(first_mapped_ntk.num_gates() == uncached_mapped_ntk.num_gates());
+
+    check_eq(ntk, second_mapped_ntk);
+    check_eq(ntk, uncached_mapped_ntk);
+
+    clear_technology_mapping_library_cache();
+}
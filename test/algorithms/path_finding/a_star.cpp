@@ -7,6 +7,7 @@
 #include <fiction/algorithms/path_finding/a_star.hpp>
 #include <fiction/algorithms/path_finding/cost.hpp>
 #include <fiction/algorithms/path_finding/distance.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
 #include <fiction/layouts/coordinates.hpp>
@@ -663,3 +664,153 @@ TEST_CASE("A* path finding with the A* distance functor (don't do this!)", "[A*]
         }
     }
 }
+
+TEST_CASE("A* with dense storage", "[A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    a_star_params dense_params{};
+    dense_params.dense_storage = true;
+
+    SECTION("(0,0) to (3,3) with coordinate obstruction")
+    {
+        const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+        obstruction_layout obstr_lyt{layout, obstruction_storage::DENSE};
+
+        obstr_lyt.obstruct_coordinate({3, 0});
+        obstr_lyt.obstruct_coordinate({3, 1});
+        obstr_lyt.obstruct_coordinate({1, 2});
+        obstr_lyt.obstruct_coordinate({2, 2});
+
+        const auto path = a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}}, manhattan_distance_functor<obst_lyt>(),
+                                             unit_cost_functor<obst_lyt>(), dense_params);  // only one path possible
+
+        CHECK(path.size() == 7);
+        CHECK(path.source() == coordinate<obst_lyt>{0, 0});
+        CHECK(path.target() == coordinate<obst_lyt>{3, 3});
+        CHECK(path[1] == coordinate<obst_lyt>{0, 1});
+        CHECK(path[2] == coordinate<obst_lyt>{0, 2});
+        CHECK(path[3] == coordinate<obst_lyt>{0, 3});
+        CHECK(path[4] == coordinate<obst_lyt>{1, 3});
+        CHECK(path[5] == coordinate<obst_lyt>{2, 3});
+    }
+    SECTION("agreement with hashed storage across repeated searches and resizing")
+    {
+        clk_lyt layout{{5, 5}, use_clocking<clk_lyt>()};
+
+        obstruction_layout obstr_lyt{layout, obstruction_storage::DENSE};
+        obstr_lyt.obstruct_coordinate({2, 1});
+        obstr_lyt.obstruct_coordinate({1, 3});
+
+        const auto compare_all_pairs = [&obstr_lyt, &dense_params]()
+        {
+            obstr_lyt.foreach_coordinate(
+                [&](const auto& src)
+                {
+                    obstr_lyt.foreach_coordinate(
+                        [&](const auto& tgt)
+                        {
+                            const auto hashed_path = a_star<coord_path>(obstr_lyt, {src, tgt});
+                            const auto dense_path =
+                                a_star<coord_path>(obstr_lyt, {src, tgt}, manhattan_distance_functor<obst_lyt>(),
+                                                   unit_cost_functor<obst_lyt>(), dense_params);
+
+                            CHECK(hashed_path.size() == dense_path.size());
+                        });
+                });
+        };
+
+        compare_all_pairs();
+
+        obstr_lyt.resize({7, 6, 0});
+        obstr_lyt.obstruct_coordinate({6, 5});
+
+        compare_all_pairs();
+    }
+    SECTION("layouts without densely indexable coordinates fall back to hashed storage")
+    {
+        using cube_lyt = cartesian_layout<cube::coord_t>;
+
+        const cube_lyt layout{{3, 3}};
+
+        const auto path = a_star<layout_coordinate_path<cube_lyt>>(
+            layout, {{0, 0}, {3, 3}}, manhattan_distance_functor<cube_lyt>(), unit_cost_functor<cube_lyt>(),
+            dense_params);
+
+        CHECK(path.size() == 7);
+    }
+}
+
+TEST_CASE("A* with reusable search context", "[A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    clk_lyt layout{{5, 5}, use_clocking<clk_lyt>()};
+
+    obstruction_layout obstr_lyt{layout, obstruction_storage::DENSE};
+    obstr_lyt.obstruct_coordinate({2, 1});
+    obstr_lyt.obstruct_coordinate({1, 3});
+
+    const auto compare_all_pairs = [&obstr_lyt](auto& context)
+    {
+        obstr_lyt.foreach_coordinate(
+            [&](const auto& src)
+            {
+                obstr_lyt.foreach_coordinate(
+                    [&](const auto& tgt)
+                    {
+                        const auto expected_path = a_star<coord_path>(obstr_lyt, {src, tgt});
+                        const auto context_path  = a_star<coord_path>(obstr_lyt, {src, tgt}, context);
+
+                        CHECK(expected_path.size() == context_path.size());
+
+                        if (!context_path.empty())
+                        {
+                            CHECK(context_path.source() == src);
+                            CHECK(context_path.target() == tgt);
+                        }
+                    });
+            });
+    };
+
+    SECTION("hashed storage")
+    {
+        path_search_context<offset::ucoord_t> context{};
+
+        compare_all_pairs(context);
+
+        obstr_lyt.resize({7, 6, 0});
+        obstr_lyt.obstruct_coordinate({6, 5});
+
+        compare_all_pairs(context);
+    }
+    SECTION("dense storage")
+    {
+        dense_path_search_context<offset::ucoord_t> context{};
+
+        compare_all_pairs(context);
+
+        obstr_lyt.resize({7, 6, 0});
+        obstr_lyt.obstruct_coordinate({6, 5});
+
+        compare_all_pairs(context);
+    }
+    SECTION("context shared between layouts of different types")
+    {
+        preferred_path_search_context<offset::ucoord_t> context{};
+
+        const auto path_1 = a_star<coord_path>(obstr_lyt, {{0, 0}, {5, 5}}, context);
+        const auto path_2 =
+            a_star<layout_coordinate_path<clk_lyt>>(layout, {{0, 0}, {5, 5}}, context);  // ignores obstructions
+        const auto path_3 = a_star<coord_path>(obstr_lyt, {{0, 0}, {5, 5}}, context);
+
+        CHECK(path_1.size() == 11);
+        CHECK(path_2.size() == 11);
+        CHECK(path_1 == path_3);
+    }
+}
@@ -0,0 +1,237 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/bidirectional_a_star.hpp>
+#include <fiction/algorithms/path_finding/cost.hpp>
+#include <fiction/algorithms/path_finding/distance.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+namespace
+{
+
+template <typename Path, typename Lyt>
+void check_path_validity(const Lyt& lyt, const Path& path, const routing_objective<Lyt>& objective)
+{
+    REQUIRE(!path.empty());
+
+    CHECK(path.source() == objective.source);
+    CHECK(path.target() == objective.target);
+
+    for (auto i = 1ul; i < path.size(); ++i)
+    {
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            CHECK(lyt.is_outgoing_clocked(path[i - 1], path[i]));
+        }
+        else
+        {
+            CHECK(lyt.is_adjacent_of(path[i - 1], path[i]));
+        }
+
+        if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+        {
+            if (path[i] != objective.target)
+            {
+                CHECK(!lyt.is_obstructed_coordinate(path[i]));
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Bidirectional A* on 4x4 layouts", "[bidirectional-A*]")
+{
+    using lyt        = cartesian_layout<offset::ucoord_t>;
+    using coord_path = layout_coordinate_path<lyt>;
+
+    const lyt layout{{3, 3}};
+
+    SECTION("(0,0) to (3,3)")
+    {
+        const auto path = bidirectional_a_star<coord_path>(layout, {{0, 0}, {3, 3}});
+
+        CHECK(path.size() == 7);
+        check_path_validity(layout, path, {{0, 0}, {3, 3}});
+    }
+    SECTION("(3,1) to (0,2)")
+    {
+        const auto path = bidirectional_a_star<coord_path>(layout, {{3, 1}, {0, 2}});
+
+        CHECK(path.size() == 5);
+        check_path_validity(layout, path, {{3, 1}, {0, 2}});
+    }
+    SECTION("(0,0) to (0,0)")  // source and target are identical
+    {
+        const auto path = bidirectional_a_star<coord_path>(layout, {{0, 0}, {0, 0}});
+
+        CHECK(path.size() == 1);
+        CHECK(path.source() == coordinate<lyt>{0, 0});
+    }
+    SECTION("(0,0) to (1,0)")  // adjacent coordinates
+    {
+        const auto path = bidirectional_a_star<coord_path>(layout, {{0, 0}, {1, 0}});
+
+        CHECK(path.size() == 2);
+        check_path_validity(layout, path, {{0, 0}, {1, 0}});
+    }
+}
+
+TEST_CASE("Bidirectional A* on clocked layouts", "[bidirectional-A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    SECTION("2DDWave")
+    {
+        const clk_lyt layout{{5, 5}, twoddwave_clocking<clk_lyt>()};
+
+        const auto path = bidirectional_a_star<coord_path>(layout, {{0, 0}, {5, 5}});
+
+        CHECK(path.size() == 11);
+        check_path_validity(layout, path, {{0, 0}, {5, 5}});
+
+        // clocking prohibits paths against the information flow
+        CHECK(bidirectional_a_star<coord_path>(layout, {{5, 5}, {0, 0}}).empty());
+    }
+    SECTION("USE and RES")
+    {
+        for (const auto& scheme : {use_clocking<clk_lyt>(), res_clocking<clk_lyt>()})
+        {
+            const clk_lyt layout{{7, 7}, scheme};
+
+            layout.foreach_ground_coordinate(
+                [&layout](const auto& src)
+                {
+                    layout.foreach_ground_coordinate(
+                        [&layout, &src](const auto& tgt)
+                        {
+                            const auto path = bidirectional_a_star<coord_path>(layout, {src, tgt});
+
+                            // path lengths are identical to the ones of the unidirectional A*
+                            CHECK(path.size() == a_star<coord_path>(layout, {src, tgt}).size());
+
+                            if (!path.empty())
+                            {
+                                check_path_validity(layout, path, {src, tgt});
+                            }
+                        });
+                });
+        }
+    }
+}
+
+TEST_CASE("Bidirectional A* with coordinate obstruction", "[bidirectional-A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    SECTION("2DDWave")
+    {
+        const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+        obst_lyt obstr_lyt{layout};
+
+        obstr_lyt.obstruct_coordinate({3, 0});
+        obstr_lyt.obstruct_coordinate({3, 1});
+        obstr_lyt.obstruct_coordinate({1, 2});
+        obstr_lyt.obstruct_coordinate({2, 2});
+
+        const auto path = bidirectional_a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}});  // only one path possible
+
+        REQUIRE(path.size() == 7);
+        check_path_validity(obstr_lyt, path, {{0, 0}, {3, 3}});
+        CHECK(path[1] == coordinate<obst_lyt>{0, 1});
+        CHECK(path[2] == coordinate<obst_lyt>{0, 2});
+        CHECK(path[3] == coordinate<obst_lyt>{0, 3});
+        CHECK(path[4] == coordinate<obst_lyt>{1, 3});
+        CHECK(path[5] == coordinate<obst_lyt>{2, 3});
+
+        // blocking the remaining path
+        obstr_lyt.obstruct_coordinate({0, 3});
+
+        CHECK(bidirectional_a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}}).empty());
+    }
+    SECTION("obstructed target")
+    {
+        const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+        obst_lyt obstr_lyt{layout};
+
+        obstr_lyt.obstruct_coordinate({3, 3});
+
+        const auto path = bidirectional_a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}});
+
+        CHECK(path.size() == a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}}).size());
+        check_path_validity(obstr_lyt, path, {{0, 0}, {3, 3}});
+    }
+    SECTION("random obstructions")
+    {
+        const clk_lyt layout{{9, 9}, res_clocking<clk_lyt>()};
+
+        obst_lyt obstr_lyt{layout};
+
+        // obstruct a deterministic pseudo-random pattern
+        obstr_lyt.foreach_ground_coordinate(
+            [&obstr_lyt](const auto& c)
+            {
+                if ((c.x * 7 + c.y * 13) % 5 == 0 && c != coordinate<obst_lyt>{0, 0})
+                {
+                    obstr_lyt.obstruct_coordinate(c);
+                }
+            });
+
+        auto forward_context  = preferred_path_search_context<coordinate<obst_lyt>, uint64_t>{};
+        auto backward_context = preferred_path_search_context<coordinate<obst_lyt>, uint64_t>{};
+
+        obstr_lyt.foreach_ground_coordinate(
+            [&](const auto& tgt)
+            {
+                const auto path = bidirectional_a_star<coord_path>(obstr_lyt, {{0, 0}, tgt}, forward_context,
+                                                                   backward_context);
+
+                CHECK(path.size() == a_star<coord_path>(obstr_lyt, {{0, 0}, tgt}).size());
+
+                if (!path.empty())
+                {
+                    check_path_validity(obstr_lyt, path, {{0, 0}, tgt});
+                }
+            });
+    }
+}
+
+TEST_CASE("Bidirectional A* with dense storage", "[bidirectional-A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{6, 6}, esr_clocking<clk_lyt>()};
+
+    bidirectional_a_star_params params{};
+    params.dense_storage = true;
+
+    layout.foreach_ground_coordinate(
+        [&layout, &params](const auto& tgt)
+        {
+            const auto hashed = bidirectional_a_star<coord_path>(layout, {{0, 0}, tgt});
+            const auto dense  = bidirectional_a_star<coord_path>(
+                layout, {{0, 0}, tgt}, manhattan_distance_functor<clk_lyt, uint64_t>(),
+                unit_cost_functor<clk_lyt, uint8_t>(), params);
+
+            CHECK(hashed.size() == dense.size());
+        });
+}
@@ -6,6 +6,7 @@
 
 #include <fiction/algorithms/path_finding/distance.hpp>
 #include <fiction/algorithms/path_finding/jump_point_search.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
 #include <fiction/layouts/coordinates.hpp>
@@ -410,3 +411,54 @@ TEST_CASE("JPS on 10x10 layouts with varying distance functions", "[JPS]")
         }
     }
 }
+
+TEST_CASE("JPS with dense storage", "[JPS]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    const clk_lyt layout{{9, 9}, res_clocking<clk_lyt>()};
+
+    obstruction_layout obstr_lyt{layout, obstruction_storage::DENSE};
+    obstr_lyt.obstruct_coordinate({4, 4});
+    obstr_lyt.obstruct_coordinate({5, 4});
+
+    obstr_lyt.foreach_coordinate(
+        [&obstr_lyt](const auto& tgt)
+        {
+            const auto hashed_path = jump_point_search<coord_path>(obstr_lyt, {{0, 0}, tgt});
+            const auto dense_path  = jump_point_search<coord_path>(
+                obstr_lyt, {{0, 0}, tgt}, manhattan_distance_functor<obst_lyt>(), jump_point_search_params{true});
+
+            CHECK(hashed_path.size() == dense_path.size());
+        });
+}
+
+TEST_CASE("JPS with reusable search context", "[JPS]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    const clk_lyt layout{{5, 5}, twoddwave_clocking<clk_lyt>()};
+
+    obstruction_layout obstr_lyt{layout};
+    obstr_lyt.obstruct_coordinate({2, 1});
+    obstr_lyt.obstruct_coordinate({1, 3});
+
+    dense_path_search_context<offset::ucoord_t> context{};
+
+    obstr_lyt.foreach_coordinate(
+        [&](const auto& src)
+        {
+            obstr_lyt.foreach_coordinate(
+                [&](const auto& tgt)
+                {
+                    const auto expected_path = jump_point_search<coord_path>(obstr_lyt, {src, tgt});
+                    const auto context_path  = jump_point_search<coord_path>(obstr_lyt, {src, tgt}, context);
+
+                    CHECK(expected_path == context_path);
+                });
+        });
+}
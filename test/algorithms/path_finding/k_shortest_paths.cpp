@@ -5,6 +5,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <fiction/algorithms/path_finding/k_shortest_paths.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
 #include <fiction/layouts/clocking_scheme.hpp>
@@ -784,3 +785,46 @@ TEST_CASE("Yen's algorithm on 4x4 gate-level layouts with connection obstruction
         }
     }
 }
+
+TEST_CASE("Yen's algorithm with reusable search context", "[k-shortest-paths]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+    const auto compare_all_pairs = [&layout](auto& context)
+    {
+        layout.foreach_coordinate(
+            [&](const auto& src)
+            {
+                layout.foreach_coordinate(
+                    [&](const auto& tgt)
+                    {
+                        const auto expected_collection = yen_k_shortest_paths<coord_path>(layout, {src, tgt}, 5);
+                        const auto context_collection =
+                            yen_k_shortest_paths<coord_path>(layout, {src, tgt}, 5, context);
+
+                        REQUIRE(expected_collection.size() == context_collection.size());
+
+                        for (auto i = 0ul; i < expected_collection.size(); ++i)
+                        {
+                            CHECK(expected_collection[i].size() == context_collection[i].size());
+                        }
+                    });
+            });
+    };
+
+    SECTION("hashed storage")
+    {
+        path_search_context<offset::ucoord_t> context{};
+
+        compare_all_pairs(context);
+    }
+    SECTION("dense storage")
+    {
+        dense_path_search_context<offset::ucoord_t> context{};
+
+        compare_all_pairs(context);
+    }
+}
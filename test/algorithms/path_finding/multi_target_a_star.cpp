@@ -0,0 +1,227 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/cost.hpp>
+#include <fiction/algorithms/path_finding/distance.hpp>
+#include <fiction/algorithms/path_finding/multi_target_a_star.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Multi-target A* on 4x4 layouts", "[multi-target-A*]")
+{
+    using lyt        = cartesian_layout<offset::ucoord_t>;
+    using coord_path = layout_coordinate_path<lyt>;
+
+    const lyt layout{{3, 3}};
+
+    SECTION("single source, single target")
+    {
+        const auto paths = multi_target_a_star<coord_path>(layout, {{0, 0}}, {{3, 3}});
+
+        REQUIRE(paths.size() == 1);
+        CHECK(paths[0].size() == 7);
+        CHECK(paths[0].source() == coordinate<lyt>{0, 0});
+        CHECK(paths[0].target() == coordinate<lyt>{3, 3});
+    }
+    SECTION("single source, multiple targets")
+    {
+        const std::vector<coordinate<lyt>> targets{{3, 3}, {0, 0}, {2, 0}, {0, 3}};
+
+        const auto paths = multi_target_a_star<coord_path>(layout, {{0, 0}}, targets);
+
+        REQUIRE(paths.size() == targets.size());
+
+        CHECK(paths[0].size() == 7);
+        CHECK(paths[1].size() == 1);
+        CHECK(paths[2].size() == 3);
+        CHECK(paths[3].size() == 4);
+
+        for (auto i = 0ul; i < targets.size(); ++i)
+        {
+            CHECK(paths[i].source() == coordinate<lyt>{0, 0});
+            CHECK(paths[i].target() == targets[i]);
+        }
+    }
+    SECTION("multiple sources, multiple targets")
+    {
+        const std::vector<coordinate<lyt>> targets{{0, 3}, {3, 0}, {2, 2}};
+
+        const auto paths = multi_target_a_star<coord_path>(layout, {{0, 0}, {3, 3}}, targets);
+
+        REQUIRE(paths.size() == targets.size());
+
+        // each target is reached from its closest source
+        CHECK(paths[0].size() == 4);
+        CHECK(paths[1].size() == 4);
+        CHECK(paths[2].size() == 3);
+        CHECK(paths[2].source() == coordinate<lyt>{3, 3});
+
+        for (auto i = 0ul; i < targets.size(); ++i)
+        {
+            CHECK(paths[i].target() == targets[i]);
+        }
+    }
+    SECTION("no targets")
+    {
+        const auto paths = multi_target_a_star<coord_path>(layout, {{0, 0}}, {});
+
+        CHECK(paths.empty());
+    }
+}
+
+TEST_CASE("Multi-target A* on clocked layouts with coordinate obstruction", "[multi-target-A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    SECTION("2DDWave")
+    {
+        const clk_lyt layout{{4, 4}, twoddwave_clocking<clk_lyt>()};
+
+        obst_lyt obstr_lyt{layout};
+
+        obstr_lyt.obstruct_coordinate({1, 0});
+        obstr_lyt.obstruct_coordinate({1, 1});
+        obstr_lyt.obstruct_coordinate({1, 2});
+        obstr_lyt.obstruct_coordinate({3, 3});
+        obstr_lyt.obstruct_coordinate({4, 3});
+
+        std::vector<coordinate<obst_lyt>> targets{};
+        obstr_lyt.foreach_ground_coordinate([&targets](const auto& c) { targets.push_back(c); });
+
+        const auto paths = multi_target_a_star<coord_path>(obstr_lyt, {{0, 0}}, targets);
+
+        REQUIRE(paths.size() == targets.size());
+
+        for (auto i = 0ul; i < targets.size(); ++i)
+        {
+            const auto single_path = a_star<coord_path>(obstr_lyt, {{0, 0}, targets[i]});
+
+            // path lengths are optimal, i.e., identical to the ones of the single-pair A*
+            CHECK(paths[i].size() == single_path.size());
+
+            if (!paths[i].empty())
+            {
+                CHECK(paths[i].source() == coordinate<obst_lyt>{0, 0});
+                CHECK(paths[i].target() == targets[i]);
+            }
+        }
+
+        // east of the obstructed column, the first three rows cannot be reached
+        CHECK(paths[2].empty());
+        CHECK(paths[14].empty());
+        // obstructed targets are reachable themselves, but are never passed through
+        CHECK(paths[18].size() == 7);
+        CHECK(paths[24].size() == 9);
+        CHECK(paths[24][7] == coordinate<obst_lyt>{3, 4});
+    }
+    SECTION("USE")
+    {
+        const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+        obst_lyt obstr_lyt{layout};
+
+        obstr_lyt.obstruct_coordinate({3, 0});
+
+        std::vector<coordinate<obst_lyt>> targets{};
+        obstr_lyt.foreach_ground_coordinate([&targets](const auto& c) { targets.push_back(c); });
+
+        dense_path_search_context<coordinate<obst_lyt>, uint64_t> context{};
+
+        // repeated searches in the same context yield identical results
+        for (auto r = 0u; r < 2; ++r)
+        {
+            const auto paths = multi_target_a_star<coord_path>(obstr_lyt, {{0, 0}}, targets, context);
+
+            REQUIRE(paths.size() == targets.size());
+
+            for (auto i = 0ul; i < targets.size(); ++i)
+            {
+                CHECK(paths[i].size() == a_star<coord_path>(obstr_lyt, {{0, 0}, targets[i]}).size());
+            }
+        }
+    }
+}
+
+TEST_CASE("Multi-target A* with zero heuristic", "[multi-target-A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{5, 5}, res_clocking<clk_lyt>()};
+
+    const distance_functor<clk_lyt, uint64_t> zero{[](const clk_lyt&, const coordinate<clk_lyt>&,
+                                                       const coordinate<clk_lyt>&) { return uint64_t{0}; }};
+
+    std::vector<coordinate<clk_lyt>> targets{};
+    layout.foreach_ground_coordinate([&targets](const auto& c) { targets.push_back(c); });
+
+    const auto paths = multi_target_a_star<coord_path>(layout, {{0, 0}}, targets, zero);
+
+    REQUIRE(paths.size() == targets.size());
+
+    for (auto i = 0ul; i < targets.size(); ++i)
+    {
+        CHECK(paths[i].size() == a_star<coord_path>(layout, {{0, 0}, targets[i]}).size());
+    }
+}
+
+TEST_CASE("Multi-target A* with crossings", "[multi-target-A*]")
+{
+    using gate_lyt   = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    using obst_lyt   = obstruction_layout<gate_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    gate_lyt layout{{3, 3, 1}, twoddwave_clocking<gate_lyt>()};
+
+    // a wire crossing the layout from north to south in the second column
+    const auto x1 = layout.create_pi("x1", {1, 0});
+    const auto w1 = layout.create_buf(x1, {1, 1});
+    const auto w2 = layout.create_buf(w1, {1, 2});
+    layout.create_po(w2, "f1", {1, 3});
+
+    obst_lyt obstr_lyt{layout};
+
+    const std::vector<coordinate<obst_lyt>> targets{{3, 0}, {3, 1}, {3, 3}};
+
+    SECTION("without crossings")
+    {
+        const auto paths = multi_target_a_star<coord_path>(obstr_lyt, {{0, 1}}, targets);
+
+        REQUIRE(paths.size() == targets.size());
+
+        CHECK(paths[0].empty());
+        CHECK(paths[1].empty());
+        CHECK(paths[2].empty());
+    }
+    SECTION("with crossings")
+    {
+        const a_star_params params{true};
+
+        const auto paths = multi_target_a_star<coord_path>(
+            obstr_lyt, {{0, 1}}, targets, manhattan_distance_functor<obst_lyt, uint64_t>(),
+            unit_cost_functor<obst_lyt, uint8_t>(), params);
+
+        REQUIRE(paths.size() == targets.size());
+
+        CHECK(paths[0].empty());
+        CHECK(paths[1].size() == 4);
+        CHECK(paths[1][1] == coordinate<obst_lyt>{1, 1, 1});
+        CHECK(paths[2].size() == 6);
+    }
+}
@@ -25,7 +25,9 @@
 #include <mockturtle/networks/mig.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <vector>
 
@@ -177,6 +179,13 @@ exact_physical_design_params&& async(const std::size_t t, exact_physical_design_
     return std::move(ps);
 }
 
+exact_physical_design_params&& portfolio(const std::size_t size, exact_physical_design_params&& ps) noexcept
+{
+    ps.portfolio = exact_solver_portfolio(size);
+
+    return std::move(ps);
+}
+
 exact_physical_design_params&& minimize_wires(exact_physical_design_params&& ps) noexcept
 {
     ps.minimize_wires = true;
@@ -700,6 +709,76 @@ TEST_CASE("Exact physical design timeout", "[exact]")
     CHECK(!layout.has_value());
 }
 
+TEST_CASE("Exact physical design with solver portfolio", "[exact]")
+{
+    SECTION("portfolio configurations")
+    {
+        const auto configs = exact_solver_portfolio(4);
+
+        REQUIRE(configs.size() == 4);
+
+        for (auto i = 0ul; i < configs.size(); ++i)
+        {
+            for (auto j = i + 1; j < configs.size(); ++j)
+            {
+                CHECK((configs[i].random_seed != configs[j].random_seed || configs[i].tactic != configs[j].tactic ||
+                       configs[i].symmetry_breaking != configs[j].symmetry_breaking));
+            }
+        }
+
+        CHECK(exact_solver_portfolio(0).empty());
+    }
+
+    const auto mux = blueprints::mux21_network<mockturtle::aig_network>();
+
+    exact_physical_design_stats sync_stats{};
+    const auto sync_layout = exact<cart_gate_clk_lyt>(mux, twoddwave(crossings(configuration())), &sync_stats);
+
+    REQUIRE(sync_layout.has_value());
+
+    // the synchronous mode does not report per-thread statistics
+    CHECK(sync_stats.thread_stats.empty());
+
+    const auto check_portfolio_result = [&mux, &sync_layout](const exact_physical_design_params& ps,
+                                                             const std::size_t                   num_threads)
+    {
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(mux, ps, &stats);
+
+        REQUIRE(layout.has_value());
+
+        check_drvs(*layout);
+        check_eq(mux, *layout);
+
+        // the portfolio does not impair optimality
+        CHECK(layout->area() == sync_layout->area());
+
+        REQUIRE(stats.thread_stats.size() == num_threads);
+
+        for (const auto& tst : stats.thread_stats)
+        {
+            REQUIRE(tst.num_wins.size() == ps.portfolio.size());
+
+            // every definite answer was given by exactly one configuration
+            CHECK(std::accumulate(tst.num_wins.cbegin(), tst.num_wins.cend(), 0u) == tst.num_sat + tst.num_unsat);
+        }
+    };
+
+    SECTION("single thread")
+    {
+        check_portfolio_result(twoddwave(crossings(portfolio(4, configuration()))), 1);
+    }
+    SECTION("multiple threads")
+    {
+        check_portfolio_result(twoddwave(crossings(async(2, portfolio(2, configuration())))), 2);
+    }
+    SECTION("multiple threads with border I/Os")
+    {
+        check_portfolio_result(twoddwave(crossings(border_io(async(2, portfolio(2, configuration()))))), 2);
+    }
+}
+
 TEST_CASE("Name conservation after exact physical design", "[exact]")
 {
     auto maj = blueprints::maj1_network<mockturtle::names_view<mockturtle::mig_network>>();
@@ -196,6 +196,27 @@ TEST_CASE("Multithreading", "[graph-oriented-layout-design]")
 
     REQUIRE(layout2.has_value());
     check_eq(ntk, *layout2);
+
+    // Full search
+    params.mode         = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+    params.return_first = false;
+    const auto layout3  = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    REQUIRE(layout3.has_value());
+    check_eq(ntk, *layout3);
+
+    // the statistics belong to the returned layout
+    CHECK(stats.x_size == layout3->x() + 1);
+    CHECK(stats.y_size == layout3->y() + 1);
+    CHECK(stats.num_gates == layout3->num_gates());
+    CHECK(stats.num_wires == layout3->num_wires());
+
+    // Full search with a cost objective other than area
+    params.cost        = graph_oriented_layout_design_params::cost_objective::CROSSINGS;
+    const auto layout4 = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    REQUIRE(layout4.has_value());
+    check_eq(ntk, *layout4);
 }
 
 TEST_CASE("Different cost objectives", "[graph-oriented-layout-design]")
@@ -261,6 +282,65 @@ TEST_CASE("Custom cost objective", "[graph-oriented-layout-design]")
     check_eq(ntk, *layout_high_effort);
 }
 
+TEST_CASE("Partial layout caching", "[graph-oriented-layout-design]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    graph_oriented_layout_design_params params{};
+    params.mode    = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+    params.timeout = 100000;
+
+    const auto check_identical_results = [&params](const auto& ntk)
+    {
+        // rebuild each partial layout from scratch
+        graph_oriented_layout_design_stats replay_stats{};
+        params.num_layout_snapshots = 0;
+        const auto replayed         = graph_oriented_layout_design<gate_layout>(ntk, params, &replay_stats);
+
+        REQUIRE(replayed.has_value());
+
+        // resume from cached partial layouts using a tiny and the default cache size
+        for (const auto num_snapshots : {uint64_t{1}, graph_oriented_layout_design_params{}.num_layout_snapshots})
+        {
+            graph_oriented_layout_design_stats cached_stats{};
+            params.num_layout_snapshots = num_snapshots;
+            const auto cached           = graph_oriented_layout_design<gate_layout>(ntk, params, &cached_stats);
+
+            REQUIRE(cached.has_value());
+            check_eq(ntk, *cached);
+
+            // caching does not alter the search
+            CHECK(cached_stats.x_size == replay_stats.x_size);
+            CHECK(cached_stats.y_size == replay_stats.y_size);
+            CHECK(cached_stats.num_gates == replay_stats.num_gates);
+            CHECK(cached_stats.num_wires == replay_stats.num_wires);
+            CHECK(cached_stats.num_crossings == replay_stats.num_crossings);
+        }
+    };
+
+    SECTION("First found layout")
+    {
+        params.return_first = true;
+
+        check_identical_results(blueprints::full_adder_network<technology_network>());
+        check_identical_results(blueprints::nand_xnor_network<technology_network>());
+    }
+    SECTION("Full search")
+    {
+        params.return_first = false;
+
+        check_identical_results(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("Planar layouts with wire cost")
+    {
+        params.planar       = true;
+        params.return_first = false;
+        params.cost         = graph_oriented_layout_design_params::cost_objective::WIRES;
+
+        check_identical_results(blueprints::mux21_network<technology_network>());
+    }
+}
+
 TEST_CASE("Name conservation after graph-oriented layout design", "[graph-oriented-layout-design]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
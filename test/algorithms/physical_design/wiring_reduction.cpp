@@ -34,6 +34,33 @@ void check_layout_equiv(const Ntk& ntk)
     CHECK(mockturtle::to_seconds(stats.time_total) > 0);
 }
 
+template <typename Lyt, typename Ntk>
+void check_incremental_mode(const Ntk& ntk)
+{
+    const auto layout             = orthogonal<Lyt>(ntk, {});
+    const auto incremental_layout = orthogonal<Lyt>(ntk, {});
+
+    wiring_reduction_stats stats{};
+    wiring_reduction<Lyt>(layout, {}, &stats);
+
+    wiring_reduction_params params{};
+    params.incremental = true;
+
+    wiring_reduction_stats incremental_stats{};
+    wiring_reduction<Lyt>(incremental_layout, params, &incremental_stats);
+
+    check_eq(ntk, incremental_layout);
+
+    // shifting in place yields the same layout as shifting via a copy
+    CHECK(incremental_stats.x_size_after == stats.x_size_after);
+    CHECK(incremental_stats.y_size_after == stats.y_size_after);
+    CHECK(incremental_stats.num_wires_after == stats.num_wires_after);
+
+    layout.foreach_node(
+        [&layout, &incremental_layout](const auto& n)
+        { CHECK(layout.get_tile(n) == incremental_layout.get_tile(n)); });
+}
+
 template <typename Lyt>
 void check_layout_equiv_all()
 {
@@ -145,6 +172,42 @@ TEST_CASE("Layout equivalence", "[wiring_reduction]")
     }
 }
 
+TEST_CASE("Incremental wiring reduction", "[wiring_reduction]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    SECTION("Maj1 Network")
+    {
+        check_incremental_mode<gate_layout>(blueprints::maj1_network<mockturtle::aig_network>());
+    }
+    SECTION("full_adder_network")
+    {
+        check_incremental_mode<gate_layout>(blueprints::full_adder_network<technology_network>());
+    }
+    SECTION("mux21_network")
+    {
+        check_incremental_mode<gate_layout>(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("se_coloring_corner_case_network")
+    {
+        check_incremental_mode<gate_layout>(blueprints::se_coloring_corner_case_network<technology_network>());
+    }
+    SECTION("nand_xnor_network")
+    {
+        check_incremental_mode<gate_layout>(blueprints::nand_xnor_network<technology_network>());
+    }
+    SECTION("Corner Cases")
+    {
+        const auto layout = blueprints::optimization_layout_corner_case_outputs_1<gate_layout>();
+
+        wiring_reduction_params params{};
+        params.incremental = true;
+
+        wiring_reduction<gate_layout>(layout, params);
+        check_eq(blueprints::optimization_layout_corner_case_outputs_1<gate_layout>(), layout);
+    }
+}
+
 TEST_CASE("Wrong clocking scheme", "[wiring_reduction]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
@@ -17,6 +17,7 @@
 
 #include <mockturtle/views/depth_view.hpp>
 
+#include <cstdint>
 #include <type_traits>
 
 using namespace fiction;
@@ -63,3 +64,115 @@ TEST_CASE("Unbalanced layout", "[throughput]")
 
     check(blueprints::unbalanced_and_layout<gate_layout>(), 2);
 }
+
+TEST_CASE("Deep layout", "[throughput]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    // a wire that is long enough to overflow the stack of a recursive implementation
+    constexpr uint64_t length = 100000;
+
+    gate_layout layout{{length, 0, 0}, twoddwave_clocking<gate_layout>()};
+
+    auto s = layout.create_pi("x", {0, 0});
+    for (uint64_t x = 1; x < length; ++x)
+    {
+        s = layout.create_buf(s, {x, 0});
+    }
+    layout.create_po(s, "f", {length, 0});
+
+    const auto cp_tp = critical_path_length_and_throughput(layout);
+
+    CHECK(cp_tp.critical_path_length == length + 1);
+    CHECK(cp_tp.throughput == 1);
+}
+
+TEST_CASE("Incremental analysis", "[throughput]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    const auto check_analyzer = [](critical_path_length_and_throughput_analyzer<gate_layout>& analyzer,
+                                   const gate_layout&                                        lyt)
+    {
+        const auto expected = critical_path_length_and_throughput(lyt);
+        const auto actual   = analyzer.get();
+
+        CHECK(actual.critical_path_length == expected.critical_path_length);
+        CHECK(actual.throughput == expected.throughput);
+    };
+
+    SECTION("Unbalanced layout")
+    {
+        auto layout = blueprints::unbalanced_and_layout<gate_layout>();
+
+        critical_path_length_and_throughput_analyzer analyzer{layout};
+
+        check_analyzer(analyzer, layout);
+        CHECK(analyzer.get().throughput == 2);
+
+        const auto num_evaluations = analyzer.num_evaluations();
+
+        // unchanged layouts are not re-evaluated
+        check_analyzer(analyzer, layout);
+        CHECK(analyzer.num_evaluations() == num_evaluations);
+
+        // modify the layout gate by gate
+        layout.foreach_gate(
+            [&layout, &analyzer, &check_analyzer](const auto& g)
+            {
+                const auto t = layout.get_tile(g);
+
+                layout.clear_tile(t);
+                check_analyzer(analyzer, layout);
+            });
+    }
+    SECTION("Moving nodes")
+    {
+        auto layout = blueprints::and_or_gate_layout<gate_layout>();
+
+        critical_path_length_and_throughput_analyzer analyzer{layout};
+
+        check_analyzer(analyzer, layout);
+
+        const auto and_node = layout.get_node({1, 0});
+        const auto or_node  = layout.get_node({2, 1});
+
+        // switch AND and OR as in the gate-level layout tests
+        layout.move_node(or_node, {3, 0}, {});
+        check_analyzer(analyzer, layout);
+
+        layout.move_node(and_node, {2, 1},
+                         {{static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{2, 0}),
+                           static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{1, 1})}});
+        check_analyzer(analyzer, layout);
+
+        layout.move_node(or_node, {1, 0},
+                         {{static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{2, 0}),
+                           static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{1, 1})}});
+        check_analyzer(analyzer, layout);
+    }
+    SECTION("Growing wire")
+    {
+        gate_layout layout{{100, 0, 0}, twoddwave_clocking<gate_layout>()};
+
+        critical_path_length_and_throughput_analyzer analyzer{layout};
+
+        auto s = layout.create_pi("x", {0, 0});
+        layout.create_po(s, "f", {1, 0});
+
+        check_analyzer(analyzer, layout);
+
+        for (uint64_t x = 1; x < 100; ++x)
+        {
+            // extend the wire by one tile
+            layout.clear_tile({x, 0});
+            s = layout.create_buf(s, {x, 0});
+            layout.create_po(s, "f", {x + 1, 0});
+
+            check_analyzer(analyzer, layout);
+        }
+
+        // each extension only re-evaluates the new tiles, i.e., a linear instead of a quadratic number of evaluations
+        CHECK(analyzer.num_evaluations() < 4 * 100);
+    }
+}
@@ -0,0 +1,114 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/simulation/qca/bistable_qca_simulation.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+#include <stdexcept>
+
+using namespace fiction;
+
+TEST_CASE("Bistable simulation of QCA wires", "[bistable-qca-simulation]")
+{
+    using qca_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    qca_layout layout{{5, 2}, twoddwave_clocking<qca_layout>()};
+
+    layout.assign_cell_type({0, 0}, qca_technology::cell_type::INPUT);
+    layout.assign_cell_type({1, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({3, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({4, 0}, qca_technology::cell_type::OUTPUT);
+
+    layout.assign_cell_type({0, 2}, qca_technology::cell_type::CONST_1);
+    layout.assign_cell_type({1, 2}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 2}, qca_technology::cell_type::OUTPUT);
+
+    bistable_qca_simulation_params params{};
+    params.num_threads = 2;
+
+    bistable_qca_simulation_stats stats{};
+
+    const auto functions = bistable_qca_simulation(layout, params, &stats);
+
+    REQUIRE(functions.size() == 2);
+
+    kitty::dynamic_truth_table identity{1}, tautology{1};
+    kitty::create_nth_var(identity, 0);
+    kitty::create_from_hex_string(tautology, "3");
+
+    CHECK(functions[0] == identity);
+    CHECK(functions[1] == tautology);
+
+    CHECK(stats.num_cells == 8);
+    CHECK(stats.num_input_patterns == 2);
+    CHECK(stats.num_interactions > 0);
+    CHECK(stats.num_unconverged_patterns == 0);
+}
+
+TEST_CASE("Bistable simulation of too many QCA inputs", "[bistable-qca-simulation]")
+{
+    using qca_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    qca_layout layout{{BISTABLE_QCA_SIMULATION_MAX_INPUTS, 1}, twoddwave_clocking<qca_layout>()};
+
+    for (auto x = 0u; x <= BISTABLE_QCA_SIMULATION_MAX_INPUTS; ++x)
+    {
+        layout.assign_cell_type({x, 0}, qca_technology::cell_type::INPUT);
+        layout.assign_cell_type({x, 1}, qca_technology::cell_type::OUTPUT);
+    }
+
+    CHECK_THROWS_AS(bistable_qca_simulation(layout), std::invalid_argument);
+}
+
+TEST_CASE("Bistable simulation of QCA ONE layouts", "[bistable-qca-simulation]")
+{
+    const auto gate_layout = blueprints::or_not_gate_layout<cart_gate_clk_lyt>();
+    const auto cell_layout = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(gate_layout);
+
+    SECTION("Correct specification")
+    {
+        bistable_qca_simulation_stats stats{};
+
+        CHECK(verify_qca_layout_by_simulation(cell_layout, gate_layout, {}, &stats));
+        CHECK(stats.num_input_patterns == 4);
+        CHECK(stats.num_unconverged_patterns == 0);
+    }
+    SECTION("Incorrect specification")
+    {
+        mockturtle::names_view<technology_network> spec{};
+
+        const auto x1 = spec.create_pi("x1");
+        const auto x2 = spec.create_pi("x2");
+        spec.create_po(spec.create_or(x1, x2), "f1");
+
+        CHECK(!verify_qca_layout_by_simulation(cell_layout, spec));
+    }
+    SECTION("Sequential and parallel simulation")
+    {
+        bistable_qca_simulation_params sequential{};
+        sequential.num_threads = 1;
+
+        bistable_qca_simulation_params parallel{};
+        parallel.num_threads = 4;
+
+        CHECK(bistable_qca_simulation(cell_layout, sequential) == bistable_qca_simulation(cell_layout, parallel));
+    }
+}
@@ -8,6 +8,7 @@
 #include "utils/blueprints/layout_blueprints.hpp"
 
 #include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
+#include <fiction/algorithms/simulation/sidb/incremental_input_simulation.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
 #include <fiction/technology/cell_technologies.hpp>
 #include <fiction/technology/charge_distribution_surface.hpp>
@@ -222,6 +223,16 @@ TEMPLATE_TEST_CASE("Test critical_temperature function", "[critical-temperature]
         CHECK_THAT(std::abs(critical_stats.energy_between_ground_state_and_first_erroneous),
                    Catch::Matchers::WithinAbs(26.02, 0.01));
         CHECK_THAT(std::abs(ct - 59.19), Catch::Matchers::WithinAbs(0.00, 0.01));
+
+        // simulating the input patterns incrementally yields the same result
+        params.input_sim_mode = input_simulation_mode::INCREMENTAL;
+
+        const auto ct_incremental =
+            critical_temperature_gate_based(lyt, std::vector<tt>{create_and_tt()}, params, &critical_stats);
+
+        CHECK_THAT(std::abs(critical_stats.energy_between_ground_state_and_first_erroneous),
+                   Catch::Matchers::WithinAbs(26.02, 0.01));
+        CHECK_THAT(std::abs(ct_incremental - ct), Catch::Matchers::WithinAbs(0.00, 0.01));
     }
 
     SECTION("Bestagon AND gate, QuickSim")
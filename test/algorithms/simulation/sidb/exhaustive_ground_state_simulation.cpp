@@ -452,3 +452,65 @@ TEMPLATE_TEST_CASE("ExGS gate simulation of Si-111 surface", "[exhaustive-ground
     CHECK(ground_state.front().get_charge_state({4, 10, 0}) == sidb_charge_state::NEGATIVE);
     CHECK(ground_state.front().get_charge_state({4, 14, 0}) == sidb_charge_state::NEGATIVE);
 }
+
+TEMPLATE_TEST_CASE("Parallel and ground-state-only ExGS simulation", "[exhaustive-ground-state-simulation]",
+                   (sidb_100_cell_clk_lyt_siqad), (cds_sidb_100_cell_clk_lyt_siqad))
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({0, 0, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({2, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({20, 0, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({18, 1, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 2, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 3, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({14, 3, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 2, 1}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 5, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters sim_params{3, -0.25};
+
+    const auto reference = exhaustive_ground_state_simulation<TestType>(lyt, sim_params);
+
+    REQUIRE(!reference.charge_distributions.empty());
+
+    exhaustive_ground_state_simulation_params params{};
+    params.simulation_parameters = sim_params;
+    params.num_threads           = 4;
+
+    SECTION("All physically valid charge distributions")
+    {
+        params.mode = exhaustive_ground_state_simulation_params::result_mode::ALL_PHYSICALLY_VALID;
+
+        const auto simulation_results = exhaustive_ground_state_simulation<TestType>(lyt, params);
+
+        REQUIRE(simulation_results.charge_distributions.size() == reference.charge_distributions.size());
+
+        for (auto i = 0u; i < reference.charge_distributions.size(); ++i)
+        {
+            CHECK(simulation_results.charge_distributions[i].get_charge_index_and_base() ==
+                  reference.charge_distributions[i].get_charge_index_and_base());
+        }
+    }
+    SECTION("Ground states only")
+    {
+        params.mode = exhaustive_ground_state_simulation_params::result_mode::GROUND_STATES_ONLY;
+
+        const auto simulation_results = exhaustive_ground_state_simulation<TestType>(lyt, params);
+        const auto ground_states      = determine_groundstate_from_simulation_results(reference);
+
+        // degenerate ground states are returned even if their energies differ by rounding errors
+        REQUIRE(!ground_states.empty());
+        CHECK(simulation_results.charge_distributions.size() >= ground_states.size());
+
+        for (const auto& cds : simulation_results.charge_distributions)
+        {
+            CHECK_THAT(cds.get_system_energy(), Catch::Matchers::WithinAbs(ground_states.front().get_system_energy(),
+                                                                           physical_constants::POP_STABILITY_ERR));
+        }
+    }
+}
@@ -0,0 +1,252 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/simulation/sidb/hierarchical_sidb_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+#include <fiction/types.hpp>
+
+#include <fmt/format.h>
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Hierarchical simulation of a Bestagon AND circuit", "[hierarchical-sidb-simulation]")
+{
+    using gate_layout = hex_odd_row_gate_clk_lyt;
+
+    gate_layout layout{{1, 2}, row_clocking<gate_layout>()};
+
+    const auto x1 = layout.create_pi("x1", {0, 0});
+    const auto x2 = layout.create_pi("x2", {1, 0});
+    const auto a  = layout.create_and(x1, x2, {0, 1});
+    layout.create_po(a, "f1", {0, 2});
+
+    const auto cell_layout = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(layout);
+
+    kitty::dynamic_truth_table conjunction{2};
+    kitty::create_from_hex_string(conjunction, "8");
+
+    SECTION("QuickExact")
+    {
+        hierarchical_sidb_simulation_stats stats{};
+
+        const auto functions = hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, {}, &stats);
+
+        REQUIRE(functions.size() == 1);
+        CHECK(functions[0] == conjunction);
+
+        CHECK(stats.num_tiles == 4);
+        CHECK(stats.num_levels == 3);
+        CHECK(stats.num_input_patterns == 4);
+        CHECK(stats.num_undefined_patterns == 0);
+        // each tile is evaluated once per input pattern, either by simulation or from the cache
+        CHECK(stats.num_tile_simulations + stats.num_cache_hits == 16);
+        CHECK(stats.num_cache_hits > 0);
+    }
+    SECTION("ExGS")
+    {
+        hierarchical_sidb_simulation_params params{};
+        params.sim_engine = exact_sidb_simulation_engine::EXGS;
+
+        const auto functions = hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, params);
+
+        REQUIRE(functions.size() == 1);
+        CHECK(functions[0] == conjunction);
+    }
+    SECTION("Verification")
+    {
+        CHECK(verify_sidb_layout_by_hierarchical_simulation<sidb_bestagon_library>(layout, cell_layout));
+    }
+    SECTION("Sequential and parallel simulation")
+    {
+        hierarchical_sidb_simulation_params sequential{};
+        sequential.num_threads = 1;
+
+        hierarchical_sidb_simulation_params parallel{};
+        parallel.num_threads = 4;
+
+        CHECK(hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, sequential) ==
+              hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, parallel));
+    }
+}
+
+TEST_CASE("Hierarchical simulation of a Bestagon inverter circuit", "[hierarchical-sidb-simulation]")
+{
+    using gate_layout = hex_odd_row_gate_clk_lyt;
+
+    gate_layout layout{{0, 2}, row_clocking<gate_layout>()};
+
+    const auto x1 = layout.create_pi("x1", {0, 0});
+    const auto n  = layout.create_not(x1, {0, 1});
+    layout.create_po(n, "f1", {0, 2});
+
+    const auto cell_layout = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(layout);
+
+    kitty::dynamic_truth_table negation{1};
+    kitty::create_from_hex_string(negation, "1");
+
+    hierarchical_sidb_simulation_stats stats{};
+
+    const auto functions = hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, {}, &stats);
+
+    REQUIRE(functions.size() == 1);
+    CHECK(functions[0] == negation);
+    CHECK(stats.num_input_patterns == 2);
+    CHECK(stats.num_undefined_patterns == 0);
+
+    CHECK(verify_sidb_layout_by_hierarchical_simulation<sidb_bestagon_library>(layout, cell_layout));
+}
+
+TEST_CASE("Hierarchical simulation of a Bestagon half adder with fanouts and a crossing",
+          "[hierarchical-sidb-simulation]")
+{
+    using gate_layout = hex_odd_row_gate_clk_lyt;
+
+    gate_layout layout{{2, 4, 1}, row_clocking<gate_layout>()};
+
+    const auto a = layout.create_pi("a", {0, 0});
+    const auto b = layout.create_pi("b", {1, 0});
+
+    const auto fa = layout.create_buf(a, {0, 1});
+    const auto fb = layout.create_buf(b, {1, 1});
+
+    // a is routed from north-west to south-east below b, which is routed from north-east to south-west
+    const auto wa = layout.create_buf(fa, {0, 2});
+    const auto ca = layout.create_buf(fa, {1, 2, 0});
+    const auto cb = layout.create_buf(fb, {1, 2, 1});
+    const auto wb = layout.create_buf(fb, {2, 2});
+
+    const auto sum   = layout.create_xor(wa, cb, {0, 3});
+    const auto carry = layout.create_and(ca, wb, {1, 3});
+
+    layout.create_po(sum, "sum", {0, 4});
+    layout.create_po(carry, "carry", {1, 4});
+
+    REQUIRE(layout.is_fanout(layout.get_node({0, 1})));
+    REQUIRE(layout.is_fanout(layout.get_node({1, 1})));
+
+    const auto cell_layout = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(layout);
+
+    kitty::dynamic_truth_table exclusive_disjunction{2}, conjunction{2};
+    kitty::create_from_hex_string(exclusive_disjunction, "6");
+    kitty::create_from_hex_string(conjunction, "8");
+
+    SECTION("Simulation")
+    {
+        hierarchical_sidb_simulation_stats stats{};
+
+        const auto functions = hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, {}, &stats);
+
+        REQUIRE(functions.size() == 2);
+        CHECK(functions[0] == exclusive_disjunction);
+        CHECK(functions[1] == conjunction);
+
+        // the crossing is simulated as a single tile
+        CHECK(stats.num_tiles == 11);
+        CHECK(stats.num_levels == 5);
+        CHECK(stats.num_undefined_patterns == 0);
+    }
+    SECTION("Verification")
+    {
+        CHECK(verify_sidb_layout_by_hierarchical_simulation<sidb_bestagon_library>(layout, cell_layout));
+    }
+    SECTION("Pattern blocks")
+    {
+        hierarchical_sidb_simulation_params single_pattern_blocks{};
+        single_pattern_blocks.pattern_block_size = 1;
+
+        hierarchical_sidb_simulation_stats stats{};
+
+        CHECK(hierarchical_sidb_simulation<sidb_bestagon_library>(layout, cell_layout, single_pattern_blocks,
+                                                                  &stats) ==
+              std::vector<kitty::dynamic_truth_table>{exclusive_disjunction, conjunction});
+        CHECK(stats.num_input_patterns == 4);
+    }
+}
+
+TEST_CASE("Hierarchical verification of mismatching Bestagon circuits", "[hierarchical-sidb-simulation]")
+{
+    using gate_layout = hex_odd_row_gate_clk_lyt;
+
+    const auto create_layout = [](const bool conjunction)
+    {
+        gate_layout layout{{1, 2}, row_clocking<gate_layout>()};
+
+        const auto x1 = layout.create_pi("x1", {0, 0});
+        const auto x2 = layout.create_pi("x2", {1, 0});
+        const auto g  = conjunction ? layout.create_and(x1, x2, {0, 1}) : layout.create_or(x1, x2, {0, 1});
+        layout.create_po(g, "f1", {0, 2});
+
+        return layout;
+    };
+
+    const auto and_layout = create_layout(true);
+    const auto or_layout  = create_layout(false);
+
+    const auto and_cell_layout = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(and_layout);
+
+    SECTION("Different gate")
+    {
+        CHECK(!verify_sidb_layout_by_hierarchical_simulation<sidb_bestagon_library>(or_layout, and_cell_layout));
+    }
+    SECTION("Missing output wire")
+    {
+        auto broken_cell_layout = and_cell_layout;
+
+        // remove all SiDBs of the primary output tile such that its output state is undefined
+        std::vector<cell<sidb_100_cell_clk_lyt>> po_cells{};
+        broken_cell_layout.foreach_cell(
+            [&po_cells](const auto& c)
+            {
+                if (c.y >= 2u * sidb_bestagon_library::gate_y_size())
+                {
+                    po_cells.push_back(c);
+                }
+            });
+
+        REQUIRE(!po_cells.empty());
+
+        for (const auto& c : po_cells)
+        {
+            broken_cell_layout.assign_cell_type(c, sidb_100_cell_clk_lyt::cell_type::EMPTY);
+        }
+
+        hierarchical_sidb_simulation_stats stats{};
+
+        const auto functions =
+            hierarchical_sidb_simulation<sidb_bestagon_library>(and_layout, broken_cell_layout, {}, &stats);
+
+        // undefined output states are represented as 0
+        REQUIRE(functions.size() == 1);
+        CHECK(kitty::is_const0(functions[0]));
+        CHECK(stats.num_undefined_patterns == 4);
+
+        CHECK(!verify_sidb_layout_by_hierarchical_simulation<sidb_bestagon_library>(and_layout, broken_cell_layout));
+    }
+}
+
+TEST_CASE("Hierarchical simulation of too many primary inputs", "[hierarchical-sidb-simulation]")
+{
+    using gate_layout = hex_odd_row_gate_clk_lyt;
+
+    gate_layout layout{{HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS, 0}, row_clocking<gate_layout>()};
+
+    for (auto x = 0u; x <= HIERARCHICAL_SIDB_SIMULATION_MAX_INPUTS; ++x)
+    {
+        layout.create_pi(fmt::format("x{}", x), {x, 0});
+    }
+
+    CHECK_THROWS_AS(hierarchical_sidb_simulation<sidb_bestagon_library>(layout, sidb_100_cell_clk_lyt{}),
+                    std::invalid_argument);
+}
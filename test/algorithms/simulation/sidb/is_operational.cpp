@@ -8,6 +8,7 @@
 
 #include <fiction/algorithms/iter/bdl_input_iterator.hpp>
 #include <fiction/algorithms/simulation/sidb/detect_bdl_wires.hpp>
+#include <fiction/algorithms/simulation/sidb/incremental_input_simulation.hpp>
 #include <fiction/algorithms/simulation/sidb/is_operational.hpp>
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
 #include <fiction/technology/cell_technologies.hpp>
@@ -151,6 +152,25 @@ TEST_CASE("Bestagon AND gate", "[is-operational]")
         CHECK(op_inputs.size() == 1);
         CHECK(op_inputs == std::set<uint64_t>{3});
     }
+    SECTION("Simulate input patterns incrementally")
+    {
+        is_operational_params params{sidb_simulation_parameters{2, -0.32}, sidb_simulation_engine::QUICKEXACT};
+        params.input_sim_mode = input_simulation_mode::INCREMENTAL;
+
+        CHECK(is_operational(lyt, std::vector<tt>{create_and_tt()}, params).first == operational_status::OPERATIONAL);
+
+        params.simulation_parameters.mu_minus = -0.30;
+
+        CHECK(is_operational(lyt, std::vector<tt>{create_and_tt()}, params).first ==
+              operational_status::NON_OPERATIONAL);
+
+        const auto op_inputs = operational_input_patterns(lyt, std::vector<tt>{create_and_tt()}, params);
+        CHECK(op_inputs == std::set<uint64_t>{3});
+
+        params.sim_engine = sidb_simulation_engine::EXGS;
+
+        CHECK(operational_input_patterns(lyt, std::vector<tt>{create_and_tt()}, params) == op_inputs);
+    }
 }
 
 TEST_CASE("Not working diagonal Wire", "[is-operational]")
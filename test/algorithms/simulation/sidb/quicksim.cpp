@@ -16,9 +16,12 @@
 #include <fiction/technology/charge_distribution_surface.hpp>
 #include <fiction/technology/physical_constants.hpp>
 #include <fiction/technology/sidb_charge_state.hpp>
+#include <fiction/technology/sidb_defect_surface.hpp>
+#include <fiction/technology/sidb_defects.hpp>
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 
+#include <any>
 #include <cstdint>
 
 using namespace fiction;
@@ -348,6 +351,59 @@ TEMPLATE_TEST_CASE("QuickSim simulation of a Y-shaped SiDB arrangement with vary
         check_for_runtime_measurement(simulation_results);
         check_charge_configuration(simulation_results);
     }
+    SECTION("Interaction cutoff")
+    {
+        // all SiDBs are within the cutoff radius of each other, i.e., the result is exact
+        quicksim_params.interaction_cutoff = 30.0;
+
+        const auto simulation_results = quicksim<TestType>(lyt, quicksim_params);
+
+        check_for_absence_of_positive_charges(simulation_results);
+        check_for_runtime_measurement(simulation_results);
+        check_charge_configuration(simulation_results);
+
+        CHECK(std::any_cast<double>(simulation_results.additional_simulation_parameters.at("energy_error_bound")) ==
+              0.0);
+    }
+}
+
+TEST_CASE("QuickSim simulation of SiDBs next to a charged defect with an interaction cutoff", "[quicksim]")
+{
+    using layout = sidb_defect_surface<sidb_100_cell_clk_lyt_siqad>;
+
+    layout lyt{};
+
+    // the first SiDB is neutralized by the defect, the second one is too far away to be affected
+    lyt.assign_cell_type({1, 3, 0}, layout::cell_type::NORMAL);
+    lyt.assign_cell_type({100, 3, 0}, layout::cell_type::NORMAL);
+
+    quicksim_params quicksim_params{sidb_simulation_parameters{2, -0.25}};
+    quicksim_params.seed = 42;
+
+    lyt.assign_sidb_defect({1, 2, 0}, sidb_defect{sidb_defect_type::UNKNOWN, -1,
+                                                   quicksim_params.simulation_parameters.epsilon_r,
+                                                   quicksim_params.simulation_parameters.lambda_tf});
+
+    const auto check_ground_state = [](const sidb_simulation_result<layout>& simulation_results)
+    {
+        const auto ground_states = determine_groundstate_from_simulation_results(simulation_results);
+
+        REQUIRE(ground_states.size() == 1);
+        CHECK(ground_states.front().get_charge_state({1, 3, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(ground_states.front().get_charge_state({100, 3, 0}) == sidb_charge_state::NEGATIVE);
+
+        return ground_states.front().get_system_energy();
+    };
+
+    const auto energy = check_ground_state(quicksim<layout>(lyt, quicksim_params));
+
+    quicksim_params.interaction_cutoff = 10.0;
+
+    const auto simulation_results = quicksim<layout>(lyt, quicksim_params);
+    const auto error_bound =
+        std::any_cast<double>(simulation_results.additional_simulation_parameters.at("energy_error_bound"));
+
+    CHECK_THAT(check_ground_state(simulation_results), Catch::Matchers::WithinAbs(energy, error_bound + 1E-9));
 }
 
 TEMPLATE_TEST_CASE("QuickSim simulation of a Y-shaped SiDB OR gate with input 01 and varying thread counts",
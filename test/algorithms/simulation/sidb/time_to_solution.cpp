@@ -190,3 +190,45 @@ TEMPLATE_TEST_CASE("time-to-solution test with simulation results", "[time-to-so
                    Catch::Matchers::WithinAbs(0.0, physical_constants::POP_STABILITY_ERR));
     }
 }
+
+TEMPLATE_TEST_CASE("Parallel time-to-solution with reused exact simulation results", "[time-to-solution]",
+                   sidb_100_cell_clk_lyt_siqad, cds_sidb_100_cell_clk_lyt_siqad)
+{
+    TestType lyt{};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{2, -0.30};
+
+    const auto simulation_results_exact = quickexact(lyt, quickexact_params<cell<TestType>>{params});
+
+    quicksim_params qs_params{params};
+    qs_params.number_threads = 1;
+    qs_params.seed           = 42;
+
+    time_to_solution_params tts_params{};
+    tts_params.repetitions = 20;
+
+    time_to_solution_stats sequential_stats{};
+    time_to_solution<TestType>(lyt, simulation_results_exact, qs_params, tts_params, &sequential_stats);
+
+    tts_params.num_threads = 4;
+
+    time_to_solution_stats parallel_stats{};
+    time_to_solution<TestType>(lyt, simulation_results_exact, qs_params, tts_params, &parallel_stats);
+
+    CHECK(sequential_stats.algorithm == "QuickExact");
+    CHECK(parallel_stats.algorithm == "QuickExact");
+
+    CHECK(sequential_stats.single_runtimes.size() == 20);
+    CHECK(parallel_stats.single_runtimes.size() == 20);
+
+    // the seed of each repetition only depends on its index
+    CHECK(sequential_stats.acc == parallel_stats.acc);
+    CHECK(parallel_stats.acc == 100.0);
+    CHECK(parallel_stats.time_to_solution > 0.0);
+}
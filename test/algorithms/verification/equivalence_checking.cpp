@@ -17,47 +17,62 @@
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
 
+#include <vector>
+
 using namespace fiction;
 
+const std::vector<equivalence_checking_params> modes{
+    equivalence_checking_params{},
+    equivalence_checking_params{equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED, 4ull, 42ull, 2ull}};
+
 template <typename Spec, typename Impl>
 void check_for_strong_equiv(const Spec& spec, const Impl& impl)
 {
-    equivalence_checking_stats st{};
+    for (const auto& ps : modes)
+    {
+        equivalence_checking_stats st{};
 
-    const auto equiv = equivalence_checking(spec, impl, &st);
+        const auto equiv = equivalence_checking(spec, impl, ps, &st);
 
-    CHECK(equiv == eq_type::STRONG);
-    CHECK(st.eq == eq_type::STRONG);
-    CHECK(st.counter_example.empty());
-    CHECK(st.spec_drv_stats.drvs == 0);
-    CHECK(st.impl_drv_stats.drvs == 0);
-    CHECK(st.tp_diff == 0);
+        CHECK(equiv == eq_type::STRONG);
+        CHECK(st.eq == eq_type::STRONG);
+        CHECK(st.counter_example.empty());
+        CHECK(st.spec_drv_stats.drvs == 0);
+        CHECK(st.impl_drv_stats.drvs == 0);
+        CHECK(st.tp_diff == 0);
+    }
 }
 
 template <typename Spec, typename Impl>
 void check_for_weak_equiv(const Spec& spec, const Impl& impl)
 {
-    equivalence_checking_stats st{};
+    for (const auto& ps : modes)
+    {
+        equivalence_checking_stats st{};
 
-    const auto equiv = equivalence_checking(spec, impl, &st);
+        const auto equiv = equivalence_checking(spec, impl, ps, &st);
 
-    CHECK(equiv == eq_type::WEAK);
-    CHECK(st.eq == eq_type::WEAK);
-    CHECK(st.counter_example.empty());
-    CHECK(st.spec_drv_stats.drvs == 0);
-    CHECK(st.impl_drv_stats.drvs == 0);
-    CHECK(st.tp_diff > 0);
+        CHECK(equiv == eq_type::WEAK);
+        CHECK(st.eq == eq_type::WEAK);
+        CHECK(st.counter_example.empty());
+        CHECK(st.spec_drv_stats.drvs == 0);
+        CHECK(st.impl_drv_stats.drvs == 0);
+        CHECK(st.tp_diff > 0);
+    }
 }
 
 template <typename Spec, typename Impl>
 void check_for_no_equiv(const Spec& spec, const Impl& impl)
 {
-    equivalence_checking_stats st{};
+    for (const auto& ps : modes)
+    {
+        equivalence_checking_stats st{};
 
-    const auto equiv = equivalence_checking(spec, impl, &st);
+        const auto equiv = equivalence_checking(spec, impl, ps, &st);
 
-    CHECK(equiv == eq_type::NO);
-    CHECK(((!st.counter_example.empty()) || (st.spec_drv_stats.drvs != 0) || (st.impl_drv_stats.drvs != 0)));
+        CHECK(equiv == eq_type::NO);
+        CHECK(((!st.counter_example.empty()) || (st.spec_drv_stats.drvs != 0) || (st.impl_drv_stats.drvs != 0)));
+    }
 }
 
 TEST_CASE("Network-network equivalence", "[equiv]")
@@ -182,3 +197,51 @@ TEST_CASE("No equivalence", "[equiv]")
     check_for_no_equiv(blueprints::and_not_gate_layout<hex_odd_row_gate_clk_lyt>(),
                        blueprints::and_or_gate_layout<hex_even_col_gate_clk_lyt>());
 }
+
+TEST_CASE("Output-partitioned equivalence checking", "[equiv]")
+{
+    equivalence_checking_params ps{};
+    ps.mode = equivalence_checking_params::checking_mode::OUTPUT_PARTITIONED;
+
+    SECTION("Equivalent outputs are proven individually")
+    {
+        const auto spec = blueprints::full_adder_network<mockturtle::aig_network>();
+        const auto impl = blueprints::full_adder_network<mockturtle::mig_network>();
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(spec, impl, ps, &st) == eq_type::STRONG);
+
+        REQUIRE(st.output_stats.size() == spec.num_pos());
+
+        for (const auto& os : st.output_stats)
+        {
+            REQUIRE(os.equivalent.has_value());
+            CHECK(*os.equivalent);
+            CHECK(!os.decided_by_simulation);
+        }
+    }
+    SECTION("Counter examples are found by simulation")
+    {
+        const auto spec = blueprints::and_or_network<mockturtle::aig_network>();
+
+        // complement the second output
+        mockturtle::aig_network impl{};
+
+        const auto a = impl.create_pi();
+        const auto b = impl.create_pi();
+
+        impl.create_po(impl.create_and(a, b));
+        impl.create_po(!impl.create_or(a, b));
+
+        equivalence_checking_stats st{};
+
+        CHECK(equivalence_checking(spec, impl, ps, &st) == eq_type::NO);
+
+        REQUIRE(st.output_stats.size() == spec.num_pos());
+        REQUIRE(st.output_stats.back().equivalent.has_value());
+        CHECK(!(*st.output_stats.back().equivalent));
+        CHECK(st.output_stats.back().decided_by_simulation);
+        CHECK(st.counter_example.size() == spec.num_pis());
+    }
+}
@@ -0,0 +1,34 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/hexagonalization.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark gate library application", "[benchmark]")
+{
+    const auto cart_layout = orthogonal<cart_gate_clk_lyt>(blueprints::parity_network<mockturtle::aig_network>());
+    const auto hex_layout  = hexagonalization<hex_even_row_gate_clk_lyt>(cart_layout);
+
+    BENCHMARK("apply_gate_library: QCA ONE")
+    {
+        return apply_gate_library<qca_cell_clk_lyt, qca_one_library>(cart_layout);
+    };
+    BENCHMARK("apply_gate_library: Bestagon")
+    {
+        return apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(hex_layout);
+    };
+}
@@ -0,0 +1,137 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinates.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+/**
+ * Sums up the clock numbers of all given clock zones such that no lookup can be optimized away. The number of
+ * performed lookups equals the size of `zones`, which allows deriving the per-lookup cost from the benchmark results.
+ */
+uint64_t sum_clock_numbers(const clocking_scheme<clock_zone<clk_lyt>>& scheme,
+                           const std::vector<clock_zone<clk_lyt>>&     zones)
+{
+    uint64_t sum = 0;
+
+    for (const auto& cz : zones)
+    {
+        sum += scheme(cz);
+    }
+
+    return sum;
+}
+
+/**
+ * Creates a regular scheme from the given cutout that, like all schemes before the introduction of fast lookups, has to
+ * go through `std::function` on every call.
+ */
+template <std::size_t Rows, std::size_t Columns, const detail::clock_cutout<Rows, Columns>& Cutout>
+clocking_scheme<clock_zone<clk_lyt>> generic_scheme(const char* name, const uint8_t num_clocks)
+{
+    return clocking_scheme<clock_zone<clk_lyt>>{
+        name, [](const clock_zone<clk_lyt>& cz) noexcept { return Cutout[cz.y % Rows][cz.x % Columns]; }, 2u, 2u,
+        num_clocks, true};
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark clock number lookup", "[benchmark]")
+{
+    // 10,000 lookups per benchmark run
+    std::vector<clock_zone<clk_lyt>> zones{};
+    zones.reserve(100 * 100);
+
+    for (uint64_t y = 0; y < 100; ++y)
+    {
+        for (uint64_t x = 0; x < 100; ++x)
+        {
+            zones.emplace_back(x, y);
+        }
+    }
+
+    const auto twoddwave = twoddwave_clocking<clk_lyt>();
+    const auto use       = use_clocking<clk_lyt>();
+    const auto bancs     = bancs_clocking<clk_lyt>();
+
+    // an irregular scheme in which every zone has been assigned manually
+    auto irregular = open_clocking<clk_lyt>();
+    for (const auto& cz : zones)
+    {
+        irregular.override_clock_number(cz, use(cz));
+    }
+
+    // the same scheme stored in a hash map because cube coordinates cannot be indexed densely
+    using cube_lyt = clocked_layout<cartesian_layout<cube::coord_t>>;
+
+    auto irregular_hashed = open_clocking<cube_lyt>();
+
+    std::vector<clock_zone<cube_lyt>> cube_zones{};
+    cube_zones.reserve(zones.size());
+
+    for (const auto& cz : zones)
+    {
+        cube_zones.emplace_back(static_cast<int32_t>(cz.x), static_cast<int32_t>(cz.y));
+        irregular_hashed.override_clock_number(cube_zones.back(), use(cz));
+    }
+
+    const auto generic_twoddwave = generic_scheme<4u, 4u, detail::twoddwave_4_cutout>(clock_name::TWODDWAVE, 4u);
+    const auto generic_use       = generic_scheme<4u, 4u, detail::use_cutout>(clock_name::USE, 4u);
+
+    // all variants have to agree with each other
+    REQUIRE(sum_clock_numbers(twoddwave, zones) == sum_clock_numbers(generic_twoddwave, zones));
+    REQUIRE(sum_clock_numbers(use, zones) == sum_clock_numbers(generic_use, zones));
+    REQUIRE(sum_clock_numbers(use, zones) == sum_clock_numbers(irregular, zones));
+
+    BENCHMARK("2DDWave: constexpr cutout")
+    {
+        return sum_clock_numbers(twoddwave, zones);
+    };
+    BENCHMARK("2DDWave: std::function")
+    {
+        return sum_clock_numbers(generic_twoddwave, zones);
+    };
+    BENCHMARK("USE: constexpr cutout")
+    {
+        return sum_clock_numbers(use, zones);
+    };
+    BENCHMARK("USE: std::function")
+    {
+        return sum_clock_numbers(generic_use, zones);
+    };
+    BENCHMARK("BANCS: constexpr cutout")
+    {
+        return sum_clock_numbers(bancs, zones);
+    };
+    BENCHMARK("Irregular: dense clock array")
+    {
+        return sum_clock_numbers(irregular, zones);
+    };
+    BENCHMARK("Irregular: hash map")
+    {
+        uint64_t sum = 0;
+
+        for (const auto& cz : cube_zones)
+        {
+            sum += irregular_hashed(cz);
+        }
+
+        return sum;
+    };
+}
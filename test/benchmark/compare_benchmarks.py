@@ -0,0 +1,166 @@
+"""Records and compares the results of fiction's Catch2 benchmarks.
+
+The benchmark binaries in this folder can write their results in Catch2's XML format, e.g.,
+
+    ./bench_orthogonal --reporter xml --out orthogonal.xml
+
+This script turns such reports into a machine-readable baseline and compares later runs against it:
+
+    python3 compare_benchmarks.py record baseline.json orthogonal.xml [more.xml ...]
+    python3 compare_benchmarks.py compare baseline.json orthogonal.xml [more.xml ...] --threshold 0.1
+
+`record` merges the given reports into the baseline file, replacing entries of the same name. `compare` prints the
+relative change of each benchmark's mean run time and exits with a non-zero status if any benchmark became slower than
+allowed by the threshold. Benchmarks are identified by their test case and benchmark names.
+
+Since absolute run times depend on the machine, no baseline is shipped with the repository. Record one on the machine
+that later runs the comparison, e.g., from the commit a change is based on.
+"""
+
+import argparse
+import json
+import platform
+import sys
+import xml.etree.ElementTree as ET
+from datetime import datetime, timezone
+from pathlib import Path
+
+SCHEMA_VERSION = 1
+
+
+def parse_report(path):
+    """Extracts all benchmark results of a Catch2 XML report. Times are given in nanoseconds."""
+    results = {}
+
+    for test_case in ET.parse(path).getroot().iter("TestCase"):
+        for benchmark in test_case.iter("BenchmarkResults"):
+            mean = benchmark.find("mean")
+            std_dev = benchmark.find("standardDeviation")
+
+            if mean is None:
+                continue
+
+            key = f"{test_case.get('name')}/{benchmark.get('name')}"
+            results[key] = {
+                "mean_ns": float(mean.get("value")),
+                "lower_bound_ns": float(mean.get("lowerBound", mean.get("value"))),
+                "upper_bound_ns": float(mean.get("upperBound", mean.get("value"))),
+                "std_dev_ns": float(std_dev.get("value")) if std_dev is not None else 0.0,
+                "samples": int(benchmark.get("samples", 0)),
+            }
+
+    return results
+
+
+def parse_reports(paths):
+    results = {}
+
+    for path in paths:
+        results.update(parse_report(path))
+
+    return results
+
+
+def load_baseline(path):
+    if not Path(path).exists():
+        return {"schema_version": SCHEMA_VERSION, "benchmarks": {}}
+
+    with open(path) as f:
+        baseline = json.load(f)
+
+    if baseline.get("schema_version") != SCHEMA_VERSION:
+        sys.exit(f"[e] unsupported baseline schema version in {path}")
+
+    return baseline
+
+
+def format_time(ns):
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= factor:
+            return f"{ns / factor:.3f} {unit}"
+
+    return f"{ns:.3f} ns"
+
+
+def record(args):
+    baseline = load_baseline(args.baseline)
+
+    baseline["benchmarks"].update(parse_reports(args.reports))
+    baseline["machine"] = args.machine if args.machine else f"{platform.system()} {platform.machine()}"
+    baseline["recorded"] = datetime.now(timezone.utc).isoformat(timespec="seconds")
+
+    with open(args.baseline, "w") as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+    print(f"[i] recorded {len(baseline['benchmarks'])} benchmarks in {args.baseline}")
+
+    return 0
+
+
+def compare(args):
+    reference = load_baseline(args.baseline)["benchmarks"]
+
+    # an empty baseline would let every comparison pass
+    if not reference:
+        sys.exit(f"[e] {args.baseline} does not contain any benchmarks; record a baseline first")
+
+    current = parse_reports(args.reports)
+
+    regressions = []
+
+    print(f"{'benchmark':<80} {'baseline':>12} {'current':>12} {'change':>9}")
+
+    for key, result in sorted(current.items()):
+        if key not in reference:
+            print(f"{key:<80} {'new':>12} {format_time(result['mean_ns']):>12} {'':>9}")
+            continue
+
+        base = reference[key]["mean_ns"]
+        change = (result["mean_ns"] - base) / base if base > 0 else 0.0
+
+        # only consider a slowdown a regression if the confidence intervals do not overlap
+        significant = result["lower_bound_ns"] > reference[key]["upper_bound_ns"]
+
+        if change > args.threshold and significant:
+            regressions.append(key)
+
+        marker = " !" if key in regressions else ""
+        print(f"{key:<80} {format_time(base):>12} {format_time(result['mean_ns']):>12} {change:>+8.1%}{marker}")
+
+    for key in sorted(set(reference) - set(current)):
+        print(f"{key:<80} {format_time(reference[key]['mean_ns']):>12} {'missing':>12} {'':>9}")
+
+    if regressions:
+        print(f"\n[e] {len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}")
+        return 1
+
+    print("\n[i] no regressions detected")
+
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Record and compare fiction's Catch2 benchmark results.")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    record_parser = commands.add_parser("record", help="merge Catch2 XML reports into a baseline file")
+    record_parser.add_argument("baseline", help="baseline JSON file to create or update")
+    record_parser.add_argument("reports", nargs="+", help="Catch2 XML reports")
+    record_parser.add_argument("--machine", help="description of the machine the benchmarks were run on")
+    record_parser.set_defaults(func=record)
+
+    compare_parser = commands.add_parser("compare", help="compare Catch2 XML reports against a baseline file")
+    compare_parser.add_argument("baseline", help="baseline JSON file")
+    compare_parser.add_argument("reports", nargs="+", help="Catch2 XML reports")
+    compare_parser.add_argument("--threshold", type=float, default=0.1,
+                                help="maximum tolerated relative slowdown of a benchmark's mean (default: 0.1)")
+    compare_parser.set_defaults(func=compare)
+
+    args = parser.parse_args()
+
+    sys.exit(args.func(args))
+
+
+if __name__ == "__main__":
+    main()
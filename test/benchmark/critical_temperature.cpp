@@ -0,0 +1,42 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/simulation/sidb/critical_temperature.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark critical temperature", "[benchmark]")
+{
+    const auto siqad_and    = blueprints::siqad_and_gate<sidb_100_cell_clk_lyt_siqad>();
+    const auto bestagon_and = blueprints::bestagon_and_gate<sidb_100_cell_clk_lyt_siqad>();
+    const auto spec         = std::vector<tt>{create_and_tt()};
+
+    critical_temperature_params siqad_params{};
+    siqad_params.simulation_parameters = sidb_simulation_parameters{2, -0.28};
+    siqad_params.engine                = critical_temperature_params::simulation_engine::EXACT;
+    siqad_params.confidence_level      = 0.99;
+    siqad_params.max_temperature       = 350;
+
+    critical_temperature_params bestagon_params{siqad_params};
+    bestagon_params.simulation_parameters = sidb_simulation_parameters{2, -0.32};
+
+    BENCHMARK("critical_temperature_gate_based: SiQAD AND gate")
+    {
+        return critical_temperature_gate_based(siqad_and, spec, siqad_params);
+    };
+    BENCHMARK("critical_temperature_gate_based: Bestagon AND gate")
+    {
+        return critical_temperature_gate_based(bestagon_and, spec, bestagon_params);
+    };
+}
@@ -0,0 +1,81 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+namespace
+{
+
+/**
+ * Visits all fanouts of all nodes and sums up their tiles' x-coordinates such that no traversal can be optimized away.
+ */
+template <typename Lyt>
+uint64_t traverse_fanouts(const Lyt& lyt)
+{
+    uint64_t sum = 0;
+
+    lyt.foreach_node([&lyt, &sum](const auto& n)
+                     { lyt.foreach_fanout(n, [&lyt, &sum](const auto& fo) { sum += lyt.get_tile(fo).x; }); });
+
+    return sum;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark fanout traversal", "[benchmark]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    const auto layout = orthogonal<gate_layout>(blueprints::parity_network<mockturtle::aig_network>());
+
+    auto indexed = layout.clone();
+    indexed.enable_fanout_index();
+
+    REQUIRE(traverse_fanouts(layout) == traverse_fanouts(indexed));
+
+    BENCHMARK("foreach_fanout: hash map lookups")
+    {
+        return traverse_fanouts(layout);
+    };
+    BENCHMARK("foreach_fanout: fanout index")
+    {
+        return traverse_fanouts(indexed);
+    };
+    BENCHMARK("outgoing_data_flow: hash map lookups")
+    {
+        uint64_t sum = 0;
+        layout.foreach_node([&layout, &sum](const auto& n)
+                            { sum += layout.outgoing_data_flow(layout.get_tile(n)).size(); });
+        return sum;
+    };
+    BENCHMARK("outgoing_data_flow: fanout index")
+    {
+        uint64_t sum = 0;
+        indexed.foreach_node([&indexed, &sum](const auto& n)
+                             { sum += indexed.outgoing_data_flow(indexed.get_tile(n)).size(); });
+        return sum;
+    };
+    BENCHMARK("enable_fanout_index")
+    {
+        auto copy = layout.clone();
+        copy.enable_fanout_index();
+        return copy.has_fanout_index();
+    };
+}
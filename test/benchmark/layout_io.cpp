@@ -0,0 +1,73 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/hexagonalization.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/io/read_fgl_layout.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/io/write_fgl_layout.hpp>
+#include <fiction/io/write_sqd_layout.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark FGL reader and writer", "[benchmark]")
+{
+    const auto layout = orthogonal<cart_gate_clk_lyt>(blueprints::parity_network<mockturtle::aig_network>());
+
+    std::stringstream fgl_stream{};
+    write_fgl_layout(layout, fgl_stream);
+    const auto fgl = fgl_stream.str();
+
+    BENCHMARK("write_fgl_layout: parity")
+    {
+        std::ostringstream os{};
+        write_fgl_layout(layout, os);
+
+        return os.str().size();
+    };
+    BENCHMARK("read_fgl_layout: parity")
+    {
+        std::istringstream is{fgl};
+
+        return read_fgl_layout<cart_gate_clk_lyt>(is);
+    };
+}
+
+TEST_CASE("Benchmark SQD reader and writer", "[benchmark]")
+{
+    const auto cart_layout = orthogonal<cart_gate_clk_lyt>(blueprints::parity_network<mockturtle::aig_network>());
+    const auto cell_layout = apply_gate_library<sidb_100_cell_clk_lyt, sidb_bestagon_library>(
+        hexagonalization<hex_even_row_gate_clk_lyt>(cart_layout));
+
+    std::stringstream sqd_stream{};
+    write_sqd_layout(cell_layout, sqd_stream);
+    const auto sqd = sqd_stream.str();
+
+    BENCHMARK("write_sqd_layout: parity")
+    {
+        std::ostringstream os{};
+        write_sqd_layout(cell_layout, os);
+
+        return os.str().size();
+    };
+    BENCHMARK("read_sqd_layout: parity")
+    {
+        std::istringstream is{sqd};
+
+        return read_sqd_layout<sidb_100_cell_clk_lyt>(is);
+    };
+}
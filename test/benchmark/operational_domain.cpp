@@ -0,0 +1,49 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark operational domain computation", "[benchmark]")
+{
+    const auto lyt  = blueprints::siqad_and_gate<sidb_100_cell_clk_lyt_siqad>();
+    const auto spec = std::vector<tt>{create_and_tt()};
+
+    sidb_simulation_parameters sim_params{};
+    sim_params.base     = 2;
+    sim_params.mu_minus = -0.28;
+
+    operational_domain_params op_domain_params{};
+    op_domain_params.operational_params.simulation_parameters = sim_params;
+    op_domain_params.sweep_dimensions                         = {{sweep_parameter::EPSILON_R, 5.1, 6.0, 0.1},
+                                                                 {sweep_parameter::LAMBDA_TF, 4.5, 5.4, 0.1}};
+
+    BENCHMARK("operational_domain_grid_search: SiQAD AND gate")
+    {
+        return operational_domain_grid_search(lyt, spec, op_domain_params);
+    };
+    BENCHMARK("operational_domain_random_sampling: SiQAD AND gate")
+    {
+        return operational_domain_random_sampling(lyt, spec, 100, op_domain_params);
+    };
+    BENCHMARK("operational_domain_flood_fill: SiQAD AND gate")
+    {
+        return operational_domain_flood_fill(lyt, spec, 1, op_domain_params);
+    };
+    BENCHMARK("operational_domain_contour_tracing: SiQAD AND gate")
+    {
+        return operational_domain_contour_tracing(lyt, spec, 1, op_domain_params);
+    };
+}
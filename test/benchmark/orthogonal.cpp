@@ -0,0 +1,36 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark orthogonal", "[benchmark]")
+{
+    const auto full_adder = blueprints::full_adder_network<mockturtle::aig_network>();
+    const auto mux21      = blueprints::mux21_network<technology_network>();
+    const auto parity     = blueprints::parity_network<mockturtle::aig_network>();
+
+    BENCHMARK("orthogonal: full adder")
+    {
+        return orthogonal<cart_gate_clk_lyt>(full_adder);
+    };
+    BENCHMARK("orthogonal: 2:1 MUX")
+    {
+        return orthogonal<cart_gate_clk_lyt>(mux21);
+    };
+    BENCHMARK("orthogonal: parity")
+    {
+        return orthogonal<cart_gate_clk_lyt>(parity);
+    };
+}
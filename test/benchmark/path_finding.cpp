@@ -0,0 +1,194 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/cost.hpp>
+#include <fiction/algorithms/path_finding/distance.hpp>
+#include <fiction/algorithms/path_finding/jump_point_search.hpp>
+#include <fiction/algorithms/path_finding/search_context.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+// count all heap allocations of this executable to quantify the allocator pressure of path finding
+
+namespace
+{
+
+std::atomic<std::size_t> num_allocations{0};
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto* ptr = std::malloc(size); ptr != nullptr)
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace fiction;
+
+using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+using obst_lyt   = obstruction_layout<clk_lyt>;
+using coord_path = layout_coordinate_path<obst_lyt>;
+
+namespace
+{
+
+obst_lyt generate_obstructed_layout()
+{
+    const clk_lyt layout{{15, 15}, use_clocking<clk_lyt>()};
+
+    obst_lyt obstr_lyt{layout, obstruction_storage::DENSE};
+
+    // obstruct every fourth coordinate in a diagonal pattern
+    obstr_lyt.foreach_coordinate(
+        [&obstr_lyt](const auto& c)
+        {
+            if ((c.x + 3 * c.y) % 4 == 0 && c != coordinate<obst_lyt>{0, 0})
+            {
+                obstr_lyt.obstruct_coordinate(c);
+            }
+        });
+
+    return obstr_lyt;
+}
+
+template <typename SearchFn>
+uint64_t route_all_pairs(const obst_lyt& layout, SearchFn&& search)
+{
+    uint64_t sum = 0;
+
+    layout.foreach_coordinate(
+        [&layout, &search, &sum](const auto& src)
+        {
+            layout.foreach_coordinate([&search, &sum, &src](const auto& tgt)
+                                      { sum += static_cast<uint64_t>(search(src, tgt).size()); });
+        });
+
+    return sum;
+}
+
+template <typename SearchFn>
+std::size_t count_allocations(const obst_lyt& layout, SearchFn&& search)
+{
+    const auto before = num_allocations.load(std::memory_order_relaxed);
+
+    route_all_pairs(layout, std::forward<SearchFn>(search));
+
+    return num_allocations.load(std::memory_order_relaxed) - before;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark A* allocations", "[benchmark]")
+{
+    const auto layout = generate_obstructed_layout();
+
+    a_star_params dense_params{};
+    dense_params.dense_storage = true;
+
+    path_search_context<offset::ucoord_t>       hashed_context{};
+    dense_path_search_context<offset::ucoord_t> dense_context{};
+
+    const auto without_context = [&layout](const auto& src, const auto& tgt)
+    { return a_star<coord_path>(layout, {src, tgt}); };
+
+    const auto dense_without_context = [&layout, &dense_params](const auto& src, const auto& tgt)
+    {
+        return a_star<coord_path>(layout, {src, tgt}, manhattan_distance_functor<obst_lyt>(),
+                                  unit_cost_functor<obst_lyt>(), dense_params);
+    };
+
+    const auto with_hashed_context = [&layout, &hashed_context](const auto& src, const auto& tgt)
+    { return a_star<coord_path>(layout, {src, tgt}, hashed_context); };
+
+    const auto with_dense_context = [&layout, &dense_context](const auto& src, const auto& tgt)
+    { return a_star<coord_path>(layout, {src, tgt}, dense_context); };
+
+    // warm up the contexts such that their buffers have reached their final capacity
+    route_all_pairs(layout, with_hashed_context);
+    route_all_pairs(layout, with_dense_context);
+
+    const auto allocations_without_context       = count_allocations(layout, without_context);
+    const auto allocations_dense_without_context = count_allocations(layout, dense_without_context);
+    const auto allocations_hashed_context        = count_allocations(layout, with_hashed_context);
+    const auto allocations_dense_context         = count_allocations(layout, with_dense_context);
+
+    // heap allocations for all-pairs A* on a 16x16 layout; reported by Catch2 if a check fails
+    INFO("hashed storage without context: " << allocations_without_context);
+    INFO("dense storage without context: " << allocations_dense_without_context);
+    INFO("hashed storage with context: " << allocations_hashed_context);
+    INFO("dense storage with context: " << allocations_dense_context);
+
+    // with a warm dense context, only the returned paths are allocated
+    CHECK(allocations_dense_context <= layout.area() * layout.area());
+    CHECK(allocations_dense_context < allocations_dense_without_context);
+    CHECK(allocations_hashed_context < allocations_without_context);
+
+    BENCHMARK("A*: hashed storage without context")
+    {
+        return route_all_pairs(layout, without_context);
+    };
+    BENCHMARK("A*: dense storage without context")
+    {
+        return route_all_pairs(layout, dense_without_context);
+    };
+    BENCHMARK("A*: hashed storage with context")
+    {
+        return route_all_pairs(layout, with_hashed_context);
+    };
+    BENCHMARK("A*: dense storage with context")
+    {
+        return route_all_pairs(layout, with_dense_context);
+    };
+}
+
+TEST_CASE("Benchmark A* vs. jump point search", "[benchmark]")
+{
+    const auto layout = generate_obstructed_layout();
+
+    const auto a_star_search = [&layout](const auto& src, const auto& tgt)
+    { return a_star<coord_path>(layout, {src, tgt}); };
+
+    const auto jump_point = [&layout](const auto& src, const auto& tgt)
+    { return jump_point_search<coord_path>(layout, {src, tgt}); };
+
+    BENCHMARK("A*: all pairs")
+    {
+        return route_all_pairs(layout, a_star_search);
+    };
+    BENCHMARK("JPS: all pairs")
+    {
+        return route_all_pairs(layout, jump_point);
+    };
+}
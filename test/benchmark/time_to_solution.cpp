@@ -0,0 +1,58 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/simulation/sidb/quickexact.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/algorithms/simulation/sidb/time_to_solution.hpp>
+#include <fiction/types.hpp>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark time-to-solution", "[benchmark]")
+{
+    const auto lyt = blueprints::bestagon_and_gate<sidb_100_cell_clk_lyt_siqad>();
+
+    const sidb_simulation_parameters params{2, -0.32};
+
+    // the exact reference simulation is run once and reused by all time-to-solution calls
+    const auto exact_result = quickexact(lyt, quickexact_params<cell<sidb_100_cell_clk_lyt_siqad>>{params});
+
+    quicksim_params qs_params{};
+    qs_params.simulation_parameters = params;
+    qs_params.number_threads        = 1;
+    qs_params.seed                  = 42;
+
+    time_to_solution_params sequential_params{};
+    sequential_params.repetitions = 50;
+
+    time_to_solution_params parallel_params{sequential_params};
+    parallel_params.num_threads = 4;
+
+    // the seed makes the accuracy independent of the number of threads
+    time_to_solution_stats sequential_stats{};
+    time_to_solution_stats parallel_stats{};
+    time_to_solution(lyt, exact_result, qs_params, sequential_params, &sequential_stats);
+    time_to_solution(lyt, exact_result, qs_params, parallel_params, &parallel_stats);
+
+    REQUIRE(sequential_stats.acc == parallel_stats.acc);
+
+    BENCHMARK("time_to_solution: 1 thread")
+    {
+        time_to_solution_stats st{};
+        time_to_solution(lyt, exact_result, qs_params, sequential_params, &st);
+        return st.acc;
+    };
+    BENCHMARK("time_to_solution: 4 threads")
+    {
+        time_to_solution_stats st{};
+        time_to_solution(lyt, exact_result, qs_params, parallel_params, &st);
+        return st.acc;
+    };
+}
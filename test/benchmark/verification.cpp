@@ -0,0 +1,61 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/verification/design_rule_violations.hpp>
+#include <fiction/algorithms/verification/equivalence_checking.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+#include <sstream>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark verification", "[benchmark]")
+{
+    const auto full_adder = blueprints::full_adder_network<mockturtle::aig_network>();
+    const auto parity     = blueprints::parity_network<mockturtle::aig_network>();
+
+    const auto full_adder_layout = orthogonal<cart_gate_clk_lyt>(full_adder);
+    const auto parity_layout     = orthogonal<cart_gate_clk_lyt>(parity);
+
+    BENCHMARK("gate_level_drvs: full adder")
+    {
+        // suppress standard output
+        std::stringstream     ss{};
+        gate_level_drv_params ps{};
+        ps.out = &ss;
+
+        gate_level_drv_stats st{};
+        gate_level_drvs(full_adder_layout, ps, &st);
+
+        return st.drvs;
+    };
+    BENCHMARK("gate_level_drvs: parity")
+    {
+        // suppress standard output
+        std::stringstream     ss{};
+        gate_level_drv_params ps{};
+        ps.out = &ss;
+
+        gate_level_drv_stats st{};
+        gate_level_drvs(parity_layout, ps, &st);
+
+        return st.drvs;
+    };
+    BENCHMARK("equivalence_checking: full adder network vs. layout")
+    {
+        return equivalence_checking(full_adder, full_adder_layout);
+    };
+    BENCHMARK("equivalence_checking: parity network vs. layout")
+    {
+        return equivalence_checking(parity, parity_layout);
+    };
+}
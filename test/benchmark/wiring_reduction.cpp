@@ -0,0 +1,41 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/physical_design/wiring_reduction.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark wiring reduction", "[benchmark]")
+{
+    const auto full_adder = orthogonal<cart_gate_clk_lyt>(blueprints::full_adder_network<mockturtle::aig_network>());
+    const auto parity     = orthogonal<cart_gate_clk_lyt>(blueprints::parity_network<mockturtle::aig_network>());
+
+    wiring_reduction_params params{};
+    params.timeout = 100000;
+
+    wiring_reduction_params incremental_params{params};
+    incremental_params.incremental = true;
+
+    BENCHMARK("wiring_reduction: full adder")
+    {
+        wiring_reduction(full_adder.clone(), params);
+    };
+    BENCHMARK("wiring_reduction: parity")
+    {
+        wiring_reduction(parity.clone(), params);
+    };
+    BENCHMARK("wiring_reduction: parity, incremental")
+    {
+        wiring_reduction(parity.clone(), incremental_params);
+    };
+}
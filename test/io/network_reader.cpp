@@ -10,6 +10,9 @@
 #include <fiction/io/network_reader.hpp>
 #include <fiction/types.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 #include <string>
 
@@ -64,3 +67,93 @@ TEST_CASE("Read Verilog", "[network-reader]")
         CHECK(mux21.get_output_name(0) == "out");
     }
 }
+
+TEST_CASE("Read directory in parallel", "[network-reader]")
+{
+    constexpr const char* toy_folder = "../../benchmarks/TOY/";
+
+    std::ostringstream sequential_os{};
+    std::ostringstream parallel_os{};
+
+    network_reader_params params{};
+    params.parallel    = true;
+    params.num_threads = 4;
+
+    network_reader<tec_ptr> sequential_reader{toy_folder, sequential_os};
+    network_reader<tec_ptr> parallel_reader{toy_folder, parallel_os, params};
+
+    // status updates are identical
+    CHECK(sequential_os.str() == parallel_os.str());
+
+    const auto sequential_nets = sequential_reader.get_networks();
+    const auto parallel_nets   = parallel_reader.get_networks();
+
+    REQUIRE(!sequential_nets.empty());
+    REQUIRE(sequential_nets.size() == parallel_nets.size());
+
+    // networks are returned in the same deterministic order
+    for (auto i = 0ul; i < sequential_nets.size(); ++i)
+    {
+        CHECK(sequential_nets[i]->get_network_name() == parallel_nets[i]->get_network_name());
+        CHECK(sequential_nets[i]->size() == parallel_nets[i]->size());
+        CHECK(sequential_nets[i]->num_gates() == parallel_nets[i]->num_gates());
+    }
+
+    CHECK(std::is_sorted(sequential_nets.cbegin(), sequential_nets.cend(),
+                         [](const auto& n1, const auto& n2)
+                         { return n1->get_network_name() < n2->get_network_name(); }));
+}
+
+TEST_CASE("Read technology networks from cache", "[network-reader]")
+{
+    constexpr const char* toy_folder = "../../benchmarks/TOY/";
+
+    const auto cache_directory = std::filesystem::temp_directory_path() / "fiction_network_reader_cache_test";
+    std::filesystem::remove_all(cache_directory);
+
+    network_reader_params params{};
+    params.cache_directory = cache_directory.string();
+
+    std::ostringstream uncached_os{};
+    std::ostringstream cached_os{};
+    std::ostringstream recovering_os{};
+
+    // populates the cache
+    network_reader<tec_ptr> uncached_reader{toy_folder, uncached_os, params};
+    const auto              uncached_nets = uncached_reader.get_networks();
+
+    REQUIRE(!uncached_nets.empty());
+    CHECK(!std::filesystem::is_empty(cache_directory));
+
+    // reads from the cache
+    params.parallel = true;
+
+    network_reader<tec_ptr> cached_reader{toy_folder, cached_os, params};
+    const auto              cached_nets = cached_reader.get_networks();
+
+    CHECK(cached_os.str() == uncached_os.str());
+    REQUIRE(cached_nets.size() == uncached_nets.size());
+
+    for (auto i = 0ul; i < cached_nets.size(); ++i)
+    {
+        CHECK(cached_nets[i]->get_network_name() == uncached_nets[i]->get_network_name());
+        CHECK(cached_nets[i]->num_pis() == uncached_nets[i]->num_pis());
+        CHECK(cached_nets[i]->num_pos() == uncached_nets[i]->num_pos());
+        CHECK(cached_nets[i]->num_gates() == uncached_nets[i]->num_gates());
+
+        check_eq(*cached_nets[i], *uncached_nets[i]);
+    }
+
+    // corrupted cache entries are ignored
+    for (const auto& entry : std::filesystem::directory_iterator(cache_directory))
+    {
+        std::ofstream{entry.path(), std::ofstream::trunc} << "corrupted";
+    }
+
+    network_reader<tec_ptr> recovering_reader{toy_folder, recovering_os, params};
+
+    CHECK(recovering_os.str() == uncached_os.str());
+    CHECK(recovering_reader.get_networks().size() == uncached_nets.size());
+
+    std::filesystem::remove_all(cache_directory);
+}
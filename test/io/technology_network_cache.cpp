@@ -0,0 +1,162 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/io/technology_network_cache.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/types.hpp>
+
+#include <kitty/operations.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+TEST_CASE("Technology network cache round trip", "[technology-network-cache]")
+{
+    const auto check = [](const auto& ntk)
+    {
+        std::stringstream stream{};
+
+        write_technology_network_cache(ntk, stream);
+        const auto restored = read_technology_network_cache<tec_nt>(stream);
+
+        CHECK(restored.size() == ntk.size());
+        CHECK(restored.num_pis() == ntk.num_pis());
+        CHECK(restored.num_pos() == ntk.num_pos());
+        CHECK(restored.num_gates() == ntk.num_gates());
+
+        // gates keep their functions and positions
+        ntk.foreach_gate([&ntk, &restored](const auto& g)
+                         { CHECK(kitty::equal(restored.node_function(g), ntk.node_function(g))); });
+
+        check_eq(ntk, restored);
+    };
+
+    SECTION("MUX")
+    {
+        check(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("Full adder")
+    {
+        check(blueprints::full_adder_network<technology_network>());
+    }
+    SECTION("Constant gate inputs")
+    {
+        check(blueprints::constant_gate_input_maj_network<technology_network>());
+    }
+    SECTION("Fanouts and inverters")
+    {
+        check(blueprints::se_coloring_corner_case_network<technology_network>());
+    }
+}
+
+TEST_CASE("Technology network cache name conservation", "[technology-network-cache]")
+{
+    tec_nt ntk{};
+    ntk.set_network_name("named");
+
+    const auto a = ntk.create_pi("a");
+    const auto b = ntk.create_pi("b");
+    const auto c = ntk.create_pi();
+
+    const auto x = ntk.create_xor(a, b);
+    ntk.set_name(x, "x");
+
+    ntk.create_po(ntk.create_and(x, c), "f");
+    ntk.create_po(x);
+
+    std::stringstream stream{};
+
+    write_technology_network_cache(ntk, stream);
+    const auto restored = read_technology_network_cache<tec_nt>(stream);
+
+    CHECK(restored.get_network_name() == "named");
+
+    CHECK(restored.get_name(restored.make_signal(2)) == "a");
+    CHECK(restored.get_name(restored.make_signal(3)) == "b");
+    CHECK(!restored.has_name(restored.make_signal(4)));
+    CHECK(restored.get_name(restored.make_signal(5)) == "x");
+
+    CHECK(restored.get_output_name(0) == "f");
+    CHECK(!restored.has_output_name(1));
+}
+
+TEST_CASE("Malformed technology network cache", "[technology-network-cache]")
+{
+    SECTION("Invalid header")
+    {
+        std::stringstream stream{std::string{"this is not a cache file"}};
+
+        CHECK_THROWS_AS(read_technology_network_cache<tec_nt>(stream), technology_network_cache_error);
+    }
+    SECTION("Truncated file")
+    {
+        std::stringstream stream{};
+        write_technology_network_cache(blueprints::full_adder_network<technology_network>(), stream);
+
+        auto content = stream.str();
+        content.resize(content.size() / 2);
+
+        std::stringstream truncated{content};
+
+        CHECK_THROWS_AS(read_technology_network_cache<tec_nt>(truncated), technology_network_cache_error);
+    }
+
+    // writes the header of a cache file followed by the given values in host byte order
+    const auto forge = [](const std::initializer_list<uint64_t> values, const uint32_t fanin_size = 0)
+    {
+        std::string content{detail::TECHNOLOGY_NETWORK_CACHE_MAGIC.cbegin(),
+                            detail::TECHNOLOGY_NETWORK_CACHE_MAGIC.cend()};
+
+        const auto append = [&content](const auto value)
+        { content.append(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        append(detail::TECHNOLOGY_NETWORK_CACHE_VERSION);
+
+        for (const auto v : values)
+        {
+            append(v);
+        }
+
+        if (fanin_size != 0)
+        {
+            append(fanin_size);
+        }
+
+        // padding that is too short to hold the announced contents
+        content.append(64, '\0');
+
+        return std::stringstream{content};
+    };
+
+    SECTION("Excessive string length")
+    {
+        auto stream = forge({std::numeric_limits<uint64_t>::max()});
+
+        CHECK_THROWS_AS(read_technology_network_cache<tec_nt>(stream), technology_network_cache_error);
+    }
+    SECTION("Excessive number of primary inputs")
+    {
+        // empty network name, followed by the number of primary inputs
+        auto stream = forge({0, uint64_t{1} << 40u});
+
+        CHECK_THROWS_AS(read_technology_network_cache<tec_nt>(stream), technology_network_cache_error);
+    }
+    SECTION("Excessive fan-in size")
+    {
+        // empty network name, no primary inputs, one gate
+        auto stream = forge({0, 0, 1}, 64);
+
+        CHECK_THROWS_AS(read_technology_network_cache<tec_nt>(stream), technology_network_cache_error);
+    }
+}
@@ -0,0 +1,125 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/io/write_svg_layout.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace fiction;
+
+static std::size_t count_occurrences(const std::string& str, const std::string_view& pattern) noexcept
+{
+    std::size_t count = 0;
+
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size()))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+TEST_CASE("Write cell-based QCA layout as SVG", "[write-svg-layout]")
+{
+    using qca_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    qca_layout layout{{4, 0}, "wire"};
+
+    layout.assign_cell_type({0, 0}, qca_technology::cell_type::INPUT);
+    layout.assign_cell_type({1, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({3, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({4, 0}, qca_technology::cell_type::OUTPUT);
+
+    std::ostringstream os{};
+    write_qca_layout_svg(layout, os);
+
+    const auto svg = os.str();
+
+    CHECK(svg.rfind("<?xml", 0) == 0);
+    CHECK(svg.find("<defs>") < svg.find("</defs>"));
+    CHECK(svg.find("</svg>") != std::string::npos);
+
+    // one instance per cell, one symbol per distinct cell, i.e., input, output, and a normal cell
+    CHECK(count_occurrences(svg, "<use") == 5);
+    CHECK(count_occurrences(svg, "id=\"c") == 3);
+}
+
+TEST_CASE("Write cell-based QCA layout with a crossing as SVG", "[write-svg-layout]")
+{
+    using qca_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    qca_layout layout{{4, 0, 1}, "crossing"};
+
+    layout.assign_cell_type({0, 0}, qca_technology::cell_type::INPUT);
+    layout.assign_cell_type({1, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 0, 1}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({3, 0}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_type({4, 0}, qca_technology::cell_type::OUTPUT);
+
+    std::ostringstream os{};
+    write_qca_layout_svg(layout, os);
+
+    const auto svg = os.str();
+
+    // the cell above the crossing is not drawn and, thus, does not need a symbol
+    CHECK(count_occurrences(svg, "<use") == 5);
+    CHECK(count_occurrences(svg, "id=\"c") == 4);
+
+    // symbols are numbered and defined in order of their first use
+    CHECK(svg.find("id=\"c0\"") < svg.find("id=\"c1\""));
+    CHECK(svg.find("id=\"c1\"") < svg.find("id=\"c2\""));
+    CHECK(svg.find("id=\"c2\"") < svg.find("id=\"c3\""));
+    CHECK(svg.find("xlink:href=\"#c0\"") < svg.find("xlink:href=\"#c1\""));
+
+    // the output does not depend on the run
+    std::ostringstream os_repeated{};
+    write_qca_layout_svg(layout, os_repeated);
+
+    CHECK(os_repeated.str() == svg);
+}
+
+TEST_CASE("Write tile-based QCA layout as SVG", "[write-svg-layout]")
+{
+    const auto layout = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(
+        blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>());
+
+    SECTION("Default")
+    {
+        std::ostringstream os{};
+        write_qca_layout_svg(layout, os);
+
+        const auto svg = os.str();
+
+        // all 4 x 3 tiles are drawn, but identical ones are defined only once
+        CHECK(count_occurrences(svg, "<use") == 12);
+        CHECK(count_occurrences(svg, "id=\"t") < 12);
+    }
+    SECTION("Simple")
+    {
+        std::ostringstream os{};
+        write_qca_layout_svg(layout, os, {true});
+
+        const auto svg = os.str();
+
+        // only the 7 occupied tiles are drawn
+        CHECK(count_occurrences(svg, "<use") == 7);
+        CHECK(count_occurrences(svg, "id=\"t") <= 7);
+    }
+}
@@ -10,6 +10,7 @@
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/layouts/hexagonal_layout.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -1905,6 +1906,96 @@ TEST_CASE("Override clocking", "[clocking-scheme]")
     CHECK(twoddwave4({3, 3}) == 2);
 }
 
+TEST_CASE("Override clocking far away and on the crossing layer", "[clocking-scheme]")
+{
+    SECTION("offset coordinates")
+    {
+        using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+        auto use4 = use_clocking<clk_lyt>();
+
+        use4.override_clock_number({1, 1, 1}, 3);
+        use4.override_clock_number({100, 200}, 1);
+        use4.override_clock_number({2, 2}, 2);
+        use4.override_clock_number({2, 2}, 5);
+
+        CHECK(!use4.is_regular());
+
+        CHECK(use4({1, 1, 1}) == 3);
+        CHECK(use4({1, 1, 0}) == 2);
+        CHECK(use4({100, 200}) == 1);
+        CHECK(use4({100, 200, 1}) == 0);
+        CHECK(use4({2, 2}) == 1);
+        CHECK(use4({101, 200}) == 1);
+        CHECK(use4({1000, 1000}) == 0);
+    }
+    SECTION("cube coordinates")
+    {
+        using clk_lyt = clocked_layout<cartesian_layout<cube::coord_t>>;
+
+        auto twoddwave4 = twoddwave_clocking<clk_lyt>();
+
+        twoddwave4.override_clock_number({1, 1}, 0);
+        twoddwave4.override_clock_number({1, 1, 1}, 1);
+
+        CHECK(twoddwave4({1, 1}) == 0);
+        CHECK(twoddwave4({1, 1, 1}) == 1);
+        CHECK(twoddwave4({1, 0}) == 1);
+        CHECK(twoddwave4({2, 1}) == 3);
+    }
+}
+
+TEST_CASE("Clock number lookup is equivalent to the clock function", "[clocking-scheme]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    const auto check = [](const auto& scheme)
+    {
+        // a copy of the scheme without the fast lookup has to evaluate the generic clock function
+        const auto generic_function = [&scheme](const clock_zone<clk_lyt>& cz) { return scheme(cz); };
+
+        const clocking_scheme<clock_zone<clk_lyt>> generic{scheme.name,
+                                                           generic_function,
+                                                           scheme.max_in_degree,
+                                                           scheme.max_out_degree,
+                                                           scheme.num_clocks,
+                                                           scheme.is_regular()};
+
+        for (uint64_t y = 0; y < 13; ++y)
+        {
+            for (uint64_t x = 0; x < 13; ++x)
+            {
+                CHECK(scheme({x, y}) == generic({x, y}));
+                CHECK(scheme({x, y}) < scheme.num_clocks);
+            }
+        }
+    };
+
+    check(open_clocking<clk_lyt>(num_clks::THREE));
+    check(open_clocking<clk_lyt>(num_clks::FOUR));
+    check(columnar_clocking<clk_lyt>(num_clks::THREE));
+    check(columnar_clocking<clk_lyt>(num_clks::FOUR));
+    check(row_clocking<clk_lyt>(num_clks::THREE));
+    check(row_clocking<clk_lyt>(num_clks::FOUR));
+    check(twoddwave_clocking<clk_lyt>(num_clks::THREE));
+    check(twoddwave_clocking<clk_lyt>(num_clks::FOUR));
+    check(use_clocking<clk_lyt>());
+    check(res_clocking<clk_lyt>());
+    check(esr_clocking<clk_lyt>());
+    check(cfe_clocking<clk_lyt>());
+    check(ripple_clocking<clk_lyt>());
+    check(bancs_clocking<clk_lyt>());
+
+    // spot checks against the published cutouts
+    const auto bancs = bancs_clocking<clk_lyt>();
+
+    CHECK(bancs({0, 5}) == 0);
+    CHECK(bancs({1, 5}) == 2);
+    CHECK(bancs({2, 5}) == 1);
+    CHECK(bancs({3, 6}) == 0);
+    CHECK(bancs({4, 7}) == 1);
+}
+
 TEST_CASE("4-phase ESP", "[clocking-scheme]")
 {
     using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
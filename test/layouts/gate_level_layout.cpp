@@ -17,6 +17,8 @@
 #include <mockturtle/traits.hpp>
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace fiction;
 
@@ -1277,6 +1279,68 @@ TEST_CASE("Clear crossing", "[gate-level-layout]")
     CHECK(layout.num_pos() == 2);
 }
 
+TEST_CASE("Network events", "[gate-level-layout]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    gate_layout layout{{2, 2, 1}, twoddwave_clocking<gate_layout>()};
+
+    using node   = mockturtle::node<gate_layout>;
+    using signal = mockturtle::signal<gate_layout>;
+
+    std::vector<node>                                 added{};
+    std::vector<std::pair<node, std::vector<signal>>> modified{};
+    std::vector<node>                                 deleted{};
+
+    [[maybe_unused]] const auto add_event =
+        layout.events().register_add_event([&added](const auto& n) { added.push_back(n); });
+    [[maybe_unused]] const auto modified_event = layout.events().register_modified_event(
+        [&modified](const auto& n, const auto& previous_children) { modified.emplace_back(n, previous_children); });
+    [[maybe_unused]] const auto delete_event =
+        layout.events().register_delete_event([&deleted](const auto& n) { deleted.push_back(n); });
+
+    // all creations, including the ones of PIs and POs, invoke on_add
+    const auto x1 = layout.create_pi("x1", {0, 0});
+    const auto x2 = layout.create_pi("x2", {1, 0});
+    const auto w  = layout.create_buf(x1, {0, 1});
+    const auto a  = layout.create_and(w, x2, {1, 1});
+    layout.create_po(a, "f", {2, 1});
+
+    CHECK(added == std::vector<node>{2, 3, 4, 5, 6});
+    CHECK(modified.empty());
+    CHECK(deleted.empty());
+
+    added.clear();
+
+    // moving a node invokes on_modified with its previous children but neither on_add nor on_delete
+    const auto and_node = layout.get_node(a);
+    layout.move_node(and_node, {1, 2}, {x2});
+
+    REQUIRE(modified.size() == 1);
+    CHECK(modified[0].first == and_node);
+    CHECK(modified[0].second == std::vector<signal>{w, x2});
+    CHECK(added.empty());
+    CHECK(deleted.empty());
+
+    modified.clear();
+
+    // connecting a signal invokes on_modified with the previous children
+    layout.connect(w, and_node);
+
+    REQUIRE(modified.size() == 1);
+    CHECK(modified[0].first == and_node);
+    CHECK(modified[0].second == std::vector<signal>{x2});
+
+    modified.clear();
+
+    // clearing a tile invokes on_delete with the node that is removed
+    layout.clear_tile({1, 2});
+
+    CHECK(deleted == std::vector<node>{and_node});
+    CHECK(added.empty());
+    CHECK(modified.empty());
+}
+
 TEST_CASE("Gate-level cardinal operations", "[gate-level-layout]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
@@ -1315,3 +1379,123 @@ TEST_CASE("Gate-level cardinal operations", "[gate-level-layout]")
     CHECK(layout.has_western_incoming_signal({3, 1}));
     CHECK(layout.has_western_incoming_signal({3, 2}));
 }
+
+TEST_CASE("Fanout index", "[gate-level-layout]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    // all fanouts of all nodes in the order they are visited
+    const auto fanouts = [](const gate_layout& lyt)
+    {
+        std::vector<std::vector<tile<gate_layout>>> fos{};
+
+        for (auto n = 0u; n < lyt.size(); ++n)
+        {
+            std::vector<tile<gate_layout>> fo{};
+            lyt.foreach_fanout(n, [&lyt, &fo](const auto& f) { fo.push_back(lyt.get_tile(f)); });
+
+            CHECK(fo == lyt.outgoing_data_flow(lyt.get_tile(n)));
+            CHECK(fo.size() == lyt.fanout_size(n));
+
+            fos.push_back(fo);
+        }
+
+        return fos;
+    };
+
+    const auto check_index = [&fanouts](gate_layout lyt)
+    {
+        auto indexed = lyt.clone();
+
+        CHECK(!indexed.has_fanout_index());
+        indexed.enable_fanout_index();
+        CHECK(indexed.has_fanout_index());
+        CHECK(indexed.clone().has_fanout_index());
+
+        CHECK(fanouts(lyt) == fanouts(indexed));
+
+        // the index has to be maintained on modification
+        lyt.foreach_node(
+            [&lyt, &indexed, &fanouts](const auto& n)
+            {
+                if (lyt.is_pi(n) || lyt.is_po(n))
+                {
+                    return;
+                }
+
+                // move n one layer up while preserving its children
+                const auto t  = lyt.get_tile(n);
+                const auto up = lyt.above(t);
+
+                if (up == t || !lyt.is_empty_tile(up))
+                {
+                    return;
+                }
+
+                std::vector<mockturtle::signal<gate_layout>> children{};
+                lyt.foreach_fanin(n, [&children](const auto& fi) { children.push_back(fi); });
+
+                lyt.move_node(n, up, children);
+                indexed.move_node(n, up, children);
+
+                CHECK(fanouts(lyt) == fanouts(indexed));
+
+                lyt.move_node(n, t, children);
+                indexed.move_node(n, t, children);
+
+                CHECK(fanouts(lyt) == fanouts(indexed));
+            });
+
+        lyt.foreach_node(
+            [&lyt, &indexed, &fanouts](const auto& n)
+            {
+                if (lyt.is_gate(n))
+                {
+                    const auto t = lyt.get_tile(n);
+
+                    lyt.clear_tile(t);
+                    indexed.clear_tile(t);
+
+                    CHECK(fanouts(lyt) == fanouts(indexed));
+                }
+            });
+
+        indexed.disable_fanout_index();
+        CHECK(!indexed.has_fanout_index());
+        CHECK(fanouts(lyt) == fanouts(indexed));
+    };
+
+    check_index(blueprints::and_or_gate_layout<gate_layout>());
+    check_index(blueprints::crossing_layout<gate_layout>());
+    check_index(blueprints::fanout_layout<gate_layout>());
+
+    SECTION("Creation on an indexed layout")
+    {
+        gate_layout layout{{2, 2, 1}, twoddwave_clocking<gate_layout>()};
+        layout.enable_fanout_index();
+
+        const auto x1 = layout.create_pi("x1", {0, 0});
+        // create a fanout before its child is placed
+        const auto f = layout.create_buf(static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{0, 1}), {1, 1});
+        const auto w = layout.create_buf(x1, {0, 1});
+        layout.create_po(f, "f1", {2, 1});
+        layout.create_po(f, "f2", {1, 2});
+
+        CHECK(layout.fanout_size(layout.get_node(x1)) == 1);
+        CHECK(layout.fanout_size(layout.get_node(w)) == 1);
+        CHECK(layout.fanout_size(layout.get_node(f)) == 2);
+        CHECK(layout.is_fanout(layout.get_node(f)));
+
+        // connecting adds a fanout
+        const auto g = layout.create_not(static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{}), {1, 0});
+        layout.connect(x1, layout.get_node(g));
+
+        CHECK(layout.fanout_size(layout.get_node(x1)) == 2);
+        CHECK(layout.outgoing_data_flow({0, 0}) == std::vector<tile<gate_layout>>{{1, 0}, {0, 1}});
+
+        // overwriting a node removes its fanouts
+        layout.create_pi("x2", {1, 0});
+
+        CHECK(layout.fanout_size(layout.get_node(x1)) == 1);
+    }
+}
@@ -12,6 +12,7 @@
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/layouts/gate_level_layout.hpp>
 #include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
 #include <fiction/traits.hpp>
 
 using namespace fiction;
@@ -95,6 +96,41 @@ TEST_CASE("Traits and construction", "[obstruction-layout]")
     }
 }
 
+TEST_CASE("Dense coordinate obstruction", "[obstruction-layout]")
+{
+    using layout = cartesian_layout<offset::ucoord_t>;
+
+    layout lyt{{4, 4}};
+
+    obstruction_layout obstr_lyt{lyt, obstruction_storage::DENSE};
+
+    obstr_lyt.foreach_coordinate([&obstr_lyt](const auto& c) { CHECK(!obstr_lyt.is_obstructed_coordinate(c)); });
+
+    obstr_lyt.obstruct_coordinate({0, 0});
+    obstr_lyt.obstruct_coordinate({4, 4});
+
+    CHECK(obstr_lyt.is_obstructed_coordinate({0, 0}));
+    CHECK(obstr_lyt.is_obstructed_coordinate({4, 4}));
+    CHECK(!obstr_lyt.is_obstructed_coordinate({4, 4, 1}));
+
+    // obstructions beyond the layout bounds remain valid after resizing
+    obstr_lyt.obstruct_coordinate({7, 9, 1});
+    CHECK(obstr_lyt.is_obstructed_coordinate({7, 9, 1}));
+
+    obstr_lyt.resize({9, 9, 1});
+
+    CHECK(obstr_lyt.is_obstructed_coordinate({0, 0}));
+    CHECK(obstr_lyt.is_obstructed_coordinate({4, 4}));
+    CHECK(obstr_lyt.is_obstructed_coordinate({7, 9, 1}));
+    CHECK(!obstr_lyt.is_obstructed_coordinate({9, 7, 1}));
+
+    obstr_lyt.clear_obstructed_coordinate({4, 4});
+    CHECK(!obstr_lyt.is_obstructed_coordinate({4, 4}));
+
+    obstr_lyt.clear_obstructed_coordinates();
+    obstr_lyt.foreach_coordinate([&obstr_lyt](const auto& c) { CHECK(!obstr_lyt.is_obstructed_coordinate(c)); });
+}
+
 TEST_CASE("Coordinate obstruction", "[obstruction-layout]")
 {
     SECTION("Cartesian layout")
@@ -486,3 +522,45 @@ TEST_CASE("Connection obstruction", "[obstruction-layout]")
         CHECK(!obstr_lyt.is_obstructed_connection({3, 3}, {2, 3}));
     }
 }
+
+TEST_CASE("Deep copy", "[obstruction-layout]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    for (const auto strg_type : {obstruction_storage::HASHED, obstruction_storage::DENSE})
+    {
+        gate_layout layout{{3, 3, 1}, twoddwave_clocking<gate_layout>()};
+
+        obstruction_layout obstr_lyt{layout, strg_type};
+
+        const auto x1 = obstr_lyt.create_pi("x1", {0, 0});
+        obstr_lyt.create_po(x1, "f1", {1, 0});
+
+        obstr_lyt.obstruct_coordinate({2, 2});
+        obstr_lyt.obstruct_connection({0, 1}, {0, 2});
+
+        const auto copy = obstr_lyt.clone();
+
+        // modify the original layout
+        obstr_lyt.create_buf(x1, {0, 1});
+        obstr_lyt.obstruct_coordinate({3, 3});
+        obstr_lyt.clear_obstructed_coordinate({2, 2});
+        obstr_lyt.clear_obstructed_connection({0, 1}, {0, 2});
+        obstr_lyt.resize({4, 4, 1});
+
+        CHECK(obstr_lyt.is_obstructed_coordinate({0, 1}));
+        CHECK(obstr_lyt.is_obstructed_coordinate({3, 3}));
+        CHECK(!obstr_lyt.is_obstructed_coordinate({2, 2}));
+        CHECK(!obstr_lyt.is_obstructed_connection({0, 1}, {0, 2}));
+
+        // the copy remains unaffected
+        CHECK(copy.x() == 3);
+        CHECK(copy.num_wires() == 2);
+        CHECK(copy.is_obstructed_coordinate({0, 0}));
+        CHECK(copy.is_obstructed_coordinate({1, 0}));
+        CHECK(!copy.is_obstructed_coordinate({0, 1}));
+        CHECK(!copy.is_obstructed_coordinate({3, 3}));
+        CHECK(copy.is_obstructed_coordinate({2, 2}));
+        CHECK(copy.is_obstructed_connection({0, 1}, {0, 2}));
+    }
+}
@@ -20,6 +20,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <optional>
 
 using namespace fiction;
 
@@ -2186,6 +2187,186 @@ TEST_CASE("Assign charge index", "[charge-distribution-surface]")
     }
 }
 
+TEST_CASE("Defect potentials of a defect surface", "[charge-distribution-surface]")
+{
+    using lattice = sidb_defect_surface<sidb_100_cell_clk_lyt_siqad>;
+
+    lattice lyt{};
+
+    lyt.assign_cell_type({0, 0, 0}, lattice::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, lattice::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 1, 1}, lattice::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{3, -0.32};
+
+    const sidb_defect negative{sidb_defect_type::UNKNOWN, -1, params.epsilon_r, params.lambda_tf};
+    const sidb_defect positive{sidb_defect_type::UNKNOWN, 1, params.epsilon_r, params.lambda_tf};
+
+    lyt.assign_sidb_defect({-4, 0, 0}, negative);
+    lyt.assign_sidb_defect({10, 2, 0}, positive);
+    lyt.assign_sidb_defect({2, 4, 1}, sidb_defect{sidb_defect_type::SILOXANE});
+
+    // reference: the defects are added one after the other to a defect-free layout
+    sidb_100_cell_clk_lyt_siqad defect_free{};
+    lyt.foreach_cell([&defect_free](const auto& c)
+                     { defect_free.assign_cell_type(c, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL); });
+
+    charge_distribution_surface reference{defect_free, params, sidb_charge_state::NEGATIVE};
+    reference.add_sidb_defect_to_potential_landscape({-4, 0, 0}, negative);
+    reference.add_sidb_defect_to_potential_landscape({10, 2, 0}, positive);
+
+    charge_distribution_surface charge_layout{lyt, params, sidb_charge_state::NEGATIVE};
+
+    // the potential field is computed once and shared
+    CHECK(lyt.defect_potential_field() == lyt.defect_potential_field());
+    CHECK(lyt.defect_potential_field()->num_defects() == 2);
+
+    auto defect_potentials           = charge_layout.get_local_defect_potentials();
+    auto reference_defect_potentials = reference.get_local_defect_potentials();
+
+    REQUIRE(defect_potentials.size() == 3);
+
+    charge_layout.foreach_cell(
+        [&](const auto& c)
+        {
+            CHECK_THAT(defect_potentials[c], Catch::Matchers::WithinAbs(reference_defect_potentials[c], 1E-8));
+            CHECK_THAT(charge_layout.get_local_potential(c).value(),
+                       Catch::Matchers::WithinAbs(reference.get_local_potential(c).value(), 1E-8));
+        });
+
+    CHECK_THAT(charge_layout.get_system_energy(), Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-8));
+
+    // assigning a defect invalidates the potential field
+    const auto field = lyt.defect_potential_field();
+    lyt.assign_sidb_defect({20, 0, 0}, negative);
+    CHECK(lyt.defect_potential_field() != field);
+    CHECK(lyt.defect_potential_field()->num_defects() == 3);
+}
+
+TEST_CASE("Interaction cutoff", "[charge-distribution-surface]")
+{
+    sidb_100_cell_clk_lyt_siqad lyt{};
+
+    // a wire of 40 SiDBs that is much longer than the cutoff radius
+    for (int32_t x = 0; x < 400; x += 10)
+    {
+        lyt.assign_cell_type({x, x % 20 == 0 ? 0 : 1, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    }
+
+    const sidb_simulation_parameters params{3, -0.32};
+
+    charge_distribution_surface dense{lyt, params, sidb_charge_state::NEUTRAL};
+    charge_distribution_surface sparse{lyt, params, sidb_charge_state::NEUTRAL};
+
+    CHECK(!sparse.get_interaction_cutoff().has_value());
+    CHECK(sparse.get_system_energy_error_bound() == 0.0);
+
+    sparse.assign_interaction_cutoff(20.0);
+
+    REQUIRE(sparse.get_interaction_cutoff().has_value());
+    CHECK(sparse.get_interaction_cutoff().value() == 20.0);
+    CHECK(sparse.get_local_potential_error_bound() > 0.0);
+    CHECK(sparse.get_local_potential_error_bound() < 1E-2);
+    CHECK(sparse.get_system_energy_error_bound() >= sparse.get_local_potential_error_bound());
+
+    // pairs within the cutoff radius interact, all others do not
+    CHECK(sparse.get_chargeless_potential_between_sidbs({0, 0, 0}, {10, 1, 0}) ==
+          dense.get_chargeless_potential_between_sidbs({0, 0, 0}, {10, 1, 0}));
+    CHECK(sparse.get_chargeless_potential_between_sidbs({0, 0, 0}, {390, 1, 0}) == 0.0);
+    CHECK(sparse.get_nm_distance_between_sidbs({0, 0, 0}, {390, 1, 0}) ==
+          dense.get_nm_distance_between_sidbs({0, 0, 0}, {390, 1, 0}));
+
+    const auto check_consistency = [&dense, &sparse]()
+    {
+        dense.update_after_charge_change();
+        sparse.update_after_charge_change();
+
+        dense.foreach_cell(
+            [&dense, &sparse](const auto& c)
+            {
+                CHECK_THAT(sparse.get_local_potential(c).value(),
+                           Catch::Matchers::WithinAbs(dense.get_local_potential(c).value(),
+                                                      sparse.get_local_potential_error_bound()));
+            });
+
+        CHECK_THAT(sparse.get_system_energy(),
+                   Catch::Matchers::WithinAbs(dense.get_system_energy(), sparse.get_system_energy_error_bound()));
+        CHECK(sparse.is_physically_valid() == dense.is_physically_valid());
+    };
+
+    SECTION("All SiDBs negatively charged")
+    {
+        dense.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+        sparse.assign_all_charge_states(sidb_charge_state::NEGATIVE);
+
+        check_consistency();
+        CHECK(sparse.is_physically_valid());
+    }
+    SECTION("Alternating charge states")
+    {
+        uint64_t i = 0;
+        dense.foreach_cell(
+            [&dense, &sparse, &i](const auto& c)
+            {
+                const auto cs = i++ % 3 == 0 ? sidb_charge_state::POSITIVE : sidb_charge_state::NEGATIVE;
+                dense.assign_charge_state(c, cs);
+                sparse.assign_charge_state(c, cs);
+            });
+
+        check_consistency();
+    }
+    SECTION("Restoring the dense interaction")
+    {
+        sparse.assign_interaction_cutoff(std::nullopt);
+
+        CHECK(!sparse.get_interaction_cutoff().has_value());
+        CHECK(sparse.get_system_energy_error_bound() == 0.0);
+        CHECK(sparse.get_chargeless_potential_between_sidbs({0, 0, 0}, {390, 1, 0}) ==
+              dense.get_chargeless_potential_between_sidbs({0, 0, 0}, {390, 1, 0}));
+    }
+}
+
+TEST_CASE("Interaction cutoff with charged defects", "[charge-distribution-surface]")
+{
+    sidb_defect_surface<sidb_100_cell_clk_lyt_siqad> lyt{};
+
+    for (int32_t x = 0; x < 200; x += 10)
+    {
+        lyt.assign_cell_type({x, 0, 0}, sidb_100_cell_clk_lyt_siqad::cell_type::NORMAL);
+    }
+
+    const sidb_simulation_parameters params{3, -0.32};
+
+    lyt.assign_sidb_defect({5, 2, 0}, sidb_defect{sidb_defect_type::UNKNOWN, -1, params.epsilon_r, params.lambda_tf});
+    lyt.assign_sidb_defect({150, 3, 0}, sidb_defect{sidb_defect_type::UNKNOWN, 1, params.epsilon_r, params.lambda_tf});
+
+    charge_distribution_surface dense{lyt, params, sidb_charge_state::NEGATIVE};
+
+    // the electrostatics, including the defect potentials, are only initialized together with the cutoff
+    charge_distribution_surface sparse{lyt, params, sidb_charge_state::NEGATIVE,
+                                       cds_configuration::CHARGE_LOCATION_ONLY};
+    sparse.assign_interaction_cutoff(20.0);
+
+    dense.update_after_charge_change();
+    sparse.update_after_charge_change();
+
+    const auto defect_potentials = sparse.get_local_defect_potentials();
+
+    CHECK(defect_potentials == dense.get_local_defect_potentials());
+    CHECK(defect_potentials.at({0, 0, 0}) != 0.0);
+
+    dense.foreach_cell(
+        [&dense, &sparse](const auto& c)
+        {
+            CHECK_THAT(sparse.get_local_potential(c).value(),
+                       Catch::Matchers::WithinAbs(dense.get_local_potential(c).value(),
+                                                  sparse.get_local_potential_error_bound()));
+        });
+
+    CHECK_THAT(sparse.get_system_energy(),
+               Catch::Matchers::WithinAbs(dense.get_system_energy(), sparse.get_system_energy_error_bound()));
+}
+
 TEST_CASE("Tests for Si-111 lattice orientation", "[charge-distribution-surface]")
 {
     sidb_111_cell_clk_lyt_siqad lyt{};
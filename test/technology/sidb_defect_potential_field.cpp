@@ -0,0 +1,73 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/technology/physical_constants.hpp>
+#include <fiction/technology/sidb_defect_potential_field.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Defect potential field", "[sidb-defect-potential-field]")
+{
+    const std::vector<std::pair<std::pair<double, double>, sidb_defect>> defects{
+        {{1.0, 2.0}, sidb_defect{sidb_defect_type::UNKNOWN, -1, 5.6, 5.0}},
+        {{30.0, 2.0}, sidb_defect{sidb_defect_type::UNKNOWN, 1, 5.6, 5.0}},
+        {{0.0, 0.0}, sidb_defect{sidb_defect_type::SILOXANE, 0, 5.6, 5.0}}};
+
+    const sidb_defect_potential_field field{defects};
+
+    SECTION("Uncharged defects are ignored")
+    {
+        CHECK(field.num_defects() == 2);
+    }
+    SECTION("Potential at a position")
+    {
+        const std::pair<double, double> position{3.0, 4.0};
+
+        double direct_sum = 0.0;
+        for (const auto& [pos, defect] : defects)
+        {
+            direct_sum += sidb_defect_potential_field::potential(
+                              defect, std::hypot(pos.first - position.first, pos.second - position.second)) *
+                          (is_charged_defect_type(defect) ? 1.0 : 0.0);
+        }
+
+        CHECK_THAT(field.potential_at(position), Catch::Matchers::WithinAbs(direct_sum, 1E-8));
+        CHECK(field.potential_at(position) < 0.0);
+    }
+    SECTION("Cutoff distance")
+    {
+        const auto& defect = defects.front().second;
+        const auto  cutoff = field.cutoff_distance(defect);
+
+        CHECK(cutoff > defect.lambda_tf);
+        CHECK(std::abs(sidb_defect_potential_field::potential(defect, cutoff)) < 1E-9);
+        CHECK(std::abs(sidb_defect_potential_field::potential(defect, cutoff - 0.01)) >= 1E-9);
+
+        // unscreened defects are never cut off
+        CHECK(std::isinf(field.cutoff_distance(sidb_defect{sidb_defect_type::UNKNOWN, -1, 5.6, 0.0})));
+
+        // positions beyond the cutoff distances of all defects are not affected
+        CHECK(field.potential_at({500.0, 500.0}) == 0.0);
+    }
+    SECTION("Interaction energy")
+    {
+        const auto k = physical_constants::K_E / 5.6;
+
+        const auto expected = 2.0 * k / (std::hypot(29.0, 0.0) * 1E-9) * std::exp(-29.0 / 5.0) *
+                              physical_constants::ELEMENTARY_CHARGE;
+
+        CHECK_THAT(field.interaction_energy(k, 5.0), Catch::Matchers::WithinAbs(expected, 1E-12));
+        // memoized
+        CHECK(field.interaction_energy(k, 5.0) == field.interaction_energy(k, 5.0));
+        CHECK(field.interaction_energy(k, 2.0) < field.interaction_energy(k, 5.0));
+    }
+}
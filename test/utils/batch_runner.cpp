@@ -0,0 +1,245 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/batch_runner.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+struct counter_state
+{
+    uint64_t value{0};
+};
+
+using stage   = batch_stage<counter_state>;
+using context = batch_stage_context;
+
+const stage increment{"increment",
+                      [](counter_state& state, const context&)
+                      {
+                          ++state.value;
+                          return nlohmann::json{{"value", state.value}};
+                      }};
+
+const stage fail{"fail", [](counter_state&, const context&) -> nlohmann::json
+                 { throw batch_stage_error("no result"); }};
+
+const stage sleep{"sleep",
+                  [](counter_state&, const context&)
+                  {
+                      std::this_thread::sleep_for(std::chrono::seconds{30});
+                      return nlohmann::json::object();
+                  }};
+
+const stage nap{"nap",
+                [](counter_state&, const context&)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+                    return nlohmann::json::object();
+                }};
+
+const stage allocate{"allocate",
+                     [](counter_state&, const context&)
+                     {
+                         std::vector<char> memory(std::size_t{8} << 30u, 1);
+                         return nlohmann::json{{"size", memory.size()}};
+                     }};
+
+const stage crash{"crash",
+                  [](counter_state&, const context&) -> nlohmann::json
+                  {
+                      // bypass any signal handlers installed by the test framework
+                      std::signal(SIGSEGV, SIG_DFL);
+                      std::raise(SIGSEGV);
+
+                      return nlohmann::json::object();
+                  }};
+
+std::vector<nlohmann::json> run_batch(const std::vector<stage>& pipeline, const batch_runner_params& ps,
+                                      const std::vector<std::string>& benchmarks = {"b1"})
+{
+    std::stringstream jsonl{};
+    std::stringstream csv{};
+
+    batch_record_writer writer{jsonl, &csv};
+    batch_runner        runner{pipeline, ps};
+
+    runner.run(benchmarks, writer);
+
+    std::vector<nlohmann::json> records{};
+
+    for (std::string line{}; std::getline(jsonl, line);)
+    {
+        records.push_back(nlohmann::json::parse(line));
+    }
+
+    // one header row plus one row per record
+    std::size_t num_rows = 0;
+    for (std::string line{}; std::getline(csv, line);)
+    {
+        ++num_rows;
+    }
+
+    CHECK(num_rows == records.size() + 1);
+
+    return records;
+}
+
+}  // namespace
+
+TEST_CASE("Batch runner in threads", "[batch-runner]")
+{
+    batch_runner_params ps{};
+    ps.num_jobs = 2;
+
+    SECTION("Stages hand their state on")
+    {
+        const auto records = run_batch({increment, increment}, ps, {"b1", "b2", "b3"});
+
+        REQUIRE(records.size() == 6);
+
+        for (const auto& record : records)
+        {
+            CHECK(record["status"] == "success");
+            CHECK(record.contains("revision"));
+        }
+
+        // records of one benchmark appear in the order of their stages
+        for (const auto* benchmark : {"b1", "b2", "b3"})
+        {
+            std::vector<uint64_t> values{};
+
+            for (const auto& record : records)
+            {
+                if (record["benchmark"] == benchmark)
+                {
+                    values.push_back(record["metrics"]["value"].get<uint64_t>());
+                }
+            }
+
+            CHECK(values == std::vector<uint64_t>{1, 2});
+        }
+    }
+    SECTION("Failures skip the remaining stages")
+    {
+        const auto records = run_batch({increment, fail, increment}, ps);
+
+        REQUIRE(records.size() == 2);
+        CHECK(records[0]["status"] == "success");
+        CHECK(records[1]["status"] == "failure");
+        CHECK(records[1]["metrics"]["error"] == "no result");
+    }
+    SECTION("Timeouts are reported")
+    {
+        ps.stage_timeout = 50;
+
+        const auto records = run_batch({nap, increment}, ps);
+
+        REQUIRE(records.size() == 1);
+        CHECK(records[0]["stage"] == "nap");
+        CHECK(records[0]["status"] == "timeout");
+    }
+}
+
+#if FICTION_BATCH_RUNNER_POSIX
+
+// AddressSanitizer reserves more virtual memory than any reasonable address space limit permits
+#if defined(__SANITIZE_ADDRESS__)
+#define FICTION_TEST_ADDRESS_SANITIZER 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define FICTION_TEST_ADDRESS_SANITIZER 1
+#endif
+#endif
+
+TEST_CASE("Batch runner in isolated processes", "[batch-runner]")
+{
+    batch_runner_params ps{};
+    ps.num_jobs          = 2;
+    ps.isolate_processes = true;
+
+    SECTION("Stages hand their state on")
+    {
+        const auto records = run_batch({increment, increment}, ps, {"b1", "b2"});
+
+        REQUIRE(records.size() == 4);
+
+        for (const auto& record : records)
+        {
+            CHECK(record["status"] == "success");
+        }
+    }
+    SECTION("Timeouts terminate the stage")
+    {
+        ps.stage_timeout = 200;
+
+        const auto start   = std::chrono::steady_clock::now();
+        const auto records = run_batch({increment, sleep, increment}, ps);
+
+        // the sleeping stage was killed long before it would have finished
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds{10});
+
+        REQUIRE(records.size() == 2);
+        CHECK(records[0]["status"] == "success");
+        CHECK(records[1]["stage"] == "sleep");
+        CHECK(records[1]["status"] == "timeout");
+    }
+#ifndef FICTION_TEST_ADDRESS_SANITIZER
+    SECTION("Memory limits are enforced")
+    {
+        ps.memory_limit = 1024;
+
+        const auto records = run_batch({increment, allocate, increment}, ps);
+
+        REQUIRE(records.size() == 2);
+        CHECK(records[0]["status"] == "success");
+        CHECK(records[1]["stage"] == "allocate");
+        CHECK(records[1]["status"] == "memory_limit");
+    }
+#endif
+    SECTION("Crashes are isolated")
+    {
+        const auto records = run_batch({increment, crash, increment}, ps, {"b1", "b2"});
+
+        REQUIRE(records.size() == 4);
+
+        for (const auto* benchmark : {"b1", "b2"})
+        {
+            std::vector<std::string> statuses{};
+
+            for (const auto& record : records)
+            {
+                if (record["benchmark"] == benchmark)
+                {
+                    statuses.push_back(record["status"].get<std::string>());
+
+                    if (record["status"] == "crash")
+                    {
+                        CHECK(record["stage"] == "crash");
+                        CHECK(record["metrics"]["signal"] == SIGSEGV);
+                    }
+                }
+            }
+
+            CHECK(statuses == std::vector<std::string>{"success", "crash"});
+        }
+    }
+}
+
+#endif
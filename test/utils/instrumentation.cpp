@@ -0,0 +1,209 @@
+//
+// Created by agent on 18.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/utils/instrumentation.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Profiler timers, counters, and histograms", "[instrumentation]")
+{
+    auto& p = profiler::instance();
+    p.reset();
+
+    auto& t = p.timer("test: timer");
+    auto& c = p.counter("test: counter");
+    auto& h = p.histogram("test: histogram");
+
+    // lookups by name yield the same objects
+    CHECK(&t == &p.timer("test: timer"));
+    CHECK(&c == &p.counter("test: counter"));
+    CHECK(&h == &p.histogram("test: histogram"));
+
+    SECTION("Timers")
+    {
+        {
+            const scoped_profile_timer scope{t};
+        }
+
+        p.record(t, 0, 100);
+        p.record(t, 0, 300);
+
+        CHECK(t.calls == 3);
+        CHECK(t.total_ns >= 400);
+        CHECK(t.max_ns >= 300);
+        CHECK(t.min_ns <= 100);
+    }
+    SECTION("Counters")
+    {
+        std::vector<std::thread> threads{};
+
+        for (auto i = 0; i < 4; ++i)
+        {
+            threads.emplace_back(
+                [&c]
+                {
+                    for (auto j = 0; j < 1000; ++j)
+                    {
+                        c.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(c == 4000);
+    }
+    SECTION("Histograms")
+    {
+        CHECK(profile_histogram::bucket_of(0) == 0);
+        CHECK(profile_histogram::bucket_of(1) == 1);
+        CHECK(profile_histogram::bucket_of(2) == 2);
+        CHECK(profile_histogram::bucket_of(3) == 2);
+        CHECK(profile_histogram::bucket_of(4) == 3);
+        CHECK(profile_histogram::bucket_of(UINT64_MAX) == profile_histogram::NUM_BUCKETS - 1);
+
+        h.record(0);
+        h.record(3);
+        h.record(3);
+        h.record(8);
+
+        CHECK(h.count == 4);
+        CHECK(h.sum == 14);
+        CHECK(h.buckets[0] == 1);
+        CHECK(h.buckets[2] == 2);
+        CHECK(h.buckets[4] == 1);
+    }
+    SECTION("Reset")
+    {
+        p.record(t, 0, 100);
+        c.fetch_add(5);
+        h.record(5);
+
+        p.reset();
+
+        CHECK(t.calls == 0);
+        CHECK(t.total_ns == 0);
+        CHECK(c == 0);
+        CHECK(h.count == 0);
+        CHECK(h.buckets[3] == 0);
+    }
+}
+
+TEST_CASE("Profile export", "[instrumentation]")
+{
+    auto& p = profiler::instance();
+    p.reset();
+
+    auto& t = p.timer("test: exported timer");
+    auto& c = p.counter("test: exported counter");
+
+    SECTION("Flat profile")
+    {
+        p.record(t, 0, 1000);
+        c.fetch_add(42);
+        p.histogram("test: exported histogram").record(7);
+
+        std::ostringstream os{};
+        p.write_flat_profile(os);
+
+        const auto profile = os.str();
+
+        CHECK(profile.find("test: exported timer") != std::string::npos);
+        CHECK(profile.find("test: exported counter") != std::string::npos);
+        CHECK(profile.find("42") != std::string::npos);
+        CHECK(profile.find("histogram: test: exported histogram") != std::string::npos);
+        CHECK(profile.find("[4, 8)") != std::string::npos);
+    }
+    SECTION("Chrome trace without tracing")
+    {
+        p.enable_tracing(false);
+        p.record(t, 0, 1000);
+
+        std::ostringstream os{};
+        p.write_chrome_trace(os);
+
+        const auto trace = nlohmann::json::parse(os.str());
+
+        REQUIRE(trace.contains("traceEvents"));
+        CHECK(trace["otherData"]["timers"]["test: exported timer"]["calls"] == 1);
+
+        for (const auto& e : trace["traceEvents"])
+        {
+            CHECK(e["ph"] != "X");
+        }
+    }
+    SECTION("Chrome trace with tracing")
+    {
+        p.enable_tracing(true, 2);
+
+        p.record(t, 1000, 2000);
+        p.record(t, 5000, 500);
+        p.record(t, 9000, 500);  // exceeds the maximum number of trace events
+
+        std::ostringstream os{};
+        p.write_chrome_trace(os);
+
+        p.enable_tracing(false);
+
+        const auto trace = nlohmann::json::parse(os.str());
+
+        std::vector<nlohmann::json> complete_events{};
+        for (const auto& e : trace["traceEvents"])
+        {
+            if (e["ph"] == "X")
+            {
+                complete_events.push_back(e);
+            }
+        }
+
+        REQUIRE(complete_events.size() == 2);
+        CHECK(complete_events[0]["name"] == "test: exported timer");
+        CHECK(complete_events[0]["ts"] == 1.0);
+        CHECK(complete_events[0]["dur"] == 2.0);
+        CHECK(complete_events[1]["ts"] == 5.0);
+        CHECK(complete_events[1]["dur"] == 0.5);
+
+        // all three measurements are part of the timer statistics
+        CHECK(t.calls == 3);
+    }
+}
+
+#if (FICTION_INSTRUMENTATION)
+
+TEST_CASE("Instrumented A* expansions", "[instrumentation]")
+{
+    using lyt        = cartesian_layout<offset::ucoord_t>;
+    using coord_path = layout_coordinate_path<lyt>;
+
+    auto& p = profiler::instance();
+    p.reset();
+
+    const lyt layout{{4, 4}};
+
+    const auto path = a_star<coord_path>(layout, {{0, 0}, {4, 4}});
+
+    CHECK(path.size() == 9);
+    CHECK(p.timer("a_star").calls == 1);
+    CHECK(p.counter("a_star: expansions") >= 8);
+    CHECK(p.counter("hashed_search_storage: probes") > 0);
+}
+
+#endif  // FICTION_INSTRUMENTATION